@@ -0,0 +1,168 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_comm_chunk.c                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the chunked gather    **/
+/**                routines of the comm module. These      **/
+/**                routines are compiled with a very small **/
+/**                chunk size, so that every gather spans  **/
+/**                many chunks and refills the request     **/
+/**                array of the root process.              **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define COMMCHUNKSIZE               3             /* Force many chunks per process */
+
+#include "../libscotch/comm.c"
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm            proccomm;
+  int                 procglbnbr;                 /* Number of processes sharing data */
+  int                 proclocnum;                 /* Number of this process           */
+  int                 protnum;                    /* Number of root process           */
+  Gnum *              recvcnttab;
+  Gnum *              recvdsptab;
+  Gnum *              recvdattab;
+  Gnum *              senddattab;
+  Gnum                recvdatnbr;
+  Gnum                senddatnbr;
+  Gnum                datanum;
+  int                 procnum;
+  int                 passnum;
+#ifdef SCOTCH_PTHREAD
+  int                 thrdlvlreqval;
+  int                 thrdlvlproval;
+#endif /* SCOTCH_PTHREAD */
+
+  errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdlvlreqval = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdlvlreqval, &thrdlvlproval) != MPI_SUCCESS)
+    errorPrint ("main: Cannot initialize (1)");
+  if (thrdlvlreqval > thrdlvlproval)
+    errorPrint ("main: MPI implementation is not thread-safe: recompile without SCOTCH_PTHREAD");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+  if ((recvcnttab = memAlloc (procglbnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("main: out of memory (1)");
+    exit (EXIT_FAILURE);
+  }
+  if ((recvdsptab = memAlloc (procglbnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("main: out of memory (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  for (passnum = 0; passnum < 2; passnum ++) {    /* Pass 0 has process 0 send nothing; pass 1 uses large counts */
+    for (protnum = 0; protnum < procglbnbr; protnum ++) {
+      for (procnum = 0, recvdatnbr = 0; procnum < procglbnbr; procnum ++) {
+        recvdsptab[procnum] = recvdatnbr;         /* Leave holes between fragments to check displacements */
+        recvcnttab[procnum] = (passnum == 0) ? (procnum * (COMMCHUNKSIZE + 1))
+                                             : (procnum + 1) * (COMMCHUNKREQNBR * COMMCHUNKSIZE + 2);
+        recvdatnbr         += recvcnttab[procnum] + 1;
+      }
+      senddatnbr = recvcnttab[proclocnum];
+
+      if (((senddattab = memAlloc ((senddatnbr + 1) * sizeof (Gnum))) == NULL) ||
+          ((recvdattab = memAlloc (recvdatnbr * sizeof (Gnum))) == NULL)) {
+        errorPrint ("main: out of memory (3)");
+        exit (EXIT_FAILURE);
+      }
+      for (datanum = 0; datanum < senddatnbr; datanum ++)
+        senddattab[datanum] = proclocnum * 1000000 + datanum;
+      for (datanum = 0; datanum < recvdatnbr; datanum ++)
+        recvdattab[datanum] = -1;
+
+      if (commGathervChunk (senddattab, senddatnbr, COMM_INT, recvdattab, recvcnttab, recvdsptab, protnum, 0, proccomm) != MPI_SUCCESS) {
+        errorPrint ("main: communication error (1)");
+        exit (EXIT_FAILURE);
+      }
+
+      if (proclocnum == protnum) {
+        for (procnum = 0; procnum < procglbnbr; procnum ++) {
+          for (datanum = 0; datanum < recvcnttab[procnum]; datanum ++) {
+            if (recvdattab[recvdsptab[procnum] + datanum] != (procnum * 1000000 + datanum)) {
+              errorPrint ("main: invalid received data (pass %d, root %d, process %d)", passnum, protnum, procnum);
+              exit (EXIT_FAILURE);
+            }
+          }
+          if (recvdattab[recvdsptab[procnum] + datanum] != -1) {
+            errorPrint ("main: data written out of bounds (pass %d, root %d, process %d)", passnum, protnum, procnum);
+            exit (EXIT_FAILURE);
+          }
+        }
+      }
+
+      memFree (recvdattab);
+      memFree (senddattab);
+
+      if (MPI_Barrier (proccomm) != MPI_SUCCESS) {
+        errorPrint ("main: cannot communicate");
+        exit (EXIT_FAILURE);
+      }
+    }
+  }
+
+  memFree (recvdsptab);
+  memFree (recvcnttab);
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
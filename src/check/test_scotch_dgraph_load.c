@@ -0,0 +1,240 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_dgraph_load.c               **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_dgraphLoadShared() routine.  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <mpi.h>
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "ptscotch.h"
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm              proccomm;
+  int                   procglbnbr;               /* Number of processes sharing graph data */
+  int                   proclocnum;               /* Number of this process                 */
+  SCOTCH_Dgraph         srcgrafdat;               /* Graph loaded by root process           */
+  SCOTCH_Dgraph         shrgrafdat;               /* Graph loaded from shared file          */
+  SCOTCH_Graph          srccgrfdat;               /* Centralized graphs                     */
+  SCOTCH_Graph          shrcgrfdat;
+  SCOTCH_Graph *        srccgrfptr;
+  SCOTCH_Graph *        shrcgrfptr;
+  SCOTCH_Num            srcvertglbnbr;
+  SCOTCH_Num            shrvertglbnbr;
+  SCOTCH_Num            srcedgeglbnbr;
+  SCOTCH_Num            shredgeglbnbr;
+  FILE *                file;
+#ifdef SCOTCH_PTHREAD
+  int                 thrdlvlreqval;
+  int                 thrdlvlproval;
+#endif /* SCOTCH_PTHREAD */
+
+  SCOTCH_errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdlvlreqval = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdlvlreqval, &thrdlvlproval) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (1)");
+  if (thrdlvlreqval > thrdlvlproval)
+    SCOTCH_errorPrint ("main: MPI implementation is not thread-safe: recompile without SCOTCH_PTHREAD");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+  fprintf (stderr, "Proc %2d of %2d, pid %d\n", proclocnum, procglbnbr, getpid ());
+
+#ifdef SCOTCH_CHECK_NOAUTO
+  if (proclocnum == 0) {                          /* Synchronize on keybord input */
+    char           c;
+
+    printf ("Waiting for key press...\n");
+    scanf ("%c", &c);
+  }
+#endif /* SCOTCH_CHECK_NOAUTO */
+
+  if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Synchronize for debug */
+    SCOTCH_errorPrint ("main: cannot communicate (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphInit (&srcgrafdat, proccomm) != 0) { /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize source graph");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_dgraphInit (&shrgrafdat, proccomm) != 0) { /* Initialize shared-loaded graph */
+    SCOTCH_errorPrint ("main: cannot initialize shared graph");
+    exit (EXIT_FAILURE);
+  }
+
+  file = NULL;
+  if ((proclocnum == 0) &&
+      ((file = fopen (argv[1], "r")) == NULL)) {
+    SCOTCH_errorPrint ("main: cannot open graph file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphLoad (&srcgrafdat, file, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load source graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (file != NULL)
+    fclose (file);
+
+  if (SCOTCH_dgraphLoadShared (&shrgrafdat, argv[1], -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load shared graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphCheck (&shrgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid shared graph");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_dgraphSize (&srcgrafdat, &srcvertglbnbr, NULL, &srcedgeglbnbr, NULL);
+  SCOTCH_dgraphSize (&shrgrafdat, &shrvertglbnbr, NULL, &shredgeglbnbr, NULL);
+  if ((srcvertglbnbr != shrvertglbnbr) ||
+      (srcedgeglbnbr != shredgeglbnbr)) {
+    SCOTCH_errorPrint ("main: shared graph differs (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  srccgrfptr =                                    /* Gather both graphs on root process */
+  shrcgrfptr = NULL;
+  if (proclocnum == 0) {
+    srccgrfptr = &srccgrfdat;
+    shrcgrfptr = &shrcgrfdat;
+    SCOTCH_graphInit (srccgrfptr);
+    SCOTCH_graphInit (shrcgrfptr);
+  }
+  if ((SCOTCH_dgraphGather (&srcgrafdat, srccgrfptr) != 0) ||
+      (SCOTCH_dgraphGather (&shrgrafdat, shrcgrfptr) != 0)) {
+    SCOTCH_errorPrint ("main: cannot gather graphs");
+    exit (EXIT_FAILURE);
+  }
+
+  if (proclocnum == 0) {
+    SCOTCH_Num          baseval;
+    SCOTCH_Num          vertnbr;
+    SCOTCH_Num          vertnum;
+    SCOTCH_Num *        srcverttab;
+    SCOTCH_Num *        shrverttab;
+    SCOTCH_Num *        srcvendtab;
+    SCOTCH_Num *        shrvendtab;
+    SCOTCH_Num *        srcvelotab;
+    SCOTCH_Num *        shrvelotab;
+    SCOTCH_Num *        srcvlbltab;
+    SCOTCH_Num *        shrvlbltab;
+    SCOTCH_Num *        srcedgetab;
+    SCOTCH_Num *        shredgetab;
+    SCOTCH_Num *        srcedlotab;
+    SCOTCH_Num *        shredlotab;
+
+    SCOTCH_graphData (srccgrfptr, &baseval, &vertnbr, &srcverttab, &srcvendtab, &srcvelotab, &srcvlbltab, NULL, &srcedgetab, &srcedlotab);
+    SCOTCH_graphData (shrcgrfptr, NULL,     NULL,     &shrverttab, &shrvendtab, &shrvelotab, &shrvlbltab, NULL, &shredgetab, &shredlotab);
+    if (((srcvelotab == NULL) != (shrvelotab == NULL)) ||
+        ((srcvlbltab == NULL) != (shrvlbltab == NULL)) ||
+        ((srcedlotab == NULL) != (shredlotab == NULL))) {
+      SCOTCH_errorPrint ("main: shared graph differs (2)");
+      exit (EXIT_FAILURE);
+    }
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+      SCOTCH_Num          edgenum;
+
+      if ((srcverttab[vertnum] != shrverttab[vertnum]) ||
+          (srcvendtab[vertnum] != shrvendtab[vertnum]) ||
+          ((srcvelotab != NULL) && (srcvelotab[vertnum] != shrvelotab[vertnum])) ||
+          ((srcvlbltab != NULL) && (srcvlbltab[vertnum] != shrvlbltab[vertnum]))) {
+        SCOTCH_errorPrint ("main: shared graph differs (3)");
+        exit (EXIT_FAILURE);
+      }
+      for (edgenum = srcverttab[vertnum] - baseval; edgenum < srcvendtab[vertnum] - baseval; edgenum ++) {
+        if ((srcedgetab[edgenum] != shredgetab[edgenum]) ||
+            ((srcedlotab != NULL) && (srcedlotab[edgenum] != shredlotab[edgenum]))) {
+          SCOTCH_errorPrint ("main: shared graph differs (4)");
+          exit (EXIT_FAILURE);
+        }
+      }
+    }
+
+    SCOTCH_graphExit (shrcgrfptr);
+    SCOTCH_graphExit (srccgrfptr);
+  }
+
+  SCOTCH_dgraphExit (&shrgrafdat);
+  SCOTCH_dgraphExit (&srcgrafdat);
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
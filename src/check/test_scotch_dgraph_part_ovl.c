@@ -0,0 +1,258 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_dgraph_part_ovl.c           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_dgraphPartOvl() routine.     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <mpi.h>
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "ptscotch.h"
+
+#define PARTNBR                     3             /* Number of tested part counts */
+
+static SCOTCH_Num           partnbrtab[PARTNBR] = { 2, 3, 5 };
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm            proccomm;
+  int                 procglbnbr;                 /* Number of processes sharing graph data */
+  int                 proclocnum;                 /* Number of this process                 */
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertglbnbr;
+  SCOTCH_Num          vertlocnbr;
+  SCOTCH_Num          vertgstnbr;
+  SCOTCH_Num *        vertloctab;
+  SCOTCH_Num *        vendloctab;
+  SCOTCH_Num *        edgegsttab;
+  SCOTCH_Num *        partloctab;
+  int *               partgsttab;
+  long *              sizeloctab;
+  long *              sizeglbtab;
+  SCOTCH_Dgraph       grafdat;
+  SCOTCH_Strat        stradat;
+  FILE *              file;
+  int                 i;
+#ifdef SCOTCH_PTHREAD
+  int                 thrdlvlreqval;
+  int                 thrdlvlproval;
+#endif /* SCOTCH_PTHREAD */
+
+  SCOTCH_errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdlvlreqval = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdlvlreqval, &thrdlvlproval) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (1)");
+  if (thrdlvlreqval > thrdlvlproval)
+    SCOTCH_errorPrint ("main: MPI implementation is not thread-safe: recompile without SCOTCH_PTHREAD");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+  fprintf (stderr, "Proc %2d of %2d, pid %d\n", proclocnum, procglbnbr, getpid ());
+
+#ifdef SCOTCH_CHECK_NOAUTO
+  if (proclocnum == 0) {                          /* Synchronize on keybord input */
+    char           c;
+
+    printf ("Waiting for key press...\n");
+    scanf ("%c", &c);
+  }
+#endif /* SCOTCH_CHECK_NOAUTO */
+
+  if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Synchronize for debug */
+    SCOTCH_errorPrint ("main: cannot communicate (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphInit (&grafdat, proccomm) != 0) { /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  file = NULL;
+  if ((proclocnum == 0) &&
+      ((file = fopen (argv[1], "r")) == NULL)) {
+    SCOTCH_errorPrint ("main: cannot open graph file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphLoad (&grafdat, file, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (file != NULL)
+    fclose (file);
+
+  if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Synchronize for debug */
+    SCOTCH_errorPrint ("main: cannot communicate (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphGhst (&grafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute ghost edge array");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_dgraphData (&grafdat, &baseval, &vertglbnbr, &vertlocnbr, NULL, &vertgstnbr, &vertloctab, &vendloctab, NULL, NULL, NULL, NULL, NULL, NULL, &edgegsttab, NULL, NULL);
+
+  if (((partloctab = malloc ((vertlocnbr + 1) * sizeof (SCOTCH_Num))) == NULL) ||
+      ((partgsttab = malloc ((vertgstnbr + 1) * sizeof (int)))        == NULL) ||
+      ((sizeloctab = malloc ((partnbrtab[PARTNBR - 1] + 1) * 2 * sizeof (long)))       == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  sizeglbtab = sizeloctab + partnbrtab[PARTNBR - 1] + 1;
+
+  for (i = 0; i < PARTNBR; i ++) {
+    SCOTCH_Num          partnbr;
+    SCOTCH_Num          partnum;
+    SCOTCH_Num          vertlocnum;
+
+    partnbr = partnbrtab[i];
+
+    SCOTCH_stratInit (&stradat);
+    if (SCOTCH_dgraphPartOvl (&grafdat, partnbr, &stradat, partloctab) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute overlap partition");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+
+    memset (sizeloctab, 0, (partnbr + 1) * sizeof (long));
+    for (vertlocnum = 0; vertlocnum < vertlocnbr; vertlocnum ++) {
+      SCOTCH_Num          partval;
+
+      partval = partloctab[vertlocnum];
+      if ((partval < -1) || (partval >= partnbr)) {
+        SCOTCH_errorPrint ("main: invalid part index");
+        exit (EXIT_FAILURE);
+      }
+      partgsttab[vertlocnum] = (int) partval;
+      sizeloctab[partval + 1] ++;                 /* Slot 0 counts overlap vertices */
+    }
+
+    if (SCOTCH_dgraphHalo (&grafdat, partgsttab, MPI_INT) != 0) {
+      SCOTCH_errorPrint ("main: cannot perform halo exchange");
+      exit (EXIT_FAILURE);
+    }
+
+    for (vertlocnum = 0; vertlocnum < vertlocnbr; vertlocnum ++) {
+      SCOTCH_Num          edgelocnum;
+      int                 partval;
+
+      partval = partgsttab[vertlocnum];
+      if (partval < 0)                            /* Overlap vertices may have any neighbors */
+        continue;
+
+      for (edgelocnum = vertloctab[vertlocnum]; edgelocnum < vendloctab[vertlocnum]; edgelocnum ++) {
+        int                 partend;
+
+        partend = partgsttab[edgegsttab[edgelocnum - baseval] - baseval];
+        if ((partend >= 0) && (partend != partval)) {
+          SCOTCH_errorPrint ("main: parts are not separated by overlap");
+          exit (EXIT_FAILURE);
+        }
+      }
+    }
+
+    if (MPI_Allreduce (sizeloctab, sizeglbtab, (int) (partnbr + 1), MPI_LONG, MPI_SUM, proccomm) != MPI_SUCCESS) {
+      SCOTCH_errorPrint ("main: cannot communicate (3)");
+      exit (EXIT_FAILURE);
+    }
+
+    for (partnum = 1; partnum <= partnbr; partnum ++) {
+      if (sizeglbtab[partnum] <= 0) {
+        SCOTCH_errorPrint ("main: empty part");
+        exit (EXIT_FAILURE);
+      }
+    }
+
+    if (proclocnum == 0) {
+      printf ("Parts: %ld, overlap: %ld, sizes:", (long) partnbr, sizeglbtab[0]);
+      for (partnum = 1; partnum <= partnbr; partnum ++)
+        printf (" %ld", sizeglbtab[partnum]);
+      printf ("\n");
+    }
+  }
+
+  free (sizeloctab);
+  free (partgsttab);
+  free (partloctab);
+  SCOTCH_dgraphExit (&grafdat);
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2012,2014,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2014,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,6 +40,8 @@
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 21 feb 2012     **/
 /**                                 to   : 22 may 2018     **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,8 +80,28 @@ char *              argv[])
   SCOTCH_Num            vertlocnbr;
   SCOTCH_Num            vertlocnum;
   SCOTCH_Num *          partloctab;
+  SCOTCH_Context        contdat;
   SCOTCH_Dgraph         srcgrafdat;
+  SCOTCH_Dgraph         srccontgrafdat;           /* Source graph bound to context */
   SCOTCH_Dgraph         dstgrafdat;
+  SCOTCH_Dgraph         cmpgrafdat;               /* Graph redistributed with compression */
+  SCOTCH_Num            baseval;
+  SCOTCH_Num            dstvertlocnbr;
+  SCOTCH_Num            cmpvertlocnbr;
+  SCOTCH_Num            dstedgelocnbr;
+  SCOTCH_Num            cmpedgelocnbr;
+  SCOTCH_Num *          dstvertloctab;
+  SCOTCH_Num *          cmpvertloctab;
+  SCOTCH_Num *          dstvendloctab;
+  SCOTCH_Num *          cmpvendloctab;
+  SCOTCH_Num *          dstveloloctab;
+  SCOTCH_Num *          cmpveloloctab;
+  SCOTCH_Num *          dstvlblloctab;
+  SCOTCH_Num *          cmpvlblloctab;
+  SCOTCH_Num *          dstedgeloctab;
+  SCOTCH_Num *          cmpedgeloctab;
+  SCOTCH_Num *          dstedloloctab;
+  SCOTCH_Num *          cmpedloloctab;
   FILE *                file;
 #ifdef SCOTCH_PTHREAD
   int                 thrdlvlreqval;
@@ -173,6 +195,58 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
+  SCOTCH_contextInit (&contdat);                  /* Redistribute graph again with compressed communications */
+  SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMCOMPRESS, 1);
+  if (SCOTCH_contextBindDgraph (&contdat, &srcgrafdat, &srccontgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot bind graph to context");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_dgraphInit (&cmpgrafdat, proccomm) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize compressed destination graph");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_dgraphRedist (&srccontgrafdat, partloctab, NULL, -1, -1, &cmpgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute compressed redistributed graph");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_dgraphCheck (&cmpgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: invalid compressed redistributed graph");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_dgraphData (&dstgrafdat, &baseval, NULL, &dstvertlocnbr, NULL, NULL, &dstvertloctab, &dstvendloctab, &dstveloloctab, &dstvlblloctab,
+                     NULL, &dstedgelocnbr, NULL, &dstedgeloctab, NULL, &dstedloloctab, NULL);
+  SCOTCH_dgraphData (&cmpgrafdat, NULL,     NULL, &cmpvertlocnbr, NULL, NULL, &cmpvertloctab, &cmpvendloctab, &cmpveloloctab, &cmpvlblloctab,
+                     NULL, &cmpedgelocnbr, NULL, &cmpedgeloctab, NULL, &cmpedloloctab, NULL);
+  if ((dstvertlocnbr != cmpvertlocnbr) ||
+      (dstedgelocnbr != cmpedgelocnbr) ||
+      ((dstveloloctab == NULL) != (cmpveloloctab == NULL)) ||
+      ((dstedloloctab == NULL) != (cmpedloloctab == NULL))) {
+    SCOTCH_errorPrint ("main: compressed redistributed graph differs (1)");
+    exit (EXIT_FAILURE);
+  }
+  for (vertlocnum = 0; vertlocnum < dstvertlocnbr; vertlocnum ++) {
+    SCOTCH_Num          edgelocnum;
+
+    if ((dstvertloctab[vertlocnum] != cmpvertloctab[vertlocnum]) ||
+        (dstvendloctab[vertlocnum] != cmpvendloctab[vertlocnum]) ||
+        (dstvlblloctab[vertlocnum] != cmpvlblloctab[vertlocnum]) ||
+        ((dstveloloctab != NULL) && (dstveloloctab[vertlocnum] != cmpveloloctab[vertlocnum]))) {
+      SCOTCH_errorPrint ("main: compressed redistributed graph differs (2)");
+      exit (EXIT_FAILURE);
+    }
+    for (edgelocnum = dstvertloctab[vertlocnum] - baseval; edgelocnum < dstvendloctab[vertlocnum] - baseval; edgelocnum ++) {
+      if ((dstedgeloctab[edgelocnum] != cmpedgeloctab[edgelocnum]) ||
+          ((dstedloloctab != NULL) && (dstedloloctab[edgelocnum] != cmpedloloctab[edgelocnum]))) {
+        SCOTCH_errorPrint ("main: compressed redistributed graph differs (3)");
+        exit (EXIT_FAILURE);
+      }
+    }
+  }
+
+  SCOTCH_dgraphExit  (&cmpgrafdat);
+  SCOTCH_dgraphExit  (&srccontgrafdat);
+  SCOTCH_contextExit (&contdat);
   SCOTCH_dgraphExit (&dstgrafdat);
   SCOTCH_dgraphExit (&srcgrafdat);
   free (partloctab);
@@ -1,4 +1,4 @@
-/* Copyright 2014,2015,2018,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2014,2015,2018,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,6 +43,8 @@
 /**                                 to   : 22 may 2018     **/
 /**                # Version 6.1  : from : 24 jun 2021     **/
 /**                                 to   : 24 jun 2021     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -57,6 +59,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/context.h"
+#include "../libscotch/arch.h"
+#include "../libscotch/graph.h"
+#include "../libscotch/graph_coarsen.h"
+#include "../libscotch/graph_hier.h"
 #include "scotch.h"
 
 /**************************************/
@@ -231,13 +240,17 @@ char *              argv[])
   SCOTCH_Graph            coargrafdat;            /* Coarse graph              */
   SCOTCH_Num *            coarmulttab;            /* Multinode array           */
   SCOTCH_Num              coarvertnbr;            /* Number of coarse vertices */
+  SCOTCH_Num              coarvertnbr2;           /* Number with two-hop pass  */
   SCOTCH_Num              coaredgenbr;            /* Number of coarse edges    */
+  SCOTCH_Num              partnbr;                /* Number of parts           */
+  const Graph *           finegrafptr;            /* Internal fine graph       */
+  const GraphHier *       hierptr;                /* Attached hierarchy        */
   FILE *                  fileptr;
 
   SCOTCH_errorProg (argv[0]);
 
-  if (argc != 2) {
-    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+  if ((argc < 2) || (argc > 3)) {
+    SCOTCH_errorPrint ("usage: %s graph_file [hop_flag]", argv[0]);
     exit (EXIT_FAILURE);
   }
 
@@ -277,6 +290,29 @@ char *              argv[])
           coarvertnbr);
   printf ("Graph mated with a ratio of %lg\n", (double) coarvertnbr / (double) finevertnbr);
 
+  if ((argc > 2) && (atoi (argv[2]) != 0)) {      /* If two-hop matching must be checked */
+    coarvertnbr2 = 0;
+    if (SCOTCH_graphCoarsenMatch (&finegrafdat, &coarvertnbr2, 1.0, SCOTCH_COARSENNOMERGE | SCOTCH_COARSENHOP, finematetab) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute two-hop matching");
+      exit (EXIT_FAILURE);
+    }
+
+    checkFineCoar (finematetab, coarvertnbr2, finevertnbr, baseval);
+
+    printf ("Two-hop mate array has " SCOTCH_NUMSTRING " vertices\n",
+            coarvertnbr2);
+    if (coarvertnbr2 >= coarvertnbr) {
+      SCOTCH_errorPrint ("main: two-hop matching did not reduce number of coarse vertices");
+      exit (EXIT_FAILURE);
+    }
+
+    coarvertnbr = 0;                              /* Recompute plain matching for next tests */
+    if (SCOTCH_graphCoarsenMatch (&finegrafdat, &coarvertnbr, 1.0, SCOTCH_COARSENNOMERGE, finematetab) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute matching");
+      exit (EXIT_FAILURE);
+    }
+  }
+
   if ((coarmulttab = malloc (coarvertnbr * 2 * sizeof (SCOTCH_Num))) == NULL) {
     SCOTCH_errorPrint ("main: out of memory (2)");
     exit (EXIT_FAILURE);
@@ -345,6 +381,55 @@ char *              argv[])
 
   SCOTCH_graphExit (&coargrafdat);
   free             (coarmulttab);                 /* Free third multinode array */
+
+  if ((finematetab = malloc (finevertnbr * sizeof (SCOTCH_Num))) == NULL) { /* Part array */
+    SCOTCH_errorPrint ("main: out of memory (4)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphCoarsenHier (&finegrafdat, 10, 0.8) != 0) { /* Attach hierarchy with ratio of default strategies */
+    SCOTCH_errorPrint ("main: cannot build coarsening hierarchy (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  finegrafptr = (const Graph *) &finegrafdat;     /* TRICK: graph without context is plain Graph */
+  hierptr     = finegrafptr->hierptr;
+
+  for (partnbr = 2; partnbr <= 9; partnbr += 7) { /* Repeated partitions reusing hierarchy */
+    SCOTCH_Strat        stradat;
+    SCOTCH_Num          finevertnum;
+    SCOTCH_Num          usednbr;
+
+    usednbr = hierptr->usednbr;
+    SCOTCH_stratInit (&stradat);
+    if (SCOTCH_graphPart (&finegrafdat, partnbr, &stradat, finematetab) != 0) {
+      SCOTCH_errorPrint ("main: cannot partition graph");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+
+    for (finevertnum = 0; finevertnum < finevertnbr; finevertnum ++) {
+      if ((finematetab[finevertnum] < 0) || (finematetab[finevertnum] >= partnbr)) {
+        SCOTCH_errorPrint ("main: invalid partition");
+        exit (EXIT_FAILURE);
+      }
+    }
+    if ((hierptr->levlnbr > 0) &&                 /* Multilevel methods must have coarsened through hierarchy levels */
+        (hierptr->usednbr <= usednbr)) {
+      SCOTCH_errorPrint ("main: coarsening hierarchy not reused");
+      exit (EXIT_FAILURE);
+    }
+    printf ("Graph partitioned in " SCOTCH_NUMSTRING " parts using " SCOTCH_NUMSTRING " hierarchy levels\n", partnbr, hierptr->usednbr - usednbr);
+  }
+
+  SCOTCH_graphCoarsenHierFree (&finegrafdat);     /* Free hierarchy explicitly */
+
+  if (SCOTCH_graphCoarsenHier (&finegrafdat, 10, 0.8) != 0) { /* Hierarchy will be freed along with graph */
+    SCOTCH_errorPrint ("main: cannot build coarsening hierarchy (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  free             (finematetab);
   SCOTCH_graphExit (&finegrafdat);
 
   exit (EXIT_SUCCESS);
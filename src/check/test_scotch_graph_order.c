@@ -1,4 +1,4 @@
-/* Copyright 2014,2018,2019 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2014,2018,2019,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -36,11 +36,13 @@
 /**   AUTHOR     : Francois PELLEGRINI                     **/
 /**                                                        **/
 /**   FUNCTION   : This module tests the operation of      **/
-/**                the SCOTCH_graphOrderCompute*()         **/
-/**                routines.                               **/
+/**                the SCOTCH_graphOrderCompute*() and     **/
+/**                SCOTCH_graphOrderStat() routines.       **/
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 05 aug 2014     **/
 /**                                 to   : 01 sep 2019     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,6 +80,11 @@ char *              argv[])
   SCOTCH_Num          listnbr;
   SCOTCH_Num          listnum;
   SCOTCH_Num *        listtab;
+  SCOTCH_Num *        fathtab;
+  SCOTCH_Num *        ccnttab;
+  double              fnnzval;
+  double              fnnzsum;
+  double              fopcval;
 
   SCOTCH_errorProg (argv[0]);
 
@@ -110,6 +117,11 @@ char *              argv[])
     SCOTCH_errorPrint ("main: out of memory (1)");
     exit (EXIT_FAILURE);
   }
+  if (((fathtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((ccnttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory (2)");
+    exit (EXIT_FAILURE);
+  }
   for (listnum = 0, vertnum = baseval + (listnbr / 4); /* Keep only middle half of the vertices */
        listnum < listnbr; listnum ++, vertnum ++)
     listtab[listnum] = vertnum;
@@ -139,6 +151,27 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
+  if (SCOTCH_graphOrderStat (&grafdat, &ordedat, fathtab, ccnttab, &fnnzval, &fopcval) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute ordering statistics");
+    exit (EXIT_FAILURE);
+  }
+  for (vertnum = 0, fnnzsum = 0.0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Num          fathnum;
+
+    fathnum = fathtab[vertnum];
+    if ((fathnum != -1) &&                        /* Fathers come after their sons and hold their rows but one */
+        ((fathnum <= (vertnum + baseval)) || (fathnum >= (vertnbr + baseval)) ||
+         (ccnttab[fathnum - baseval] < (ccnttab[vertnum] - 1)))) {
+      SCOTCH_errorPrint ("main: invalid elimination tree");
+      exit (EXIT_FAILURE);
+    }
+    fnnzsum += (double) ccnttab[vertnum];
+  }
+  if ((fnnzsum != fnnzval) || (fnnzval < (double) vertnbr) || (fopcval < fnnzval)) {
+    SCOTCH_errorPrint ("main: invalid ordering statistics");
+    exit (EXIT_FAILURE);
+  }
+
   SCOTCH_graphOrderSave     (&grafdat, &ordedat, fileptr); /* Test ordering data output routines */
   SCOTCH_graphOrderSaveMap  (&grafdat, &ordedat, fileptr);
   SCOTCH_graphOrderSaveTree (&grafdat, &ordedat, fileptr);
@@ -166,6 +199,8 @@ char *              argv[])
 
   fclose (fileptr);
 
+  free (ccnttab);
+  free (fathtab);
   free (listtab);
   SCOTCH_stratExit      (&stradat);
   SCOTCH_graphOrderExit (&grafdat, &ordedat);
@@ -0,0 +1,208 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_part_geom.c           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the sequential        **/
+/**                geometric graph partitioning routine.   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "scotch.h"
+
+/*
+**  The static variables.
+*/
+
+static const char *         C_stratab[] = {       /* Strategies to test; empty string means default one */
+                              "",
+                              "r{job=t,map=t,poli=S,bal=0.05,sep=c{type=c}f{bal=0.05,move=120}}",
+                              "r{job=t,map=t,poli=S,bal=0.05,sep=m{vert=120,low=c{type=i},asc=b{bnd=f{bal=0.05},org=f{bal=0.05}}}}",
+                              NULL };
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  SCOTCH_Graph          grafdat;
+  SCOTCH_Graph          grafdat2;                 /* Empty graph not matching geometry */
+  SCOTCH_Geom           geomdat;
+  SCOTCH_Strat          stradat;
+  SCOTCH_Num            baseval;
+  SCOTCH_Num            partnbr;
+  SCOTCH_Num            partnum;
+  SCOTCH_Num *          parttab;
+  SCOTCH_Num            vertnbr;
+  SCOTCH_Num            vertnum;
+  SCOTCH_Num *          verttab;
+  SCOTCH_Num *          vendtab;
+  SCOTCH_Num *          velotab;
+  SCOTCH_Num *          edgetab;
+  SCOTCH_Num *          loadtab;
+  SCOTCH_Num            loadmax;
+  SCOTCH_Num            loadsum;
+  SCOTCH_Num            cutsum;
+  double                loadavg;
+  FILE *                fileptr;
+  FILE *                geomptr;
+  int                   stranum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 4) {
+    SCOTCH_errorPrint ("usage: %s nparts input_source_graph_file input_geometry_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if ((partnbr = (SCOTCH_Num) atoi (argv[1])) < 1) {
+    SCOTCH_errorPrint ("main: invalid number of parts (\"%s\")", argv[1]);
+    exit (EXIT_FAILURE);
+  }
+
+  if ((SCOTCH_graphInit (&grafdat) != 0) ||
+      (SCOTCH_geomInit  (&geomdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (((fileptr = fopen (argv[2], "r")) == NULL) ||
+      ((geomptr = fopen (argv[3], "r")) == NULL)) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphGeomLoadScot (&grafdat, &geomdat, fileptr, geomptr, NULL) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (geomptr);
+  fclose (fileptr);
+
+  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, &verttab, &vendtab, &velotab, NULL, NULL, &edgetab, NULL);
+
+  if (((parttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((loadtab = malloc (partnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (stranum = 0; C_stratab[stranum] != NULL; stranum ++) {
+    if (SCOTCH_stratInit (&stradat) != 0) {
+      SCOTCH_errorPrint ("main: cannot initialize strategy");
+      exit (EXIT_FAILURE);
+    }
+    if ((C_stratab[stranum][0] != '\0') &&
+        (SCOTCH_stratGraphMap (&stradat, C_stratab[stranum]) != 0)) {
+      SCOTCH_errorPrint ("main: invalid strategy (%d)", stranum);
+      exit (EXIT_FAILURE);
+    }
+
+    if (SCOTCH_graphPartGeom (&grafdat, &geomdat, partnbr, &stradat, parttab) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute partition (%d)", stranum);
+      exit (EXIT_FAILURE);
+    }
+
+    memset (loadtab, 0, partnbr * sizeof (SCOTCH_Num));
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+      if ((parttab[vertnum] < 0) || (parttab[vertnum] >= partnbr)) {
+        SCOTCH_errorPrint ("main: invalid part number (%d)", stranum);
+        exit (EXIT_FAILURE);
+      }
+      loadtab[parttab[vertnum]] += (velotab == NULL) ? 1 : velotab[vertnum];
+    }
+
+    for (partnum = 0, loadsum = loadmax = 0; partnum < partnbr; partnum ++) {
+      loadsum += loadtab[partnum];
+      if (loadtab[partnum] > loadmax)
+        loadmax = loadtab[partnum];
+    }
+    loadavg = (double) loadsum / (double) partnbr;
+
+    for (vertnum = 0, cutsum = 0; vertnum < vertnbr; vertnum ++) { /* Count cut edges */
+      SCOTCH_Num          edgenum;
+
+      for (edgenum = verttab[vertnum] - baseval; edgenum < vendtab[vertnum] - baseval; edgenum ++) {
+        if (parttab[edgetab[edgenum] - baseval] != parttab[vertnum])
+          cutsum ++;
+      }
+    }
+    printf ("Strategy %d: CompLoadMax/Avg=%g\tCutEdges=%ld\n", stranum, (double) loadmax / loadavg, (long) (cutsum / 2));
+    if (((double) loadmax / loadavg) > 1.2) {
+      SCOTCH_errorPrint ("main: partition too imbalanced (%d)", stranum);
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_stratExit (&stradat);
+  }
+
+  SCOTCH_graphInit (&grafdat2);
+  SCOTCH_stratInit (&stradat);
+  if (SCOTCH_graphPartGeom (&grafdat2, &geomdat, partnbr, &stradat, parttab) == 0) { /* Geometry of wrong size must be rejected */
+    SCOTCH_errorPrint ("main: geometry of invalid size accepted");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_stratExit (&stradat);
+  SCOTCH_graphExit (&grafdat2);
+
+  free (loadtab);
+  free (parttab);
+
+  SCOTCH_geomExit  (&geomdat);
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
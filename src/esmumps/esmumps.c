@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2020,2022,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2020,2022,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 28 aug 2020     **/
 /**                                 to   : 05 sep 2020     **/
 /**                # Version 7.0  : from : 01 dec 2022     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -116,7 +116,9 @@ INT * restrict const        elentab,              /*+ Permutations computed for
 INT * restrict const        lasttab)              /*+ Permutations computed for debugging only +*/
 {
   INT                         baseval;            /* Base value                          */
+  SCOTCH_Context              contdat;            /* Execution context                   */
   Graph                       grafdat;            /* Graph                               */
+  Graph                       cgrfdat;            /* Graph bound to execution context    */
   Order                       ordedat;            /* Graph ordering                      */
   SymbolMatrix                symbdat;            /* Block factored matrix               */
   INT                         vertnum;
@@ -139,8 +141,16 @@ INT * restrict const        lasttab)              /*+ Permutations computed for
   graphInit        (&grafdat);
   graphBuildGraph2 (&grafdat, 1, n, pfree - 1, petab, vendtab, velotab, NULL, iwtab, NULL); /* Assume Fortran-based indexing */
 
+  SCOTCH_contextInit (&contdat);                  /* Create execution context shared by ordering and symbolic factorization */
+  if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cgrfdat) != 0) {
+    errorPrint ("esmumps2: cannot bind context");
+    SCOTCH_contextExit (&contdat);
+    memFree (vendtab);
+    return (1);
+  }
+
   orderInit  (&ordedat);
-  orderGraph (&ordedat, &grafdat);                /* Compute ordering with Scotch */
+  orderGraph (&ordedat, &cgrfdat);                /* Compute ordering with Scotch */
 
 #ifdef ESMUMPS_ORDER_DUMP
   {
@@ -168,7 +178,7 @@ INT * restrict const        lasttab)              /*+ Permutations computed for
 #endif /* ESMUMPS_DEBUG */
 
   symbolInit     (&symbdat);
-  symbolFaxGraph (&symbdat, &grafdat, &ordedat);  /* Compute block symbolic factorizaion */
+  symbolFaxGraph (&symbdat, &grafdat, &ordedat, (Context *) &contdat); /* Compute block symbolic factorizaion */
 
 #ifdef ESMUMPS_DEBUG_OUTPUT
   {
@@ -229,6 +239,8 @@ INT * restrict const        lasttab)              /*+ Permutations computed for
 
   symbolExit (&symbdat);
   orderExit  (&ordedat);
+  graphExit  (&cgrfdat);
+  SCOTCH_contextExit (&contdat);
   graphExit  (&grafdat);
   memFree    (vendtab);
 
@@ -1,4 +1,4 @@
-/* Copyright 2009,2018,2022,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2009,2018,2022,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.1  : from : 05 sep 2020     **/
 /**                                 to   : 05 sep 2020     **/
 /**                # Version 7.0  : from : 21 apr 2022     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -118,6 +118,11 @@
 #define errorProg                   SCOTCH_NAME_MACRO2 (SCOTCH_, errorProg)
 
 #define intSort1asc1                SCOTCH_NAME_INTERN (intSort1asc1)
+#define intSort2asc2                SCOTCH_NAME_INTERN (intSort2asc2)
+#define memAllocGroup               SCOTCH_NAME_INTERN (memAllocGroup)
+#define threadContextBarrier        SCOTCH_NAME_INTERN (threadContextBarrier)
+#define threadContextNbr            SCOTCH_NAME_INTERN (threadContextNbr)
+#define threadLaunch                SCOTCH_NAME_INTERN (threadLaunch)
 #endif /* ((! defined SCOTCH_COMMON_EXTERNAL) || (defined SCOTCH_COMMON_RENAME)) */
 
 #ifndef ESMUMPS_NAME_PREFIX_INTERN
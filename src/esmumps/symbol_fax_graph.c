@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.0  : from : 21 jan 2020     **/
 /**                                 to   : 22 jan 2020     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # symbolFaxGraph() could have called    **/
 /**                  symbolFax() in the regular way, as    **/
@@ -72,6 +72,8 @@
 **  The defines and includes.
 */
 
+#define ESMUMPS_SYMBOL_FAX_GRAPH
+
 #include "module.h"
 #include "common.h"
 #include "scotch.h"
@@ -80,6 +82,699 @@
 #include "order.h"
 #include "fax.h"
 #include "symbol_fax.h"
+#include "symbol_fax_graph.h"
+
+/***********************************/
+/*                                 */
+/* Multi-threaded symbolic         */
+/* factorization routines.         */
+/*                                 */
+/***********************************/
+
+/*+ This routine computes the blocks of the
+*** given column block in the given block
+*** area, in the same way as the sequential
+*** routine. Blocks of contributing column
+*** blocks may belong to other block areas,
+*** which are then no longer modified.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+static
+int
+symbolFaxGraphCblk (
+SymbolFaxGraphData * const  dataptr,
+SymbolFaxGraphArea * const  areaptr,
+const INT                   cblknum)
+{
+  INT                       colnum;               /* Number of current column [based]                  */
+  INT                       colmax;               /* Maximum column index for current column block     */
+  INT                       colend;               /* Column number of vertex neighbor                  */
+  INT                       cblkctr;              /* Based number of current contributing column block */
+  SymbolBlok * restrict     bloktax;              /* Based access to block array of area               */
+  INT                       bloknum;              /* Based number of current first free block slot     */
+  INT                       blokmax;              /* Maximum number of blocks in array                 */
+  SymbolFaxTlok * restrict  tloktab;              /* Beginning of array of temporary blocks            */
+  INT                       ctrbsum;              /* Number of contributing blocks for column block    */
+  INT * restrict            sorttab;              /* Beginning of sort area                            */
+  INT                       sortnbr;              /* Number of vertices in sort area and hash table    */
+  INT * restrict            hashtab;              /* Hash vertex table                                 */
+  INT                       hashmsk;              /* Mask for access to hash table                     */
+
+  const INT                         baseval = dataptr->baseval;
+  const INT                         vertnbr = dataptr->vertnbr;
+  const INT                         cblknnd = dataptr->cblknbr + baseval;
+  const INT * restrict const        verttax = dataptr->verttax;
+  const INT * restrict const        vendtax = dataptr->vendtax;
+  const INT * restrict const        edgetax = dataptr->edgetax;
+  const INT * restrict const        permtax = dataptr->permtax;
+  const INT * restrict const        peritax = dataptr->peritax;
+  const INT * restrict const        rangtax = dataptr->rangtax;
+  SymbolCblk * restrict const       cblktax = dataptr->cblktax;
+  INT * restrict const              bnndtax = dataptr->bnndtax;
+  INT * restrict const              ctrbtax = dataptr->ctrbtax;
+  const INT * restrict const        ownrtax = dataptr->ownrtax;
+
+  bloktax = areaptr->bloktax;
+  bloknum = areaptr->bloknum;
+  blokmax = areaptr->blokmax;
+
+  {                                               /* Compute offsets and check for array size */
+    INT                 degrmax;                  /* Maximum number of local blocks in array  */
+    INT                 hashsiz;
+    INT                 hashmax;
+    INT                 ctrbtmp;
+    ptrdiff_t           sortoft;                  /* Offset of sort array                   */
+    ptrdiff_t           tlokoft;                  /* Offset of temporary block array        */
+    ptrdiff_t           tlndoft;                  /* Offset of end of temporary block array */
+    INT                 tlokmax;
+
+    colnum = rangtax[cblknum];
+    colmax = rangtax[cblknum + 1];                /* Get maximum column value */
+
+    cblktax[cblknum].fcolnum = colnum;            /* Set column block data */
+    cblktax[cblknum].lcolnum = colmax - 1;
+    cblktax[cblknum].bloknum = bloknum;
+
+    degrmax = 0;
+    for ( ; colnum < colmax; colnum ++)           /* For all columns                              */
+      degrmax += vendtax[peritax[colnum]] - verttax[peritax[colnum]]; /* Add column degrees       */
+    if (degrmax > vertnbr)                        /* There cannot be more neighbors than vertices */
+      degrmax = vertnbr;
+
+    for (hashmax = 256; hashmax < degrmax; hashmax *= 2) ; /* Get upper bound on hash table size */
+    hashsiz = hashmax << 2;                       /* Fill hash table at 1/4 of capacity            */
+    hashmsk = hashsiz - 1;
+
+    for (ctrbsum = 0, ctrbtmp = ctrbtax[cblknum]; /* Follow chain of contributing column blocks */
+         ctrbtmp != ~0; ctrbtmp = ctrbtax[ctrbtmp])
+      ctrbsum += bnndtax[ctrbtmp] - cblktax[ctrbtmp].bloknum - 2; /* Sum contributing column blocks */
+
+    tlokmax = degrmax + ctrbsum;                  /* Maximum possible number of blocks in temporary area */
+    sortoft = ((ptrdiff_t) tlokmax) * sizeof (SymbolBlok);
+    if ((((ptrdiff_t) hashsiz) * sizeof (INT)) > sortoft) /* Compute offset of sort area */
+      sortoft = (((ptrdiff_t) hashsiz) * sizeof (INT));
+    tlokoft = sortoft + ((ptrdiff_t) degrmax) * sizeof (INT); /* Compute offset of temporary block area */
+    tlndoft = tlokoft + ((ptrdiff_t) tlokmax) * sizeof (SymbolFaxTlok); /* Compute end of area          */
+
+    if (((byte *) (bloktax + bloknum) + tlndoft) > /* If not enough room */
+        ((byte *) (bloktax + blokmax))) {
+      SymbolBlok *        bloktmp;                /* Temporary pointer for array resizing */
+
+      do {
+        blokmax = blokmax + (blokmax >> 2) + 4;   /* Increase block array size by 25% as long as it does not fit */
+
+        if (blokmax < bloknum) {
+          errorPrint ("symbolFaxGraphCblk: integer overflow");
+          return (1);
+        }
+      } while (((byte *) (bloktax + bloknum) + tlndoft) >
+               ((byte *) (bloktax + blokmax)));
+
+      if ((bloktmp = (SymbolBlok *) memRealloc (bloktax + baseval, (blokmax * sizeof (SymbolBlok)))) == NULL) {
+        errorPrint ("symbolFaxGraphCblk: out of memory");
+        return (1);
+      }
+      bloktax = bloktmp - baseval;
+      areaptr->bloktax = bloktax;                 /* Area may hold blocks of contributing column blocks */
+      areaptr->blokmax = blokmax;
+    }
+
+    hashtab = (INT *)           (bloktax + bloknum);
+    sorttab = (INT *)           ((byte *) hashtab + sortoft);
+    tloktab = (SymbolFaxTlok *) ((byte *) hashtab + tlokoft);
+
+    memset (hashtab, ~0, hashsiz * sizeof (INT)); /* Initialize hash table */
+  }
+
+  sortnbr = 0;                                    /* No vertices yet                 */
+  for (colnum = rangtax[cblknum]; colnum < colmax; colnum ++) { /* For all columns */
+    INT                 vertnum;
+    INT                 edgenum;
+
+    vertnum = peritax[colnum];                    /* Get associated vertex    */
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) { /* For all adjacent edges */
+      INT                 hashnum;
+
+      colend = permtax[edgetax[edgenum]];         /* Get end column number */
+      if (colend < colmax)                        /* If end vertex number in left columns */
+        continue;                                 /* Skip to next neighbor                */
+
+      for (hashnum = (colend * SYMBOL_FAX_HASHPRIME) & hashmsk; ; /* Search end column in hash table */
+           hashnum = (hashnum + 1) & hashmsk) {
+        INT *               hashptr;
+
+        hashptr = hashtab + hashnum;              /* Point to hash slot           */
+        if (*hashptr == colend)                   /* If end column in hash table  */
+          break;                                  /* Skip to next end column      */
+        if (*hashptr == ~0) {                     /* If slot is empty             */
+          *hashptr = colend;                      /* Set column in hash table     */
+          sorttab[sortnbr ++] = colend;           /* Add end column to sort array */
+          break;
+        }
+      }
+    }                                             /* End of loop on neighbors */
+  }                                               /* End of loop on columns   */
+
+  intSort1asc1 (sorttab, sortnbr);                /* Sort neighbor array */
+
+  cblkctr = cblknum;
+  if (ctrbtax[cblknum] == ~0) {                   /* If column is not to be updated */
+    INT                 sortnum;
+
+    bloktax[bloknum].frownum = cblktax[cblknum].fcolnum; /* Build diagonal block */
+    bloktax[bloknum].lrownum = cblktax[cblknum].lcolnum;
+    bloktax[bloknum].cblknum = cblknum;
+#ifdef SYMBOL_HAS_LEVFVAL
+    bloktax[bloknum].levfval = 0;
+#endif /* SYMBOL_HAS_LEVFVAL */
+    bloknum ++;
+
+    for (sortnum = 0; sortnum < sortnbr; ) {      /* For all entries in sorted array */
+      colend = sorttab[sortnum];
+      if (colend >= rangtax[cblkctr + 1]) {       /* If column block number to be found */
+        INT                 cblktmm;              /* Median value                       */
+        INT                 cblktmx;              /* Maximum value                      */
+
+        for (cblkctr ++,                          /* Find new column block by dichotomy */
+             cblktmx = cblknnd;
+             cblktmx - cblkctr > 1; ) {
+          cblktmm = (cblktmx + cblkctr) >> 1;
+          if (rangtax[cblktmm] <= colend)
+            cblkctr = cblktmm;
+          else
+            cblktmx = cblktmm;
+        }
+      }
+
+      bloktax[bloknum].frownum = colend;          /* Set beginning of new block */
+      while ((++ sortnum < sortnbr) &&            /* Scan extent of block       */
+             (sorttab[sortnum] - 1 == sorttab[sortnum - 1]) &&
+             (sorttab[sortnum] < rangtax[cblkctr + 1])) ;
+      bloktax[bloknum].lrownum = sorttab[sortnum - 1]; /* Set end of block */
+      bloktax[bloknum].cblknum = cblkctr;
+#ifdef SYMBOL_HAS_LEVFVAL
+      bloktax[bloknum].levfval = 0;
+#endif /* SYMBOL_HAS_LEVFVAL */
+      bloknum ++;                                 /* One more block */
+    }
+  }
+  else {                                          /* Column will be updated             */
+    INT                 sortnum;                  /* Current index in sort array        */
+    INT                 tloknum;                  /* Current index on temporary block   */
+    INT                 tlokfre;                  /* Index of first free chained block  */
+    INT                 tlokfrm;                  /* Index of next free unchained block */
+#ifdef FAX_DEBUG
+    INT                 tlokmax;                  /* Maximum index of reserved space    */
+#endif /* FAX_DEBUG */
+
+    tloktab->frownum = cblktax[cblknum].fcolnum;  /* Build diagonal chained block */
+    tloktab->lrownum = cblktax[cblknum].lcolnum;
+    tloktab->cblknum = cblknum;
+    tloktab->nextnum = 1;
+
+    tloknum = 1;                                  /* Prepare for extra-diagonal blocks */
+    for (sortnum = 0; sortnum < sortnbr; ) {      /* For all entries in sorted array   */
+      colend = sorttab[sortnum];
+      if (colend >= rangtax[cblkctr + 1]) {       /* If column block number to be found */
+        INT                 cblktmm;              /* Median value                       */
+        INT                 cblktmx;              /* Maximum value                      */
+
+        for (cblkctr ++,                          /* Find new column block by dichotomy */
+             cblktmx = cblknnd;
+             cblktmx - cblkctr > 1; ) {
+          cblktmm = (cblktmx + cblkctr) >> 1;
+          if (rangtax[cblktmm] <= colend)
+            cblkctr = cblktmm;
+          else
+            cblktmx = cblktmm;
+        }
+      }
+      tloktab[tloknum].frownum = colend;          /* Set beginning of new block */
+      while ((++ sortnum < sortnbr) &&            /* Scan extent of block       */
+             (sorttab[sortnum] - 1 == sorttab[sortnum - 1]) &&
+             (sorttab[sortnum] < rangtax[cblkctr + 1])) ;
+      tloktab[tloknum].lrownum = sorttab[sortnum - 1]; /* Set end of block */
+      tloktab[tloknum].cblknum = cblkctr;
+      tloktab[tloknum].nextnum = tloknum + 1;     /* Chain block */
+      tloknum ++;
+    }
+    tloktab[tloknum].frownum =                    /* Build trailing block */
+    tloktab[tloknum].lrownum = vertnbr + baseval;
+    tloktab[tloknum].cblknum = cblknnd;
+    tloktab[tloknum].nextnum = 0;                 /* Set end of chain (never chain to diagonal block) */
+
+    tlokfre = ~0;                                 /* Chain of free blocks is empty          */
+    tlokfrm = tloknum + 1;                        /* First allocatable unchained free block */
+#ifdef FAX_DEBUG
+    tlokmax = tlokfrm + ctrbsum;                  /* Index after end of array */
+#endif /* FAX_DEBUG */
+
+    for (cblkctr = ctrbtax[cblknum]; cblkctr != ~0; cblkctr = ctrbtax[cblkctr]) { /* Follow chain */
+      const SymbolBlok * restrict ctrbtax2;       /* Block array of area of contributing column block */
+      INT                 blokctr;                /* Current index of contributing column block       */
+      INT                 tloklst;                /* Index of previous temporary block                */
+
+      ctrbtax2 = dataptr->areatab[(ownrtax[cblkctr] < 0) ? 0 : ownrtax[cblkctr]].bloktax;
+      tloklst  = 0;                               /* Previous is diagonal block */
+      tloknum  = 0;                               /* Current is diagonal block  */
+
+      for (blokctr = cblktax[cblkctr].bloknum + 2; /* For all blocks in contributing column block */
+           blokctr < bnndtax[cblkctr]; blokctr ++) {
+        while ((tloktab[tloknum].cblknum < ctrbtax2[blokctr].cblknum) || /* Skip unmatched chained blocks */
+               (tloktab[tloknum].lrownum < ctrbtax2[blokctr].frownum - 1)) {
+          tloklst = tloknum;
+          tloknum = tloktab[tloknum].nextnum;
+        }
+
+        if ((ctrbtax2[blokctr].cblknum < tloktab[tloknum].cblknum) || /* If contributing block has no mate */
+            (ctrbtax2[blokctr].lrownum < tloktab[tloknum].frownum - 1)) {
+          INT                 tloktmp;
+
+          if (tlokfre == ~0) {                    /* If no available chained free block */
+#ifdef FAX_DEBUG
+            if (tlokfrm >= tlokmax) {
+              errorPrint ("symbolFaxGraphCblk: internal error (1)");
+              return (1);
+            }
+#endif /* FAX_DEBUG */
+            tlokfre = tlokfrm ++;                 /* New free block is first unchained block */
+            tloktab[tlokfre].nextnum = ~0;        /* Make it the end of its own pseudo-chain */
+          }
+          tloktmp                  =
+          tloktab[tloklst].nextnum = tlokfre;     /* Chain new block                */
+          tloktab[tlokfre].frownum = ctrbtax2[blokctr].frownum; /* Copy block data */
+          tloktab[tlokfre].lrownum = ctrbtax2[blokctr].lrownum;
+          tloktab[tlokfre].cblknum = ctrbtax2[blokctr].cblknum;
+          tlokfre                  = tloktab[tlokfre].nextnum;
+          tloktab[tloktmp].nextnum = tloknum;     /* Complete chainimg                    */
+          tloknum                  = tloktab[tloklst].nextnum; /* Resume from new block */
+          continue;                               /* Process next block                   */
+        }
+
+        if ((ctrbtax2[blokctr].lrownum >= tloktab[tloknum].frownum - 1) && /* Update chained block lower bound */
+            (ctrbtax2[blokctr].frownum <  tloktab[tloknum].frownum))
+          tloktab[tloknum].frownum = ctrbtax2[blokctr].frownum;
+
+        if ((ctrbtax2[blokctr].frownum <= tloktab[tloknum].lrownum + 1) && /* Update chained block upper bound */
+            (ctrbtax2[blokctr].lrownum >  tloktab[tloknum].lrownum)) {
+          INT                 tloktmp;
+
+          tloktab[tloknum].lrownum = ctrbtax2[blokctr].lrownum;
+
+          for (tloktmp = tloktab[tloknum].nextnum; /* Aggregate following chained blocks */
+               (tloktab[tloktmp].cblknum == tloktab[tloknum].cblknum) &&
+               (tloktab[tloktmp].frownum <= tloktab[tloknum].lrownum + 1);
+               tloktmp = tloktab[tloknum].nextnum) {
+            if (tloktab[tloktmp].lrownum > tloktab[tloknum].lrownum) /* Merge aggregated block */
+              tloktab[tloknum].lrownum = tloktab[tloktmp].lrownum;
+            tloktab[tloknum].nextnum = tloktab[tloktmp].nextnum; /* Unlink aggregated block */
+            tloktab[tloktmp].nextnum = tlokfre;
+            tlokfre                  = tloktmp;
+          }
+        }
+      }
+    }
+
+    for (tloknum = 0;                             /* For all chained blocks                    */
+         tloktab[tloknum].nextnum != 0;           /* Until trailer block is reached            */
+         tloknum = tloktab[tloknum].nextnum, bloknum ++) { /* Copy block data to block array */
+      bloktax[bloknum].frownum = tloktab[tloknum].frownum;
+      bloktax[bloknum].lrownum = tloktab[tloknum].lrownum;
+      bloktax[bloknum].cblknum = tloktab[tloknum].cblknum;
+#ifdef SYMBOL_HAS_LEVFVAL
+      bloktax[bloknum].levfval = 0;
+#endif /* SYMBOL_HAS_LEVFVAL */
+    }
+  }
+  bnndtax[cblknum] = bloknum;                     /* Set end of block range of column block */
+  areaptr->bloknum = bloknum;
+
+  if ((bloknum - cblktax[cblknum].bloknum) > 2) { /* If more than one extra-diagonal blocks exist */
+    INT                 cblkfat;                  /* Father column block                          */
+
+    cblkfat = bloktax[cblktax[cblknum].bloknum + 1].cblknum;
+    if (ownrtax[cblkfat] == ownrtax[cblknum]) {   /* If father belongs to same area, link contributing column blocks now */
+      ctrbtax[cblknum] = ctrbtax[cblkfat];
+      ctrbtax[cblkfat] = cblknum;
+    }
+  }
+
+  return (0);
+}
+
+/*+ This routine is the threaded core of the
+*** symbolic factorization. Every thread first
+*** processes the independent subtrees it has
+*** been assigned, after which the first thread
+*** processes the top of the column block tree.
+*** Blocks are then copied concurrently in the
+*** final block array.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+static
+void
+symbolFaxGraph3 (
+ThreadDescriptor * const    descptr,
+SymbolFaxGraphData * const  dataptr)
+{
+  INT                       cblknum;
+  INT                       cblkbas;
+  INT                       cblknnd;
+
+  const INT                         baseval = dataptr->baseval;
+  const INT                         cblknbr = dataptr->cblknbr;
+  SymbolCblk * restrict const       cblktax = dataptr->cblktax;
+  const INT * restrict const        bnndtax = dataptr->bnndtax;
+  INT * restrict const              ctrbtax = dataptr->ctrbtax;
+  const INT * restrict const        ownrtax = dataptr->ownrtax;
+  SymbolFaxGraphArea * restrict const areatab = dataptr->areatab;
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+
+  for (cblknum = baseval; cblknum < (cblknbr + baseval); cblknum ++) { /* Process subtrees of area by ascending column block number */
+    if ((ownrtax[cblknum] == thrdnum) &&
+        (symbolFaxGraphCblk (dataptr, &areatab[thrdnum], cblknum) != 0)) {
+      areatab[thrdnum].retuval = 1;
+      break;
+    }
+  }
+
+  threadBarrier (descptr);                        /* All subtrees must have been processed */
+
+  if (thrdnum == 0) {                             /* First thread processes top of tree */
+    int                 areanum;
+    int                 o;
+
+    for (areanum = 0, o = 0; areanum < thrdnbr; areanum ++)
+      o |= areatab[areanum].retuval;
+
+    if (o == 0) {
+      for (cblknum = baseval; cblknum < (cblknbr + baseval); cblknum ++) { /* Link subtree roots to top of tree */
+        const SymbolBlok * restrict bloktax;
+        INT                         cblkfat;
+
+        if ((ownrtax[cblknum] < 0) ||             /* If column block in top of tree or has no contribution */
+            ((bnndtax[cblknum] - cblktax[cblknum].bloknum) <= 2))
+          continue;
+
+        bloktax = areatab[ownrtax[cblknum]].bloktax;
+        cblkfat = bloktax[cblktax[cblknum].bloknum + 1].cblknum;
+        if (ownrtax[cblkfat] == ownrtax[cblknum]) /* If already linked within area */
+          continue;
+#ifdef FAX_DEBUG
+        if (ownrtax[cblkfat] >= 0) {
+          errorPrint ("symbolFaxGraph3: internal error");
+          o = 1;
+          break;
+        }
+#endif /* FAX_DEBUG */
+        ctrbtax[cblknum] = ctrbtax[cblkfat];
+        ctrbtax[cblkfat] = cblknum;
+      }
+    }
+
+    if (o == 0) {
+      for (cblknum = baseval; cblknum < (cblknbr + baseval); cblknum ++) { /* Process top of tree in area of first thread */
+        if ((ownrtax[cblknum] < 0) &&
+            (symbolFaxGraphCblk (dataptr, &areatab[0], cblknum) != 0)) {
+          o = 1;
+          break;
+        }
+      }
+    }
+
+    if (o == 0) {
+      INT                 bloknum;
+
+      for (cblknum = baseval, bloknum = baseval; cblknum < (cblknbr + baseval); cblknum ++) { /* Compute global block indices */
+        ctrbtax[cblknum] = bloknum;
+        bloknum += bnndtax[cblknum] - cblktax[cblknum].bloknum;
+      }
+      dataptr->bloknbr = bloknum - baseval;
+
+      if ((dataptr->bloktab = (SymbolBlok *) memAlloc (dataptr->bloknbr * sizeof (SymbolBlok))) == NULL) {
+        errorPrint ("symbolFaxGraph3: out of memory");
+        o = 1;
+      }
+    }
+
+    dataptr->retuval = o;
+  }
+
+  threadBarrier (descptr);                        /* Final block array must have been allocated */
+
+  if (dataptr->retuval != 0)
+    return;
+
+  cblkbas = baseval + DATASCAN (cblknbr, thrdnbr, thrdnum);
+  cblknnd = baseval + DATASCAN (cblknbr, thrdnbr, thrdnum + 1);
+  for (cblknum = cblkbas; cblknum < cblknnd; cblknum ++) { /* Copy blocks of column blocks in final block array */
+    memCpy (dataptr->bloktab + (ctrbtax[cblknum] - baseval),
+            areatab[(ownrtax[cblknum] < 0) ? 0 : ownrtax[cblknum]].bloktax + cblktax[cblknum].bloknum,
+            (bnndtax[cblknum] - cblktax[cblknum].bloknum) * sizeof (SymbolBlok));
+    cblktax[cblknum].bloknum = ctrbtax[cblknum];
+  }
+}
+
+/*+ This routine computes the block symbolic
+*** factorization of the given matrix graph
+*** according to the given vertex ordering,
+*** by means of the threads of the given
+*** context. The elimination tree of column
+*** blocks is first computed on the quotient
+*** graph of column blocks; the father of every
+*** column block is the one of its first extra-
+*** diagonal block. Independent subtrees are then
+*** assigned to threads by decreasing load.
+*** As the blocks of every column block only
+*** depend on the ones of its descendants, the
+*** resulting matrix is identical to the one
+*** computed by the sequential routine.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+static
+int
+symbolFaxGraph2 (
+SymbolMatrix * const        symbptr,              /*+ Symbolic block matrix [based]  +*/
+const INT                   baseval,              /*+ Base value                     +*/
+const INT                   vertnbr,              /*+ Number of vertices             +*/
+const INT                   edgenbr,              /*+ Number of edges                +*/
+const INT * const           verttax,              /*+ Based graph adjacency arrays   +*/
+const INT * const           vendtax,
+const INT * const           edgetax,
+const Order * const         ordeptr,              /*+ Matrix ordering                +*/
+Context * const             contptr)              /*+ Execution context              +*/
+{
+  SymbolFaxGraphData        datadat;
+  SymbolCblk *              cblktab;
+  INT *                     ctrbtab;
+  INT *                     bnndtab;
+  INT *                     ownrtab;
+  INT *                     treetab;
+  INT * restrict            colctax;              /* Column block index of every column     */
+  INT * restrict            ancetax;              /* Ancestor array for path compression    */
+  INT * restrict            sorttab;              /* Sort array of subtree roots            */
+  INT                       sortnbr;
+  INT                       sortnum;
+  INT                       subtsum;              /* Sum of loads of all subtrees           */
+  INT                       subtmax;              /* Maximum load of an independent subtree */
+  INT                       colnum;
+  INT                       cblknum;
+  INT                       blokavg;              /* Average number of blocks per column block */
+  int                       areanum;
+
+  const INT                 cblknbr = ordeptr->cblknbr;
+  const INT                 cblknnd = cblknbr + baseval;
+  const INT                 vertnnd = vertnbr + baseval;
+  const INT * restrict const permtax = ordeptr->permtab - baseval;
+  const INT * restrict const peritax = ordeptr->peritab - baseval;
+  const INT * restrict const rangtax = ordeptr->rangtab - baseval;
+  const int                 thrdnbr = contextThreadNbr (contptr);
+
+  if ((cblktab = (SymbolCblk *) memAlloc ((cblknbr + 1) * sizeof (SymbolCblk))) == NULL) {
+    errorPrint ("symbolFaxGraph2: out of memory (1)");
+    return (1);
+  }
+  if (memAllocGroup ((void **) (void *)
+                     &ctrbtab,         (size_t) (cblknbr * sizeof (INT)),
+                     &bnndtab,         (size_t) (cblknbr * sizeof (INT)),
+                     &ownrtab,         (size_t) (cblknbr * sizeof (INT)),
+                     &treetab,         (size_t) (cblknbr * sizeof (INT)),
+                     &datadat.areatab, (size_t) (thrdnbr * sizeof (SymbolFaxGraphArea)), NULL) == NULL) {
+    errorPrint ("symbolFaxGraph2: out of memory (2)");
+    memFree    (cblktab);
+    return (1);
+  }
+  if (memAllocGroup ((void **) (void *)
+                     &sorttab, (size_t) (cblknbr * 2 * sizeof (INT)),
+                     &ancetax, (size_t) (cblknbr     * sizeof (INT)),
+                     &colctax, (size_t) (vertnbr     * sizeof (INT)), NULL) == NULL) {
+    errorPrint ("symbolFaxGraph2: out of memory (3)");
+    memFree    (ctrbtab);
+    memFree    (cblktab);
+    return (1);
+  }
+  ancetax -= baseval;
+  colctax -= baseval;
+
+  datadat.baseval = baseval;
+  datadat.vertnbr = vertnbr;
+  datadat.cblknbr = cblknbr;
+  datadat.verttax = verttax;
+  datadat.vendtax = vendtax;
+  datadat.edgetax = edgetax;
+  datadat.permtax = permtax;
+  datadat.peritax = peritax;
+  datadat.rangtax = rangtax;
+  datadat.cblktax = cblktab - baseval;
+  datadat.ctrbtax = ctrbtab - baseval;
+  datadat.bnndtax = bnndtab - baseval;
+  datadat.ownrtax = ownrtab - baseval;
+  datadat.treetax = treetab - baseval;
+  datadat.bloktab = NULL;
+  datadat.retuval = 0;
+
+  for (cblknum = baseval; cblknum < cblknnd; cblknum ++) { /* Compute column block index of every column */
+    for (colnum = rangtax[cblknum]; colnum < rangtax[cblknum + 1]; colnum ++)
+      colctax[colnum] = cblknum;
+  }
+
+  for (cblknum = baseval; cblknum < cblknnd; cblknum ++) { /* Compute elimination tree of column blocks */
+    INT                 loadval;
+
+    datadat.treetax[cblknum] =
+    ancetax[cblknum]         = ~0;
+    for (colnum = rangtax[cblknum], loadval = rangtax[cblknum + 1] - colnum;
+         colnum < rangtax[cblknum + 1]; colnum ++) {
+      INT                 vertnum;
+      INT                 edgenum;
+
+      vertnum  = peritax[colnum];
+      loadval += vendtax[vertnum] - verttax[vertnum];
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+        INT                 cblkend;
+
+        for (cblkend = colctax[permtax[edgetax[edgenum]]]; cblkend < cblknum; ) { /* Follow ancestors with path compression */
+          INT                 cblknxt;
+
+          cblknxt = ancetax[cblkend];
+          ancetax[cblkend] = cblknum;
+          if (cblknxt == ~0) {                    /* If root of subtree reached, link it */
+            datadat.treetax[cblkend] = cblknum;
+            break;
+          }
+          cblkend = cblknxt;
+        }
+      }
+    }
+    datadat.bnndtax[cblknum] = loadval;           /* TRICK: end index array first holds subtree loads */
+  }
+  subtsum = 0;
+  for (cblknum = baseval; cblknum < cblknnd; cblknum ++) { /* Accumulate subtree loads; fathers have higher numbers */
+    if (datadat.treetax[cblknum] == ~0)
+      subtsum += datadat.bnndtax[cblknum];
+    else
+      datadat.bnndtax[datadat.treetax[cblknum]] += datadat.bnndtax[cblknum];
+  }
+
+  subtmax = subtsum / (thrdnbr * SYMBOL_FAX_GRAPH_SUBTRAT); /* Maximum load of independent subtrees */
+  for (cblknum = baseval, sortnbr = 0; cblknum < cblknnd; cblknum ++) {
+    datadat.ownrtax[cblknum] = -1;                /* Column block belongs to top of tree by default */
+    if ((datadat.bnndtax[cblknum] <= subtmax) &&  /* If column block is root of independent subtree */
+        ((datadat.treetax[cblknum] == ~0) || (datadat.bnndtax[datadat.treetax[cblknum]] > subtmax))) {
+      sorttab[2 * sortnbr]     = - datadat.bnndtax[cblknum]; /* Sort subtrees by decreasing load */
+      sorttab[2 * sortnbr + 1] = cblknum;
+      sortnbr ++;
+    }
+  }
+  intSort2asc2 (sorttab, sortnbr);
+
+  for (areanum = 0; areanum < thrdnbr; areanum ++) {
+    datadat.areatab[areanum].loadval = 0;
+    datadat.areatab[areanum].blokmax = 0;         /* Count column blocks of area */
+  }
+  for (sortnum = 0; sortnum < sortnbr; sortnum ++) { /* Assign every subtree to least loaded area */
+    int                 areamin;
+
+    for (areanum = 1, areamin = 0; areanum < thrdnbr; areanum ++) {
+      if (datadat.areatab[areanum].loadval < datadat.areatab[areamin].loadval)
+        areamin = areanum;
+    }
+    datadat.ownrtax[sorttab[2 * sortnum + 1]] = areamin;
+    datadat.areatab[areamin].loadval -= sorttab[2 * sortnum];
+  }
+  for (cblknum = cblknnd - 1; cblknum >= baseval; cblknum --) { /* Propagate areas down subtrees */
+    if ((datadat.ownrtax[cblknum] < 0) &&
+        (datadat.bnndtax[cblknum] <= subtmax))
+      datadat.ownrtax[cblknum] = datadat.ownrtax[datadat.treetax[cblknum]];
+    datadat.areatab[(datadat.ownrtax[cblknum] < 0) ? 0 : datadat.ownrtax[cblknum]].blokmax ++;
+  }
+
+  memFree (sorttab);                              /* Free group leader of temporary arrays */
+  memSet  (ctrbtab, ~0, cblknbr * sizeof (INT));  /* Initialize column block contributions link array */
+
+  blokavg = 2 + edgenbr / vertnbr;
+  for (areanum = 0; areanum < thrdnbr; areanum ++) { /* Allocate block areas with estimated sizes */
+    SymbolFaxGraphArea * restrict areaptr;
+    SymbolBlok *                  bloktab;
+
+    areaptr = &datadat.areatab[areanum];
+    areaptr->blokmax = areaptr->blokmax * blokavg + 2;
+    areaptr->bloknum = baseval;
+    areaptr->retuval = 0;
+    if ((bloktab = (SymbolBlok *) memAlloc (areaptr->blokmax * sizeof (SymbolBlok))) == NULL) {
+      errorPrint ("symbolFaxGraph2: out of memory (4)");
+      while (-- areanum >= 0)
+        memFree (datadat.areatab[areanum].bloktax + baseval);
+      memFree (ctrbtab);
+      memFree (cblktab);
+      return (1);
+    }
+    areaptr->bloktax = bloktab - baseval;
+  }
+
+  contextThreadLaunch (contptr, (ThreadFunc) symbolFaxGraph3, (void *) &datadat);
+
+  for (areanum = 0; areanum < thrdnbr; areanum ++)
+    memFree (datadat.areatab[areanum].bloktax + baseval);
+  memFree (ctrbtab);                              /* Free group leader */
+
+  if (datadat.retuval != 0) {
+    if (datadat.bloktab != NULL)
+      memFree (datadat.bloktab);
+    memFree (cblktab);
+    return (1);
+  }
+
+  datadat.cblktax[cblknnd].fcolnum =              /* Set last column block data */
+  datadat.cblktax[cblknnd].lcolnum = vertnnd;
+  datadat.cblktax[cblknnd].bloknum = datadat.bloknbr + baseval;
+
+  symbptr->baseval = baseval;                     /* Fill in matrix fields */
+  symbptr->cblknbr = cblknbr;
+  symbptr->bloknbr = datadat.bloknbr;
+  symbptr->cblktab = cblktab;
+  symbptr->bloktab = datadat.bloktab;
+  symbptr->nodenbr = vertnbr;
+
+#ifdef FAX_DEBUG
+  if (symbolCheck (symbptr) != 0) {
+    errorPrint ("symbolFaxGraph2: internal error");
+    symbolExit (symbptr);
+    return (1);
+  }
+#endif /* FAX_DEBUG */
+
+  return (0);
+}
 
 /***********************************/
 /*                                 */
@@ -90,6 +785,9 @@
 /*+ This routine computes the block symbolic
 *** factorization of the given matrix graph
 *** according to the given vertex ordering.
+*** When the given context holds several
+*** threads, the multi-threaded routine is
+*** used.
 *** It returns:
 *** - 0   : on success.
 *** - !0  : on error.
@@ -99,7 +797,8 @@ int
 symbolFaxGraph (
 SymbolMatrix * const        symbptr,              /*+ Symbolic block matrix [based]      +*/
 const Graph * const         grafptr,              /*+ Matrix adjacency structure [based] +*/
-const Order * const         ordeptr)              /*+ Matrix ordering                    +*/
+const Order * const         ordeptr,              /*+ Matrix ordering                    +*/
+Context * const             contptr)              /*+ Execution context, or NULL         +*/
 {
   INT                   baseval;
   INT                   vertnbr;
@@ -113,6 +812,10 @@ const Order * const         ordeptr)              /*+ Matrix ordering
   const INT * restrict  edgetax;
 
   SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, &edgenbr, &edgetab, NULL);
+
+  if ((contptr != NULL) && (contextThreadNbr (contptr) > 1) && (vertnbr > 0)) /* If several threads available */
+    return (symbolFaxGraph2 (symbptr, baseval, vertnbr, edgenbr, verttab - baseval, vendtab - baseval, edgetab - baseval, ordeptr, contptr));
+
   verttax = verttab - baseval;
   vendtax = vendtab - baseval;
   edgetax = edgetab - baseval;
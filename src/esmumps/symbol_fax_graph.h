@@ -0,0 +1,106 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : symbol_fax_graph.h                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : Part of a parallel direct block solver. **/
+/**                These lines are the data declarations   **/
+/**                for the multi-threaded symbolic         **/
+/**                factorization routine for graphs.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Ratio between the number of independent
+    subtrees and the number of threads.      +*/
+
+#define SYMBOL_FAX_GRAPH_SUBTRAT    4
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The block area structure. Every thread
+    computes the blocks of the column blocks
+    it is in charge of in its own block area. +*/
+
+typedef struct SymbolFaxGraphArea_ {
+  SymbolBlok *              bloktax;              /*+ Based access to block array     +*/
+  INT                       bloknum;              /*+ Based number of first free slot +*/
+  INT                       blokmax;              /*+ Size of block array             +*/
+  INT                       loadval;              /*+ Load of subtrees of area        +*/
+  int                       retuval;              /*+ Return value of thread          +*/
+} SymbolFaxGraphArea;
+
+/*+ The thread-independent data block. +*/
+
+typedef struct SymbolFaxGraphData_ {
+  INT                       baseval;              /*+ Base value                                     +*/
+  INT                       vertnbr;              /*+ Number of vertices                             +*/
+  INT                       cblknbr;              /*+ Number of column blocks                        +*/
+  const INT *               verttax;              /*+ Based access to graph adjacency arrays         +*/
+  const INT *               vendtax;
+  const INT *               edgetax;
+  const INT *               permtax;              /*+ Based access to direct permutation array       +*/
+  const INT *               peritax;              /*+ Based access to inverse permutation array      +*/
+  const INT *               rangtax;              /*+ Based access to column block range array       +*/
+  SymbolCblk *              cblktax;              /*+ Column block array; holds local start indices  +*/
+  INT *                     bnndtax;              /*+ Local end indices of column block blocks       +*/
+  INT *                     ctrbtax;              /*+ Contribution chains; then global start indices +*/
+  INT *                     ownrtax;              /*+ Area of column block; -1 for top of tree       +*/
+  INT *                     treetax;              /*+ Father column block; ~0 for roots              +*/
+  SymbolFaxGraphArea *      areatab;              /*+ Array of block areas                           +*/
+  SymbolBlok *              bloktab;              /*+ Final block array                              +*/
+  INT                       bloknbr;              /*+ Number of blocks                               +*/
+  int                       retuval;              /*+ Return value                                   +*/
+} SymbolFaxGraphData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef ESMUMPS_SYMBOL_FAX_GRAPH
+
+static int                  symbolFaxGraphCblk  (SymbolFaxGraphData * const dataptr, SymbolFaxGraphArea * const areaptr, const INT cblknum);
+static void                 symbolFaxGraph3     (ThreadDescriptor * const descptr, SymbolFaxGraphData * const dataptr);
+static int                  symbolFaxGraph2     (SymbolMatrix * const symbptr, const INT baseval, const INT vertnbr, const INT edgenbr, const INT * const verttax, const INT * const vendtax, const INT * const edgetax, const Order * const ordeptr, Context * const contptr);
+
+#endif /* ESMUMPS_SYMBOL_FAX_GRAPH */
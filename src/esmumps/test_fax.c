@@ -1,4 +1,4 @@
-/* Copyright 2022 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2022,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                symbolic factorization routine.         **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 21 apr 2022     **/
-/**                                 to   : 11 dec 2022     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -47,6 +47,8 @@
 **  The defines and includes.
 */
 
+#define TEST_FAX_THREADNBR          4             /* Number of threads of multi-threaded factorization */
+
 #include "module.h"
 #include "common.h"
 #include "scotch.h"
@@ -56,6 +58,57 @@
 #include "symbol.h"
 #include "fax.h"
 
+/*****************************/
+/*                           */
+/* The comparison routine.   */
+/*                           */
+/*****************************/
+
+/*+ This routine checks that the two given
+*** symbolic block matrices are identical.
+*** It returns:
+*** - 0   : if matrices are identical.
+*** - !0  : on error.
++*/
+
+static
+int
+symbolCompare (
+const SymbolMatrix * const  symbptr,
+const SymbolMatrix * const  symbptr2)
+{
+  INT                 cblknum;
+  INT                 bloknum;
+
+  if ((symbptr->baseval != symbptr2->baseval) ||
+      (symbptr->cblknbr != symbptr2->cblknbr) ||
+      (symbptr->bloknbr != symbptr2->bloknbr) ||
+      (symbptr->nodenbr != symbptr2->nodenbr)) {
+    errorPrint ("symbolCompare: sizes do not match");
+    return     (1);
+  }
+
+  for (cblknum = 0; cblknum <= symbptr->cblknbr; cblknum ++) { /* Also compare end marker of column block array */
+    if ((symbptr->cblktab[cblknum].fcolnum != symbptr2->cblktab[cblknum].fcolnum) ||
+        (symbptr->cblktab[cblknum].lcolnum != symbptr2->cblktab[cblknum].lcolnum) ||
+        (symbptr->cblktab[cblknum].bloknum != symbptr2->cblktab[cblknum].bloknum)) {
+      errorPrint ("symbolCompare: column blocks do not match");
+      return     (1);
+    }
+  }
+
+  for (bloknum = 0; bloknum < symbptr->bloknbr; bloknum ++) {
+    if ((symbptr->bloktab[bloknum].frownum != symbptr2->bloktab[bloknum].frownum) ||
+        (symbptr->bloktab[bloknum].lrownum != symbptr2->bloktab[bloknum].lrownum) ||
+        (symbptr->bloktab[bloknum].cblknum != symbptr2->bloktab[bloknum].cblknum)) {
+      errorPrint ("symbolCompare: blocks do not match");
+      return     (1);
+    }
+  }
+
+  return (0);
+}
+
 /******************************/
 /*                            */
 /* This is the main function. */
@@ -70,13 +123,15 @@ char *              argv[];
   Graph               grafdat;                    /* Graph to load */
   Order               ordedat;
   SymbolMatrix        symbdat;
+  SymbolMatrix        symbdat2;                   /* Matrix computed by multi-threaded factorization */
+  SCOTCH_Context      contdat;
   Dof                 deofdat;
   FILE *              stream;
   double              nonzval;
   double              opcoval;
 
-  if (argc != 3) {
-    errorPrint ("test_fax: usage: test_fax graph_file ordering_file");
+  if ((argc < 2) || (argc > 3)) {
+    errorPrint ("test_fax: usage: test_fax graph_file [ordering_file]");
     exit       (EXIT_FAILURE);
   }
 
@@ -94,25 +149,49 @@ char *              argv[];
   fclose (stream);
 
   orderInit (&ordedat);
-  if ((stream = fopen (argv[2], "r")) == NULL) {
-    errorPrint ("test_fax: cannot open ordering file");
-    orderExit  (&ordedat);
-    graphExit  (&grafdat);
-    exit       (EXIT_FAILURE);
+  if (argc > 2) {                                 /* If ordering file provided */
+    if ((stream = fopen (argv[2], "r")) == NULL) {
+      errorPrint ("test_fax: cannot open ordering file");
+      orderExit  (&ordedat);
+      graphExit  (&grafdat);
+      exit       (EXIT_FAILURE);
+    }
+    if (orderLoad (&ordedat, stream) != 0) {
+      errorPrint ("test_fax: cannot open ordering file");
+      orderExit  (&ordedat);
+      graphExit  (&grafdat);
+      exit       (EXIT_FAILURE);
+    }
+    fclose (stream);
   }
-  if (orderLoad (&ordedat, stream) != 0) {
-    errorPrint ("test_fax: cannot open ordering file");
-    orderExit  (&ordedat);
-    graphExit  (&grafdat);
-    exit       (EXIT_FAILURE);
+  else {                                          /* Else compute ordering */
+    if (orderGraph (&ordedat, &grafdat) != 0) {
+      errorPrint ("test_fax: cannot compute ordering");
+      orderExit  (&ordedat);
+      graphExit  (&grafdat);
+      exit       (EXIT_FAILURE);
+    }
   }
-  fclose (stream);
 
   symbolInit (&symbdat);
-  if (symbolFaxGraph (&symbdat, &grafdat, &ordedat) != 0) {
-    errorPrint ("test_fax: error in symbolic factorization");
+  if (symbolFaxGraph (&symbdat, &grafdat, &ordedat, NULL) != 0) {
+    errorPrint ("test_fax: error in symbolic factorization (1)");
+    exit       (EXIT_FAILURE);
+  }
+
+  SCOTCH_contextInit        (&contdat);           /* Multi-threaded factorization must yield same matrix */
+  SCOTCH_contextThreadSpawn (&contdat, TEST_FAX_THREADNBR, NULL);
+  symbolInit (&symbdat2);
+  if (symbolFaxGraph (&symbdat2, &grafdat, &ordedat, (Context *) &contdat) != 0) {
+    errorPrint ("test_fax: error in symbolic factorization (2)");
+    exit       (EXIT_FAILURE);
+  }
+  if (symbolCompare (&symbdat, &symbdat2) != 0) {
+    errorPrint ("test_fax: sequential and multi-threaded factorizations differ");
     exit       (EXIT_FAILURE);
   }
+  symbolExit         (&symbdat2);
+  SCOTCH_contextExit (&contdat);
 
   dofInit  (&deofdat);
   dofGraph (&deofdat, &grafdat, 1, ordedat.peritab);
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2010,2011,2013,2014,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2010,2011,2013,2014,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 27 dec 2007     **/
 /**                                 to   : 31 aug 2014     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -145,6 +145,7 @@ const BdgraphBipartSqParam * const  paraptr)      /*+ Method parameters +*/
   Gnum              complocsize1;
   Gnum              complocload1;
   Gnum              fronlocnbr;
+  Context           contdat;                      /* Threaded clone of execution context                 */
   int               o;
 
   if ((MPI_Type_contiguous (6, GNUM_MPI, &besttypedat)                              != MPI_SUCCESS) ||
@@ -170,6 +171,10 @@ const BdgraphBipartSqParam * const  paraptr)      /*+ Method parameters +*/
     return     (1);
   }
 
+  if ((dgraphNodeData (&dgrfptr->s) == 0) &&     /* Use node cores that sequential run would leave idle */
+      (contextThreadClone (&contdat, dgrfptr->contptr, dgrfptr->s.procnodnbr, dgrfptr->s.procnodnum) == 0))
+    cgrfdat.contptr = &contdat;
+
   if (bgraphBipartSt (&cgrfdat, paraptr->strat) != 0) { /* Bipartition centralized graph */
     errorPrint ("bdgraphBipartSq: cannot bipartition centralized graph");
     reduloctab[3] =
@@ -182,6 +187,11 @@ const BdgraphBipartSqParam * const  paraptr)      /*+ Method parameters +*/
     reduloctab[1] = cgrfdat.compload0dlt;
   }
 
+  if (cgrfdat.contptr != dgrfptr->contptr) {      /* If threaded clone of context used, free it */
+    contextThreadCloneExit (&contdat);
+    cgrfdat.contptr = dgrfptr->contptr;
+  }
+
   if (dgrfptr->partgsttax == NULL) {
     if (dgraphGhst (&dgrfptr->s) != 0) {          /* Compute ghost edge array if not already present, before copying graph fields */
       errorPrint ("bdgraphBipartSq: cannot compute ghost edge array");
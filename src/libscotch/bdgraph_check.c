@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2011,2013,2014 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2011,2013,2014,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,6 +44,8 @@
 /**                                 to   : 22 jul 2008     **/
 /**                # Version 6.0  : from : 03 sep 2011     **/
 /**                                 to   : 31 aug 2014     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -274,6 +276,8 @@ const Bdgraph * restrict const grafptr)
     memFree (grafdat.edgegsttax + grafptr->s.baseval);
   if (grafptr->s.procsidtab != grafdat.procsidtab) /* The same for procsidtab */
     memFree (grafdat.procsidtab);
+  if ((grafptr->s.flagval & DGRAPHHASNGBCOMM) == 0) /* The same for neighborhood communicator */
+    dgraphNgbFree (&grafdat);
   memFree (partgsttax + grafptr->s.baseval);      /* Free group leader */
 
   if ((cheklocval == 0) &&
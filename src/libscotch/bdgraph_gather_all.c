@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2010,2011,2014,2018-2020 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2010,2011,2014,2018-2020,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 29 aug 2014     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 14 jan 2020     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The definitions of MPI_Gather and     **/
 /**                  MPI_Gatherv indicate that elements in **/
@@ -191,6 +191,8 @@ Bgraph * restrict              cgrfptr)            /* Centralized graph */
   cgrfptr->domnwght[1]   = dgrfptr->domnwght[1];
   cgrfptr->vfixload[0]   =                        /* Fixed vertices will soon be available in PT-Scotch */
   cgrfptr->vfixload[1]   = 0;
+  cgrfptr->dimnnbr       = 0;
+  cgrfptr->geomtab       = NULL;
   cgrfptr->levlnum       = dgrfptr->levlnum;
   cgrfptr->contptr       = dgrfptr->contptr;
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2014,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2014,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -64,6 +64,8 @@
 /**                                 to   : 18 mar 2011     **/
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 15 may 2018     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -170,6 +172,8 @@ const Gnum                      vfixload1)
   grafptr->vfixload[0]   = vfixload0;
   grafptr->vfixload[1]   = vfixload1;
   grafptr->bbalval       = (double) grafptr->compload0dlt / (double) grafptr->compload0avg;
+  grafptr->dimnnbr       = 0;
+  grafptr->geomtab       = NULL;
   grafptr->levlnum       = 0;
 
   memSet (grafptr->parttax + grafptr->s.baseval, 0, grafptr->s.vertnbr * sizeof (GraphPart)); /* Set all vertices to part 0 */
@@ -194,6 +198,9 @@ Bgraph * restrict const     grafptr)
   if ((grafptr->parttax != NULL) &&
       ((grafptr->s.flagval & BGRAPHFREEPART) != 0))
     memFree (grafptr->parttax + grafptr->s.baseval);
+  if ((grafptr->geomtab != NULL) &&
+      ((grafptr->s.flagval & BGRAPHFREEGEOM) != 0))
+    memFree (grafptr->geomtab);
 
   graphExit (&grafptr->s);                        /* Free re-allocated arrays of cloned source graph, if any */
 
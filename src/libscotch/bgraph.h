@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2011,2014,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2011,2014,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -65,7 +65,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -81,6 +81,7 @@
 #define BGRAPHFREEPART              (GRAPHBITSNOTUSED << 1) /* Free part array              */
 #define BGRAPHFREEVEEX              (GRAPHBITSNOTUSED << 2) /* Free external gain array     */
 #define BGRAPHHASANCHORS            (GRAPHBITSNOTUSED << 3) /* If graph has anchor vertices */
+#define BGRAPHFREEGEOM              (GRAPHBITSNOTUSED << 4) /* Free geometry array          */
 
 /*
 **  The type and structure definitions.
@@ -108,6 +109,8 @@ typedef struct Bgraph_ {
   Anum                      domndist;             /*+ Distance between subdomains                        +*/
   Gnum                      domnwght[2];          /*+ Weights of the two subdomains                      +*/
   Gnum                      vfixload[2];          /*+ Vertex load biases of the two subdomains           +*/
+  int                       dimnnbr;              /*+ Geometry dimension, if any                         +*/
+  double *                  geomtab;              /*+ Vertex coordinates [vertnbr * dimnnbr], or NULL    +*/
   INT                       levlnum;              /*+ Coarsening level                                   +*/
   Context *                 contptr;              /*+ Execution context                                  +*/
 } Bgraph;
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2014,2016,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2014,2016,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 07 nov 2011     **/
 /**                                 to   : 31 aug 2019     **/
 /**                # Version 7.0  : from : 28 aug 2019     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -481,6 +481,8 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
   bndgrafdat.vfixload[0]   = orggrafptr->vfixload[0];
   bndgrafdat.vfixload[1]   = orggrafptr->vfixload[1];
   bndgrafdat.bbalval       = orggrafptr->bbalval;
+  bndgrafdat.dimnnbr       = 0;                   /* Band graph does not keep geometry */
+  bndgrafdat.geomtab       = NULL;
   bndgrafdat.levlnum       = orggrafptr->levlnum;
   bndgrafdat.contptr       = orggrafptr->contptr;
 
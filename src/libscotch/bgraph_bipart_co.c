@@ -0,0 +1,295 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bgraph_bipart_co.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module bipartitions an active      **/
+/**                graph according to the coordinates of   **/
+/**                its vertices, by recursive coordinate   **/
+/**                bisection (RCB) or recursive inertial   **/
+/**                bisection (RIB).                        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "bgraph.h"
+#include "bgraph_bipart_co.h"
+
+/*
+**  The static routines.
+*/
+
+/* This routine sorts an array of
+** projected coordinates by
+** ascending order.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+#define INTSORTQUAL                 static
+#define INTSORTNAME                 bgraphBipartCoSort
+#define INTSORTSIZE                 (sizeof (BgraphBipartCoSort))
+#define INTSORTSWAP(p,q)            do {                                                             \
+                                      BgraphBipartCoSort t;                                          \
+                                      t = *((BgraphBipartCoSort *) (p));                             \
+                                      *((BgraphBipartCoSort *) (p)) = *((BgraphBipartCoSort *) (q)); \
+                                      *((BgraphBipartCoSort *) (q)) = t;                             \
+                                    } while (0)
+#define INTSORTCMP(p,q)             ((((BgraphBipartCoSort *) (p))->projval < ((BgraphBipartCoSort *) (q))->projval) || \
+                                     ((((BgraphBipartCoSort *) (p))->projval == ((BgraphBipartCoSort *) (q))->projval) && \
+                                      (((BgraphBipartCoSort *) (p))->vertnum < ((BgraphBipartCoSort *) (q))->vertnum)))
+#include "common_sort.c"
+#undef INTSORTQUAL
+#undef INTSORTNAME
+#undef INTSORTSIZE
+#undef INTSORTSWAP
+#undef INTSORTCMP
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the bipartitioning.
+** Vertices are sorted according to their
+** projection onto the cutting axis, and
+** the lowest ones are put in part 0 until
+** its target load is reached.
+** It returns:
+** - 0 : if bipartitioning could be computed.
+** - 1 : on error.
+*/
+
+int
+bgraphBipartCo (
+Bgraph * restrict const           grafptr,
+const BgraphBipartCoParam * const paraptr)        /*+ Method parameters +*/
+{
+  BgraphBipartCoSort * restrict sorttab;
+  double                        meantab[BGRAPHBIPARTCODIMNMAX];
+  double                        minitab[BGRAPHBIPARTCODIMNMAX];
+  double                        maxitab[BGRAPHBIPARTCODIMNMAX];
+  double                        axistab[BGRAPHBIPARTCODIMNMAX];
+  double                        loadsum;
+  double                        dltamax;
+  Gnum                          vertnum;
+  Gnum                          sortnum;
+  int                           dimnnum;
+  int                           dimnbst;
+  Gnum                          compload0dlt;
+  Gnum                          compsize0;
+  Gnum                          commloadintn;
+  Gnum                          commloadextn;
+  Gnum                          fronnbr;
+
+  const int                     dimnnbr = grafptr->dimnnbr;
+  const double * restrict const geomtab = grafptr->geomtab;
+  const Gnum                    baseval = grafptr->s.baseval;
+  const Gnum * restrict const   verttax = grafptr->s.verttax;
+  const Gnum * restrict const   vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const   velotax = grafptr->s.velotax;
+  const Gnum * restrict const   edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const   edlotax = grafptr->s.edlotax;
+  const Gnum * restrict const   veextax = grafptr->veextax;
+  GraphPart * restrict const    parttax = grafptr->parttax;
+
+  if (geomtab == NULL) {
+    errorPrint ("bgraphBipartCo: geometry not available");
+    return     (1);
+  }
+  if ((dimnnbr < 1) || (dimnnbr > BGRAPHBIPARTCODIMNMAX)) {
+    errorPrint ("bgraphBipartCo: invalid geometry dimension");
+    return     (1);
+  }
+
+  if ((sorttab = (BgraphBipartCoSort *) memAlloc ((grafptr->s.vertnbr + 1) * sizeof (BgraphBipartCoSort))) == NULL) {
+    errorPrint ("bgraphBipartCo: out of memory");
+    return     (1);
+  }
+
+  for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++) {
+    meantab[dimnnum] = 0.0;
+    minitab[dimnnum] = (grafptr->s.vertnbr > 0) ? geomtab[dimnnum] : 0.0;
+    maxitab[dimnnum] = minitab[dimnnum];
+  }
+  loadsum = 0.0;
+  for (vertnum = 0; vertnum < grafptr->s.vertnbr; vertnum ++) { /* Compute weighted barycenter and bounding box */
+    double              veloval;
+
+    veloval  = (velotax != NULL) ? (double) velotax[vertnum + baseval] : 1.0;
+    loadsum += veloval;
+    for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++) {
+      double              coorval;
+
+      coorval = geomtab[vertnum * dimnnbr + dimnnum];
+      meantab[dimnnum] += veloval * coorval;
+      if (coorval < minitab[dimnnum])
+        minitab[dimnnum] = coorval;
+      if (coorval > maxitab[dimnnum])
+        maxitab[dimnnum] = coorval;
+    }
+  }
+  for (dimnnum = 0, dimnbst = 0, dltamax = -1.0; dimnnum < dimnnbr; dimnnum ++) {
+    if (loadsum > 0.0)
+      meantab[dimnnum] /= loadsum;
+    axistab[dimnnum] = 0.0;
+    if ((maxitab[dimnnum] - minitab[dimnnum]) > dltamax) { /* Coordinate axis of largest extent */
+      dltamax = maxitab[dimnnum] - minitab[dimnnum];
+      dimnbst = dimnnum;
+    }
+  }
+  axistab[dimnbst] = 1.0;
+
+  if ((paraptr->typeval == BGRAPHBIPARTCOTYPEINER) && (dimnnbr > 1)) { /* If principal axis of inertia wanted */
+    double              covatab[BGRAPHBIPARTCODIMNMAX][BGRAPHBIPARTCODIMNMAX];
+    int                 dimnidx;
+    int                 iternum;
+
+    for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++) {
+      for (dimnidx = 0; dimnidx < dimnnbr; dimnidx ++)
+        covatab[dimnnum][dimnidx] = 0.0;
+    }
+    for (vertnum = 0; vertnum < grafptr->s.vertnbr; vertnum ++) { /* Compute weighted covariance matrix */
+      double              veloval;
+
+      veloval = (velotax != NULL) ? (double) velotax[vertnum + baseval] : 1.0;
+      for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++) {
+        double              coorval;
+
+        coorval = geomtab[vertnum * dimnnbr + dimnnum] - meantab[dimnnum];
+        for (dimnidx = 0; dimnidx <= dimnnum; dimnidx ++)
+          covatab[dimnnum][dimnidx] += veloval * coorval * (geomtab[vertnum * dimnnbr + dimnidx] - meantab[dimnidx]);
+      }
+    }
+    for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++) { /* Symmetrize matrix */
+      for (dimnidx = dimnnum + 1; dimnidx < dimnnbr; dimnidx ++)
+        covatab[dimnnum][dimnidx] = covatab[dimnidx][dimnnum];
+    }
+
+    for (iternum = 0; iternum < BGRAPHBIPARTCOITERNBR; iternum ++) { /* Power iteration from coordinate axis */
+      double              vecttab[BGRAPHBIPARTCODIMNMAX];
+      double              normval;
+
+      for (dimnnum = 0, normval = 0.0; dimnnum < dimnnbr; dimnnum ++) {
+        vecttab[dimnnum] = 0.0;
+        for (dimnidx = 0; dimnidx < dimnnbr; dimnidx ++)
+          vecttab[dimnnum] += covatab[dimnnum][dimnidx] * axistab[dimnidx];
+        normval += vecttab[dimnnum] * vecttab[dimnnum];
+      }
+      if (normval <= 0.0)                         /* If degenerate geometry, keep current axis */
+        break;
+      normval = sqrt (normval);
+      for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++)
+        axistab[dimnnum] = vecttab[dimnnum] / normval;
+    }
+  }
+
+  for (vertnum = 0; vertnum < grafptr->s.vertnbr; vertnum ++) { /* Project vertices onto cutting axis */
+    double              projval;
+
+    for (dimnnum = 0, projval = 0.0; dimnnum < dimnnbr; dimnnum ++)
+      projval += axistab[dimnnum] * (geomtab[vertnum * dimnnbr + dimnnum] - meantab[dimnnum]);
+    sorttab[vertnum].projval = projval;
+    sorttab[vertnum].vertnum = vertnum + baseval;
+  }
+  bgraphBipartCoSort (sorttab, grafptr->s.vertnbr);
+
+  memSet (parttax + baseval, 1, grafptr->s.vertnbr * sizeof (GraphPart)); /* Put all vertices in part 1 */
+  compload0dlt = - grafptr->compload0avg;         /* Part 0 is empty */
+  compsize0    = 0;
+  for (sortnum = 0; sortnum < grafptr->s.vertnbr; sortnum ++) { /* Fill part 0 with lowest vertices */
+    Gnum                veloval;
+
+    vertnum = sorttab[sortnum].vertnum;
+    veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+    if ((compload0dlt + veloval) > (- compload0dlt)) /* If adding vertex would worsen imbalance */
+      break;
+    parttax[vertnum] = 0;
+    compload0dlt    += veloval;
+    compsize0 ++;
+  }
+
+  memFree (sorttab);
+
+  commloadintn = 0;
+  commloadextn = 0;
+  fronnbr      = 0;
+  for (vertnum = baseval; vertnum < grafptr->s.vertnnd; vertnum ++) { /* Compute frontier and communication loads */
+    Gnum                partval;
+    Gnum                edgenum;
+    Gnum                flagval;
+
+    partval = (Gnum) parttax[vertnum];
+    if ((veextax != NULL) && (partval != 0))
+      commloadextn += veextax[vertnum];
+    for (edgenum = verttax[vertnum], flagval = 0; edgenum < vendtax[vertnum]; edgenum ++) {
+      if ((Gnum) parttax[edgetax[edgenum]] != partval) {
+        flagval = 1;
+        if (partval == 0)                         /* Count cut edges once */
+          commloadintn += (edlotax != NULL) ? edlotax[edgenum] : 1;
+      }
+    }
+    if (flagval != 0)
+      grafptr->frontab[fronnbr ++] = vertnum;
+  }
+
+  grafptr->fronnbr      = fronnbr;
+  grafptr->compload0    = grafptr->compload0avg + compload0dlt;
+  grafptr->compload0dlt = compload0dlt;
+  grafptr->compsize0    = compsize0;
+  grafptr->commload     = grafptr->commloadextn0 + commloadextn + commloadintn * grafptr->domndist;
+  grafptr->commgainextn = grafptr->commgainextn0 - commloadextn * 2;
+  grafptr->bbalval      = (double) ((grafptr->compload0dlt < 0) ? (- grafptr->compload0dlt) : grafptr->compload0dlt) / (double) grafptr->compload0avg;
+
+#ifdef SCOTCH_DEBUG_BGRAPH2
+  if (bgraphCheck (grafptr) != 0) {
+    errorPrint ("bgraphBipartCo: inconsistent graph data");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_BGRAPH2 */
+
+  return (0);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2011,2014,2015,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2011,2014,2015,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 16 aug 2015     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,6 +72,7 @@
 #include "arch.h"
 #include "mapping.h"
 #include "graph_coarsen.h"
+#include "graph_hier.h"
 #include "bgraph.h"
 #include "bgraph_bipart_ml.h"
 #include "bgraph_bipart_st.h"
@@ -86,7 +87,9 @@
 ** graph that is given on input. The coarser
 ** graphs differ at this stage from classical
 ** active graphs as their internal gains are not
-** yet computed.
+** yet computed. When label propagation clusters
+** are contracted, the fine-to-coarse array is
+** returned in place of the multinode array.
 ** It returns:
 ** - 0  : if the coarse graph has been built.
 ** - 1  : if threshold reached or on error.
@@ -97,16 +100,39 @@ int
 bgraphBipartMlCoarsen (
 const Bgraph * const                  finegrafptr, /*+ Finer graph                                  +*/
 Bgraph * restrict const               coargrafptr, /*+ Coarser graph to build                       +*/
+Gnum * restrict * const               finecoarptr, /*+ Pointer to un-based fine-to-coarse array     +*/
 GraphCoarsenMulti * restrict * const  coarmultptr, /*+ Pointer to un-based multinode table to build +*/
 const BgraphBipartMlParam * const     paraptr)    /*+ Method parameters                             +*/
 {
-  Gnum                comploadtmp;                /* Increase of imbalance range for coarse graph */
+  Gnum                  comploadtmp;              /* Increase of imbalance range for coarse graph   */
+  const GraphHierLevl * levlptr;                  /* Level of attached coarsening hierarchy, if any */
 
+  *finecoarptr = NULL;                            /* Assume no fine-to-coarse array needed    */
   *coarmultptr = NULL;                            /* Allocate multloctab along with coarse graph */
-  if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr,
-                    paraptr->coarnbr, paraptr->coarrat, GRAPHCOARSENNONE,
-                    NULL, NULL, 0, finegrafptr->contptr) != 0)
-    return (1);                                   /* Return if coarsening failed */
+  if ((paraptr->coartype != GRAPHCOARLBP) &&      /* If matching-based coarsening */
+      ((levlptr = graphHierLevl (&finegrafptr->s, finegrafptr->levlnum, paraptr->coarnbr, paraptr->coarrat)) != NULL)) {
+    coargrafptr->s         = levlptr->grafdat;    /* Use coarse graph of attached hierarchy         */
+    coargrafptr->s.flagval = (coargrafptr->s.flagval & (GRAPHBITSUSED & ~GRAPHFREETABS)) | GRAPHHASHIER; /* Do not free it */
+    coargrafptr->s.hierptr = finegrafptr->s.hierptr; /* Keep hierarchy for next level                */
+    *coarmultptr           = levlptr->multtab;
+  }
+  else {
+    if ((paraptr->coartype == GRAPHCOARLBP) &&    /* If clusters wanted, keep fine-to-coarse array */
+        ((*finecoarptr = (Gnum *) memAlloc (finegrafptr->s.vertnbr * sizeof (Gnum))) == NULL)) {
+      errorPrint ("bgraphBipartMlCoarsen: out of memory (1)");
+      return     (1);
+    }
+    if (graphCoarsen (&finegrafptr->s, &coargrafptr->s,
+                      (*finecoarptr != NULL) ? finecoarptr : NULL, coarmultptr,
+                      paraptr->coarnbr, paraptr->coarrat,
+                      ((*finecoarptr != NULL) ? GRAPHCOARSENCLUSTER : GRAPHCOARSENNONE) |
+                      ((paraptr->coartype == GRAPHCOARHOP) ? GRAPHCOARSENHOP : GRAPHCOARSENNONE),
+                      NULL, NULL, 0, finegrafptr->contptr) != 0) {
+      if (*finecoarptr != NULL)
+        memFree (*finecoarptr);
+      return (1);                                 /* Return if coarsening failed */
+    }
+  }
 
   if (finegrafptr->veextax != NULL) {             /* Merge external gains for coarsened vertices */
     GraphCoarsenMulti * restrict  coarmulttab;
@@ -117,22 +143,37 @@ const BgraphBipartMlParam * const     paraptr)    /*+ Method parameters
     const Gnum * restrict const fineveextax = finegrafptr->veextax;
 
     if ((coarveextab = (Gnum *) memAlloc (coargrafptr->s.vertnbr * sizeof (Gnum))) == NULL) {
-      errorPrint ("bgraphBipartMlCoarsen: out of memory");
+      errorPrint ("bgraphBipartMlCoarsen: out of memory (2)");
       graphExit  (&coargrafptr->s);               /* Only free Graph since veextab not allocated */
+      if (*finecoarptr != NULL)
+        memFree (*finecoarptr);
       return     (1);
     }
 
-    coarmulttab = *coarmultptr;
-    for (coarvertnum = 0, coarvertnbr = coargrafptr->s.vertnbr;
-         coarvertnum < coarvertnbr; coarvertnum ++) {
-      Gnum                finevertnum0;           /* First multinode vertex  */
-      Gnum                finevertnum1;           /* Second multinode vertex */
-
-      finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
-      finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
-      coarveextab[coarvertnum] = (finevertnum0 != finevertnum1)
-                                 ? fineveextax[finevertnum0] + fineveextax[finevertnum1]
-                                 : fineveextax[finevertnum0];
+    if (*finecoarptr != NULL) {                   /* If clusters contracted, use fine-to-coarse array */
+      Gnum                finevertnum;
+      Gnum                finevertnnd;
+
+      const Gnum * restrict const finecoartax = *finecoarptr - finegrafptr->s.baseval;
+
+      memSet (coarveextab, 0, coargrafptr->s.vertnbr * sizeof (Gnum));
+      for (finevertnum = finegrafptr->s.baseval, finevertnnd = finegrafptr->s.vertnnd;
+           finevertnum < finevertnnd; finevertnum ++)
+        coarveextab[finecoartax[finevertnum] - finegrafptr->s.baseval] += fineveextax[finevertnum];
+    }
+    else {
+      coarmulttab = *coarmultptr;
+      for (coarvertnum = 0, coarvertnbr = coargrafptr->s.vertnbr;
+           coarvertnum < coarvertnbr; coarvertnum ++) {
+        Gnum                finevertnum0;         /* First multinode vertex  */
+        Gnum                finevertnum1;         /* Second multinode vertex */
+
+        finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
+        finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
+        coarveextab[coarvertnum] = (finevertnum0 != finevertnum1)
+                                   ? fineveextax[finevertnum0] + fineveextax[finevertnum1]
+                                   : fineveextax[finevertnum0];
+      }
     }
 
     coargrafptr->s.flagval |= BGRAPHFREEVEEX;
@@ -141,6 +182,23 @@ const BgraphBipartMlParam * const     paraptr)    /*+ Method parameters
   else                                            /* If fine graph does not have external gains */
     coargrafptr->veextax = NULL;                  /* Coarse graph does not have external gains  */
 
+  coargrafptr->dimnnbr = finegrafptr->dimnnbr;
+  coargrafptr->geomtab = NULL;
+  if (finegrafptr->geomtab != NULL) {             /* Project coordinates onto coarse vertices */
+    if (graphCoarsenGeom (&finegrafptr->s, coargrafptr->s.vertnbr, *finecoarptr, *coarmultptr,
+                          finegrafptr->dimnnbr, finegrafptr->geomtab, &coargrafptr->geomtab) != 0) {
+      errorPrint ("bgraphBipartMlCoarsen: cannot compute coarse geometry");
+      if ((coargrafptr->veextax != NULL) &&
+          ((coargrafptr->s.flagval & BGRAPHFREEVEEX) != 0))
+        memFree (coargrafptr->veextax + coargrafptr->s.baseval);
+      graphExit (&coargrafptr->s);
+      if (*finecoarptr != NULL)
+        memFree (*finecoarptr);
+      return (1);
+    }
+    coargrafptr->s.flagval |= BGRAPHFREEGEOM;
+  }
+
   coargrafptr->s.flagval |= BGRAPHFREEPART;       /* Only part array will have to be freed, as frontier is shared */
   coargrafptr->parttax    = NULL;                 /* Do not allocate partition data yet                           */
   coargrafptr->frontab    = finegrafptr->frontab; /* Use frontier array of finer graph as coarse frontier array   */
@@ -166,7 +224,9 @@ const BgraphBipartMlParam * const     paraptr)    /*+ Method parameters
 
 /* This routine propagates the bipartition of the
 ** coarser graph back to the finer graph, according
-** to the multinode table of collapsed vertices.
+** to the multinode table of collapsed vertices, or
+** to the fine-to-coarse array when clusters have
+** been contracted.
 ** After the bipartition is propagated, it finishes
 ** to compute the parameters of the finer graph that
 ** were not computed at the coarsening stage.
@@ -179,8 +239,9 @@ static
 int
 bgraphBipartMlUncoarsen (
 Bgraph * restrict const         finegrafptr,      /*+ Finer graph                         +*/
-const Bgraph * const            coargrafptr,      /*+ Coarser graph                       +*/
-const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to un-based multinode array +*/
+const Bgraph * const            coargrafptr,      /*+ Coarser graph                           +*/
+const Gnum * const              finecoartab,      /*+ Un-based fine-to-coarse array, if any   +*/
+const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to un-based multinode array     +*/
 {
   Gnum                        coarvertnnd;
   Gnum                        coarvertnum;
@@ -215,6 +276,69 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to un-based multin
   fineparttax   = finegrafptr->parttax;
   finecompsize1 = coargrafptr->s.vertnbr - coargrafptr->compsize0; /* Pre-allocate sizes */
 
+  if (finecoartab != NULL) {                      /* If clusters contracted, project through fine-to-coarse array */
+    byte * restrict     coarflagtax;              /* Flag array for coarse frontier vertices                      */
+    Gnum                finevertnnd;
+    Gnum                finevertnum;
+
+    const Gnum * restrict const finecoartax = finecoartab - finegrafptr->s.baseval;
+
+    if ((coarflagtax = (byte *) memAlloc (coargrafptr->s.vertnbr * sizeof (byte))) == NULL) {
+      errorPrint ("bgraphBipartMlUncoarsen: out of memory (2)");
+      return     (1);
+    }
+    memSet (coarflagtax, 0, coargrafptr->s.vertnbr * sizeof (byte));
+    coarflagtax -= coargrafptr->s.baseval;
+
+    for (coarfronnum = 0, coarfronnbr = coargrafptr->fronnbr; /* Flag coarse frontier vertices */
+         coarfronnum < coarfronnbr; coarfronnum ++)
+      coarflagtax[coarfrontab[coarfronnum]] = 1;
+
+    for (finevertnum = finegrafptr->s.baseval, finevertnnd = finegrafptr->s.vertnnd, finecompsize1 = 0;
+         finevertnum < finevertnnd; finevertnum ++) {
+      GraphPart           partval;
+
+      partval = coarparttax[finecoartax[finevertnum]];
+      fineparttax[finevertnum] = partval;
+      finecompsize1 += (Gnum) partval;
+    }
+
+    for (finevertnum = finegrafptr->s.baseval, finefronnbr = 0; /* Only fine vertices of coarse frontier vertices may be in frontier */
+         finevertnum < finevertnnd; finevertnum ++) {
+      Gnum                fineedgenum;
+
+      if (coarflagtax[finecoartax[finevertnum]] == 0)
+        continue;
+
+      for (fineedgenum = fineverttax[finevertnum];
+           fineedgenum < finevendtax[finevertnum]; fineedgenum ++) {
+        if (fineparttax[fineedgetax[fineedgenum]] != fineparttax[finevertnum]) { /* If vertex belongs to frontier */
+          coarfrontab[finefronnbr ++] = finevertnum; /* TRICK: coarse frontier array is also fine frontier array */
+          break;
+        }
+      }
+    }
+
+    memFree (coarflagtax + coargrafptr->s.baseval);
+
+    finegrafptr->compload0    = coargrafptr->compload0;
+    finegrafptr->compload0dlt = coargrafptr->compload0dlt;
+    finegrafptr->compsize0    = finegrafptr->s.vertnbr - finecompsize1;
+    finegrafptr->commload     = coargrafptr->commload;
+    finegrafptr->commgainextn = coargrafptr->commgainextn;
+    finegrafptr->bbalval      = coargrafptr->bbalval;
+    finegrafptr->fronnbr      = finefronnbr;
+
+#ifdef SCOTCH_DEBUG_BGRAPH2
+    if (bgraphCheck (finegrafptr) != 0) {
+      errorPrint ("bgraphBipartMlUncoarsen: inconsistent graph data (1)");
+      return     (1);
+    }
+#endif /* SCOTCH_DEBUG_BGRAPH2 */
+
+    return (0);
+  }
+
   for (coarvertnum = coargrafptr->s.baseval, coarvertnnd = coargrafptr->s.vertnnd;
        coarvertnum < coarvertnnd; coarvertnum ++) {
     Gnum                finevertnum0;             /* First multinode vertex  */
@@ -293,7 +417,7 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to un-based multin
 
 #ifdef SCOTCH_DEBUG_BGRAPH2
   if (bgraphCheck (finegrafptr) != 0) {
-    errorPrint ("bgraphBipartMlUncoarsen: inconsistent graph data");
+    errorPrint ("bgraphBipartMlUncoarsen: inconsistent graph data (2)");
     return     (1);
   }
 #endif /* SCOTCH_DEBUG_BGRAPH2 */
@@ -315,18 +439,21 @@ Bgraph * restrict const           grafptr,        /*+ Active graph      +*/
 const BgraphBipartMlParam * const paraptr)        /*+ Method parameters +*/
 {
   Bgraph              coargrafdat;
+  Gnum *              finecoartab;
   GraphCoarsenMulti * coarmulttab;
   int                 o;
 
-  if (bgraphBipartMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = bgraphBipartMl2         (&coargrafdat, paraptr))              == 0) &&
-        ((o = bgraphBipartMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
-        ((o = bgraphBipartSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
+  if (bgraphBipartMlCoarsen (grafptr, &coargrafdat, &finecoartab, &coarmulttab, paraptr) == 0) {
+    if (((o = bgraphBipartMl2         (&coargrafdat, paraptr))                           == 0) &&
+        ((o = bgraphBipartMlUncoarsen (grafptr, &coargrafdat, finecoartab, coarmulttab)) == 0) &&
+        ((o = bgraphBipartSt          (grafptr, paraptr->stratasc))                      != 0)) /* Apply ascending strategy */
       errorPrint ("bgraphBipartMl2: cannot apply ascending strategy");
     bgraphExit (&coargrafdat);
+    if (finecoartab != NULL)                      /* If clusters were contracted */
+      memFree (finecoartab);
   }
   else {
-    if (((o = bgraphBipartMlUncoarsen (grafptr, NULL, NULL))        == 0) && /* Finalize graph   */
+    if (((o = bgraphBipartMlUncoarsen (grafptr, NULL, NULL, NULL))  == 0) && /* Finalize graph   */
         ((o = bgraphBipartSt          (grafptr, paraptr->stratlow)) != 0)) /* Apply low strategy */
       errorPrint ("bgraphBipartMl2: cannot apply low strategy");
   }
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2011,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2011,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 /**                # Version 6.0  : from : 16 apr 2011     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,6 +66,7 @@
 typedef struct BgraphBipartMlParam_ {
   INT                       coarnbr;              /*+ Minimum number of vertices   +*/
   double                    coarrat;              /*+ Coarsening ratio             +*/
+  GraphCoarsenType          coartype;             /*+ Edge matching function type  +*/
   Strat *                   stratlow;             /*+ Strategy at lowest level     +*/
   Strat *                   stratasc;             /*+ Strategy at ascending levels +*/
 } BgraphBipartMlParam;
@@ -76,8 +77,8 @@ typedef struct BgraphBipartMlParam_ {
 
 #ifdef SCOTCH_BGRAPH_BIPART_ML
 
-static int                  bgraphBipartMlCoarsen (const Bgraph * const, Bgraph * restrict const, GraphCoarsenMulti * restrict * const, const BgraphBipartMlParam * const);
-static int                  bgraphBipartMlUncoarsen (Bgraph * restrict const, const Bgraph * restrict const, const GraphCoarsenMulti * const);
+static int                  bgraphBipartMlCoarsen (const Bgraph * const, Bgraph * restrict const, Gnum * restrict * const, GraphCoarsenMulti * restrict * const, const BgraphBipartMlParam * const);
+static int                  bgraphBipartMlUncoarsen (Bgraph * restrict const, const Bgraph * restrict const, const Gnum * const, const GraphCoarsenMulti * const);
 static int                  bgraphBipartMl2     (Bgraph * restrict const, const BgraphBipartMlParam * const);
 
 #endif /* SCOTCH_BGRAPH_BIPART_ML */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009-2012,2016,2017,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009-2012,2016,2017,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 02 jan 2017     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -74,6 +74,7 @@
 #include "graph_coarsen.h"
 #include "bgraph.h"
 #include "bgraph_bipart_bd.h"
+#include "bgraph_bipart_co.h"
 #include "bgraph_bipart_df.h"
 #include "bgraph_bipart_ex.h"
 #include "bgraph_bipart_fm.h"
@@ -94,6 +95,11 @@ static union {
   StratNodeMethodData       padding;
 } bgraphbipartstdefaultbd = { { 3, &stratdummy } };
 
+static union {
+  BgraphBipartCoParam       param;
+  StratNodeMethodData       padding;
+} bgraphbipartstdefaultco = { { BGRAPHBIPARTCOTYPEINER } };
+
 static union {
   BgraphBipartDfParam       param;
   StratNodeMethodData       padding;
@@ -117,10 +123,11 @@ static union {
 static union {
   BgraphBipartMlParam       param;
   StratNodeMethodData       padding;
-} bgraphbipartstdefaultml = { { 100, 0.8L, &stratdummy, &stratdummy } };
+} bgraphbipartstdefaultml = { { 100, 0.8L, GRAPHCOARHEM, &stratdummy, &stratdummy } };
 
 static StratMethodTab       bgraphbipartstmethtab[] = { /* Bipartitioning methods array */
                               { BGRAPHBIPARTSTMETHBD, "b",  bgraphBipartBd, &bgraphbipartstdefaultbd },
+                              { BGRAPHBIPARTSTMETHCO, "c",  bgraphBipartCo, &bgraphbipartstdefaultco },
                               { BGRAPHBIPARTSTMETHDF, "d",  bgraphBipartDf, &bgraphbipartstdefaultdf },
                               { BGRAPHBIPARTSTMETHEX, "x",  bgraphBipartEx, NULL },
                               { BGRAPHBIPARTSTMETHFM, "f",  bgraphBipartFm, &bgraphbipartstdefaultfm },
@@ -143,6 +150,10 @@ static StratParamTab        bgraphbipartstparatab[] = { /* Method parameter list
                                 (byte *) &bgraphbipartstdefaultbd.param,
                                 (byte *) &bgraphbipartstdefaultbd.param.distmax,
                                 NULL },
+                              { BGRAPHBIPARTSTMETHCO,  STRATPARAMCASE,   "type",
+                                (byte *) &bgraphbipartstdefaultco.param,
+                                (byte *) &bgraphbipartstdefaultco.param.typeval,
+                                (void *) "ci" },
                               { BGRAPHBIPARTSTMETHDF,  STRATPARAMINT,    "pass",
                                 (byte *) &bgraphbipartstdefaultdf.param,
                                 (byte *) &bgraphbipartstdefaultdf.param.passnbr,
@@ -183,6 +194,10 @@ static StratParamTab        bgraphbipartstparatab[] = { /* Method parameter list
                                 (byte *) &bgraphbipartstdefaultml.param,
                                 (byte *) &bgraphbipartstdefaultml.param.stratlow,
                                 (void *) &bgraphbipartststratab },
+                              { BGRAPHBIPARTSTMETHML,  STRATPARAMCASE,   "type",
+                                (byte *) &bgraphbipartstdefaultml.param,
+                                (byte *) &bgraphbipartstdefaultml.param.coartype,
+                                (void *) "hslt" },
                               { BGRAPHBIPARTSTMETHML,  STRATPARAMINT,    "vert",
                                 (byte *) &bgraphbipartstdefaultml.param,
                                 (byte *) &bgraphbipartstdefaultml.param.coarnbr,
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,6 +48,8 @@
 /**                                 to   : 13 jan 2007     **/
 /**                # Version 6.0  : from : 05 apr 2018     **/
 /**                                 to   : 05 apr 2018     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -59,6 +61,7 @@
 
 typedef enum BgraphBipartStMethodType_ {
   BGRAPHBIPARTSTMETHBD = 0,                       /*+ Band                   +*/
+  BGRAPHBIPARTSTMETHCO,                           /*+ Geometric (RCB/RIB)    +*/
   BGRAPHBIPARTSTMETHDF,                           /*+ Diffusion              +*/
   BGRAPHBIPARTSTMETHEX,                           /*+ Exactifying            +*/
   BGRAPHBIPARTSTMETHFM,                           /*+ Fiduccia-Mattheyses    +*/
@@ -1,4 +1,4 @@
-/* Copyright 2010,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**    DATES     : # Version 5.1  : from : 30 jul 2010     **/
 /**                                 to   : 30 jul 2010     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -53,6 +53,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "common_thread_system.h"
 #include "comm.h"
 
 /************************************/
@@ -225,3 +226,312 @@ MPI_Comm                    comm)
 
   return (o);
 }
+
+/* This routine posts non-blocking receptions
+** of an array of arbitrary size sent by
+** commSendChunk(), as a sequence of messages
+** of at most COMMCHUNKSIZE elements each,
+** directly into the target array. Since at
+** most COMMCHUNKREQNBR requests can be
+** pending in the request array, the routine
+** waits for all of them to complete when it
+** is full. The caller must wait for the
+** remaining pending requests, whose number
+** is given by *reqnbrptr.
+** It returns:
+** - MPI_SUCCESS : on success.
+** - !0          : on error.
+*/
+
+int
+commRecvChunk (
+void * const                recvdattab,
+const Gnum                  recvcntnbr,
+MPI_Datatype                recvtypval,
+const int                   procnum,
+const int                   tagnum,
+MPI_Comm                    comm,
+MPI_Request * const         reqtab,               /* Array of COMMCHUNKREQNBR requests */
+int * const                 reqnbrptr)            /* Number of pending requests        */
+{
+  byte *              recvdatptr;
+  Gnum                recvdatnbr;
+  int                 recvtypsiz;
+  int                 reqnbr;
+  int                 o;
+
+  MPI_Type_size (recvtypval, &recvtypsiz);
+
+  for (recvdatptr = (byte *) recvdattab, recvdatnbr = recvcntnbr, reqnbr = *reqnbrptr, o = MPI_SUCCESS;
+       recvdatnbr > 0; ) {
+    int                 recvchknbr;
+
+    if (reqnbr >= COMMCHUNKREQNBR) {              /* If request array full, wait for pending receptions */
+      o = MPI_Waitall (reqnbr, reqtab, MPI_STATUSES_IGNORE);
+      reqnbr = 0;
+      if (o != MPI_SUCCESS)
+        break;
+    }
+
+    recvchknbr = (int) MIN (recvdatnbr, COMMCHUNKSIZE);
+    o = MPI_Irecv (recvdatptr, recvchknbr, recvtypval, procnum, tagnum, comm, &reqtab[reqnbr ++]);
+    if (o != MPI_SUCCESS)
+      break;
+
+    recvdatptr += (size_t) recvchknbr * (size_t) recvtypsiz;
+    recvdatnbr -= recvchknbr;
+  }
+  *reqnbrptr = reqnbr;
+
+  return (o);
+}
+
+/* This routine sends an array of arbitrary
+** size as a sequence of messages of at most
+** COMMCHUNKSIZE elements each, to be received
+** by commRecvChunk(). Several consecutive
+** calls with the same tag can be matched by
+** a single reception call for their total
+** size, provided that all calls but the last
+** one send multiples of COMMCHUNKSIZE.
+** It returns:
+** - MPI_SUCCESS : on success.
+** - !0          : on error.
+*/
+
+int
+commSendChunk (
+const void * const          senddattab,
+const Gnum                  sendcntnbr,
+MPI_Datatype                sendtypval,
+const int                   procnum,
+const int                   tagnum,
+MPI_Comm                    comm)
+{
+  const byte *        senddatptr;
+  Gnum                senddatnbr;
+  int                 sendtypsiz;
+  int                 o;
+
+  MPI_Type_size (sendtypval, &sendtypsiz);
+
+  for (senddatptr = (const byte *) senddattab, senddatnbr = sendcntnbr, o = MPI_SUCCESS;
+       senddatnbr > 0; ) {
+    int                 sendchknbr;
+
+    sendchknbr = (int) MIN (senddatnbr, COMMCHUNKSIZE);
+    o = MPI_Send ((void *) senddatptr, sendchknbr, sendtypval, procnum, tagnum, comm);
+    if (o != MPI_SUCCESS)
+      break;
+
+    senddatptr += (size_t) sendchknbr * (size_t) sendtypsiz;
+    senddatnbr -= sendchknbr;
+  }
+
+  return (o);
+}
+
+/* This routine gathers arrays of arbitrary
+** size on the root process, by means of
+** commSendChunk() and commRecvChunk(). Data
+** are received in place in the target array,
+** and counts and displacements are expressed
+** in elements of type sendtypval. The local
+** part of the root process is copied while
+** receptions are in flight, unless senddattab
+** is NULL because it is already in place.
+** It returns:
+** - MPI_SUCCESS : on success.
+** - !0          : on error.
+*/
+
+int
+commGathervChunk (
+void * const                senddattab,
+const Gnum                  sendcntnbr,
+MPI_Datatype                sendtypval,
+void * const                recvdattab,
+const Gnum * const          recvcnttab,
+const Gnum * const          recvdsptab,
+const int                   rootnum,
+const int                   tagnum,
+MPI_Comm                    comm)
+{
+  MPI_Request         reqtab[COMMCHUNKREQNBR];
+  int                 reqnbr;
+  int                 typesiz;
+  int                 procglbnbr;
+  int                 proclocnum;
+  int                 procnum;
+  int                 o;
+
+  MPI_Comm_rank (comm, &proclocnum);
+  if (proclocnum != rootnum)                      /* If process is not root, send local part */
+    return (commSendChunk (senddattab, sendcntnbr, sendtypval, rootnum, tagnum, comm));
+
+  MPI_Type_size (sendtypval, &typesiz);
+  MPI_Comm_size (comm, &procglbnbr);
+  for (procnum = 0, reqnbr = 0, o = MPI_SUCCESS; procnum < procglbnbr; procnum ++) {
+    if (procnum == rootnum)
+      continue;
+    o = commRecvChunk ((byte *) recvdattab + (size_t) recvdsptab[procnum] * (size_t) typesiz, recvcnttab[procnum],
+                       sendtypval, procnum, tagnum, comm, reqtab, &reqnbr);
+    if (o != MPI_SUCCESS)
+      break;
+  }
+  if ((o == MPI_SUCCESS) && (senddattab != NULL)) /* Copy local part while receiving others */
+    memCpy ((byte *) recvdattab + (size_t) recvdsptab[rootnum] * (size_t) typesiz, senddattab, (size_t) sendcntnbr * (size_t) typesiz);
+  if (reqnbr > 0) {
+    int                 o2;
+
+    o2 = MPI_Waitall (reqnbr, reqtab, MPI_STATUSES_IGNORE);
+    if (o == MPI_SUCCESS)
+      o = o2;
+  }
+
+  return (o);
+}
+
+/************************************/
+/*                                  */
+/* These routines handle the node   */
+/* resources of communicators.      */
+/*                                  */
+/************************************/
+
+/* This routine computes the number of processes
+** of the given communicator which share the cores
+** of the calling process, that is, which reside
+** on the same compute node and are bound to the
+** same set of cores (all the cores of the node
+** if processes are not bound), as well as the
+** rank of the calling process among them.
+** When node information cannot be obtained, all
+** the processes of the communicator are deemed
+** to share the same cores.
+** This routine must be called collectively.
+** It returns:
+** - MPI_SUCCESS : on success.
+** - !0          : on error.
+*/
+
+int
+commNodeData (
+MPI_Comm                    comm,
+int * const                 procnbrptr,           /*+ Number of processes sharing our cores +*/
+int * const                 procnumptr)           /*+ Rank of process among them            +*/
+{
+#if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
+  MPI_Comm            nodecomm;
+  MPI_Comm            corecomm;
+  int                 corefst;
+  int                 o;
+
+  threadSystemCoreAff (&corefst);                 /* Processes bound to the same cores share their first core */
+
+  if ((o = MPI_Comm_split_type (comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodecomm)) != MPI_SUCCESS)
+    return (o);
+  o = MPI_Comm_split (nodecomm, corefst, 0, &corecomm);
+  MPI_Comm_free (&nodecomm);
+  if (o != MPI_SUCCESS)
+    return (o);
+
+  if ((o = MPI_Comm_size (corecomm, procnbrptr)) == MPI_SUCCESS)
+    o = MPI_Comm_rank (corecomm, procnumptr);
+  MPI_Comm_free (&corecomm);
+
+  return (o);
+#else /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+  int                 o;
+
+  if ((o = MPI_Comm_size (comm, procnbrptr)) == MPI_SUCCESS) /* Assume all processes reside on the same node */
+    o = MPI_Comm_rank (comm, procnumptr);
+
+  return (o);
+#endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+}
+
+/**************************************/
+/*                                    */
+/* These routines handle the encoding */
+/* of compressed index arrays.        */
+/*                                    */
+/**************************************/
+
+/* This routine encodes the given array of
+** Gnum values as a stream of bytes. Every
+** value is replaced by its difference with
+** its predecessor, the first value being
+** compared to the given reference value,
+** so that sorted or clustered index arrays
+** yield small differences. Differences are
+** mapped to unsigned values such that small
+** negative values remain small, and are
+** written 7 bits at a time, the high bit of
+** each byte being set when more bytes follow.
+** At most COMMENCODESIZE(datanbr) bytes are
+** written.
+** It returns:
+** - byte * : pointer to the byte following
+**            the last byte written.
+*/
+
+byte *
+commEncode (
+byte * restrict             bytetab,              /*+ Byte array to write to           +*/
+const Gnum * restrict const datatab,              /*+ Array of values to encode        +*/
+const Gnum                  datanbr,              /*+ Number of values to encode       +*/
+Gnum                        dataref)              /*+ Reference value for first value  +*/
+{
+  Gnum                datanum;
+
+  for (datanum = 0; datanum < datanbr; datanum ++) {
+    Gunum               datadlt;
+    Gunum               datazig;
+
+    datadlt = (Gunum) datatab[datanum] - (Gunum) dataref; /* Compute difference modulo word size */
+    datazig = ((Gnum) datadlt < 0) ? ~(datadlt << 1) : (datadlt << 1); /* Interleave signs      */
+    dataref = datatab[datanum];
+
+    while (datazig >= 0x80) {
+      *(bytetab ++) = (byte) (datazig | 0x80);
+      datazig >>= 7;
+    }
+    *(bytetab ++) = (byte) datazig;
+  }
+
+  return (bytetab);
+}
+
+/* This routine decodes an array of Gnum
+** values encoded by commEncode() with the
+** same reference value.
+** It returns:
+** - byte * : pointer to the byte following
+**            the last byte read.
+*/
+
+const byte *
+commDecode (
+const byte * restrict       bytetab,              /*+ Byte array to read from          +*/
+Gnum * restrict const       datatab,              /*+ Array of decoded values          +*/
+const Gnum                  datanbr,              /*+ Number of values to decode       +*/
+Gnum                        dataref)              /*+ Reference value for first value  +*/
+{
+  Gnum                datanum;
+
+  for (datanum = 0; datanum < datanbr; datanum ++) {
+    Gunum               datazig;
+    int                 bitsnum;
+    byte                byteval;
+
+    for (datazig = 0, bitsnum = 0; ((byteval = *(bytetab ++)) & 0x80) != 0; bitsnum += 7)
+      datazig |= ((Gunum) (byteval & 0x7F)) << bitsnum;
+    datazig |= ((Gunum) byteval) << bitsnum;
+
+    dataref  = (Gnum) ((Gunum) dataref + ((datazig >> 1) ^ (- (datazig & 1)))); /* De-interleave signs and add difference */
+    datatab[datanum] = dataref;
+  }
+
+  return (bytetab);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2010,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,10 +43,31 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Maximum number of elements per message
+    in chunked point-to-point transfers.     +*/
+
+#ifndef COMMCHUNKSIZE
+#define COMMCHUNKSIZE               (1 << 20)
+#endif /* COMMCHUNKSIZE */
+
+/*+ Maximum number of pending chunk receptions. +*/
+
+#define COMMCHUNKREQNBR             8
+
+/*+ Maximum number of bytes needed to encode
+    a given number of Gnum values with
+    commEncode(), at 7 bits per byte.        +*/
+
+#define COMMENCODESIZE(n)           ((n) * ((sizeof (Gnum) * 8 + 6) / 7))
+
 /*
 **  The type and structure definitions.
 */
@@ -62,9 +83,15 @@ typedef UINT                  Gunum;              /* Unsigned type of same width
 **  The function prototypes.
 */
 
+byte *                      commEncode          (byte * restrict, const Gnum * restrict const, const Gnum, Gnum);
+const byte *                commDecode          (const byte * restrict, Gnum * restrict const, const Gnum, Gnum);
 int                         commAllgatherv      (void * const, const Gnum, MPI_Datatype, void * const, const Gnum * const, const Gnum * const, MPI_Datatype, MPI_Comm);
 int                         commGatherv         (void * const, const Gnum, MPI_Datatype, void * const, const Gnum * const, const Gnum * const, MPI_Datatype, const int, MPI_Comm);
 int                         commScatterv        (void * const, const Gnum * const, const Gnum * const, MPI_Datatype, void * const, const Gnum, MPI_Datatype, const int, MPI_Comm);
+int                         commRecvChunk       (void * const, const Gnum, MPI_Datatype, const int, const int, MPI_Comm, MPI_Request * const, int * const);
+int                         commSendChunk       (const void * const, const Gnum, MPI_Datatype, const int, const int, MPI_Comm);
+int                         commGathervChunk    (void * const, const Gnum, MPI_Datatype, void * const, const Gnum * const, const Gnum * const, const int, const int, MPI_Comm);
+int                         commNodeData        (MPI_Comm, int * const, int * const);
 
 /*
 **  The macro definitions.
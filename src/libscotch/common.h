@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2016,2018-2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2016,2018-2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,7 +57,7 @@
 /**                # Version 6.1  : from : 02 apr 2021     **/
 /**                                 to   : 24 jun 2021     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 27 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -460,6 +460,8 @@ int                         contextCommit       (Context * const);
 int                         contextRandomClone  (Context * const);
 int                         contextThreadInit2  (Context * const, const int, const int * const);
 int                         contextThreadInit   (Context * const);
+int                         contextThreadClone  (Context * const, const Context * const, const int, const int);
+void                        contextThreadCloneExit (Context * const);
 int                         contextThreadLaunchSplit (Context * const, ContextSplitFunc const, void * const);
 int                         contextValuesInit   (Context * const, void * const, const size_t, const int, const size_t, const int, const size_t);
 int                         contextValuesGetDbl (Context * const, const int, double * const);
@@ -1,4 +1,4 @@
-/* Copyright 2019,2021-2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2021-2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                context management routines.            **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -59,6 +59,13 @@
 
 static ValuesContext        valudat = { NULL, NULL, 0, 0, 0, 0, 0 };
 
+#ifdef COMMON_PTHREAD
+static pthread_mutex_t      contextclonmutedat = PTHREAD_MUTEX_INITIALIZER; /*+ Lock for cached clone pool +*/
+#endif /* COMMON_PTHREAD */
+static ThreadContext *      contextclonthrdptr = NULL; /*+ Thread pool cached for context clones     +*/
+static int                  contextclonbusyval = 0; /*+ Set while cached pool is used by a clone    +*/
+static int                  contextclonkeytab[4];   /*+ Thread, core, process numbers of pool       +*/
+
 /***********************************/
 /*                                 */
 /* These routines handle contexts. */
@@ -227,6 +234,178 @@ Context * const             contptr)
   return (contextThreadInit2 (contptr, thrdnbr, NULL));
 }
 
+/* This routine frees the thread pool cached
+** for context clones. It is registered with
+** atexit() when the pool is first created.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+contextThreadCloneFree (void)
+{
+  if (contextclonthrdptr != NULL) {
+    threadContextExit (contextclonthrdptr);
+    memFree (contextclonthrdptr);
+    contextclonthrdptr = NULL;
+  }
+}
+
+/* This routine initializes a clone of the given
+** execution context, which shares its random and
+** values contexts but owns a separate thread context.
+** It is meant for centralized fallbacks of parallel
+** routines, which run sequential methods on all or
+** some of the processes, so that these methods can
+** use the share of node cores of their process, even
+** when the given context has fewer threads (e.g. one
+** thread per process) or more threads, competing for
+** the same cores with the other processes of the node.
+** Threads run on the share of the cores of the
+** calling process which corresponds to its rank
+** among the processes bound to the same cores.
+** When these cores are those of the whole node,
+** threads are bound to the cores of the share;
+** when they are shared with other processes on a
+** restricted set, threads are left unbound; when
+** they are private, threads are bound to them in
+** a round-robin way. The number of threads is
+** capped by the SCOTCH_PTHREAD_NUMBER environment
+** variable, if it is set.
+** The thread pool is created once per process and
+** kept until process exit, so that repeated fallbacks
+** do not pay for thread creation. It is re-created
+** only if the share of cores changes, and can be used
+** by one clone at a time; the calling thread keeps the
+** binding it received when the pool was created.
+** Such clones can only be freed by
+** contextThreadCloneExit().
+** It returns:
+** - 0   : if the clone has been initialized.
+** - 1   : if the clone would be the same as the
+**         given context, or if the cached pool is
+**         in use by another clone.
+** - 2   : on error.
+*/
+
+int
+contextThreadClone (
+Context * const             clonptr,
+const Context * const       contptr,
+const int                   procnbr,              /*+ Number of processes sharing the cores of the process +*/
+const int                   procnum)              /*+ Rank of the process among them                       +*/
+{
+  int *               coretab;
+  int                 corenbr;
+  int                 corefst;
+  int                 thrdnbr;
+  int                 thrdmax;
+  int                 thrdnum;
+  int                 o;
+
+  corenbr = threadSystemCoreAff (&corefst);
+  thrdnbr = corenbr / procnbr;                    /* Share cores evenly between processes */
+  thrdmax = envGetInt ("SCOTCH_PTHREAD_NUMBER", -1);
+  if ((thrdmax > 0) && (thrdnbr > thrdmax))       /* If user prescribed a maximum number of threads */
+    thrdnbr = thrdmax;
+  if (thrdnbr < 1)                                /* Always keep at least the calling thread */
+    thrdnbr = 1;
+  if ((thrdnbr == contextThreadNbr (contptr)) &&  /* If clone would not differ from given context */
+      ((procnbr <= 1) || (thrdnbr <= 1)))
+    return (1);
+
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&contextclonmutedat);
+#endif /* COMMON_PTHREAD */
+  o = 0;
+  if (contextclonbusyval != 0)                    /* If pool already used by a concurrent clone, use given context */
+    o = 1;
+  else if ((contextclonthrdptr == NULL) ||        /* If no pool or pool built for another share of cores */
+           (contextclonkeytab[0] != thrdnbr) || (contextclonkeytab[1] != corenbr) ||
+           (contextclonkeytab[2] != procnbr) || (contextclonkeytab[3] != procnum)) {
+    if (contextclonthrdptr != NULL)
+      contextThreadCloneFree ();
+    else if (atexit (contextThreadCloneFree) != 0) { /* Register cleaning routine on first creation */
+      errorPrint ("contextThreadClone: cannot register exit routine");
+      o = 2;
+    }
+
+    coretab = NULL;                               /* Assume private cores: round-robin binding */
+    if ((o == 0) && (procnbr > 1)) {
+      if ((coretab = memAlloc (thrdnbr * sizeof (int))) == NULL) {
+        errorPrint ("contextThreadClone: out of memory (1)");
+        o = 2;
+      }
+      else {
+        for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+          coretab[thrdnum] = (corenbr == threadSystemCoreNbr ()) /* If process not bound, bind threads to our share of node cores */
+                             ? ((procnum * thrdnbr) + thrdnum)
+                             : -1;                /* Else leave threads unbound within shared set of cores */
+      }
+    }
+    if (o == 0) {
+      if ((contextclonthrdptr = memAlloc (sizeof (ThreadContext))) == NULL) {
+        errorPrint ("contextThreadClone: out of memory (2)");
+        o = 2;
+      }
+      else if (threadContextInit (contextclonthrdptr, thrdnbr, coretab) != 0) {
+        memFree (contextclonthrdptr);
+        contextclonthrdptr = NULL;
+        o = 2;
+      }
+      else {
+        contextclonkeytab[0] = thrdnbr;
+        contextclonkeytab[1] = corenbr;
+        contextclonkeytab[2] = procnbr;
+        contextclonkeytab[3] = procnum;
+      }
+    }
+    if (coretab != NULL)
+      memFree (coretab);
+  }
+  if (o == 0)
+    contextclonbusyval = 1;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&contextclonmutedat);
+#endif /* COMMON_PTHREAD */
+  if (o != 0)
+    return (o);
+
+  clonptr->thrdptr = contextclonthrdptr;
+  clonptr->randptr = contptr->randptr;            /* Share random and values contexts with original context */
+  clonptr->valuptr = contptr->valuptr;
+
+  return (0);
+}
+
+/* This routine frees a context clone
+** created by contextThreadClone(). The
+** cached thread pool is released for
+** subsequent clones, but not freed.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+contextThreadCloneExit (
+Context * const             clonptr)
+{
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&contextclonmutedat);
+#endif /* COMMON_PTHREAD */
+  contextclonbusyval = 0;                         /* Only the thread context belongs to the clone, and it is cached */
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&contextclonmutedat);
+#endif /* COMMON_PTHREAD */
+
+#ifdef SCOTCH_DEBUG_CONTEXT1
+  clonptr->thrdptr = NULL;
+  clonptr->randptr = NULL;
+  clonptr->valuptr = NULL;
+#endif /* SCOTCH_DEBUG_CONTEXT1 */
+}
+
 /* This routine, to be called only by the leader thread
 ** of the current threading environment, splits this
 ** context into two sub-contexts, each of them inheriting
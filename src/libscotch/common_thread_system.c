@@ -1,4 +1,4 @@
-/* Copyright 2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                threads.                                **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 24 aug 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code mainly derives from that    **/
 /**                  of the Pastix solver.                 **/
@@ -51,6 +51,11 @@
 **  The defines and includes.
 */
 
+#ifdef COMMON_PTHREAD_AFFINITY_LINUX
+#define _GNU_SOURCE
+#include <sched.h>
+#endif /* COMMON_PTHREAD_AFFINITY_LINUX */
+
 #include "module.h"
 #include "common.h"
 #include "common_thread_system.h"
@@ -146,3 +151,34 @@ threadSystemCoreNbr ()
 }
 
 #endif /* COMMON_PTHREAD */
+
+/* This routine returns the number of cores
+** onto which the calling thread may run, and
+** sets the index of the first of them. When
+** affinity is not supported, all the cores of
+** the system are deemed available.
+** It returns:
+** - !0  : number of cores.
+*/
+
+int
+threadSystemCoreAff (
+int * const                 corefstptr)
+{
+#ifdef COMMON_PTHREAD_AFFINITY_LINUX
+  cpu_set_t           cpusdat;
+  int                 corenum;
+
+  if (pthread_getaffinity_np (pthread_self (), sizeof (cpu_set_t), &cpusdat) == 0) {
+    for (corenum = 0; corenum < CPU_SETSIZE; corenum ++) {
+      if (CPU_ISSET (corenum, &cpusdat)) {        /* If first available core found */
+        *corefstptr = corenum;
+        return (CPU_COUNT (&cpusdat));
+      }
+    }
+  }
+#endif /* COMMON_PTHREAD_AFFINITY_LINUX */
+
+  *corefstptr = 0;
+  return (threadSystemCoreNbr ());
+}
@@ -1,4 +1,4 @@
-/* Copyright 2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                management routines.                    **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 24 aug 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -49,3 +49,4 @@
 */
 
 int                         threadSystemCoreNbr (void);
+int                         threadSystemCoreAff (int * const);
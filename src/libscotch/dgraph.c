@@ -1,4 +1,4 @@
-/* Copyright 2007,2010,2012,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2010,2012,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,7 +57,7 @@
 /**                # Version 6.1  : from : 24 sep 2021     **/
 /**                                 to   : 24 sep 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,6 +67,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "comm.h"
 #include "dgraph.h"
 
 /*************************************/
@@ -154,6 +155,7 @@ Dgraph * restrict const     grafptr)
   if ((grafptr->flagval & DGRAPHFREEPRIV) != 0)   /* If private data has to be freed */
     if (grafptr->procdsptab != NULL)
       memFree (grafptr->procdsptab);              /* Free group leader of graph private data */
+  dgraphNgbFree (grafptr);                        /* Free neighborhood communicator, if any */
 }
 
 void
@@ -164,13 +166,17 @@ Dgraph * restrict const     grafptr)
   MPI_Comm            proccomm;                   /* Data for temporarily saving private data */
   int                 procglbnbr;
   int                 proclocnum;
+  int                 procnodnbr;
+  int                 procnodnum;
 
   dgraphFree2 (grafptr);                          /* Free all user fields */
 
-  flagval    = grafptr->flagval & DGRAPHFREECOMM;
+  flagval    = grafptr->flagval & (DGRAPHFREECOMM | DGRAPHHASNODE);
   proccomm   = grafptr->proccomm;                 /* Save private fields only */
   procglbnbr = grafptr->procglbnbr;
   proclocnum = grafptr->proclocnum;
+  procnodnbr = grafptr->procnodnbr;               /* Node data only depend on communicator */
+  procnodnum = grafptr->procnodnum;
 
   memSet (grafptr, 0, sizeof (Dgraph));           /* Reset graph structure */
 
@@ -178,6 +184,8 @@ Dgraph * restrict const     grafptr)
   grafptr->proccomm   = proccomm;
   grafptr->procglbnbr = procglbnbr;
   grafptr->proclocnum = proclocnum;
+  grafptr->procnodnbr = procnodnbr;
+  grafptr->procnodnum = procnodnum;
 
   return;
 }
@@ -208,3 +216,32 @@ Dgraph * restrict const     grafptr)
 #endif /* SCOTCH_DEBUG_DGRAPH1 */
   grafptr->flagval = flagval & ~DGRAPHBITSUSED;   /* A subsequent dgraphExit() will have no effect */
 }
+
+/* This routine computes, if not already done,
+** the number of processes of the graph
+** communicator which share the cores of the
+** calling process, and its rank among them.
+** These data are kept in the graph structure
+** so that subsequent calls are cheap.
+** This routine must be called collectively
+** the first time.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphNodeData (
+Dgraph * restrict const     grafptr)
+{
+  if ((grafptr->flagval & DGRAPHHASNODE) != 0)    /* If node data already computed, do nothing */
+    return (0);
+
+  if (commNodeData (grafptr->proccomm, &grafptr->procnodnbr, &grafptr->procnodnum) != MPI_SUCCESS) {
+    errorPrint ("dgraphNodeData: communication error");
+    return (1);
+  }
+  grafptr->flagval |= DGRAPHHASNODE;
+
+  return (0);
+}
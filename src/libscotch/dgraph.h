@@ -1,4 +1,4 @@
-/* Copyright 2007-2010,2012,2015,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2010,2012,2015,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -61,7 +61,7 @@
 /**                # Version 6.1  : from : 19 jun 2021     **/
 /**                                 to   : 19 jun 2021     **/
 /**                # Version 7.0  : from : 03 may 2019     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -77,6 +77,12 @@
 #define SCOTCH_COMM_PTOP_RAT        0.25          /* Percentage under which point-to-point is allowed */
 #endif /* SCOTCH_COMM_PTOP_RAT */
 
+/* Neighborhood collective communication. */
+
+#if ((defined MPI_VERSION) && (MPI_VERSION >= 3) && (! defined SCOTCH_MPI_NO_NGB_COLL))
+#define SCOTCH_MPI_NGB_COLL                       /* Use neighborhood collectives on distributed graph topologies */
+#endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3) && (! defined SCOTCH_MPI_NO_NGB_COLL)) */
+
 /* Graph flags. */
 
 #define DGRAPHNONE                  0x0000        /* No options set */
@@ -89,11 +95,14 @@
 #define DGRAPHHASEDGEGST            0x0020        /* Edge ghost array computed           */
 #define DGRAPHVERTGROUP             0x0040        /* All vertex arrays grouped           */
 #define DGRAPHEDGEGROUP             0x0080        /* All edge arrays grouped             */
-#define DGRAPHFREEALL               (DGRAPHFREEPRIV | DGRAPHFREECOMM | DGRAPHFREETABS | DGRAPHFREEPSID | DGRAPHFREEEDGEGST)
 #define DGRAPHCOMMPTOP              0x0100        /* Use point-to-point collective communication */
+#define DGRAPHHASNGBCOMM            0x0200        /* Neighborhood communicator computed          */
+#define DGRAPHFREENGBCOMM           0x0400        /* Set if neighborhood communicator freed      */
+#define DGRAPHHASNODE               0x0800        /* Node sharing data computed                  */
+#define DGRAPHFREEALL               (DGRAPHFREEPRIV | DGRAPHFREECOMM | DGRAPHFREETABS | DGRAPHFREEPSID | DGRAPHFREEEDGEGST | DGRAPHFREENGBCOMM)
 
-#define DGRAPHBITSUSED              0x01FF        /* Significant bits for plain distributed graph routines               */
-#define DGRAPHBITSNOTUSED           0x0200        /* Value above which bits not used by plain distributed graph routines */
+#define DGRAPHBITSUSED              0x0FFF        /* Significant bits for plain distributed graph routines               */
+#define DGRAPHBITSNOTUSED           0x1000        /* Value above which bits not used by plain distributed graph routines */
 
 /* Used in algorithms */
 
@@ -190,6 +199,10 @@ typedef struct Dgraph_ {
   int *                     procsndtab;           /*+ Number of vertices to send in ghost vertex sub-arrays     +*/
   int *                     procsidtab;           /*+ Array of indices to build communication vectors (send)    +*/
   int                       procsidnbr;           /*+ Size of the send index array                              +*/
+  MPI_Comm                  procngbcomm;          /*+ Neighborhood communicator, if DGRAPHHASNGBCOMM set        +*/
+  int *                     procngbdattab;        /*+ Neighbor count and displacement array of procngbcomm      +*/
+  int                       procnodnbr;           /*+ Number of processes sharing our cores, if DGRAPHHASNODE   +*/
+  int                       procnodnum;           /*+ Rank of this process among them, if DGRAPHHASNODE set     +*/
 } Dgraph;
 
 /*
@@ -199,7 +212,9 @@ typedef struct Dgraph_ {
 int                         dgraphInit          (Dgraph * const, MPI_Comm);
 void                        dgraphExit          (Dgraph * const);
 void                        dgraphFree          (Dgraph * const);
+int                         dgraphNodeData      (Dgraph * const);
 int                         dgraphLoad          (Dgraph * const, FILE * const, const Gnum, const DgraphFlag);
+int                         dgraphLoadShared    (Dgraph * const, const char * const, Gnum, const DgraphFlag);
 int                         dgraphSave          (Dgraph * const, FILE * const);
 int                         dgraphBuild         (Dgraph * const, const Gnum, const Gnum, const Gnum, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, const Gnum, const Gnum, Gnum * const, Gnum * const, Gnum * const);
 int                         dgraphBuild2        (Dgraph * const, const Gnum, const Gnum, const Gnum, Gnum * const, Gnum * const, Gnum * const, const Gnum, Gnum * const, Gnum * const, const Gnum, const Gnum, Gnum * const, Gnum * const, Gnum * const, const Gnum);
@@ -213,8 +228,8 @@ int                         dgraphView          (const Dgraph * const, FILE * co
 int                         dgraphGhst2         (Dgraph * const, const int);
 int                         dgraphBand          (Dgraph * restrict const, const Gnum, Gnum * restrict const, const GraphPart * restrict const, const Gnum, const Gnum, Gnum, Dgraph * restrict const, Gnum * restrict * const, GraphPart * restrict * const, Gnum * const, Gnum * const, Gnum * const, Context * restrict const);
 
-int                         dgraphFold          (const Dgraph * restrict const, const int, Dgraph * restrict const, const void * restrict const, void ** restrict const, MPI_Datatype);
-int                         dgraphFold2         (const Dgraph * restrict const, const int, Dgraph * const, MPI_Comm, const void * restrict const, void ** restrict const, MPI_Datatype);
+int                         dgraphFold          (const Dgraph * restrict const, const int, Dgraph * restrict const, const void * restrict const, void ** restrict const, MPI_Datatype, Context * restrict const);
+int                         dgraphFold2         (const Dgraph * restrict const, const int, Dgraph * const, MPI_Comm, const void * restrict const, void ** restrict const, MPI_Datatype, Context * restrict const);
 int                         dgraphFoldDup       (const Dgraph * restrict const, Dgraph * restrict const, void * restrict const, void ** restrict const, MPI_Datatype, Context * restrict const);
 int                         dgraphInduce2       (Dgraph * restrict const, Gnum (*) (Dgraph * restrict const, Dgraph * restrict const, const void * restrict const, Gnum * restrict const), const void * const, const Gnum, Gnum *, Dgraph * restrict const);
 
@@ -230,6 +245,14 @@ int                         dgraphScatter       (Dgraph * const, const Graph * c
 
 int                         dgraphHaloSync      (Dgraph * const, void * const, MPI_Datatype);
 
+int                         dgraphNgbComm       (Dgraph * const);
+void                        dgraphNgbFree       (Dgraph * const);
+int                         dgraphNgbAlltoall   (Dgraph * const, int * const, int * const);
+int                         dgraphNgbAlltoallv  (Dgraph * const, void * const, int * const, int * const, MPI_Datatype, void * const, int * const, int * const, MPI_Datatype);
+#ifdef SCOTCH_MPI_ASYNC_COLL
+int                         dgraphNgbIalltoallv (Dgraph * const, void * const, int * const, int * const, MPI_Datatype, void * const, int * const, int * const, MPI_Datatype, int * const, MPI_Request * const);
+#endif /* SCOTCH_MPI_ASYNC_COLL */
+
 /*
 **  The macro definitions.
 */
@@ -1,4 +1,4 @@
-/* Copyright 2007-2012,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2012,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**                # Version 6.0  : from : 03 apr 2012     **/
 /**                                 to   : 22 may 2018     **/
 /**                # Version 7.0  : from : 08 oct 2021     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code derives from the code of    **/
 /**                  vdgraph_separate_bd.c in version      **/
@@ -59,6 +59,7 @@
 #include "common.h"
 #include "context.h"
 #include "dgraph.h"
+#include "dgraph_band.h"
 
 /**********************************/
 /*                                */
@@ -89,6 +90,220 @@
 #undef DGRAPHBANDGROWENQU
 #undef DGRAPHBANDGROWSMUL
 
+/*****************************************/
+/*                                       */
+/* Band graph building thread routines.  */
+/*                                       */
+/*****************************************/
+
+/* This routine performs a prefix scan
+** sum operation on a single Gnum value,
+** backed by a temporary area.
+*/
+
+static
+void
+dgraphBandScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* This routine fills the vertex, edge and
+** part arrays of the band graph, for all
+** band vertices but the anchors. When several
+** threads are available, each of them first
+** counts the number of band edges of its
+** slice of band vertices, so that a prefix
+** scan provides the start index of its
+** edge sub-array. Since slices are made of
+** consecutive band vertices, the resulting
+** band graph is the same whatever the number
+** of threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+dgraphBandBuild (
+ThreadDescriptor * restrict const   descptr,
+DgraphBandData * restrict const     bandptr)
+{
+  Gnum                bandvertlocbas;
+  Gnum                bandvertlocend;
+  Gnum                bandvertloclvl;             /* End of slice vertices not belonging to last level */
+  Gnum                bandvertlocnum;
+  Gnum                bandedgelocnum;
+  Gnum                bandvertlocnbr1;
+  Gnum                bandvelolocsum;
+  Gnum                bandvelolocsum1;
+  Gnum                banddegrlocmax;
+  Gnum                veloval;
+
+  const Dgraph * restrict const     grafptr        = bandptr->grafptr;
+  const Gnum * restrict const       vertloctax     = grafptr->vertloctax;
+  const Gnum * restrict const       vendloctax     = grafptr->vendloctax;
+  const Gnum * restrict const       veloloctax     = grafptr->veloloctax;
+  const Gnum * restrict const       edgegsttax     = grafptr->edgegsttax;
+  const Gnum * restrict const       edloloctax     = grafptr->edloloctax;
+  const GraphPart * restrict const  partgsttax     = bandptr->partgsttax;
+  const Gnum * restrict const       bandvnumgsttax = bandptr->bandvnumgsttax;
+  Dgraph * restrict const           bandgrafptr    = bandptr->bandgrafptr;
+  Gnum * restrict const             bandvertloctax = bandgrafptr->vertloctax;
+  Gnum * restrict const             bandvnumloctax = bandgrafptr->vnumloctax;
+  Gnum * restrict const             bandveloloctax = bandgrafptr->veloloctax;
+  Gnum * restrict const             bandedgeloctax = bandptr->bandedgeloctax;
+  Gnum * restrict const             bandedloloctax = bandptr->bandedloloctax;
+  GraphPart * restrict const        bandpartgsttax = bandptr->bandpartgsttax;
+  const Gnum                        bandvertlocnnd = bandptr->bandvertlocnnd;
+  const Gnum                        bandvertlvlnum = bandptr->bandvertlvlnum;
+  const Gnum                        baseval        = grafptr->baseval;
+  const int                         thrdnbr        = threadNbr (descptr);
+  const int                         thrdnum        = threadNum (descptr);
+  DgraphBandThread * restrict const thrdptr        = &bandptr->thrdtab[thrdnum];
+
+  bandvertlocbas = baseval + DATASCAN (bandvertlocnnd - baseval, thrdnbr, thrdnum);
+  bandvertlocend = baseval + DATASCAN (bandvertlocnnd - baseval, thrdnbr, thrdnum + 1);
+  bandvertloclvl = MAX (bandvertlocbas, MIN (bandvertlocend, bandvertlvlnum));
+
+  thrdptr->retuval = 0;
+
+  bandedgelocnum = baseval;
+  if (thrdnbr > 1) {                              /* If several threads, compute start index of edge sub-array */
+    Gnum                bandedgelocnbr;
+
+    for (bandvertlocnum = bandvertlocbas, bandedgelocnbr = 0; /* Vertices that do not belong to the last level keep all their edges */
+         bandvertlocnum < bandvertloclvl; bandvertlocnum ++) {
+      Gnum                vertlocnum;
+
+      vertlocnum = bandvnumloctax[bandvertlocnum];
+      bandedgelocnbr += vendloctax[vertlocnum] - vertloctax[vertlocnum];
+    }
+    for ( ; bandvertlocnum < bandvertlocend; bandvertlocnum ++) { /* Vertices of last level keep edges to band vertices, plus anchor edge */
+      Gnum                vertlocnum;
+      Gnum                edgelocnum;
+
+      vertlocnum = bandvnumloctax[bandvertlocnum];
+      for (edgelocnum = vertloctax[vertlocnum]; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++)
+        bandedgelocnbr += (bandvnumgsttax[edgegsttax[edgelocnum]] != ~0) ? 1 : 0;
+      bandedgelocnbr ++;
+    }
+
+    thrdptr->scantab[0] = bandedgelocnbr;
+    threadScan (descptr, &thrdptr->scantab[0], sizeof (DgraphBandThread), (ThreadScanFunc) dgraphBandScan, NULL);
+    bandedgelocnum += thrdptr->scantab[0] - bandedgelocnbr; /* Start index is sum of edge counts of previous threads */
+  }
+
+  veloval = 1;
+  bandvertlocnbr1 = 0;
+  bandvelolocsum  = 0;
+  bandvelolocsum1 = 0;
+  banddegrlocmax  = 0;
+  for (bandvertlocnum = bandvertlocbas;           /* For all slice vertices that do not belong to the last level */
+       bandvertlocnum < bandvertloclvl; bandvertlocnum ++) {
+    Gnum              vertlocnum;
+    Gnum              edgelocnum;
+    Gnum              degrval;
+    GraphPart         partval;
+    Gnum              partval1;
+
+    vertlocnum = bandvnumloctax[bandvertlocnum];
+    partval    = partgsttax[vertlocnum];
+#ifdef SCOTCH_DEBUG_DGRAPH2
+    if (partval > 2) {
+      errorPrint ("dgraphBandBuild: internal error (1)");
+      thrdptr->retuval = 1;
+      return;
+    }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+    partval1 = partval & 1;
+    bandvertlocnbr1 += partval1;                  /* Count vertices in part 1 */
+    bandpartgsttax[bandvertlocnum] = partval;
+    bandvertloctax[bandvertlocnum] = bandedgelocnum;
+    if (veloloctax != NULL) {
+      veloval = veloloctax[vertlocnum];
+      bandvelolocsum  += veloval;
+      bandvelolocsum1 += veloval & (- partval1);  /* Sum vertex load if (partval == 1) */
+    }
+    bandveloloctax[bandvertlocnum] = veloval;
+
+    degrval = vendloctax[vertlocnum] - vertloctax[vertlocnum];
+    if (banddegrlocmax < degrval)
+      banddegrlocmax = degrval;
+
+    if (bandedloloctax != NULL)                   /* If graph has edge weights, copy loads */
+      memCpy (bandedloloctax + bandedgelocnum, edloloctax + vertloctax[vertlocnum], degrval * sizeof (Gnum));
+    for (edgelocnum = vertloctax[vertlocnum];     /* For all original edges */
+         edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+#ifdef SCOTCH_DEBUG_DGRAPH2
+      if (bandvnumgsttax[edgegsttax[edgelocnum]] == ~0) { /* All ends should belong to the band graph too */
+        errorPrint ("dgraphBandBuild: internal error (2)");
+        thrdptr->retuval = 1;
+        return;
+      }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+      bandedgeloctax[bandedgelocnum ++] = bandvnumgsttax[edgegsttax[edgelocnum]];
+    }
+  }
+  for ( ; bandvertlocnum < bandvertlocend; bandvertlocnum ++) { /* For all slice vertices that belong to the last level */
+    Gnum              vertlocnum;
+    Gnum              edgelocnum;
+    Gnum              degrval;
+    GraphPart         partval;
+    Gnum              partval1;
+
+    vertlocnum = bandvnumloctax[bandvertlocnum];
+    partval    = partgsttax[vertlocnum];
+#ifdef SCOTCH_DEBUG_DGRAPH2
+    if (partval > 2) {
+      errorPrint ("dgraphBandBuild: internal error (3)");
+      thrdptr->retuval = 1;
+      return;
+    }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+    partval1 = partval & 1;
+    bandvertlocnbr1 += partval1;                  /* Count vertices in part 1 */
+    bandpartgsttax[bandvertlocnum] = partval;
+    bandvertloctax[bandvertlocnum] = bandedgelocnum;
+    if (veloloctax != NULL) {
+      veloval = veloloctax[vertlocnum];
+      bandvelolocsum  += veloval;
+      bandvelolocsum1 += veloval & (- partval1);  /* Sum vertex load if (partval == 1) */
+    }
+    bandveloloctax[bandvertlocnum] = veloval;
+
+    for (edgelocnum = vertloctax[vertlocnum];     /* For all original edges */
+         edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+      Gnum              bandvertlocend;
+
+      bandvertlocend = bandvnumgsttax[edgegsttax[edgelocnum]];
+      if (bandvertlocend != ~0) {                 /* If end vertex belongs to band graph  */
+        if (bandedloloctax != NULL)               /* If graph has edge weights, copy load */
+          bandedloloctax[bandedgelocnum] = edloloctax[edgelocnum];
+        bandedgeloctax[bandedgelocnum ++] = bandvertlocend;
+      }
+    }
+    if (bandedloloctax != NULL)                   /* If graph has edge weights */
+      bandedloloctax[bandedgelocnum] = 1;         /* Edge to anchor has load 1 */
+    bandedgeloctax[bandedgelocnum ++] = bandvertlocnnd + bandptr->bandvertlocadj + partval1; /* Add edge to anchor of proper part */
+
+    degrval = bandedgelocnum - bandvertloctax[bandvertlocnum];
+    if (banddegrlocmax < degrval)
+      banddegrlocmax = degrval;
+  }
+
+  thrdptr->scantab[1]  = bandedgelocnum;          /* Record end of edge sub-array */
+  thrdptr->vertlocnbr1 = bandvertlocnbr1;
+  thrdptr->velolocsum  = bandvelolocsum;
+  thrdptr->velolocsum1 = bandvelolocsum1;
+  thrdptr->degrlocmax  = banddegrlocmax;
+}
+
 /*****************************/
 /*                           */
 /* This is the main routine. */
@@ -141,18 +356,23 @@ Context *                           contptr)      /*+ Execution context
   Gnum * restrict         bandvnumgsttax;         /* Indices of selected band vertices in band graph           */
   Gnum                    banddegrlocmax;
   Gnum                    degrval;
-  Gnum                    veloval;
-  const Gnum * restrict   edgegsttax;
+  DgraphBandData          banddat;
+  DgraphBandThread *      thrdtab;
+  int                     thrdnum;
   Gnum                    fronlocnum;
   int                     cheklocval;
   int                     procngbnum;
 
+  const int               thrdnbr = contextThreadNbr (contptr);
+
   if (dgraphGhst (grafptr) != 0) {                /* Compute ghost edge array if not already present */
     errorPrint ("dgraphBand: cannot compute ghost edge array");
     return (1);
   }
 
-  cheklocval = 0;
+  cheklocval     = 0;
+  bandfronloctab = NULL;
+  bandpartgsttax = NULL;
   bandvnumgstsiz = MAX ((grafptr->vertgstnbr * sizeof (Gnum)), (grafptr->procglbnbr * sizeof (int))); /* TRICK: re-use array for further error collective communications */
  if ((bandvnumgsttax = memAlloc (bandvnumgstsiz)) == NULL) /* Error will be propagated by dgraphBand2*() */
     errorPrint ("dgraphBand: out of memory (1)");
@@ -216,8 +436,13 @@ Context *                           contptr)      /*+ Execution context
       errorPrint ("dgraphBand: out of memory (6)");
       cheklocval = 1;
     }
-    else
+    else {
       bandpartgsttax -= bandgrafptr->baseval;
+      if ((thrdtab = memAlloc (thrdnbr * sizeof (DgraphBandThread))) == NULL) {
+        errorPrint ("dgraphBand: out of memory (7)");
+        cheklocval = 1;
+      }
+    }
   }
 
   if (cheklocval != 0) {                          /* In case of memory error */
@@ -227,6 +452,8 @@ Context *                           contptr)      /*+ Execution context
       errorPrint ("dgraphBand: communication error (1)");
       return (1);
     }
+    if (bandpartgsttax != NULL)
+      memFree (bandpartgsttax + bandgrafptr->baseval);
     if (bandfronloctab != NULL)
       memFree (bandfronloctab);
     dgraphFree (bandgrafptr);
@@ -248,6 +475,7 @@ Context *                           contptr)      /*+ Execution context
 
   for (procngbnum = 1; procngbnum <= grafptr->procglbnbr; procngbnum ++) { /* Process potential error flags from other processes */
     if (bandgrafptr->procdsptab[procngbnum] < 0) { /* If error notified by another process                                       */
+      memFree (thrdtab);
       if (bandpartgsttax != NULL)
         memFree (bandpartgsttax + bandgrafptr->baseval);
       if (bandfronloctab != NULL)
@@ -285,101 +513,39 @@ Context *                           contptr)      /*+ Execution context
     return (1);
   }
 
-  edgegsttax = grafptr->edgegsttax;
+  bandvertloctax = bandgrafptr->vertloctax;
+
+  banddat.grafptr        = grafptr;
+  banddat.bandgrafptr    = bandgrafptr;
+  banddat.partgsttax     = partgsttax;
+  banddat.bandvnumgsttax = bandvnumgsttax;
+  banddat.bandedgeloctax = bandedgeloctax;
+  banddat.bandedloloctax = bandedloloctax;
+  banddat.bandpartgsttax = bandpartgsttax;
+  banddat.bandvertlvlnum = bandvertlvlnum;
+  banddat.bandvertlocnnd = bandvertlocnnd;
+  banddat.bandvertlocadj = bandvertlocadj;
+  banddat.thrdtab        = thrdtab;
+  contextThreadLaunch (contptr, (ThreadFunc) dgraphBandBuild, (void *) &banddat); /* Build band vertex and edge arrays */
 
-  veloval = 1;
-  bandvertloctax  = bandgrafptr->vertloctax;
   bandvertlocnbr1 = 0;
   bandvelolocsum  = 0;
   bandvelolocsum1 = 0;
   banddegrlocmax  = 0;
-  for (bandvertlocnum = bandedgelocnum = bandgrafptr->baseval; /* Build global vertex array of band graph             */
-       bandvertlocnum < bandvertlvlnum; bandvertlocnum ++) { /* For all vertices that do not belong to the last level */
-    Gnum              vertlocnum;
-    Gnum              edgelocnum;
-    Gnum              degrval;
-    GraphPart         partval;
-    Gnum              partval1;
-
-    vertlocnum = bandgrafptr->vnumloctax[bandvertlocnum];
-    partval    = partgsttax[vertlocnum];
-#ifdef SCOTCH_DEBUG_DGRAPH2
-    if (partval > 2) {
-      errorPrint ("dgraphBand: internal error (1)");
-      return (1);
-    }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
-    partval1 = partval & 1;
-    bandvertlocnbr1 += partval1;                  /* Count vertices in part 1 */
-    bandpartgsttax[bandvertlocnum] = partval;
-    bandvertloctax[bandvertlocnum] = bandedgelocnum;
-    if (grafptr->veloloctax != NULL) {
-      veloval = grafptr->veloloctax[vertlocnum];
-      bandvelolocsum  += veloval;
-      bandvelolocsum1 += veloval & (- partval1);  /* Sum vertex load if (partval == 1) */
-    }
-    bandgrafptr->veloloctax[bandvertlocnum] = veloval;
-
-    degrval = grafptr->vendloctax[vertlocnum] - grafptr->vertloctax[vertlocnum];
-    if (banddegrlocmax < degrval)
-      banddegrlocmax = degrval;
-
-    for (edgelocnum = grafptr->vertloctax[vertlocnum]; /* For all original edges */
-         edgelocnum < grafptr->vendloctax[vertlocnum]; edgelocnum ++) {
-#ifdef SCOTCH_DEBUG_DGRAPH2
-      if (bandvnumgsttax[edgegsttax[edgelocnum]] == ~0) { /* All ends should belong to the band graph too */
-        errorPrint ("dgraphBand: internal error (2)");
-        return (1);
-      }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
-      bandedgeloctax[bandedgelocnum ++] = bandvnumgsttax[edgegsttax[edgelocnum]];
-    }
-  }
-  for ( ; bandvertlocnum < bandvertlocnnd; bandvertlocnum ++) { /* For all vertices that belong to the last level except anchors */
-    Gnum              vertlocnum;
-    Gnum              edgelocnum;
-    Gnum              degrval;
-    GraphPart         partval;
-    Gnum              partval1;
-
-    vertlocnum = bandgrafptr->vnumloctax[bandvertlocnum];
-    partval    = partgsttax[vertlocnum];
-#ifdef SCOTCH_DEBUG_DGRAPH2
-    if (partval > 2) {
-      errorPrint ("dgraphBand: internal error (3)");
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) { /* Accumulate data of all threads */
+    if (thrdtab[thrdnum].retuval != 0) {
+      errorPrint ("dgraphBand: cannot build band graph arrays");
       return (1);
     }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
-    partval1 = partval & 1;
-    bandvertlocnbr1 += partval1;                  /* Count vertices in part 1 */
-    bandpartgsttax[bandvertlocnum] = partval;
-    bandvertloctax[bandvertlocnum] = bandedgelocnum;
-    if (grafptr->veloloctax != NULL) {
-      veloval = grafptr->veloloctax[vertlocnum];
-      bandvelolocsum  += veloval;
-      bandvelolocsum1 += veloval & (- partval1);  /* Sum vertex load if (partval == 1) */
-    }
-    bandgrafptr->veloloctax[bandvertlocnum] = veloval;
-
-    for (edgelocnum = grafptr->vertloctax[vertlocnum]; /* For all original edges */
-         edgelocnum < grafptr->vendloctax[vertlocnum]; edgelocnum ++) {
-      Gnum              bandvertlocend;
-
-      bandvertlocend = bandvnumgsttax[edgegsttax[edgelocnum]];
-      if (bandvertlocend != ~0) {                 /* If end vertex belongs to band graph  */
-        if (bandedloloctax != NULL)               /* If graph has edge weights, copy load */
-          bandedloloctax[bandedgelocnum] = grafptr->edloloctax[edgelocnum];
-        bandedgeloctax[bandedgelocnum ++] = bandvertlocend;
-      }
-    }
-    if (bandedloloctax != NULL)                   /* If graph has edge weights */
-      bandedloloctax[bandedgelocnum] = 1;         /* Edge to anchor has load 1 */
-    bandedgeloctax[bandedgelocnum ++] = bandvertlocnnd + bandvertlocadj + partval1; /* Add edge to anchor of proper part */
-
-    degrval = bandedgelocnum - bandvertloctax[bandvertlocnum];
-    if (banddegrlocmax < degrval)
-      banddegrlocmax = degrval;
+    bandvertlocnbr1 += thrdtab[thrdnum].vertlocnbr1;
+    bandvelolocsum  += thrdtab[thrdnum].velolocsum;
+    bandvelolocsum1 += thrdtab[thrdnum].velolocsum1;
+    if (banddegrlocmax < thrdtab[thrdnum].degrlocmax)
+      banddegrlocmax = thrdtab[thrdnum].degrlocmax;
   }
+  bandvertlocnum = bandvertlocnnd;
+  bandedgelocnum = thrdtab[thrdnbr - 1].scantab[1]; /* End of edge sub-array of last thread */
+  memFree (thrdtab);
 
   memFree (bandvnumgsttax + bandgrafptr->baseval); /* Free useless space */
 
@@ -416,18 +582,7 @@ Context *                           contptr)      /*+ Execution context
     Gnum              edgelocnum;
     Gnum              edgelocnnd;
 
-    for (bandvertlocnum = bandgrafptr->baseval;   /* For all vertices that do not belong to the last level */
-         bandvertlocnum < bandvertlvlnum; bandvertlocnum ++) {
-      Gnum              vertlocnum;
-      Gnum              bandedgelocnum;
-
-      vertlocnum     = bandgrafptr->vnumloctax[bandvertlocnum];
-      bandedgelocnum = bandvertloctax[bandvertlocnum];
-      memCpy (bandedloloctax + bandedgelocnum,    /* Copy edge load array */
-              &grafptr->edloloctax[grafptr->vertloctax[vertlocnum]],
-              (bandvertloctax[bandvertlocnum + 1] - bandedgelocnum) * sizeof (Gnum));
-    }                                             /* Vertices of last level have been processed before */
-    for (edgelocnum = bandvertloctax[bandvertlocnnd], /* Loads of anchor edges are all 1's too         */
+    for (edgelocnum = bandvertloctax[bandvertlocnnd], /* Loads of anchor edges are all 1's; others already set */
          edgelocnnd = bandvertloctax[bandvertlocnnd + 2];
          edgelocnum < edgelocnnd; edgelocnum ++)
       bandedloloctax[edgelocnum] = 1;
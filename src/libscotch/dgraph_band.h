@@ -0,0 +1,76 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : dgraph_band.h                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This file provides the data structures  **/
+/**                for the distributed band graph          **/
+/**                building routine.                       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct DgraphBandThread_ {
+  Gnum                      scantab[2];           /*+ Edge count and start index; TRICK: FIRST +*/
+  Gnum                      vertlocnbr1;          /*+ Number of band vertices in part 1        +*/
+  Gnum                      velolocsum;           /*+ Sum of vertex loads                      +*/
+  Gnum                      velolocsum1;          /*+ Sum of vertex loads in part 1            +*/
+  Gnum                      degrlocmax;           /*+ Maximum degree                           +*/
+  int                       retuval;              /*+ Return value                             +*/
+} DgraphBandThread;
+
+/*+ The band graph building data structure. +*/
+
+typedef struct DgraphBandData_ {
+  const Dgraph *            grafptr;              /*+ Original graph                              +*/
+  Dgraph *                  bandgrafptr;          /*+ Band graph being built                      +*/
+  const GraphPart *         partgsttax;           /*+ Part array of original graph                +*/
+  const Gnum *              bandvnumgsttax;       /*+ Global band indices of original vertices    +*/
+  Gnum *                    bandedgeloctax;       /*+ Band edge array                             +*/
+  Gnum *                    bandedloloctax;       /*+ Band edge load array, if any                +*/
+  GraphPart *               bandpartgsttax;       /*+ Band part array                             +*/
+  Gnum                      bandvertlvlnum;       /*+ Index of first band vertex of last level    +*/
+  Gnum                      bandvertlocnnd;       /*+ End of band vertex array, without anchors   +*/
+  Gnum                      bandvertlocadj;       /*+ Local-to-global band index adjustment      +*/
+  DgraphBandThread *        thrdtab;              /*+ Array of thread data blocks                 +*/
+} DgraphBandData;
@@ -1,4 +1,4 @@
-/* Copyright 2007-2012,2018,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2012,2018,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 03 apr 2012     **/
 /**                                 to   : 21 may 2018     **/
 /**                # Version 7.0  : from : 01 oct 2021     **/
-/**                                 to   : 08 oct 2021     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code derives from the code of    **/
 /**                  vdgraph_separate_bd.c in version      **/
@@ -256,12 +256,12 @@ Context *                         contptr)        /*+ Execution context
       vsndcnttab[procglbnum] = nsndidxtab[procngbnum] - vsnddsptab[procglbnum];
     }
 
-    if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, vrcvcnttab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS) {
+    if (dgraphNgbAlltoall (grafptr, vsndcnttab, vrcvcnttab) != 0) {
       errorPrint (DGRAPHBANDGROWNSTR "Coll: communication error (2)");
       return     (1);
     }
-    if (MPI_Alltoallv (vsnddattab, vsndcnttab, vsnddsptab, GNUM_MPI,
-                       vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
+    if (dgraphNgbAlltoallv (grafptr, vsnddattab, vsndcnttab, vsnddsptab, GNUM_MPI,
+                                     vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI) != 0) {
       errorPrint (DGRAPHBANDGROWNSTR "Coll: communication error (3)");
       return     (1);
     }
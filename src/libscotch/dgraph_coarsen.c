@@ -1,4 +1,4 @@
-/* Copyright 2007-2012,2014,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2012,2014,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 17 jun 2021     **/
 /**                                 to   : 27 dec 2021     **/
 /**                # Version 7.0  : from : 14 jan 2020     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -244,7 +244,6 @@ DgraphCoarsenData * restrict const  coarptr)
 {
   int                 procngbnum;
 
-  MPI_Comm                      proccomm   = coarptr->finegrafptr->proccomm;
   Dgraph * restrict const       grafptr    = coarptr->finegrafptr;
   const Gnum                    vertlocadj = grafptr->procvrttab[grafptr->proclocnum] - grafptr->baseval;
   const int                     procngbnbr = grafptr->procngbnbr;
@@ -268,12 +267,12 @@ DgraphCoarsenData * restrict const  coarptr)
     vsnddsptab[procglbnum] = 2 * coarptr->vsnddsptab[procglbnum];
   }
 
-  if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, coarptr->vrcvcnttab, 1, MPI_INT, proccomm) != MPI_SUCCESS) {
+  if (dgraphNgbAlltoall (grafptr, vsndcnttab, coarptr->vrcvcnttab) != 0) {
     errorPrint ("dgraphCoarsenBuildColl: communication error (1)");
     return (1);
   }
-  if (MPI_Alltoallv (coarptr->vsnddattab, vsndcnttab,          vsnddsptab, GNUM_MPI,
-                     coarptr->vrcvdattab, coarptr->vrcvcnttab, vrcvdsptab, GNUM_MPI, proccomm) != MPI_SUCCESS) {
+  if (dgraphNgbAlltoallv (grafptr, coarptr->vsnddattab, vsndcnttab,          vsnddsptab, GNUM_MPI,
+                                   coarptr->vrcvdattab, coarptr->vrcvcnttab, vrcvdsptab, GNUM_MPI) != 0) {
     errorPrint ("dgraphCoarsenBuildColl: communication error (2)");
     return (1);
   }
@@ -1207,7 +1206,7 @@ DgraphCoarsenData * restrict const  coarptr)
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
 
 #ifdef SCOTCH_DEBUG_DGRAPH2
-  if (MPI_Alltoall (esndcnttab, 1, MPI_INT, ercvdbgtab, 1, MPI_INT, proccomm) != MPI_SUCCESS) {
+  if (dgraphNgbAlltoall (finegrafptr, esndcnttab, ercvdbgtab) != 0) {
     errorPrint ("dgraphCoarsenBuild: communication error (3)");
     return (1);
   }
@@ -1218,8 +1217,8 @@ DgraphCoarsenData * restrict const  coarptr)
     }
   }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
-  if (MPI_Alltoallv (esnddattab, esndcnttab, esnddsptab, GNUM_MPI,
-                     ercvdattab, ercvcnttab, ercvdsptab, GNUM_MPI, proccomm) != MPI_SUCCESS) {
+  if (dgraphNgbAlltoallv (finegrafptr, esnddattab, esndcnttab, esnddsptab, GNUM_MPI,
+                                      ercvdattab, ercvcnttab, ercvdsptab, GNUM_MPI) != 0) {
     errorPrint ("dgraphCoarsenBuild: communication error (4)");
     return (1);
   }
@@ -1458,7 +1457,7 @@ Context * restrict const              contptr)    /*+ Execution context
     coarmultptr = NULL;                           /* Assume we will not get a multinode array     */
     if ((flagval & DGRAPHCOARSENFOLDDUP) == DGRAPHCOARSENFOLD) { /* Do a simple folding           */
       memSet (coargrafptr, 0, sizeof (Dgraph));   /* Also reset procglbnbr for unused processes   */
-      o = dgraphFold (&coargrafdat, 0, coargrafptr, (void *) matedat.c.multloctab, (void **) (void *) &coarmultptr, coarmultype);
+      o = dgraphFold (&coargrafdat, 0, coargrafptr, (void *) matedat.c.multloctab, (void **) (void *) &coarmultptr, coarmultype, contptr);
     }
     else {                                        /* Do a duplicant-folding */
       int               loopval;
@@ -1,4 +1,4 @@
-/* Copyright 2007-2011,2014,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2011,2014,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.1  : from : 18 jun 2021     **/
 /**                                 to   : 19 jun 2021     **/
 /**                # Version 7.0  : from : 14 sep 2021     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -57,6 +57,8 @@
 
 #include "module.h"
 #include "common.h"
+#include "context.h"
+#include "comm.h"
 #include "dgraph.h"
 #include "dgraph_fold.h"
 #include "dgraph_fold_comm.h"
@@ -68,6 +70,73 @@
 /*                            */
 /******************************/
 
+/* This routine renumbers the end vertices of
+** a compact edge sub-array from their global
+** indices in the original graph to their global
+** indices in the folded graph. Source and
+** destination arrays may be the same.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+dgraphFold2Edge (
+const Gnum * const              orgedgetab,       /*+ Un-based source edge sub-array                          +*/
+Gnum * const                    fldedgetab,       /*+ Un-based destination edge sub-array, may be orgedgetab  +*/
+const Gnum                      edgenbr,          /*+ Number of edges to process                              +*/
+const Gnum                      vertglbbas,       /*+ Global index of first vertex owning the edges           +*/
+const int                       vertadjnbr,       /*+ Number of adjustment ranges                             +*/
+const Gnum * restrict const     vertadjtab,       /*+ Array of global start indices for adjustment slots      +*/
+const Gnum * restrict const     vertdlttab)       /*+ Array of index adjustments for original global indices  +*/
+{
+  Gnum              orgvertlocmin;
+  Gnum              orgvertlocmax;
+  Gnum              fldvertlocadj;
+  Gnum              edgenum;
+  int               procngbnum;
+  int               procngbmax;
+
+  for (procngbnum = 0, procngbmax = vertadjnbr;   /* Initialize search accelerator */
+       procngbmax - procngbnum > 1; ) {
+    int               procngbmed;
+
+    procngbmed = (procngbmax + procngbnum) / 2;
+    if (vertadjtab[procngbmed] <= vertglbbas)
+      procngbnum = procngbmed;
+    else
+      procngbmax = procngbmed;
+  }
+  orgvertlocmin = vertadjtab[procngbnum];
+  orgvertlocmax = vertadjtab[procngbmax];
+  fldvertlocadj = vertdlttab[procngbnum];
+  for (edgenum = 0; edgenum < edgenbr; edgenum ++) {
+    Gnum              orgvertlocend;
+
+    orgvertlocend = orgedgetab[edgenum];
+
+    if ((orgvertlocend >= orgvertlocmin) &&       /* If end vertex is local */
+        (orgvertlocend <  orgvertlocmax))
+      fldedgetab[edgenum] = orgvertlocend + fldvertlocadj;
+    else {                                        /* End vertex is not local */
+      int               procngbnum;
+      int               procngbmax;
+
+      for (procngbnum = 0, procngbmax = vertadjnbr;
+           procngbmax - procngbnum > 1; ) {
+        int               procngbmed;
+
+        procngbmed = (procngbmax + procngbnum) / 2;
+        if (vertadjtab[procngbmed] <= orgvertlocend)
+          procngbnum = procngbmed;
+        else
+          procngbmax = procngbmed;
+      }
+      fldedgetab[edgenum] = orgvertlocend + vertdlttab[procngbnum];
+    }
+  }
+}
+
 /* This routine builds a folded graph by merging graph
 ** data to the processes of the first half or to the
 ** second half of the communicator.
@@ -85,7 +154,8 @@ const int                     partval,            /*+ 0 for first half, 1 for se
 Dgraph * restrict const       fldgrafptr,
 const void * restrict const   orgdataptr,         /*+ Un-based array of data which must be folded, e.g. coarmulttab              +*/
 void ** const                 flddataptr,         /*+ Un-based array of data which must be folded, e.g. coarmulttab [norestrict] +*/
-MPI_Datatype                  datatype)
+MPI_Datatype                  datatype,
+Context * restrict const      contptr)            /*+ Execution context                                                          +*/
 {
   int               fldprocnbr;
   int               fldprocnum;                   /* Index of local process in folded communicator   */
@@ -106,7 +176,7 @@ MPI_Datatype                  datatype)
     return (1);
   }
 
-  o = dgraphFold2 (orggrafptr, partval, fldgrafptr, fldproccomm, orgdataptr, flddataptr, datatype);
+  o = dgraphFold2 (orggrafptr, partval, fldgrafptr, fldproccomm, orgdataptr, flddataptr, datatype, contptr);
   fldgrafptr->prockeyval = fldproccol;            /* Key of folded communicator is always zero if no duplication occurs */
 
   return (o);
@@ -120,7 +190,8 @@ Dgraph * const                fldgrafptr,         /*+ Folded graph structure to
 MPI_Comm                      fldproccomm,
 const void * restrict const   orgdataptr,         /*+ Un-based array of data which must be kept, e.g. coarmulttab  +*/
 void ** const                 flddataptr,         /*+ Un-based array of data which must be kept, e.g. coarmulttab  +*/
-MPI_Datatype                  datatype)
+MPI_Datatype                  datatype,
+Context * restrict const      contptr)            /*+ Execution context                                            +*/
 {
   Gnum * restrict               orgvertloctax;    /* Pointer to (possible compacted) vertex array                     */ 
   Gnum * restrict               orgedgeloctax;    /* Pointer to (possible compacted) edge array                       */
@@ -131,7 +202,10 @@ MPI_Datatype                  datatype)
   Gnum *                        fldvertidxtab;    /* Start indices of vertex arrays [norestrict]                      */
   Gnum *                        fldedgeidxtab;    /* Start indices of edge arrays [norestrict]                        */
   Gnum *                        fldedgecnttab;    /* Number of edges exchanged during each communication [norestrict] */
-  Gnum *                        fldedgecnptab;    /* Temporary save for fldedgecnttab for MPI standard [norestrict]   */
+  Gnum *                        fldedgemsgtab;    /* Edge size messages, preserved while communication in progress    */
+  Gnum *                        fldbytedsptab;    /* Start indices of compressed edge data [norestrict]               */
+  byte *                        fldbsndtab;       /* Compressed edge data to send                                     */
+  byte *                        fldbrcvtab;       /* Compressed edge data received                                    */
   Gnum                          fldvertlocnbr;    /* Number of vertices in local folded part                          */
   Gnum                          fldedgelocsiz;    /* (Upper bound of) number of edges in folded graph                 */
   Gnum                          fldedlolocsiz;    /* (Upper bound of) number of edge loads in folded graph            */
@@ -147,6 +221,14 @@ MPI_Datatype                  datatype)
   int                           requnbr;
   MPI_Request * restrict        requtab;
   int                           infosiz;          /* Size of one information                                          */
+  INT                           compval;          /* Flag set if edge data are to be compressed                       */
+#ifdef DGRAPHFOLDSHM
+  MPI_Comm                      nodecomm;         /* Communicator of processes located on the same node               */
+  MPI_Group                     procgrup;         /* Group of original communicator                                   */
+  MPI_Group                     nodegrup;         /* Group of node communicator                                       */
+  MPI_Win                       nodewin;          /* Shared-memory window holding edge data sent within the node      */
+  Gnum *                        nodesegtab;       /* Local segment of shared-memory window                            */
+#endif /* DGRAPHFOLDSHM */
 
   const Gnum                    orgprocvrtbas = orggrafptr->procvrttab[orggrafptr->proclocnum];
 
@@ -282,7 +364,8 @@ MPI_Datatype                  datatype)
                       &fldvertidxtab, (size_t) (commmax * sizeof (Gnum)),
                       &fldedgeidxtab, (size_t) (commmax * sizeof (Gnum)),
                       &fldedgecnttab, (size_t) (commmax * sizeof (Gnum)),
-                      &fldedgecnptab, (size_t) (commmax * sizeof (Gnum)),
+                      &fldedgemsgtab, (size_t) (DGRAPHFOLDMESGSIZE * commmax * sizeof (Gnum)),
+                      &fldbytedsptab, (size_t) (commmax * sizeof (Gnum)),
                       &requtab,       (size_t) (commmax * DGRAPHFOLDTAGNBR * sizeof (MPI_Request)), NULL) == NULL)) {
     errorPrint ("dgraphFold2: out of memory (5)");
     cheklocval = 1;
@@ -307,31 +390,133 @@ MPI_Datatype                  datatype)
     return (1);
   }
 
-  requnbr = 0;                                    /* Communications without further processing are placed at beginning of array */
+#ifdef DGRAPHFOLDSHM
+  if ((MPI_Comm_split_type (orggrafptr->proccomm, MPI_COMM_TYPE_SHARED, orggrafptr->proclocnum, MPI_INFO_NULL, &nodecomm) != MPI_SUCCESS) ||
+      (MPI_Comm_group (orggrafptr->proccomm, &procgrup) != MPI_SUCCESS) ||
+      (MPI_Comm_group (nodecomm, &nodegrup) != MPI_SUCCESS)) {
+    errorPrint ("dgraphFold2: communication error (22)");
+    return (1);
+  }
+  else {                                          /* Senders place edge data bound to receivers of the same node in shared memory */
+    Gnum              nodesegnbr;
+
+    nodesegnbr = 0;
+    if ((fldcommtypval & DGRAPHFOLDCOMMSEND) != 0) {
+      Gnum              vertsndbas;
+      Gnum              vertsndnbr;
+      int               i;
+
+      vertsndnbr = ((fldcommtypval & DGRAPHFOLDCOMMRECV) != 0) ? (fldcommvrttab[0] - orgprocvrtbas) : 0;
+      for (i = 0, vertsndbas = orggrafptr->baseval;
+           (i < commmax) && (fldcommdattab[i].procnum != -1); i ++) {
+        int               procsndnum;
+        int               nodesndnum;
+
+        vertsndbas += vertsndnbr;
+        vertsndnbr  = fldcommdattab[i].vertnbr;
+
+        fldedgeidxtab[i]         = orgvertloctax[vertsndbas];
+        DGRAPHFOLDMESGEDGE (i) = orgvertloctax[vertsndbas + vertsndnbr] - orgvertloctax[vertsndbas];
+        DGRAPHFOLDMESGSEGM (i) = -1;              /* Assume edge data will be sent by message */
+
+        procsndnum = (int) fldcommdattab[i].procnum;
+        MPI_Group_translate_ranks (procgrup, 1, &procsndnum, nodegrup, &nodesndnum);
+        if (nodesndnum != MPI_UNDEFINED) {        /* If receiver is located on the same node */
+          DGRAPHFOLDMESGSEGM (i) = nodesegnbr;
+          nodesegnbr += (orgedloloctax != NULL) ? (2 * DGRAPHFOLDMESGEDGE (i)) : DGRAPHFOLDMESGEDGE (i);
+        }
+      }
+    }
+
+    if (MPI_Win_allocate_shared ((MPI_Aint) (nodesegnbr * sizeof (Gnum)), sizeof (Gnum), MPI_INFO_NULL, nodecomm, &nodesegtab, &nodewin) != MPI_SUCCESS) {
+      errorPrint ("dgraphFold2: communication error (23)");
+      return (1);
+    }
+    MPI_Win_lock_all (MPI_MODE_NOCHECK, nodewin);
+
+    if (nodesegnbr > 0) {                         /* If process has edge data to share */
+      int               i;
+
+      for (i = 0; (i < commmax) && (fldcommdattab[i].procnum != -1); i ++) {
+        Gnum              edgesndnbr;
+        Gnum * restrict   nodesegptr;
+
+        if (DGRAPHFOLDSHMMESG (i))
+          continue;
+
+        edgesndnbr = DGRAPHFOLDMESGEDGE (i);
+        nodesegptr = nodesegtab + DGRAPHFOLDMESGSEGM (i);
+        memCpy (nodesegptr, orgedgeloctax + fldedgeidxtab[i], edgesndnbr * sizeof (Gnum));
+        if (orgedloloctax != NULL)
+          memCpy (nodesegptr + edgesndnbr, orgedloloctax + fldedgeidxtab[i], edgesndnbr * sizeof (Gnum));
+      }
+    }
+
+    MPI_Win_sync (nodewin);                       /* Make segment contents visible to all processes of the node */
+    MPI_Barrier  (nodecomm);
+    MPI_Win_sync (nodewin);
+  }
+#endif /* DGRAPHFOLDSHM */
+
+  fldbsndtab = NULL;
+  fldbrcvtab = NULL;
+  requnbr    = 0;                                 /* Communications without further processing are placed at beginning of array */
 
   if ((fldcommtypval & DGRAPHFOLDCOMMSEND) != 0) { /* If process is (also) a sender */
     Gnum              vertsndbas;
     Gnum              vertsndnbr;
+    Gnum              edgesndnbr;                 /* Number of edges sent by message */
     int               i;
 
     vertsndnbr = ((fldcommtypval & DGRAPHFOLDCOMMRECV) != 0) ? (fldcommvrttab[0] - orgprocvrtbas) : 0; /* If process is also a receiver, start sending after kept vertices */
 
-    for (i = 0, vertsndbas = orggrafptr->baseval; /* For all send communications to perform */
-         (i < commmax) && (fldcommdattab[i].procnum != -1) && (cheklocval == 0); i ++) {
+    for (i = 0, vertsndbas = orggrafptr->baseval, edgesndnbr = 0; /* For all send communications to perform */
+         (i < commmax) && (fldcommdattab[i].procnum != -1); i ++) {
       vertsndbas += vertsndnbr;
       vertsndnbr  = fldcommdattab[i].vertnbr;
 
       fldvertidxtab[i] = vertsndbas;
       fldedgeidxtab[i] = orgvertloctax[vertsndbas];
-      fldedgecnptab[i] =                          /* Save fldedgecnttab in temporary array to read it while MPI communication in progress */
-      fldedgecnttab[i] = orgvertloctax[vertsndbas + vertsndnbr] - orgvertloctax[vertsndbas]; /* Graph is compact        */
-      if (MPI_Isend (&fldedgecnptab[i], 1, GNUM_MPI, fldcommdattab[i].procnum,
+      fldedgecnttab[i] =                          /* Save edge count in message array to read it while MPI communication in progress */
+      DGRAPHFOLDMESGEDGE (i) = orgvertloctax[vertsndbas + vertsndnbr] - orgvertloctax[vertsndbas]; /* Graph is compact    */
+      DGRAPHFOLDMESGBYTE (i) = 0;                 /* Assume edge data will not be compressed */
+      if (DGRAPHFOLDSHMMESG (i))
+        edgesndnbr += fldedgecnttab[i];
+    }
+    commnbr = i;
+
+    contextValuesGetInt (contptr, CONTEXTOPTIONNUMCOMPRESS, &compval);
+    if ((compval != 0) && (edgesndnbr > 0)) {     /* If edge data sent by message are to be compressed */
+      if (orgedloloctax != NULL)                  /* Edge loads are compressed along with edges        */
+        edgesndnbr *= 2;
+      if ((fldbsndtab = memAlloc (COMMENCODESIZE ((size_t) edgesndnbr))) != NULL) { /* If not enough memory, send raw data */
+        byte *            fldbsndptr;
+
+        for (i = 0, fldbsndptr = fldbsndtab; i < commnbr; i ++) {
+          byte *            fldbsndbeg;
+
+          if ((! DGRAPHFOLDSHMMESG (i)) ||        /* Compressed data must fit in a single message */
+              (COMMENCODESIZE ((size_t) fldedgecnttab[i] * ((orgedloloctax != NULL) ? 2 : 1)) > INT_MAX))
+            continue;
+
+          fldbytedsptab[i] = (Gnum) (fldbsndptr - fldbsndtab);
+          fldbsndbeg = fldbsndptr;
+          fldbsndptr = commEncode (fldbsndptr, orgedgeloctax + fldedgeidxtab[i], fldedgecnttab[i], 0);
+          if (orgedloloctax != NULL)
+            fldbsndptr = commEncode (fldbsndptr, orgedloloctax + fldedgeidxtab[i], fldedgecnttab[i], 0);
+          DGRAPHFOLDMESGBYTE (i) = (Gnum) (fldbsndptr - fldbsndbeg);
+        }
+        fldbsndtab = memRealloc (fldbsndtab, (fldbsndptr - fldbsndtab) + 1); /* Shrink array; TRICK: "+1" to avoid empty allocation */
+      }
+    }
+
+    for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
+      if (MPI_Isend (fldedgemsgtab + DGRAPHFOLDMESGSIZE * i, DGRAPHFOLDMESGSIZE, GNUM_MPI, fldcommdattab[i].procnum, /* Send edge size message */
                      TAGFOLD + TAGVLBLLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
         errorPrint ("dgraphFold2: communication error (2)");
         cheklocval = 1;
       }
     }
-    commnbr = i;
 
     for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
       if (MPI_Isend (orgvertloctax + fldvertidxtab[i], fldcommdattab[i].vertnbr, GNUM_MPI, fldcommdattab[i].procnum,
@@ -341,8 +526,12 @@ MPI_Datatype                  datatype)
       }
     }
     for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-      if (MPI_Isend (orgedgeloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
-                     TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
+      if (DGRAPHFOLDSHMMESG (i) &&
+          ((DGRAPHFOLDMESGBYTE (i) > 0)
+           ? (MPI_Isend (fldbsndtab + fldbytedsptab[i], (int) DGRAPHFOLDMESGBYTE (i), MPI_BYTE, fldcommdattab[i].procnum,
+                         TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS)
+           : (MPI_Isend (orgedgeloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
+                         TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS))) {
         errorPrint ("dgraphFold2: communication error (4)");
         cheklocval = 1;
       }
@@ -360,7 +549,7 @@ MPI_Datatype                  datatype)
       int               procsndnum;               /* Rank of process to send to */
 
       procsndnum = fldcommdattab[i].procnum;
-      if ((orgedloloctax != NULL) &&
+      if ((orgedloloctax != NULL) && DGRAPHFOLDSHMMESG (i) && (DGRAPHFOLDMESGBYTE (i) == 0) && /* Compressed edge loads already sent with edges */
           (MPI_Isend (orgedloloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, procsndnum,
                       TAGFOLD + TAGEDLOLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS)) {
         errorPrint ("dgraphFold2: communication error (6)");
@@ -384,16 +573,10 @@ MPI_Datatype                  datatype)
   if ((fldcommtypval & DGRAPHFOLDCOMMRECV) != 0) { /* If process is (also) a receiver */
     Gnum                orgvertlocnbr;
     Gnum                orgvertlocnnd;
-    Gnum                orgvertlocmin;
-    Gnum                orgvertlocmax;
-    Gnum                fldvertlocadj;
     Gnum                fldvelolocsum;
-    Gnum * restrict     fldedgeloctax;
-    Gnum                fldedgelocnum;
     Gnum                fldedgelocnnd;
     int                 fldprocnum;
-    int                 procngbmin;
-    int                 procngbmax;
+    int                 commshmnbr;               /* Number of communications performed through shared memory */
     int                 i;
 
     fldgrafptr->procvrttab = fldgrafptr->procdsptab; /* Graph does not have holes                                 */
@@ -404,6 +587,7 @@ MPI_Datatype                  datatype)
 
     if ((fldcommtypval & DGRAPHFOLDCOMMSEND) == 0) { /* If process is a normal receiver */
       Gnum                fldedgelocbas;
+      Gnum                fldbytercvnbr;          /* Amount of compressed edge data to receive */
       Gnum                fldvertrcvbas;
       Gnum                fldvertrcvnbr;
 
@@ -413,7 +597,7 @@ MPI_Datatype                  datatype)
         fldvertrcvnbr  = fldcommdattab[i].vertnbr;
 
         fldvertidxtab[i] = fldvertrcvbas;
-        if (MPI_Irecv (&fldedgecnttab[i], 1, GNUM_MPI, fldcommdattab[i].procnum,
+        if (MPI_Irecv (fldedgemsgtab + DGRAPHFOLDMESGSIZE * i, DGRAPHFOLDMESGSIZE, GNUM_MPI, fldcommdattab[i].procnum,
                        TAGFOLD + TAGVLBLLOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGENBR * commmax + i]) != MPI_SUCCESS) {
           errorPrint ("dgraphFold2: communication error (9)");
           cheklocval = 1;
@@ -430,12 +614,28 @@ MPI_Datatype                  datatype)
 
       MPI_Waitall (commnbr, &requtab[DGRAPHFOLDTAGENBR * commmax], MPI_STATUSES_IGNORE);
 
+      for (i = 0, fldbytercvnbr = 0; i < commnbr; i ++) { /* Compute start indices of compressed edge data, if any */
+        requtab[DGRAPHFOLDTAGEDGE * commmax + i] = MPI_REQUEST_NULL;
+        fldbytedsptab[i] = fldbytercvnbr;
+        fldbytercvnbr   += DGRAPHFOLDMESGBYTE (i);
+      }
+      if ((fldbytercvnbr > 0) &&
+          ((fldbrcvtab = memAlloc (fldbytercvnbr * sizeof (byte))) == NULL)) {
+        errorPrint ("dgraphFold2: out of memory (6)");
+        cheklocval = 1;
+      }
+
       for (i = 0, fldedgelocbas = orgvertloctax[orggrafptr->vertlocnnd]; (i < commnbr) && (cheklocval == 0); i ++) {
+        fldedgecnttab[i] = DGRAPHFOLDMESGEDGE (i);
         fldedgeidxtab[i] = fldedgelocbas;
         fldedgelocbas += fldedgecnttab[i];
 
-        if (MPI_Irecv (fldgrafptr->edgeloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
-                       TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGEDGE * commmax + i]) != MPI_SUCCESS) {
+        if (DGRAPHFOLDSHMMESG (i) &&
+            ((DGRAPHFOLDMESGBYTE (i) > 0)
+             ? (MPI_Irecv (fldbrcvtab + fldbytedsptab[i], (int) DGRAPHFOLDMESGBYTE (i), MPI_BYTE, fldcommdattab[i].procnum,
+                           TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGEDGE * commmax + i]) != MPI_SUCCESS)
+             : (MPI_Irecv (fldgrafptr->edgeloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
+                           TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGEDGE * commmax + i]) != MPI_SUCCESS))) {
           errorPrint ("dgraphFold2: communication error (11)");
           cheklocval = 1;
         }
@@ -456,8 +656,10 @@ MPI_Datatype                  datatype)
         fldgrafptr->edloloctax = fldgrafptr->edgeloctax + fldgrafptr->edgelocnbr; /* Set start index of edge load array */
 
         for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-          if (MPI_Irecv (fldgrafptr->edloloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
-                         TAGFOLD + TAGEDLOLOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGEDLO * commmax + i]) != MPI_SUCCESS) {
+          requtab[DGRAPHFOLDTAGEDLO * commmax + i] = MPI_REQUEST_NULL;
+          if (DGRAPHFOLDSHMMESG (i) && (DGRAPHFOLDMESGBYTE (i) == 0) &&
+              (MPI_Irecv (fldgrafptr->edloloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
+                          TAGFOLD + TAGEDLOLOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGEDLO * commmax + i]) != MPI_SUCCESS)) {
             errorPrint ("dgraphFold2: communication error (13)");
             cheklocval = 1;
           }
@@ -523,45 +725,8 @@ MPI_Datatype                  datatype)
       commnbr = 0;                                /* Turn sender-receiver into normal receiver without any communications to perform */
     }
 
-    for (procngbmin = 0, procngbmax = fldvertadjnbr; /* Initialize search accelerator */
-         procngbmax - procngbmin > 1; ) {
-      int               procngbmed;
-
-      procngbmed = (procngbmax + procngbmin) / 2;
-      if (fldvertadjtab[procngbmed] <= orgprocvrtbas)
-        procngbmin = procngbmed;
-      else
-        procngbmax = procngbmed;
-    }
-    orgvertlocmin = fldvertadjtab[procngbmin];
-    orgvertlocmax = fldvertadjtab[procngbmax];
-    fldvertlocadj = fldvertdlttab[procngbmin];
-    fldedgeloctax = fldgrafptr->edgeloctax;
-    for (fldedgelocnum = orggrafptr->baseval; fldedgelocnum < fldedgelocnnd; fldedgelocnum ++) {
-      Gnum              orgvertlocend;
-
-      orgvertlocend = orgedgeloctax[fldedgelocnum];
-
-      if ((orgvertlocend >= orgvertlocmin) &&     /* If end vertex is local */
-          (orgvertlocend <  orgvertlocmax))
-        fldedgeloctax[fldedgelocnum] = orgvertlocend + fldvertlocadj;
-      else {                                      /* End vertex is not local */
-        int               procngbnum;
-        int               procngbmax;
-
-        for (procngbnum = 0, procngbmax = fldvertadjnbr;
-             procngbmax - procngbnum > 1; ) {
-          int               procngbmed;
-
-          procngbmed = (procngbmax + procngbnum) / 2;
-          if (fldvertadjtab[procngbmed] <= orgvertlocend)
-            procngbnum = procngbmed;
-          else
-            procngbmax = procngbmed;
-        }
-        fldedgeloctax[fldedgelocnum] = orgvertlocend + fldvertdlttab[procngbnum];
-      }
-    }
+    dgraphFold2Edge (orgedgeloctax + orggrafptr->baseval, fldgrafptr->edgeloctax + orggrafptr->baseval, /* Renumber local part of edge array */
+                     fldedgelocnnd - orggrafptr->baseval, orgprocvrtbas, fldvertadjnbr, fldvertadjtab, fldvertdlttab);
 
     if (orggrafptr->veloloctax != NULL)           /* If original graph has vertex loads             */
       memCpy (fldgrafptr->veloloctax + orggrafptr->baseval, /* Copy local part of vertex load array */
@@ -612,7 +777,36 @@ MPI_Datatype                  datatype)
       }
     }
 
-    for (i = 0; i < commnbr; i ++) {
+    commshmnbr = 0;
+#ifdef DGRAPHFOLDSHM
+    for (i = 0; i < commnbr; i ++) {              /* Process edge data of senders located on the same node */
+      MPI_Aint          nodesegsiz;
+      Gnum *            nodesegptr;
+      int               nodedspval;
+      int               procrcvnum;
+      int               nodercvnum;
+
+      if (DGRAPHFOLDSHMMESG (i))
+        continue;
+
+      procrcvnum = (int) fldcommdattab[i].procnum;
+      MPI_Group_translate_ranks (procgrup, 1, &procrcvnum, nodegrup, &nodercvnum);
+      if (MPI_Win_shared_query (nodewin, nodercvnum, &nodesegsiz, &nodedspval, &nodesegptr) != MPI_SUCCESS) {
+        errorPrint ("dgraphFold2: communication error (24)");
+        cheklocval = 1;
+        break;
+      }
+      nodesegptr += DGRAPHFOLDMESGSEGM (i);
+
+      dgraphFold2Edge (nodesegptr, fldgrafptr->edgeloctax + fldedgeidxtab[i], /* Reorder end vertices while copying them */
+                       fldedgecnttab[i], fldcommvrttab[i], fldvertadjnbr, fldvertadjtab, fldvertdlttab);
+      if (orgedloloctax != NULL)
+        memCpy (fldgrafptr->edloloctax + fldedgeidxtab[i], nodesegptr + fldedgecnttab[i], fldedgecnttab[i] * sizeof (Gnum));
+      commshmnbr ++;
+    }
+#endif /* DGRAPHFOLDSHM */
+
+    for (i = commshmnbr; i < commnbr; i ++) {     /* Process edge data received by message */
       MPI_Status        statdat;
       int               j;
 
@@ -621,72 +815,33 @@ MPI_Datatype                  datatype)
         cheklocval = 1;
       }
       else if (cheklocval == 0) {                 /* Adjust remote part(s) of edge array */
-        Gnum              orgvertlocmin;
-        Gnum              orgvertlocmax;
-        Gnum              fldvertlocadj;
-        Gnum * restrict   fldedgeloctax;
-        int               procngbnum;
-        int               procngbmax;
-
 #ifdef SCOTCH_DEBUG_DGRAPH2
         int               fldedgercvnbr;
 
-        MPI_Get_count (&statdat, GNUM_MPI, &fldedgercvnbr);
-        if (fldedgercvnbr != fldedgecnttab[j]) {
+        MPI_Get_count (&statdat, (DGRAPHFOLDMESGBYTE (j) > 0) ? MPI_BYTE : GNUM_MPI, &fldedgercvnbr);
+        if (fldedgercvnbr != ((DGRAPHFOLDMESGBYTE (j) > 0) ? DGRAPHFOLDMESGBYTE (j) : fldedgecnttab[j])) {
           errorPrint  ("dgraphFold2: internal error (1)");
           return (1);
         }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
-
-        for (procngbnum = 0, procngbmax = fldvertadjnbr; /* Initialize search accelerator */
-             procngbmax - procngbnum > 1; ) {
-          int               procngbmed;
-
-          procngbmed = (procngbmax + procngbnum) / 2;
-          if (fldvertadjtab[procngbmed] <= fldcommvrttab[j])
-            procngbnum = procngbmed;
-          else
-            procngbmax = procngbmed;
+        if ((fldedgeidxtab[j] + fldedgecnttab[j]) > (fldgrafptr->edgelocnbr + orggrafptr->baseval)) {
+          errorPrint  ("dgraphFold2: internal error (2)");
+          return (1);
         }
-        orgvertlocmin = fldvertadjtab[procngbnum];
-        orgvertlocmax = fldvertadjtab[procngbmax];
-        fldvertlocadj = fldvertdlttab[procngbnum];
-        fldedgeloctax = fldgrafptr->edgeloctax;
-        for (fldedgelocnum = fldedgeidxtab[j], fldedgelocnnd = fldedgelocnum + fldedgecnttab[j];
-             fldedgelocnum < fldedgelocnnd; fldedgelocnum ++) { /* Reorder end vertices */
-          Gnum              orgvertlocend;
-
-#ifdef SCOTCH_DEBUG_DGRAPH2
-          if (fldedgelocnum >= (fldgrafptr->edgelocnbr + orggrafptr->baseval)) {
-            errorPrint  ("dgraphFold2: internal error (2)");
-            return (1);
-          }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
 
-          orgvertlocend = fldedgeloctax[fldedgelocnum];
-
-          if ((orgvertlocend >= orgvertlocmin) && /* If end vertex is local */
-              (orgvertlocend <  orgvertlocmax))
-            fldedgeloctax[fldedgelocnum] = orgvertlocend + fldvertlocadj;
-          else {
-            int               procngbnum;
-            int               procngbmax;
-
-            for (procngbnum = 0, procngbmax = fldvertadjnbr;
-                 procngbmax - procngbnum > 1; ) {
-              int               procngbmed;
-
-              procngbmed = (procngbmax + procngbnum) / 2;
-              if (fldvertadjtab[procngbmed] <= orgvertlocend)
-                procngbnum = procngbmed;
-              else
-                procngbmax = procngbmed;
-            }
-            fldedgeloctax[fldedgelocnum] = orgvertlocend + fldvertdlttab[procngbnum];
-          }
+        if (DGRAPHFOLDMESGBYTE (j) > 0) {         /* If edge data compressed, decode them in place */
+          const byte *      fldbrcvptr;
+
+          fldbrcvptr = commDecode (fldbrcvtab + fldbytedsptab[j], fldgrafptr->edgeloctax + fldedgeidxtab[j], fldedgecnttab[j], 0);
+          if (orgedloloctax != NULL)
+            commDecode (fldbrcvptr, fldgrafptr->edloloctax + fldedgeidxtab[j], fldedgecnttab[j], 0);
         }
+        dgraphFold2Edge (fldgrafptr->edgeloctax + fldedgeidxtab[j], fldgrafptr->edgeloctax + fldedgeidxtab[j], /* Reorder end vertices in place */
+                         fldedgecnttab[j], fldcommvrttab[j], fldvertadjnbr, fldvertadjtab, fldvertdlttab);
       }
     }
+    if (fldbrcvtab != NULL)
+      memFree (fldbrcvtab);
 
     if (orggrafptr->veloloctax == NULL)           /* If no vertex loads, reset graph vertex load to number of vertices */
       fldvelolocsum = fldvertlocnbr;
@@ -747,6 +902,14 @@ MPI_Datatype                  datatype)
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
   }
 
+#ifdef DGRAPHFOLDSHM
+  MPI_Win_unlock_all (nodewin);                   /* Shared edge data no longer needed by receivers */
+  MPI_Win_free (&nodewin);
+  MPI_Group_free (&nodegrup);
+  MPI_Group_free (&procgrup);
+  MPI_Comm_free (&nodecomm);
+#endif /* DGRAPHFOLDSHM */
+
   memFree (fldcommdattab);                        /* Free group leader */
 
   if (MPI_Waitall (requnbr, requtab, MPI_STATUSES_IGNORE) != MPI_SUCCESS) { /* Wait for all graph data to arrive because graph could be freed afterwards */
@@ -754,6 +917,8 @@ MPI_Datatype                  datatype)
     cheklocval = 1;
   }
 
+  if (fldbsndtab != NULL)
+    memFree (fldbsndtab);
   memFree (fldvertidxtab);                        /* Free group leader including request array */
   if (orgvertloctax != orggrafptr->vertloctax)
     memFree (orgvertloctax + orggrafptr->baseval);
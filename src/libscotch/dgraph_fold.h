@@ -1,4 +1,4 @@
-/* Copyright 2007-2009 ENSEIRB, INRIA & CNRS
+/* Copyright 2007-2009,2026 ENSEIRB, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,6 +43,8 @@
 /**                                 to   : 06 sep 2006     **/
 /**                # Version 5.1  : from : 31 dec 2008     **/
 /**                                 to   : 01 jan 2009     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -50,6 +52,42 @@
 **  The defines.
 */
 
+/*+ Use MPI-3 shared-memory windows for folding
+    communications between processes located on
+    the same node, if requested.                  +*/
+
+#if ((defined SCOTCH_MPI_SHARED_FOLD) && (MPI_VERSION >= 3))
+#define DGRAPHFOLDSHM
+#endif /* ((defined SCOTCH_MPI_SHARED_FOLD) && (MPI_VERSION >= 3)) */
+
+/*+ Layout of the edge size message of each
+    communication slot: number of edges, size
+    in bytes of the compressed edge data, or 0
+    if edge data are not compressed, and, when
+    shared memory is used, offset of the edge
+    data in the window segment of the sender,
+    or -1 if they are exchanged by message.    +*/
+
+#ifdef DGRAPHFOLDSHM
+#define DGRAPHFOLDMESGSIZE          3
+#else /* DGRAPHFOLDSHM */
+#define DGRAPHFOLDMESGSIZE          2
+#endif /* DGRAPHFOLDSHM */
+
+#define DGRAPHFOLDMESGEDGE(i)       fldedgemsgtab[DGRAPHFOLDMESGSIZE * (i)]
+#define DGRAPHFOLDMESGBYTE(i)       fldedgemsgtab[DGRAPHFOLDMESGSIZE * (i) + 1]
+#define DGRAPHFOLDMESGSEGM(i)       fldedgemsgtab[DGRAPHFOLDMESGSIZE * (i) + 2]
+
+/*+ Flag set if the edge data of communication
+    slot i must be exchanged by message rather
+    than through the shared-memory window.     +*/
+
+#ifdef DGRAPHFOLDSHM
+#define DGRAPHFOLDSHMMESG(i)        (DGRAPHFOLDMESGSEGM (i) < 0)
+#else /* DGRAPHFOLDSHM */
+#define DGRAPHFOLDSHMMESG(i)        1
+#endif /* DGRAPHFOLDSHM */
+
 /* Slot indices used for point-to-point folding
    communications. First indices are used for
    communications without further processing.
@@ -65,3 +103,9 @@ typedef enum DgraphFoldTag_ {
   DGRAPHFOLDTAGEDLO,                              /*+ edgeloctab message +*/
   DGRAPHFOLDTAGNBR                                /*+ Number of tags     +*/
 } DgraphFoldTag;
+
+/*
+**  The function prototypes.
+*/
+
+static void                 dgraphFold2Edge     (const Gnum * const, Gnum * const, const Gnum, const Gnum, const int, const Gnum * restrict const, const Gnum * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2007-2009,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2009,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 28 sep 2014     **/
 /**                                 to   : 28 sep 2014     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,14 +83,14 @@
 static
 void
 dgraphFoldDup2 (
-Context * restrict const          contptr,        /*+ (Sub-)context (not used)               +*/
+Context * restrict const          contptr,        /*+ (Sub-)context                          +*/
 const int                         spltnum,        /*+ Rank of sub-context in initial context +*/
 const DgraphFoldDupSplit * const  spltptr)
 {
   int                 o;
 
   o = dgraphFold2 (spltptr->splttab[spltnum].orggrafptr, spltnum, spltptr->fldgrafptr,
-                   spltptr->splttab[spltnum].fldproccomm, spltptr->orgdataptr, spltptr->flddataptr, spltptr->datatype);
+                   spltptr->splttab[spltnum].fldproccomm, spltptr->orgdataptr, spltptr->flddataptr, spltptr->datatype, contptr);
 
   if (o != 0)
     *spltptr->revaptr = 1;                        /* No mutex protection */
@@ -144,6 +144,7 @@ Context * restrict const      contptr)            /*+ Context
 #ifdef SCOTCH_PTHREAD_MPI
   fldspltdat.splttab[1].orggrafptr = &orggrafdat;
   orggrafdat = *orggrafptr;                       /* Create a separate graph structure to change its communicator */
+  orggrafdat.flagval &= ~(DGRAPHHASNGBCOMM | DGRAPHFREENGBCOMM); /* Neighborhood communicator of copy will be built on new communicator */
 
   if (MPI_Comm_dup (orggrafptr->proccomm, &orggrafdat.proccomm) != MPI_SUCCESS) { /* Duplicate communicator to avoid interferences in communications */
     errorPrint ("dgraphFoldDup: communication error (2)");
@@ -161,6 +162,7 @@ Context * restrict const      contptr)            /*+ Context
       dgraphFoldDup2 (contptr, 1, &fldspltdat);
   }
 #ifdef SCOTCH_PTHREAD_MPI
+  dgraphNgbFree (&orggrafdat);                    /* Free neighborhood communicator of copy, if any */
   MPI_Comm_free (&orggrafdat.proccomm);
 #endif /* SCOTCH_PTHREAD_MPI */
 
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2010,2012,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2010,2012,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 18 jun 2021     **/
 /**                                 to   : 04 dec 2021     **/
 /**                # Version 7.0  : from : 04 aug 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The definitions of MPI_Gather and     **/
 /**                  MPI_Gatherv indicate that elements in **/
@@ -73,15 +73,19 @@
 #include "graph.h"
 #include "dgraph.h"
 
-/* This function gathers on all processes
-** the pieces of a distributed graph to
-** build a centralized graph. This function
-** does not compute edlosum on the centralized
-** graphs when it is already given in the passed
-** value, as a non-negative number.
+/* This function gathers a distributed array
+** either on all processes or on a single root
+** process. In the latter case, data are sent
+** to the root in chunks of bounded size and
+** received in place in the target array, so
+** that no temporary array is needed and the
+** number of elements per process is not bound
+** by the range of MPI counts. On the root
+** process, senddattab may be NULL if the local
+** part is already in place.
 ** It returns:
-** - 0   : if graph data are consistent.
-** - !0  : on error.
+** - MPI_SUCCESS : on success.
+** - !0          : on error.
 */
 
 static
@@ -93,14 +97,92 @@ Gnum * const                recvdattab,
 Gnum * const                recvcnttab,
 Gnum * const                recvdsptab,
 const int                   rootnum,
+const int                   tagnum,
 MPI_Comm                    comm)
 {
   if (rootnum == -1)                              /* If collective communication wanted */
     return (commAllgatherv (senddattab, sendcntnbr, GNUM_MPI, recvdattab, recvcnttab, recvdsptab, GNUM_MPI, comm));
-  else
-    return (commGatherv (senddattab, sendcntnbr, GNUM_MPI, recvdattab, recvcnttab, recvdsptab, GNUM_MPI, rootnum, comm));
+
+  return (commGathervChunk (senddattab, sendcntnbr, GNUM_MPI, recvdattab, recvcnttab, recvdsptab, rootnum, tagnum, comm));
+}
+
+/* This function gathers an edge-based array
+** of a non-compact distributed graph, by
+** compacting it before sending. For a single
+** root, non-root processes compact and send
+** their data chunk by chunk using a buffer
+** of at most COMMCHUNKSIZE elements, while
+** the root process compacts its own data
+** directly in place in the target array.
+** For collective gathering, the buffer must
+** hold all local edges.
+** It returns:
+** - MPI_SUCCESS : on success.
+** - !0          : on error.
+*/
+
+static
+int
+dgraphGatherAll4 (
+const Dgraph * restrict const dgrfptr,
+const Gnum * restrict const   datatax,            /* Edge-based array to gather      */
+Gnum * restrict const         packtab,            /* Buffer for compacted local data */
+Gnum * const                  recvdattab,
+Gnum * const                  recvcnttab,
+Gnum * const                  recvdsptab,
+const int                     protnum,
+const int                     tagnum)
+{
+  Gnum * restrict     packptr;
+  Gnum                packnbr;
+  Gnum                packnum;
+  Gnum                vertlocnum;
+  int                 o;
+
+  const Gnum * restrict const vertloctax = dgrfptr->vertloctax;
+  const Gnum * restrict const vendloctax = dgrfptr->vendloctax;
+
+  if (protnum == dgrfptr->proclocnum) {           /* If root process, compact local data in place */
+    packptr = recvdattab + recvdsptab[protnum];
+    packnbr = dgrfptr->edgelocnbr;
+  }
+  else {
+    packptr = packtab;
+    packnbr = (protnum == -1) ? dgrfptr->edgelocnbr : MIN (dgrfptr->edgelocnbr, COMMCHUNKSIZE);
+  }
+
+  for (vertlocnum = dgrfptr->baseval, packnum = 0;
+       vertlocnum < dgrfptr->vertlocnnd; vertlocnum ++) {
+    Gnum                edgelocnum;
+
+    for (edgelocnum = vertloctax[vertlocnum]; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+      if (packnum >= packnbr) {                   /* If chunk buffer full, only for non-root processes */
+        if ((o = commSendChunk (packptr, packnum, GNUM_MPI, protnum, tagnum, dgrfptr->proccomm)) != MPI_SUCCESS)
+          return (o);
+        packnum = 0;
+      }
+      packptr[packnum ++] = datatax[edgelocnum];
+    }
+  }
+
+  if (protnum == -1)
+    return (dgraphGatherAll3 (packptr, dgrfptr->edgelocnbr, recvdattab, recvcnttab, recvdsptab, -1, tagnum, dgrfptr->proccomm));
+  if (protnum == dgrfptr->proclocnum)
+    return (dgraphGatherAll3 (NULL, dgrfptr->edgelocnbr, recvdattab, recvcnttab, recvdsptab, protnum, tagnum, dgrfptr->proccomm));
+  return (commSendChunk (packptr, packnum, GNUM_MPI, protnum, tagnum, dgrfptr->proccomm)); /* Send last chunk */
 }
 
+/* This function gathers on all processes
+** the pieces of a distributed graph to
+** build a centralized graph. This function
+** does not compute edlosum on the centralized
+** graphs when it is already given in the passed
+** value, as a non-negative number.
+** It returns:
+** - 0   : if graph data are consistent.
+** - !0  : on error.
+*/
+
 int
 dgraphGatherAll2 (
 const Dgraph * restrict const dgrfptr,            /* Distributed graph  */
@@ -119,7 +201,7 @@ const int                     protnum)            /* -1 means allgather */
   Gnum                vertlocnbr;                 /* Size of temporary distributed vertex array                         */
   Gnum *              vertloctax;                 /* Temporary vertex array if graph is not compact [norestrict]        */
   Gnum                edgelocnbr;                 /* Size of temporary distributed edge array                           */
-  Gnum *              edgeloctab;                 /* Temporary edge array if distributed graph not compact [norestrict] */
+  Gnum *              edgeloctab;                 /* Temporary edge buffer if graph is not compact [norestrict]         */
   Gnum *              recvcnttab;                 /* Count array for gather operations [norestrict]                     */
   Gnum *              recvdsptab;                 /* Displacement array for gather operations [norestrict]              */
   int                 cheklocval;
@@ -185,7 +267,9 @@ const int                     protnum)            /* -1 means allgather */
   }
   else {                                          /* Need extra space to compact vertex and edge arrays before sending */
     vertlocnbr = dgrfptr->vertlocnbr;
-    edgelocnbr = dgrfptr->edgelocnbr;
+    edgelocnbr = (protnum == -1) ? dgrfptr->edgelocnbr /* Whole edge array for collective gathering */
+                 : ((protnum == dgrfptr->proclocnum) ? 0 /* Root compacts its edges in place         */
+                    : MIN (dgrfptr->edgelocnbr, COMMCHUNKSIZE)); /* Others send them chunk by chunk  */
   }
 
   if (cheklocval == 0) {
@@ -242,21 +326,20 @@ const int                     protnum)            /* -1 means allgather */
     cgrfptr->edlosum = edlosum;
     cgrfptr->degrmax = dgrfptr->degrglbmax;
   }
-#ifdef SCOTCH_DEBUG_DGRAPH2                       /* Prevent Valgrind from yelling */
-  else {                                          /* Process is not root           */
+  else {                                          /* Process is not root: arrays are never accessed */
     verttax =
     vendtax =
     velotax =
+    vnumtax =
     vlbltax =
     edgetax =
     edlotax = NULL;
   }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
 
   if (dgrfptr->vendloctax == (dgrfptr->vertloctax + 1)) { /* If distributed graph is compact                                                */
     if (dgraphGatherAll3 (dgrfptr->vertloctax + baseval + 1, dgrfptr->vertlocnbr, /* Do not send first index, it is always equal to baseval */
                           vendtax,                /* First index will always be equal to baseval too, and procdsptab holds based values     */
-                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, TAGVERTLOCTAB, dgrfptr->proccomm) != MPI_SUCCESS) {
       errorPrint ("dgraphGatherAll2: communication error (3)");
       return (1);
     }
@@ -280,22 +363,15 @@ const int                     protnum)            /* -1 means allgather */
   }
   else {                                          /* Distributed graph is not compact */
     Gnum                vertlocnum;
-    Gnum * restrict     edgelocptr;
 
     vertloctax -= baseval;                        /* Base temporary vertex array   */
-    for (vertlocnum = baseval, edgelocptr = edgeloctab; /* Build vertex send array */
-         vertlocnum < dgrfptr->vertlocnnd; vertlocnum ++) {
-      Gnum                edgelocnum;
-
+    for (vertlocnum = baseval;                    /* Build vertex send array       */
+         vertlocnum < dgrfptr->vertlocnnd; vertlocnum ++)
       vertloctax[vertlocnum] = dgrfptr->vendloctax[vertlocnum] - dgrfptr->vertloctax[vertlocnum]; /* Get edge counts */
 
-      for (edgelocnum = dgrfptr->vertloctax[vertlocnum]; edgelocnum < dgrfptr->vendloctax[vertlocnum]; edgelocnum ++)
-        *edgelocptr ++ = edgeloctax[edgelocnum];
-    }
-
     if (dgraphGatherAll3 (vertloctax + baseval, dgrfptr->vertlocnbr,
                           vendtax,                /* First index will always be equal to baseval, and procdsptab holds based values */
-                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, TAGVERTLOCTAB, dgrfptr->proccomm) != MPI_SUCCESS) {
       errorPrint ("dgraphGatherAll2: communication error (4)");
       return (1);
     }
@@ -322,7 +398,7 @@ const int                     protnum)            /* -1 means allgather */
   if (dgrfptr->veloloctax != NULL) {
     if (dgraphGatherAll3 (dgrfptr->veloloctax + baseval, dgrfptr->vertlocnbr,
                           velotax,                /* Based array since procdsptab holds based values */
-                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, TAGVELOLOCTAB, dgrfptr->proccomm) != MPI_SUCCESS) {
       errorPrint ("dgraphGatherAll2: communication error (5)");
       return (1);
     }
@@ -330,7 +406,7 @@ const int                     protnum)            /* -1 means allgather */
   if (dgrfptr->vnumloctax != NULL) {
     if (dgraphGatherAll3 (dgrfptr->vnumloctax + baseval, dgrfptr->vertlocnbr,
                           vnumtax,                /* Based array since procdsptab holds based values */
-                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, TAGVNUMLOCTAB, dgrfptr->proccomm) != MPI_SUCCESS) {
       errorPrint ("dgraphGatherAll2: communication error (6)");
       return (1);
     }
@@ -338,7 +414,7 @@ const int                     protnum)            /* -1 means allgather */
   if (dgrfptr->vlblloctax != NULL) {
     if (dgraphGatherAll3 (dgrfptr->vlblloctax + baseval, dgrfptr->vertlocnbr,
                           vlbltax,                /* Based array since procdsptab holds based values */
-                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+                          dgrfptr->proccnttab, dgrfptr->procdsptab, protnum, TAGVLBLLOCTAB, dgrfptr->proccomm) != MPI_SUCCESS) {
       errorPrint ("dgraphGatherAll2: communication error (7)");
       return (1);
     }
@@ -366,7 +442,7 @@ const int                     protnum)            /* -1 means allgather */
   if (dgrfptr->vendloctax == (dgrfptr->vertloctax + 1)) { /* If distributed graph is compact         */
     if (dgraphGatherAll3 (dgrfptr->edgeloctax + baseval, dgrfptr->edgelocnbr, /* Send global indices */
                           edgetax,                /* Based array as recvdsptab holds based values    */
-                          recvcnttab, recvdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+                          recvcnttab, recvdsptab, protnum, TAGEDGELOCTAB, dgrfptr->proccomm) != MPI_SUCCESS) {
       errorPrint ("dgraphGatherAll2: communication error (8)");
       return (1);
     }
@@ -374,35 +450,22 @@ const int                     protnum)            /* -1 means allgather */
     if (dgrfptr->edloloctax != NULL) {
       if (dgraphGatherAll3 (dgrfptr->edloloctax + baseval, dgrfptr->edgelocnbr,
                             edlotax,              /* Based array as recvdsptab holds based values */
-                            recvcnttab, recvdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+                            recvcnttab, recvdsptab, protnum, TAGEDLOLOCTAB, dgrfptr->proccomm) != MPI_SUCCESS) {
         errorPrint ("dgraphGatherAll2: communication error (9)");
         return (1);
       }
     }
   }
   else {                                          /* Distributed graph is not compact */
-    if (dgraphGatherAll3 (edgeloctab, dgrfptr->edgelocnbr,
-                          edgetax,                /* Based array as recvdsptab holds based values */
-                          recvcnttab, recvdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+    if (dgraphGatherAll4 (dgrfptr, edgeloctax, edgeloctab, edgetax, /* Based array as recvdsptab holds based values */
+                          recvcnttab, recvdsptab, protnum, TAGEDGELOCTAB) != MPI_SUCCESS) {
       errorPrint ("dgraphGatherAll2: communication error (10)");
       return (1);
     }
 
     if (dgrfptr->edloloctax != NULL) {
-      Gnum                vertlocnum;
-      Gnum * restrict     edlolocptr;
-
-      for (vertlocnum = baseval, edlolocptr = edgeloctab; /* Recycle edge send array to build edge load send array */
-           vertlocnum < dgrfptr->vertlocnnd; vertlocnum ++) {
-        Gnum                edgelocnum;
-
-        for (edgelocnum = dgrfptr->vertloctax[vertlocnum]; edgelocnum < dgrfptr->vendloctax[vertlocnum]; edgelocnum ++)
-          *edlolocptr ++ = dgrfptr->edloloctax[edgelocnum];
-      }
-
-      if (dgraphGatherAll3 (edgeloctab, dgrfptr->edgelocnbr, /* Send compacted edge load array    */
-                            edlotax,              /* Based array as recvdsptab holds based values */
-                            recvcnttab, recvdsptab, protnum, dgrfptr->proccomm) != MPI_SUCCESS) {
+      if (dgraphGatherAll4 (dgrfptr, dgrfptr->edloloctax, edgeloctab, edlotax, /* Recycle edge buffer for edge loads */
+                            recvcnttab, recvdsptab, protnum, TAGEDLOLOCTAB) != MPI_SUCCESS) {
         errorPrint ("dgraphGatherAll2: communication error (11)");
         return (1);
       }
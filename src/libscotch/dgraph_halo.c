@@ -1,4 +1,4 @@
-/* Copyright 2007-2009,2011,2014,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2009,2011,2014,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 05 apr 2021     **/
 /**                                 to   : 18 dec 2021     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -195,13 +195,16 @@ const MPI_Datatype            attrglbtype,        /* Attribute datatype
 byte ** const                 attrsndptr,         /* Pointer to array for packing data to send         */
 int ** const                  senddspptr,         /* Pointers to communication displacement arrays     */
 int ** const                  recvdspptr,
-MPI_Request ** const          requptr)            /* Pointer to local request array for point-to-point */
+MPI_Request ** const          requptr,            /* Pointer to local request array for point-to-point */
+int ** const                  ngbdatptr)          /* Pointer to neighbor work array, if wanted         */
 {
 #if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
   MPI_Aint              attrglbtmp;               /* Lower bound of attribute datatype (not used)            */
 #endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
   MPI_Aint              attrglbsiz;               /* Extent of attribute datatype                            */
   int                   procngbsiz;               /* Size of request array for point-to-point communications */
+  int                   ngbdatsiz;                /* Size of neighbor work array for asynchronous exchanges  */
+  int *                 ngbdattmp;                /* Dummy pointer when neighbor work array not wanted       */
   int                   procngbnum;
   int * restrict        recvdsptab;
   const int * restrict  procrcvtab;
@@ -212,6 +215,7 @@ MPI_Request ** const          requptr)            /* Pointer to local request ar
   }
 
   procngbsiz = ((grafptr->flagval & DGRAPHCOMMPTOP) != 0) ? grafptr->procngbnbr : 0;
+  ngbdatsiz  = (ngbdatptr != NULL) ? (grafptr->procngbnbr * 4) : 0;
 
 #if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
   MPI_Type_get_extent (attrglbtype, &attrglbtmp, &attrglbsiz); /* Get type extent */
@@ -222,7 +226,8 @@ MPI_Request ** const          requptr)            /* Pointer to local request ar
                      attrsndptr, (size_t) (grafptr->procsndnbr * attrglbsiz),
                      senddspptr, (size_t) (grafptr->procglbnbr * MAX (sizeof (int), sizeof (byte *))), /* TRICK: use senddsptab (int *) as attrdsptab (byte **) */
                      recvdspptr, (size_t) (grafptr->procglbnbr * sizeof (int)),
-                     requptr,    (size_t) (procngbsiz * 2      * sizeof (MPI_Request)), NULL) == NULL) {
+                     requptr,    (size_t) (procngbsiz * 2      * sizeof (MPI_Request)),
+                     (ngbdatptr != NULL) ? ngbdatptr : &ngbdattmp, (size_t) (ngbdatsiz * sizeof (int)), NULL) == NULL) {
     errorPrint ("dgraphHaloSync2: out of memory");
     return (1);
   }
@@ -257,7 +262,7 @@ const MPI_Datatype            attrglbtype)        /* Attribute datatype       */
   MPI_Request *       requtab;
   int                 o;
 
-  if (dgraphHaloSync2 (grafptr, attrgsttab, attrglbtype, &attrsndtab, &senddsptab, &recvdsptab, &requtab) != 0) /* Prepare communication arrays */
+  if (dgraphHaloSync2 (grafptr, attrgsttab, attrglbtype, &attrsndtab, &senddsptab, &recvdsptab, &requtab, NULL) != 0) /* Prepare communication arrays */
     return (1);
 
   o = 0;                                          /* Assume success                               */
@@ -312,10 +317,9 @@ const MPI_Datatype            attrglbtype)        /* Attribute datatype       */
       o = 1;
     }
   }
-  else {                                          /* Collective communication */
-    if (MPI_Alltoallv (attrsndtab, grafptr->procsndtab, senddsptab, attrglbtype, /* Perform diffusion */
-                       attrgsttab, grafptr->procrcvtab, recvdsptab, attrglbtype,
-                       grafptr->proccomm) != MPI_SUCCESS) {
+  else {                                          /* Collective communication with neighbors */
+    if (dgraphNgbAlltoallv (grafptr, attrsndtab, grafptr->procsndtab, senddsptab, attrglbtype, /* Perform diffusion */
+                            attrgsttab, grafptr->procrcvtab, recvdsptab, attrglbtype) != 0) {
       errorPrint ("dgraphHaloSync: communication error (4)");
       o = 1;
     }
@@ -345,19 +349,20 @@ DgraphHaloRequest * restrict  requptr)
 #ifdef SCOTCH_MPI_ASYNC_COLL
   int *               senddsptab;
   int *               recvdsptab;
+  int *               ngbdattab;                  /* Neighbor work array, kept until communication completes          */
   MPI_Request *       requtab;                    /* Not used as only a single asynchronous communication takes place */
 
   requptr->flagval    = 1;                        /* Assume error */
   requptr->attrsndtab = NULL;                     /* No memory    */
 
-  if (dgraphHaloSync2 (grafptr, attrgsttab, attrglbtype, &requptr->attrsndtab, &senddsptab, &recvdsptab, &requtab) != 0) { /* Prepare communication arrays */
+  if (dgraphHaloSync2 (grafptr, attrgsttab, attrglbtype, &requptr->attrsndtab, &senddsptab, &recvdsptab, &requtab, &ngbdattab) != 0) { /* Prepare communication arrays */
     errorPrint ("dgraphHaloAsync: cannot create halo exchange arrays");
     return;
   }
 
-  if (MPI_Ialltoallv (requptr->attrsndtab, grafptr->procsndtab, senddsptab, attrglbtype, /* Perform asynchronous collective communication */
-                      attrgsttab, grafptr->procrcvtab, recvdsptab, attrglbtype,
-                      grafptr->proccomm, &requptr->requval) != MPI_SUCCESS) {
+  if (dgraphNgbIalltoallv (grafptr, requptr->attrsndtab, grafptr->procsndtab, senddsptab, attrglbtype, /* Perform asynchronous collective communication */
+                           attrgsttab, grafptr->procrcvtab, recvdsptab, attrglbtype,
+                           ngbdattab, &requptr->requval) != 0) {
     errorPrint ("dgraphHaloAsync: communication error"); /* Group leader will be freed on wait routine */
     return;
   }
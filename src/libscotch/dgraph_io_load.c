@@ -1,4 +1,4 @@
-/* Copyright 2007-2009,2012,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2009,2012,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 25 aug 2012     **/
 /**                                 to   : 18 nov 2012     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -597,7 +597,7 @@ const int                   protnum)              /* Root process number
           errorPrint ("dgraphLoadCent: communication error (13)");
           return     (1);
         }
-        if (edlolocnbr != 0) {
+        if ((proptab[1] != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) { /* Even if no local edges, so that all processes agree */
           edloloctax = edgeloctax + edgelocnbr;
           if (MPI_Irecv (edloloctax, edgelocnbr, GNUM_MPI, protnum, TAGEDLOLOCTAB, grafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
             errorPrint ("dgraphLoadCent: communication error (14)");
@@ -907,3 +907,457 @@ const DgraphFlag            flagval)              /* Graph loading flags
   errorPrint ("dgraphLoadMulti: not implemented");
   return     (1);
 }
+
+/* This routine reads a signed integer value
+** from the given character range, skipping
+** leading blank characters.
+** It returns:
+** - !NULL : pointer to the character following the value.
+** - NULL  : if no value could be read.
+*/
+
+static
+const char *
+dgraphLoadSharedInt (
+const char *                charptr,              /* Pointer to first character to read */
+const char * const          charend,              /* Pointer to end of character range  */
+Gnum * const                valptr)               /* Pointer to value to read           */
+{
+  Gnum                valtmp;
+  int                 signval;
+
+  while ((charptr < charend) && (isspace ((int) (unsigned char) *charptr)))
+    charptr ++;
+
+  signval = 0;
+  if ((charptr < charend) && ((*charptr == '-') || (*charptr == '+'))) {
+    signval = (*charptr == '-');
+    charptr ++;
+  }
+  if ((charptr >= charend) || (! isdigit ((int) (unsigned char) *charptr)))
+    return (NULL);
+
+  for (valtmp = 0; (charptr < charend) && (isdigit ((int) (unsigned char) *charptr)); charptr ++)
+    valtmp = valtmp * 10 + (Gnum) (*charptr - '0');
+
+  *valptr = (signval != 0) ? - valtmp : valtmp;
+  return (charptr);
+}
+
+/* This routine loads a distributed source
+** graph from a centralized source graph file
+** shared by all of the processes, and which
+** they all read concurrently through MPI-IO.
+** Each process reads an equal share of the
+** bytes of the file, and keeps the vertices
+** whose lines start within this byte range.
+** Hence, every vertex record must be written
+** on a line of its own, as done by graphSave().
+** Vertex labels, if any, are resolved by
+** dgraphBuild2() afterwards.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphLoadShared (
+Dgraph * restrict const     grafptr,              /* Distributed graph to load            */
+const char * const          nameptr,              /* Name of shared centralized file      */
+Gnum                        baseval,              /* Base value (-1 means keep file base) */
+const DgraphFlag            flagval)              /* Graph loading flags                  */
+{
+  MPI_File            fileval;
+  MPI_Status          statdat;
+  MPI_Offset          filesiz;                    /* Size of graph file                            */
+  MPI_Offset          databgn;                    /* Offset of first vertex line                   */
+  MPI_Offset          datanbr;                    /* Number of bytes of vertex lines               */
+  MPI_Offset          bytebgn;                    /* Start of byte range of process                */
+  MPI_Offset          byteend;                    /* End of byte range of process                  */
+  MPI_Offset          readbgn;                    /* Start of read range, which may overlap        */
+  MPI_Offset          readmax;                    /* Upper bound on size of read range             */
+  MPI_Offset          readnum;
+  char *              chartab;                    /* Buffer holding the byte range of the process  */
+  size_t              charnbr;                    /* Number of bytes in buffer                     */
+  size_t              charnum;                    /* Index of first byte of first local vertex line */
+  const char *        charptr;
+  const char *        charend;
+  const char *        lineptr;
+  const char *        lineend;
+  Gnum                vertglbnbr;
+  Gnum                vertlocnbr;
+  Gnum                vertlocnum;
+  Gnum * restrict     vertloctax;
+  Gnum *              vertlocptr;
+  Gnum                velolocnbr;
+  Gnum                velolocsum;
+  Gnum * restrict     veloloctax;
+  Gnum                vlbllocnbr;
+  Gnum * restrict     vlblloctax;
+  Gnum                edgeglbnbr;
+  Gnum                edgelocnbr;
+  Gnum                edgelocnum;
+  Gnum * restrict     edgeloctax;
+  Gnum * restrict     edloloctax;
+  Gnum                degrlocmax;
+  Gnum                baseadj;
+  Gnum                reduloctab[3];
+  Gnum                reduglbtab[6];
+  char                proptab[4];                 /* Property string array */
+  int                 cheklocval;
+  int                 chekglbval;
+  int                 o;
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  if (MPI_Barrier (grafptr->proccomm) != MPI_SUCCESS) { /* Synchronize for debugging */
+    errorPrint ("dgraphLoadShared: communication error (1)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+  cheklocval = 0;
+  if (MPI_File_open (grafptr->proccomm, (char *) nameptr, MPI_MODE_RDONLY, MPI_INFO_NULL, &fileval) != MPI_SUCCESS)
+    cheklocval = 1;
+  else if (MPI_File_get_size (fileval, &filesiz) != MPI_SUCCESS)
+    cheklocval = 2;
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadShared: communication error (2)");
+    return     (1);
+  }
+  if (chekglbval != 0) {
+    if (cheklocval != 1)
+      MPI_File_close (&fileval);
+    if (grafptr->proclocnum == 0)
+      errorPrint ("dgraphLoadShared: cannot open graph file");
+    return (1);
+  }
+
+  reduglbtab[0] = 0;                              /* Assume everything will be fine */
+  if (grafptr->proclocnum == 0) {                 /* Root process reads file header */
+    char                headtab[DGRAPHLOADSHAREDHEADSIZ];
+    int                 headnbr;
+    int                 headtmp;
+
+    headnbr = (int) MIN (filesiz, DGRAPHLOADSHAREDHEADSIZ);
+    if ((MPI_File_read_at (fileval, 0, headtab, headnbr, MPI_CHAR, &statdat) != MPI_SUCCESS) ||
+        (MPI_Get_count (&statdat, MPI_CHAR, &headtmp) != MPI_SUCCESS) ||
+        (headtmp != headnbr)) {
+      errorPrint ("dgraphLoadShared: cannot read graph file (1)");
+      reduglbtab[0] = 1;
+    }
+    else {
+      Gnum                versval;
+
+      charend = headtab + headnbr;
+      if (((charptr = dgraphLoadSharedInt (headtab, charend, &versval))        == NULL) ||
+          ((charptr = dgraphLoadSharedInt (charptr, charend, &reduglbtab[1])) == NULL) ||
+          ((charptr = dgraphLoadSharedInt (charptr, charend, &reduglbtab[2])) == NULL) ||
+          ((charptr = dgraphLoadSharedInt (charptr, charend, &reduglbtab[3])) == NULL) ||
+          ((charptr = dgraphLoadSharedInt (charptr, charend, &reduglbtab[4])) == NULL) ||
+          (reduglbtab[4] < 0)                                                         ||
+          (reduglbtab[4] > 111)) {
+        errorPrint ("dgraphLoadShared: bad input (1)");
+        reduglbtab[0] = 1;
+      }
+      else if (versval != 0) {
+        errorPrint ("dgraphLoadShared: not a centralized graph format");
+        reduglbtab[0] = 1;
+      }
+      else {
+        while ((charptr < charend) && (*charptr != '\n') && (isspace ((int) (unsigned char) *charptr)))
+          charptr ++;
+        if (charptr < charend) {                  /* If header line end found */
+          if (*charptr != '\n') {                 /* First vertex must start a new line */
+            errorPrint ("dgraphLoadShared: bad input (2)");
+            reduglbtab[0] = 1;
+          }
+          reduglbtab[5] = (Gnum) (charptr - headtab) + 1;
+        }
+        else if (headnbr == filesiz)              /* If file only made of header */
+          reduglbtab[5] = (Gnum) headnbr;
+        else {
+          errorPrint ("dgraphLoadShared: bad input (3)");
+          reduglbtab[0] = 1;
+        }
+      }
+    }
+  }
+
+  if (MPI_Bcast (&reduglbtab[0], 6, GNUM_MPI, 0, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadShared: communication error (3)");
+    reduglbtab[0] = 1;
+  }
+  if (reduglbtab[0] != 0) {
+    MPI_File_close (&fileval);
+    return (1);
+  }
+
+  if (baseval == -1) {                            /* If keep file graph base     */
+    baseval = reduglbtab[3];                      /* Set graph base as file base */
+    baseadj = 0;                                  /* No base adjustment needed   */
+  }
+  else                                            /* If set graph base  */
+    baseadj = baseval - reduglbtab[3];            /* Update base adjust */
+
+  vertglbnbr = reduglbtab[1];
+  edgeglbnbr = reduglbtab[2];
+
+  sprintf (proptab, "%3.3d", (int) reduglbtab[4]); /* Compute file properties */
+  proptab[0] -= '0';                              /* Vertex labels flag       */
+  proptab[1] -= '0';                              /* Edge weights flag        */
+  proptab[2] -= '0';                              /* Vertex loads flag        */
+
+  databgn = (MPI_Offset) reduglbtab[5];
+  datanbr = filesiz - databgn;
+  bytebgn = databgn + (datanbr * grafptr->proclocnum)       / grafptr->procglbnbr;
+  byteend = databgn + (datanbr * (grafptr->proclocnum + 1)) / grafptr->procglbnbr;
+  readbgn = (bytebgn > databgn) ? (bytebgn - 1) : bytebgn; /* Read preceding byte to know if range starts a line */
+  readmax = datanbr / grafptr->procglbnbr + 2;    /* Bound on all read range sizes                          */
+  charnbr = (size_t) (byteend - readbgn);
+
+  if ((chartab = memAlloc (charnbr * sizeof (char))) == NULL) {
+    errorPrint ("dgraphLoadShared: out of memory (1)");
+    cheklocval = 1;
+  }
+  for (readnum = 0; readnum < readmax; readnum += DGRAPHLOADSHAREDBLOKSIZ) { /* Same number of collective reads for all */
+    char *              readptr;
+    int                 readnbr;
+    int                 readtmp;
+
+    readptr = chartab;
+    readnbr = 0;
+    if ((cheklocval == 0) && (readnum < (MPI_Offset) charnbr)) {
+      readptr += readnum;
+      readnbr  = (int) MIN ((MPI_Offset) charnbr - readnum, DGRAPHLOADSHAREDBLOKSIZ);
+    }
+    if ((MPI_File_read_at_all (fileval, readbgn + readnum, readptr, readnbr, MPI_CHAR, &statdat) != MPI_SUCCESS) ||
+        (MPI_Get_count (&statdat, MPI_CHAR, &readtmp) != MPI_SUCCESS) ||
+        (readtmp != readnbr)) {
+      if (cheklocval == 0)
+        errorPrint ("dgraphLoadShared: cannot read graph file (2)");
+      cheklocval = 1;
+    }
+  }
+
+  charnum = 0;
+  if (cheklocval == 0) {
+    if (readbgn < bytebgn) {                      /* If first byte belongs to range of previous process */
+      while ((charnum < charnbr) && (chartab[charnum] != '\n')) /* Skip end of line of previous process */
+        charnum ++;
+      if (charnum < charnbr)                      /* Skip newline character */
+        charnum ++;
+    }
+
+    if ((charnum < charnbr) &&                    /* If process owns a line which does not end in its range */
+        (chartab[charnbr - 1] != '\n')) {
+      MPI_Offset          tailbgn;
+
+      for (tailbgn = byteend; tailbgn < filesiz; ) { /* Read end of last line, which overlaps next ranges */
+        char *              chartmp;
+        size_t              tailnum;
+        int                 tailnbr;
+        int                 tailtmp;
+
+        tailnbr = (int) MIN (filesiz - tailbgn, DGRAPHLOADSHAREDTAILSIZ);
+        if ((chartmp = memRealloc (chartab, (charnbr + tailnbr) * sizeof (char))) == NULL) {
+          errorPrint ("dgraphLoadShared: out of memory (2)");
+          cheklocval = 1;
+          break;
+        }
+        chartab = chartmp;
+        if ((MPI_File_read_at (fileval, tailbgn, chartab + charnbr, tailnbr, MPI_CHAR, &statdat) != MPI_SUCCESS) ||
+            (MPI_Get_count (&statdat, MPI_CHAR, &tailtmp) != MPI_SUCCESS) ||
+            (tailtmp != tailnbr)) {
+          errorPrint ("dgraphLoadShared: cannot read graph file (3)");
+          cheklocval = 1;
+          break;
+        }
+        for (tailnum = charnbr, charnbr += tailnbr, tailbgn += tailnbr; tailnum < charnbr; tailnum ++) {
+          if (chartab[tailnum] == '\n') {         /* If end of line found, truncate buffer after it */
+            charnbr = tailnum + 1;
+            tailbgn = filesiz;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  MPI_File_close (&fileval);                      /* All processes have completed their reads */
+
+  vertlocnbr =
+  edgelocnbr = 0;
+  if (cheklocval == 0) {                          /* First pass: count local vertices and edges */
+    for (lineptr = chartab + charnum, charend = chartab + charnbr; lineptr < charend;
+         lineptr = lineend + ((lineend < charend) ? 1 : 0)) {
+      Gnum                dummval;
+      Gnum                degrlocval;
+
+      for (lineend = lineptr; (lineend < charend) && (*lineend != '\n'); lineend ++) ;
+
+      for (charptr = lineptr; (charptr < lineend) && (isspace ((int) (unsigned char) *charptr)); charptr ++) ;
+      if (charptr >= lineend)                     /* Skip empty lines */
+        continue;
+
+      if (((proptab[0] != 0) && ((charptr = dgraphLoadSharedInt (charptr, lineend, &dummval)) == NULL)) ||
+          ((proptab[2] != 0) && ((charptr = dgraphLoadSharedInt (charptr, lineend, &dummval)) == NULL)) ||
+          ((charptr = dgraphLoadSharedInt (charptr, lineend, &degrlocval)) == NULL) ||
+          (degrlocval < 0)) {
+        errorPrint ("dgraphLoadShared: bad input (4)");
+        cheklocval = 1;
+        break;
+      }
+      vertlocnbr ++;
+      edgelocnbr += degrlocval;
+    }
+  }
+
+  velolocnbr = ((proptab[2] != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? vertlocnbr : 0;
+  vlbllocnbr = (proptab[0] != 0) ? vertlocnbr : 0;
+  vlblloctax =
+  veloloctax =
+  vertloctax =
+  edgeloctax =
+  edloloctax = NULL;
+  if (cheklocval == 0) {
+    if ((vertlocptr = memAlloc ((vertlocnbr + 1 + velolocnbr + vlbllocnbr) * sizeof (Gnum))) == NULL) {
+      errorPrint ("dgraphLoadShared: out of memory (3)");
+      cheklocval = 1;
+    }
+    else {
+      Gnum                edlolocnbr;
+
+      vertloctax  =
+      vertlocptr -= baseval;
+      vertlocptr += vertlocnbr + 1;
+      if ((proptab[2] != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) { /* Decide on flags only, so that all processes agree, even when empty */
+        veloloctax  = vertlocptr;
+        vertlocptr += velolocnbr;
+      }
+      if (proptab[0] != 0) {
+        vlblloctax = vertlocptr;
+        baseadj    = 0;                           /* No vertex adjustments if vertex labels */
+      }
+
+      edlolocnbr = ((proptab[1] != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? edgelocnbr : 0;
+      if ((edgeloctax = memAlloc ((edgelocnbr + edlolocnbr + 1) * sizeof (Gnum))) == NULL) { /* TRICK: "+1" to avoid empty allocation */
+        errorPrint ("dgraphLoadShared: out of memory (4)");
+        cheklocval = 1;
+      }
+      else {
+        edgeloctax -= baseval;
+        if ((proptab[1] != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) /* Decide on flags only, as for vertex loads */
+          edloloctax = edgeloctax + edgelocnbr;
+      }
+    }
+  }
+
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadShared: communication error (4)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (edgeloctax != NULL)
+      memFree (edgeloctax + baseval);
+    if (vertloctax != NULL)
+      memFree (vertloctax + baseval);
+    if (chartab != NULL)
+      memFree (chartab);
+    return (1);
+  }
+
+  degrlocmax = 0;                                 /* Second pass: fill local arrays */
+  velolocsum = (veloloctax != NULL) ? 0 : vertlocnbr;
+  for (vertlocnum = edgelocnum = baseval, lineptr = chartab + charnum, charend = chartab + charnbr; lineptr < charend;
+       lineptr = lineend + ((lineend < charend) ? 1 : 0)) {
+    Gnum                degrlocval;
+
+    for (lineend = lineptr; (lineend < charend) && (*lineend != '\n'); lineend ++) ;
+
+    for (charptr = lineptr; (charptr < lineend) && (isspace ((int) (unsigned char) *charptr)); charptr ++) ;
+    if (charptr >= lineend)
+      continue;
+
+    if (proptab[0] != 0) {                        /* If must read label            */
+      Gnum                vlbllocval;             /* Vertex label value to be read */
+
+      charptr = dgraphLoadSharedInt (charptr, lineend, &vlbllocval); /* Values already checked in first pass */
+      vlblloctax[vertlocnum] = vlbllocval;
+    }
+    if (proptab[2] != 0) {                        /* If must read vertex load */
+      Gnum                velolocval;
+
+      charptr = dgraphLoadSharedInt (charptr, lineend, &velolocval);
+      if (veloloctax != NULL)
+        velolocsum            +=
+        veloloctax[vertlocnum] = velolocval;
+    }
+    charptr = dgraphLoadSharedInt (charptr, lineend, &degrlocval);
+    if (degrlocmax < degrlocval)                  /* Set maximum degree */
+      degrlocmax = degrlocval;
+
+    vertloctax[vertlocnum] = edgelocnum;          /* Set index in edge array */
+    for (degrlocval += edgelocnum; edgelocnum < degrlocval; edgelocnum ++) {
+      Gnum                edgelocval;             /* Value where to read edge end */
+
+      if (proptab[1] != 0) {                      /* If must read edge load        */
+        Gnum                edlolocval;           /* Value where to read edge load */
+
+        if ((charptr = dgraphLoadSharedInt (charptr, lineend, &edlolocval)) == NULL) {
+          errorPrint ("dgraphLoadShared: bad input (5)");
+          cheklocval = 1;
+          break;
+        }
+        if (edloloctax != NULL)
+          edloloctax[edgelocnum] = edlolocval;
+      }
+      if ((charptr = dgraphLoadSharedInt (charptr, lineend, &edgelocval)) == NULL) {
+        errorPrint ("dgraphLoadShared: bad input (6)");
+        cheklocval = 1;
+        break;
+      }
+      edgeloctax[edgelocnum] = edgelocval + baseadj;
+    }
+    if (cheklocval != 0)
+      break;
+
+    while ((charptr < lineend) && (isspace ((int) (unsigned char) *charptr)))
+      charptr ++;
+    if (charptr < lineend) {                      /* Vertex record must end its line */
+      errorPrint ("dgraphLoadShared: bad input (7)");
+      cheklocval = 1;
+      break;
+    }
+    vertlocnum ++;
+  }
+  vertloctax[vertlocnum] = edgelocnum;            /* Set end of edge array */
+  memFree (chartab);
+
+  reduloctab[0] = (Gnum) cheklocval;
+  reduloctab[1] = vertlocnbr;
+  reduloctab[2] = edgelocnbr;
+  if (MPI_Allreduce (reduloctab, reduglbtab, 3, GNUM_MPI, MPI_SUM, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadShared: communication error (5)");
+    reduglbtab[0] = 1;
+  }
+  if ((reduglbtab[0] == 0) &&
+      ((reduglbtab[1] != vertglbnbr) ||
+       (reduglbtab[2] != edgeglbnbr))) {
+    if (grafptr->proclocnum == 0)
+      errorPrint ("dgraphLoadShared: invalid vertex or arc count");
+    reduglbtab[0] = 1;
+  }
+  if (reduglbtab[0] != 0) {
+    if (edgeloctax != NULL)
+      memFree (edgeloctax + baseval);
+    memFree (vertloctax + baseval);
+    return  (1);
+  }
+
+  o = dgraphBuild2 (grafptr, baseval,             /* Build distributed graph */
+                    vertlocnbr, vertlocnbr, vertloctax, vertloctax + 1, veloloctax, velolocsum, NULL, vlblloctax,
+                    edgelocnbr, edgelocnbr, edgeloctax, NULL, edloloctax, degrlocmax);
+  grafptr->flagval |= DGRAPHFREETABS | DGRAPHVERTGROUP | DGRAPHEDGEGROUP;
+
+  return (o);
+}
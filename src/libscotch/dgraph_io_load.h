@@ -1,4 +1,4 @@
-/* Copyright 2007,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,10 +44,20 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Shared file loading parameters. +*/
+
+#define DGRAPHLOADSHAREDHEADSIZ     1024          /* Maximum size of centralized graph header */
+#define DGRAPHLOADSHAREDBLOKSIZ     (1 << 28)     /* Maximum size of a collective read block  */
+#define DGRAPHLOADSHAREDTAILSIZ     4096          /* Size of line tail read increments        */
+
 /*
 **  The function prototypes.
 */
@@ -56,4 +66,5 @@
 static int                  dgraphLoadCent      (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag, const int);
 static int                  dgraphLoadDist      (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag);
 static int                  dgraphLoadMulti     (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag);
+static const char *         dgraphLoadSharedInt (const char *, const char * const, Gnum * const);
 #endif /* SCOTCH_DGRAPH_IO_LOAD */
@@ -1,4 +1,4 @@
-/* Copyright 2008-2010,2012,2013,2019,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008-2010,2012,2013,2019,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 03 oct 2012     **/
 /**                                 to   : 10 oct 2013     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -131,6 +131,106 @@ DgraphMatchData * restrict const  mateptr)
   memFree (mateptr->procvgbtab);
 }
 
+/* This routine mates locally a slice of the
+** enqueued vertices which are free and not
+** involved in pending remote requests, so as
+** to overlap computation with the communication
+** of mating requests and replies.
+** A vertex is mated only if one of its heaviest
+** free neighbors is local, in order to preserve
+** the heavy edge criterion. Incoming requests
+** for vertices mated this way will be answered
+** negatively, as for any already mated vertex.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+dgraphMatchSyncSlice (
+DgraphMatchData * restrict const  mateptr,
+Gnum * restrict const             queuidxptr,     /*+ Index of first queued vertex to consider +*/
+Gnum * restrict const             matelocptr,
+Gnum * restrict const             multlocptr,
+Gnum * restrict const             edgekptptr)
+{
+  Gnum                queulocnum;
+  Gnum                queulocnnd;
+  Gnum                matelocnbr;
+  Gnum                multlocnbr;
+  Gnum                edgekptnbr;
+  Gnum                vertlocadj;
+  Gnum                vertlocnnd;
+
+  const Dgraph * restrict const       grafptr    = mateptr->c.finegrafptr;
+  const Gnum * restrict const         vertloctax = grafptr->vertloctax;
+  const Gnum * restrict const         vendloctax = grafptr->vendloctax;
+  const Gnum * restrict const         edgegsttax = grafptr->edgegsttax;
+  const Gnum * restrict const         edloloctax = grafptr->edloloctax;
+  const Gnum * restrict const         queuloctab = mateptr->queuloctab;
+  Gnum * restrict const               mategsttax = mateptr->mategsttax;
+  DgraphCoarsenMulti * restrict const multloctab = mateptr->c.multloctab;
+
+  vertlocadj = grafptr->procvrttab[grafptr->proclocnum] - grafptr->baseval;
+  vertlocnnd = grafptr->vertlocnnd;
+  matelocnbr = *matelocptr;
+  multlocnbr = *multlocptr;
+  edgekptnbr = *edgekptptr;
+
+  for (queulocnum = *queuidxptr, queulocnnd = MIN (queulocnum + DGRAPHMATCHSYNCSLICE, mateptr->queulocnbr);
+       queulocnum < queulocnnd; queulocnum ++) {
+    Gnum                vertlocnum;
+    Gnum                vertlocend;
+    Gnum                edgelocnum;
+    Gnum                edlofremax;               /* Maximum load of edges to free vertices       */
+    Gnum                edlolocmax;               /* Maximum load of edges to free local vertices */
+
+    vertlocnum = queuloctab[queulocnum];
+    if (mategsttax[vertlocnum] != -1)             /* If vertex already mated or requesting a remote mate */
+      continue;
+
+    for (edgelocnum = vertloctax[vertlocnum], vertlocend = -1, edlofremax = edlolocmax = 0;
+         edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+      Gnum                vertgstend;
+      Gnum                edlolocval;
+
+      vertgstend = edgegsttax[edgelocnum];
+      if (mategsttax[vertgstend] != -1)           /* Only consider free end vertices */
+        continue;
+
+      edlolocval = (edloloctax != NULL) ? edloloctax[edgelocnum] : 1;
+      if (edlolocval > edlofremax)
+        edlofremax = edlolocval;
+      if ((vertgstend < vertlocnnd) &&            /* Keep first heaviest local free end vertex */
+          (edlolocval > edlolocmax)) {
+        edlolocmax = edlolocval;
+        vertlocend = vertgstend;
+      }
+    }
+    if ((vertlocend < 0) ||                       /* If no local free neighbor, or a heavier remote one */
+        (edlolocmax < edlofremax))
+      continue;                                   /* Leave vertex for next pass */
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+    if (multlocnbr >= mateptr->c.multlocsiz) {
+      errorPrint ("dgraphMatchSyncSlice: undersized multinode array");
+      return;
+    }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+    mategsttax[vertlocnum] = (vertlocend + vertlocadj);
+    mategsttax[vertlocend] = (vertlocnum + vertlocadj);
+    multloctab[multlocnbr].vertglbnum[0] = (vertlocnum + vertlocadj);
+    multloctab[multlocnbr].vertglbnum[1] = (vertlocend + vertlocadj);
+    multlocnbr ++;                                /* One more coarse vertex created (two more local mates) */
+    matelocnbr += 2;
+    edgekptnbr += (vendloctax[vertlocnum] - vertloctax[vertlocnum]) + (vendloctax[vertlocend] - vertloctax[vertlocend]) - 2; /* "-2" for collapsed arcs */
+  }
+
+  *queuidxptr = queulocnum;
+  *matelocptr = matelocnbr;
+  *multlocptr = multlocnbr;
+  *edgekptptr = edgekptnbr;
+}
+
 /* These routines perform a round of computations
 ** among enqueued vertices to produce matching requests.
 ** They return:
@@ -1,4 +1,4 @@
-/* Copyright 2007-2009,2012 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2009,2012,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,9 +46,20 @@
 /**                                 to   : 04 apr 2009     **/
 /**                # Version 6.0  : from : 03 oct 2012     **/
 /**                                 to   : 03 oct 2012     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+** The defines.
+*/
+
+/*+ Number of enqueued vertices to locally mate
+    between two polls of pending messages.     +*/
+
+#define DGRAPHMATCHSYNCSLICE        64
+
 /*
 ** The type and structure definitions.
 */
@@ -69,15 +80,16 @@ typedef struct DgraphMatchData_ {
 ** The function prototypes.
 */
 
-int                         dgraphMatchInit     (DgraphMatchData * restrict const, const float);
-void                        dgraphMatchExit     (DgraphMatchData * restrict const);
-int                         dgraphMatchSync     (DgraphMatchData * restrict const);
-int                         dgraphMatchSyncColl (DgraphMatchData * restrict const);
-int                         dgraphMatchSyncPtop (DgraphMatchData * restrict const);
-int                         dgraphMatchCheck    (DgraphMatchData * restrict const);
+int                         dgraphMatchInit      (DgraphMatchData * restrict const, const float);
+void                        dgraphMatchExit      (DgraphMatchData * restrict const);
+int                         dgraphMatchSync      (DgraphMatchData * restrict const);
+int                         dgraphMatchSyncColl  (DgraphMatchData * restrict const);
+int                         dgraphMatchSyncPtop  (DgraphMatchData * restrict const);
+void                        dgraphMatchSyncSlice (DgraphMatchData * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const);
+int                         dgraphMatchCheck     (DgraphMatchData * restrict const);
 
-void                        dgraphMatchHl       (DgraphMatchData * restrict const);
-void                        dgraphMatchSc       (DgraphMatchData * restrict const);
-void                        dgraphMatchHy       (DgraphMatchData * restrict const);
-void                        dgraphMatchLc       (DgraphMatchData * restrict const);
-void                        dgraphMatchLy       (DgraphMatchData * restrict const);
+void                        dgraphMatchHl        (DgraphMatchData * restrict const);
+void                        dgraphMatchSc        (DgraphMatchData * restrict const);
+void                        dgraphMatchHy        (DgraphMatchData * restrict const);
+void                        dgraphMatchLc        (DgraphMatchData * restrict const);
+void                        dgraphMatchLy        (DgraphMatchData * restrict const);
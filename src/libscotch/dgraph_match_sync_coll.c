@@ -1,4 +1,4 @@
-/* Copyright 2009,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2009,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.1  : from : 27 dec 2021     **/
 /**                                 to   : 27 dec 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -54,6 +54,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "context.h"
 #include "dgraph.h"
 #include "dgraph_coarsen.h"
 #include "dgraph_match.h"
@@ -65,9 +66,47 @@
 /*                                   */
 /*************************************/
 
+#ifdef SCOTCH_MPI_ASYNC_COLL
+/* This routine waits for the completion of an
+** asynchronous collective exchange, locally mating
+** slices of enqueued vertices while it is pending.
+** It returns:
+** - MPI_SUCCESS : on success.
+** - !MPI_SUCCESS: on error.
+*/
+
+static
+int
+dgraphMatchSyncCollWait (
+DgraphMatchData * restrict const  mateptr,
+MPI_Request * restrict const      requptr,
+Gnum * restrict const             queuidxptr,
+Gnum * restrict const             matelocptr,
+Gnum * restrict const             multlocptr,
+Gnum * restrict const             edgekptptr)
+{
+  while (*queuidxptr < mateptr->queulocnbr) {     /* While local work remains */
+    int                 flagval;
+    int                 o;
+
+    o = MPI_Test (requptr, &flagval, MPI_STATUS_IGNORE);
+    if ((o != MPI_SUCCESS) || (flagval != 0))     /* If error or exchange completed */
+      return (o);
+
+    dgraphMatchSyncSlice (mateptr, queuidxptr, matelocptr, multlocptr, edgekptptr);
+  }
+
+  return (MPI_Wait (requptr, MPI_STATUS_IGNORE)); /* No more local work: block until exchange completes */
+}
+#endif /* SCOTCH_MPI_ASYNC_COLL */
+
 /* This routine performs a round of communication
 ** to synchronize enqueued matching requests across
-** processors.
+** processors. When asynchronous collectives are
+** available and deterministic behavior is not
+** requested, the exchanges of requests and replies
+** are overlapped with the local mating of enqueued
+** free vertices.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -90,6 +129,12 @@ DgraphMatchData * restrict const  mateptr)
   int * restrict      vrcvcnttab;
   int * restrict      vsnddsptab;
   int * restrict      vrcvdsptab;
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  Gnum                queulocidx;                 /* Index of next queued vertex to mate locally while waiting */
+  Gnum                deteval;                    /* Flag set if deterministic behavior                        */
+  int * restrict      ngbdattab;                  /* Neighbor work array for asynchronous exchanges */
+  MPI_Request         requdat;
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 
   Dgraph * restrict const             grafptr    = mateptr->c.finegrafptr;
   const int * restrict const          procngbtab = grafptr->procngbtab;
@@ -118,13 +163,20 @@ DgraphMatchData * restrict const  mateptr)
   }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
 
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  if ((vsnddsptab = memAlloc ((4 * (grafptr->procglbnbr + procngbnbr) + 1) * sizeof (int))) == NULL) {
+#else /* SCOTCH_MPI_ASYNC_COLL */
   if ((vsnddsptab = memAlloc (4 * grafptr->procglbnbr * sizeof (int))) == NULL) {
+#endif /* SCOTCH_MPI_ASYNC_COLL */
     errorPrint ("dgraphMatchSyncColl: out of memory");
     return     (1);
   }
   vsndcnttab = vsnddsptab + grafptr->procglbnbr;  /* TRICK: put vsnddsptab, vsndcnttab, vrcvdsptab in order for memSet() */
   vrcvdsptab = vsndcnttab + grafptr->procglbnbr;
   vrcvcnttab = vrcvdsptab + grafptr->procglbnbr;
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  ngbdattab  = vrcvcnttab + grafptr->procglbnbr;
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 
   for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) /* Reset indices for sending messages */
     nsndidxtab[procngbnum] = mateptr->c.vsnddsptab[procngbtab[procngbnum]];
@@ -203,20 +255,30 @@ DgraphMatchData * restrict const  mateptr)
     vsndcnttab[procglbnum] = 2 * (nsndidxtab[procngbnum] - mateptr->c.vsnddsptab[procglbnum]);
   }
 
-  if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, vrcvcnttab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS) {
+  if (dgraphNgbAlltoall (grafptr, vsndcnttab, vrcvcnttab) != 0) {
     errorPrint ("dgraphMatchSyncColl: communication error (2)");
     return     (1);
   }
-  if (MPI_Alltoallv (vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI,
-                     mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dgraphMatchSyncColl: communication error (3)");
-    return     (1);
-  }
 
   matelocnbr = mateptr->matelocnbr;
   multlocnbr = mateptr->c.multlocnbr;
   edgekptnbr = mateptr->c.edgekptnbr;
 
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  contextValuesGetInt (mateptr->c.contptr, CONTEXTOPTIONNUMDETERMINISTIC, &deteval);
+  queulocidx = (deteval != 0) ? queulocnbr : 0;   /* No local mating while waiting if deterministic behavior wanted */
+
+  if ((dgraphNgbIalltoallv (grafptr, vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI,
+                                     mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI, ngbdattab, &requdat) != 0) ||
+      (dgraphMatchSyncCollWait (mateptr, &requdat, &queulocidx, &matelocnbr, &multlocnbr, &edgekptnbr) != MPI_SUCCESS)) {
+#else /* SCOTCH_MPI_ASYNC_COLL */
+  if (dgraphNgbAlltoallv (grafptr, vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI,
+                                   mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI) != 0) {
+#endif /* SCOTCH_MPI_ASYNC_COLL */
+    errorPrint ("dgraphMatchSyncColl: communication error (3)");
+    return     (1);
+  }
+
   for (procngbidx = 0; procngbidx < procngbnbr; procngbidx ++) {
     int                 procngbnum;
     int                 procglbnum;
@@ -354,8 +416,14 @@ DgraphMatchData * restrict const  mateptr)
     }
   }
 
-  if (MPI_Alltoallv (mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI,
-                     vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  if ((dgraphNgbIalltoallv (grafptr, mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI,
+                                     vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI, ngbdattab, &requdat) != 0) ||
+      (dgraphMatchSyncCollWait (mateptr, &requdat, &queulocidx, &matelocnbr, &multlocnbr, &edgekptnbr) != MPI_SUCCESS)) {
+#else /* SCOTCH_MPI_ASYNC_COLL */
+  if (dgraphNgbAlltoallv (grafptr, mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI,
+                                   vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI) != 0) {
+#endif /* SCOTCH_MPI_ASYNC_COLL */
     errorPrint ("dgraphMatchSyncColl: communication error (3)");
     return     (1);
   }
@@ -1,4 +1,4 @@
-/* Copyright 2008,2009,2012,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2009,2012,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.1  : from : 27 dec 2021     **/
 /**                                 to   : 27 dec 2021     **/
 /**                # Version 7.0  : from : 22 oct 2021     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,9 +69,50 @@
 /*                                   */
 /*************************************/
 
+/* This routine waits for the completion of any
+** of the pending receive requests, locally mating
+** slices of enqueued vertices while no message
+** has arrived.
+** It returns:
+** - MPI_SUCCESS : on success.
+** - !MPI_SUCCESS: on error.
+*/
+
+static
+int
+dgraphMatchSyncPtopWait (
+DgraphMatchData * restrict const  mateptr,
+int * restrict const              procngbptr,     /*+ Index of neighbor whose message arrived +*/
+MPI_Status * restrict const       statptr,
+Gnum * restrict const             queuidxptr,
+Gnum * restrict const             matelocptr,
+Gnum * restrict const             multlocptr,
+Gnum * restrict const             edgekptptr)
+{
+  const int           procngbnbr = mateptr->c.finegrafptr->procngbnbr;
+
+  while (*queuidxptr < mateptr->queulocnbr) {     /* While local work remains */
+    int                 flagval;
+    int                 o;
+
+    o = MPI_Testany (procngbnbr, mateptr->c.nrcvreqtab, procngbptr, &flagval, statptr);
+    if ((o != MPI_SUCCESS) || (flagval != 0))     /* If error or message arrived */
+      return (o);
+
+    dgraphMatchSyncSlice (mateptr, queuidxptr, matelocptr, multlocptr, edgekptptr);
+  }
+
+  return (MPI_Waitany (procngbnbr, mateptr->c.nrcvreqtab, procngbptr, statptr)); /* No more local work: block until a message arrives */
+}
+
 /* This routine performs a round of point-to-point
 ** communication to synchronize enqueued matching
-** requests across processors.
+** requests across processors. Unless deterministic
+** behavior is requested, waiting for requests and
+** replies from neighbors is overlapped with the
+** local mating of enqueued free vertices; only
+** neighbor messages are awaited, with no global
+** synchronization.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -83,6 +124,7 @@ DgraphMatchData * restrict const  mateptr)
 {
   Gnum                queulocnbr;
   Gnum                queulocnum;
+  Gnum                queulocidx;                 /* Index of next queued vertex to mate locally while waiting */
   Gnum                matelocnbr;
   Gnum                multlocnbr;
   Gnum                vertlocadj;
@@ -218,6 +260,7 @@ DgraphMatchData * restrict const  mateptr)
   matelocnbr = mateptr->matelocnbr;
   multlocnbr = mateptr->c.multlocnbr;
   edgekptnbr = mateptr->c.edgekptnbr;
+  queulocidx = 0;                                 /* Start local mating from beginning of queue */
 
   contextValuesGetInt (mateptr->c.contptr, CONTEXTOPTIONNUMDETERMINISTIC, &deteval);
 
@@ -236,7 +279,7 @@ DgraphMatchData * restrict const  mateptr)
       o = MPI_Wait (&mateptr->c.nrcvreqtab[procngbnum], &statdat);
     }
     else
-      o = MPI_Waitany (procngbnbr, mateptr->c.nrcvreqtab, &procngbnum, &statdat);
+      o = dgraphMatchSyncPtopWait (mateptr, &procngbnum, &statdat, &queulocidx, &matelocnbr, &multlocnbr, &edgekptnbr);
 
     if ((o != MPI_SUCCESS) ||
         (MPI_Get_count (&statdat, GNUM_MPI, &statsiz) != MPI_SUCCESS)) {
@@ -446,7 +489,7 @@ DgraphMatchData * restrict const  mateptr)
       o = MPI_Wait (&mateptr->c.nrcvreqtab[procngbnum], &statdat);
     }
     else
-      o = MPI_Waitany (procngbnbr, mateptr->c.nrcvreqtab, &procngbnum, &statdat);
+      o = dgraphMatchSyncPtopWait (mateptr, &procngbnum, &statdat, &queulocidx, &matelocnbr, &multlocnbr, &edgekptnbr);
 
     if ((o != MPI_SUCCESS) ||
         (MPI_Get_count (&statdat, GNUM_MPI, &statsiz) != MPI_SUCCESS)) {
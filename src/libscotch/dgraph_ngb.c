@@ -0,0 +1,355 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : dgraph_ngb.c                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the routines which **/
+/**                perform all-to-all communications       **/
+/**                restricted to the neighbor processes of **/
+/**                a distributed graph.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # When neighborhood collectives are     **/
+/**                  available, communications take place  **/
+/**                  on a distributed graph topology       **/
+/**                  communicator built once per graph     **/
+/**                  from procngbtab, so that their cost   **/
+/**                  depends on the number of neighbors    **/
+/**                  rather than on the number of          **/
+/**                  processes. Else, they fall back to    **/
+/**                  plain collectives on proccomm.        **/
+/**                # The count and displacement arrays     **/
+/**                  of neighborhood collectives are kept  **/
+/**                  along with the communicator, so that  **/
+/**                  exchanges do not allocate memory.     **/
+/**                # All count and displacement arrays     **/
+/**                  passed to these routines are indexed  **/
+/**                  by global process number, and send    **/
+/**                  counts must be zero for processes     **/
+/**                  which are not neighbors.              **/
+/**                                                        **/
+/************************************************************/
+
+/*
+** The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "dgraph.h"
+
+/***********************************/
+/*                                 */
+/* These routines handle neighbor  */
+/* all-to-all communications.      */
+/*                                 */
+/***********************************/
+
+/* This routine builds the neighborhood
+** communicator of the given distributed
+** graph, if not already done, along with
+** its work array of 4 * procngbnbr integers
+** for neighbor counts and displacements.
+** It is a collective routine.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphNgbComm (
+Dgraph * restrict const     grafptr)
+{
+#ifdef SCOTCH_MPI_NGB_COLL
+  int * restrict      ngbwgttab;                  /* Halo volumes, as edge weights of the topology */
+  int                 procngbnum;
+
+  const int * restrict const  procngbtab = grafptr->procngbtab;
+  const int                   procngbnbr = grafptr->procngbnbr;
+
+  if ((grafptr->flagval & DGRAPHHASNGBCOMM) != 0) /* If communicator already built, do nothing */
+    return (0);
+
+  if ((ngbwgttab = memAlloc ((procngbnbr * 4 + 1) * sizeof (int))) == NULL) { /* "+1" in case no neighbors */
+    errorPrint ("dgraphNgbComm: out of memory");
+    return (1);
+  }
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
+    ngbwgttab[procngbnum]              = grafptr->procrcvtab[procngbtab[procngbnum]];
+    ngbwgttab[procngbnum + procngbnbr] = grafptr->procsndtab[procngbtab[procngbnum]];
+  }
+
+  if (MPI_Dist_graph_create_adjacent (grafptr->proccomm, /* Neighbor relation is symmetric */
+                                      procngbnbr, grafptr->procngbtab, ngbwgttab,
+                                      procngbnbr, grafptr->procngbtab, ngbwgttab + procngbnbr,
+                                      MPI_INFO_NULL, 0, &grafptr->procngbcomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphNgbComm: communication error");
+    memFree    (ngbwgttab);
+    return     (1);
+  }
+
+  grafptr->procngbdattab = ngbwgttab;             /* Weight array is kept as work array */
+  grafptr->flagval      |= DGRAPHHASNGBCOMM | DGRAPHFREENGBCOMM;
+#endif /* SCOTCH_MPI_NGB_COLL */
+
+  return (0);
+}
+
+/* This routine frees the neighborhood
+** communicator of the given distributed
+** graph and its work array, if they
+** belong to it.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+dgraphNgbFree (
+Dgraph * restrict const     grafptr)
+{
+  if ((grafptr->flagval & (DGRAPHHASNGBCOMM | DGRAPHFREENGBCOMM)) == (DGRAPHHASNGBCOMM | DGRAPHFREENGBCOMM)) { /* If neighborhood communicator must be freed */
+    MPI_Comm_free (&grafptr->procngbcomm);
+    memFree       (grafptr->procngbdattab);
+  }
+  grafptr->flagval      &= ~(DGRAPHHASNGBCOMM | DGRAPHFREENGBCOMM);
+  grafptr->procngbdattab = NULL;
+}
+
+/* This routine fills the neighbor-indexed
+** count and displacement arrays used by
+** neighborhood collectives, from arrays
+** indexed by global process number.
+** It returns:
+** - 0   : if data are consistent.
+** - !0  : on error.
+*/
+
+#ifdef SCOTCH_MPI_NGB_COLL
+static
+int
+dgraphNgbAlltoallv2 (
+const Dgraph * restrict const grafptr,
+const int * restrict const    sendcnttab,
+const int * restrict const    senddsptab,
+const int * restrict const    recvcnttab,
+const int * restrict const    recvdsptab,
+int * restrict const          ngbdattab)          /* Array of 4 * procngbnbr integers */
+{
+  int                 procngbnum;
+
+  const int * restrict const  procngbtab = grafptr->procngbtab;
+  const int                   procngbnbr = grafptr->procngbnbr;
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  int                 procglbnum;
+
+  for (procglbnum = procngbnum = 0; procglbnum < grafptr->procglbnbr; procglbnum ++) {
+    if ((procngbnum < procngbnbr) && (procngbtab[procngbnum] == procglbnum)) {
+      procngbnum ++;
+      continue;
+    }
+    if (sendcnttab[procglbnum] != 0) {
+      errorPrint ("dgraphNgbAlltoallv2: invalid parameters");
+      return (1);
+    }
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
+    int                 procglbnum;
+
+    procglbnum = procngbtab[procngbnum];
+    ngbdattab[procngbnum]                  = sendcnttab[procglbnum];
+    ngbdattab[procngbnum + procngbnbr]     = senddsptab[procglbnum];
+    ngbdattab[procngbnum + procngbnbr * 2] = recvcnttab[procglbnum];
+    ngbdattab[procngbnum + procngbnbr * 3] = recvdsptab[procglbnum];
+  }
+
+  return (0);
+}
+#endif /* SCOTCH_MPI_NGB_COLL */
+
+/* This routine exchanges one integer
+** with each neighbor process. Values
+** received from non-neighbor processes
+** are set to zero.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphNgbAlltoall (
+Dgraph * restrict const     grafptr,
+int * const                 sendtab,              /* Send array, indexed by global process number    */
+int * const                 recvtab)              /* Receive array, indexed by global process number */
+{
+#ifdef SCOTCH_MPI_NGB_COLL
+  int * restrict      ngbsndtab;
+  int                 procngbnum;
+
+  const int * restrict const  procngbtab = grafptr->procngbtab;
+  const int                   procngbnbr = grafptr->procngbnbr;
+
+  if (dgraphNgbComm (grafptr) != 0)
+    return (1);
+
+  ngbsndtab = grafptr->procngbdattab;
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++)
+    ngbsndtab[procngbnum] = sendtab[procngbtab[procngbnum]];
+
+  if (MPI_Neighbor_alltoall (ngbsndtab, 1, MPI_INT, ngbsndtab + procngbnbr, 1, MPI_INT, grafptr->procngbcomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphNgbAlltoall: communication error");
+    return (1);
+  }
+
+  memSet (recvtab, 0, grafptr->procglbnbr * sizeof (int));
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++)
+    recvtab[procngbtab[procngbnum]] = ngbsndtab[procngbnum + procngbnbr];
+
+  return (0);
+#else /* SCOTCH_MPI_NGB_COLL */
+  if (MPI_Alltoall (sendtab, 1, MPI_INT, recvtab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphNgbAlltoall: communication error");
+    return (1);
+  }
+
+  return (0);
+#endif /* SCOTCH_MPI_NGB_COLL */
+}
+
+/* This routine exchanges variable-size
+** data with neighbor processes.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphNgbAlltoallv (
+Dgraph * restrict const     grafptr,
+void * const                senddattab,
+int * const                 sendcnttab,           /* Arrays indexed by global process number */
+int * const                 senddsptab,
+MPI_Datatype                sendtypval,
+void * const                recvdattab,
+int * const                 recvcnttab,
+int * const                 recvdsptab,
+MPI_Datatype                recvtypval)
+{
+#ifdef SCOTCH_MPI_NGB_COLL
+  int * restrict      ngbdattab;
+
+  const int                   procngbnbr = grafptr->procngbnbr;
+
+  if (dgraphNgbComm (grafptr) != 0)
+    return (1);
+
+  ngbdattab = grafptr->procngbdattab;
+  if (dgraphNgbAlltoallv2 (grafptr, sendcnttab, senddsptab, recvcnttab, recvdsptab, ngbdattab) != 0)
+    return (1);
+
+  if (MPI_Neighbor_alltoallv (senddattab, ngbdattab, ngbdattab + procngbnbr, sendtypval,
+                              recvdattab, ngbdattab + procngbnbr * 2, ngbdattab + procngbnbr * 3, recvtypval,
+                              grafptr->procngbcomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphNgbAlltoallv: communication error");
+    return (1);
+  }
+
+  return (0);
+#else /* SCOTCH_MPI_NGB_COLL */
+  if (MPI_Alltoallv (senddattab, sendcnttab, senddsptab, sendtypval,
+                     recvdattab, recvcnttab, recvdsptab, recvtypval, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphNgbAlltoallv: communication error");
+    return (1);
+  }
+
+  return (0);
+#endif /* SCOTCH_MPI_NGB_COLL */
+}
+
+/* This routine starts an asynchronous
+** exchange of variable-size data with
+** neighbor processes. The work array, of
+** 4 * procngbnbr integers, must not be
+** freed before the communication is
+** completed.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+#ifdef SCOTCH_MPI_ASYNC_COLL
+int
+dgraphNgbIalltoallv (
+Dgraph * restrict const     grafptr,
+void * const                senddattab,
+int * const                 sendcnttab,           /* Arrays indexed by global process number */
+int * const                 senddsptab,
+MPI_Datatype                sendtypval,
+void * const                recvdattab,
+int * const                 recvcnttab,
+int * const                 recvdsptab,
+MPI_Datatype                recvtypval,
+int * const                 ngbdattab,            /* Work array for neighbor counts and displacements */
+MPI_Request * const         requptr)
+{
+#ifdef SCOTCH_MPI_NGB_COLL
+  const int                   procngbnbr = grafptr->procngbnbr;
+
+  if ((dgraphNgbComm (grafptr) != 0) ||
+      (dgraphNgbAlltoallv2 (grafptr, sendcnttab, senddsptab, recvcnttab, recvdsptab, ngbdattab) != 0))
+    return (1);
+
+  if (MPI_Ineighbor_alltoallv (senddattab, ngbdattab, ngbdattab + procngbnbr, sendtypval,
+                               recvdattab, ngbdattab + procngbnbr * 2, ngbdattab + procngbnbr * 3, recvtypval,
+                               grafptr->procngbcomm, requptr) != MPI_SUCCESS) {
+    errorPrint ("dgraphNgbIalltoallv: communication error");
+    return (1);
+  }
+#else /* SCOTCH_MPI_NGB_COLL */
+  if (MPI_Ialltoallv (senddattab, sendcnttab, senddsptab, sendtypval,
+                      recvdattab, recvcnttab, recvdsptab, recvtypval,
+                      grafptr->proccomm, requptr) != MPI_SUCCESS) {
+    errorPrint ("dgraphNgbIalltoallv: communication error");
+    return (1);
+  }
+#endif /* SCOTCH_MPI_NGB_COLL */
+
+  return (0);
+}
+#endif /* SCOTCH_MPI_ASYNC_COLL */
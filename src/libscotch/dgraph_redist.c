@@ -1,4 +1,4 @@
-/* Copyright 2012,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 10 may 2010     **/
 /**                                 to   : 13 sep 2012     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -53,6 +53,8 @@
 
 #include "module.h"
 #include "common.h"
+#include "context.h"
+#include "comm.h"
 #include "dgraph.h"
 #include "dgraph_redist.h"
 
@@ -78,7 +80,8 @@ const Gnum * restrict const srcpartloctax,        /* Array of process destinatio
 const Gnum * restrict const srcpermgsttax,        /* Redistribution permutation array */
 const Gnum                  dstvertlocdlt,        /* Extra size of local vertex array */
 const Gnum                  dstedgelocdlt,        /* Extra size of local edge array   */
-Dgraph * restrict const     dstgrafptr)           /* Destination distributed graph    */
+Dgraph * restrict const     dstgrafptr,           /* Destination distributed graph    */
+Context * restrict const    contptr)              /* Execution context                */
 {
   Gnum * restrict       permgsttax;
   const Gnum * restrict permgsttmp;
@@ -95,6 +98,7 @@ Dgraph * restrict const     dstgrafptr)           /* Destination distributed gra
   Gnum                  procvrtval;
   int                   procglbnbr;
   int                   procnum;
+  INT                   compval;
   int                   o;
 
   if (srcpartloctax == NULL) {
@@ -186,7 +190,9 @@ Dgraph * restrict const     dstgrafptr)           /* Destination distributed gra
   else
     permgsttmp = srcpermgsttax;
 
-  o = dgraphRedist2 (srcgrafptr, srcpartloctax, permgsttmp, procdsptab, procvrttab, 0, dstedgelocdlt, dstgrafptr);
+  contextValuesGetInt (contptr, CONTEXTOPTIONNUMCOMPRESS, &compval);
+
+  o = dgraphRedist2 (srcgrafptr, srcpartloctax, permgsttmp, procdsptab, procvrttab, 0, dstedgelocdlt, dstgrafptr, (int) compval);
 
   memFree (procvrttab);                           /* Free group leader */
 
@@ -203,7 +209,8 @@ const Gnum * const          dstprocdsptab,        /* New distribution of graph v
 const Gnum * const          dstprocvrttab,        /* New distribution of graph vertices */
 const Gnum                  dstvertlocdlt,        /* Extra size of local vertex array   */
 const Gnum                  dstedgelocdlt,        /* Extra size of local edge array     */
-Dgraph * restrict const     dstgrafptr)           /* Destination distributed graph      */
+Dgraph * restrict const     dstgrafptr,           /* Destination distributed graph      */
+int                         compval)              /* Flag set if data are compressed    */
 {
   Gnum                      baseval;
   int                       flveval;              /* Number of data to send per vertex                   */
@@ -415,8 +422,27 @@ Dgraph * restrict const     dstgrafptr)           /* Destination distributed gra
     dsnddatidx += dsndcnttab[procnum];
   }
 
-  if (MPI_Alltoallv (dsnddattab, dsndcnttab, dsnddsptab, GNUM_MPI, /* Exchange graph data */
-                     drcvdattab, drcvcnttab, drcvdsptab, GNUM_MPI, srcgrafptr->proccomm) != MPI_SUCCESS) {
+  if (compval != 0) {                             /* If compression requested, byte counts and displacements must fit in ints */
+    int                 compglbval;
+
+    compval = ((COMMENCODESIZE ((size_t) dsnddatnbr) <= INT_MAX) &&
+               (COMMENCODESIZE ((size_t) drcvdatnbr) <= INT_MAX)) ? 1 : 0;
+    if (MPI_Allreduce (&compval, &compglbval, 1, MPI_INT, MPI_MIN, srcgrafptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphRedist2: communication error (5)");
+      return     (1);
+    }
+    compval = compglbval;                         /* Else, fall back to raw exchange */
+  }
+
+  if (compval != 0) {
+    if (dgraphRedist3 (dsnddattab, dsndcnttab, dsnddsptab, drcvdattab, drcvcnttab, drcvdsptab,
+                       flveval, fledval, procglbnbr, srcgrafptr->proccomm) != 0) {
+      errorPrint ("dgraphRedist2: cannot exchange compressed graph data");
+      return     (1);
+    }
+  }
+  else if (MPI_Alltoallv (dsnddattab, dsndcnttab, dsnddsptab, GNUM_MPI, /* Exchange graph data */
+                          drcvdattab, drcvcnttab, drcvdsptab, GNUM_MPI, srcgrafptr->proccomm) != MPI_SUCCESS) {
     errorPrint ("dgraphRedist2: communication error (4)");
     return     (1);
   }
@@ -515,3 +541,158 @@ Dgraph * restrict const     dstgrafptr)           /* Destination distributed gra
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
   return (0);
 }
+
+/* This routine exchanges the vertex and edge
+** data records prepared by dgraphRedist2() in
+** compressed form. Every record comprises the
+** destination vertex number, its degree, its
+** label, its load if any, its edge loads if
+** any, and its end vertex numbers. Vertex
+** numbers and labels are encoded as differences
+** with the ones of the previous record sent to
+** the same process, and end vertex numbers as
+** differences with their predecessor, starting
+** from the vertex number. The decoded records
+** are laid out in the receive array just as in
+** the uncompressed exchange.
+** It returns:
+** - 0   : if the data have been exchanged.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphRedist3 (
+const Gnum * const          dsnddattab,           /* Send array for vertex and edge data    */
+const int * const           dsndcnttab,           /* Count array for sent data              */
+const int * const           dsnddsptab,           /* Displacement array for sent data       */
+Gnum * const                drcvdattab,           /* Receive array for vertex and edge data */
+const int * const           drcvcnttab,           /* Count array for received data          */
+const int * const           drcvdsptab,           /* Displacement array for received data   */
+const int                   flveval,              /* Number of data sent per vertex         */
+const int                   fledval,              /* Number of data sent per edge           */
+const int                   procglbnbr,
+MPI_Comm                    proccomm)
+{
+  byte *              bsnddattab;                 /* Send array for compressed data        */
+  byte *              brcvdattab;                 /* Receive array for compressed data     */
+  byte *              bsnddatptr;
+  int * restrict      bsndcnttab;                 /* Count array for sent bytes            */
+  int * restrict      bsnddsptab;                 /* Displacement array for sent bytes     */
+  int * restrict      brcvcnttab;                 /* Count array for received bytes        */
+  int * restrict      brcvdsptab;                 /* Displacement array for received bytes */
+  int                 brcvdatnbr;
+  int                 dsnddatnbr;
+  int                 procnum;
+
+  dsnddatnbr = dsnddsptab[procglbnbr - 1] + dsndcnttab[procglbnbr - 1];
+  if (memAllocGroup ((void **) (void *)
+                     &bsndcnttab, (size_t) (procglbnbr * sizeof (int)),
+                     &bsnddsptab, (size_t) (procglbnbr * sizeof (int)),
+                     &brcvcnttab, (size_t) (procglbnbr * sizeof (int)),
+                     &brcvdsptab, (size_t) (procglbnbr * sizeof (int)),
+                     &bsnddattab, (size_t) (COMMENCODESIZE ((size_t) dsnddatnbr)), NULL) == NULL) {
+    errorPrint ("dgraphRedist3: out of memory (1)");
+    return     (1);
+  }
+
+  for (procnum = 0, bsnddatptr = bsnddattab; procnum < procglbnbr; procnum ++) { /* Encode records of each destination process */
+    const Gnum *        dsnddatptr;
+    const Gnum *        dsnddatend;
+    Gnum                vertnumprv;               /* Previous vertex number and label */
+    Gnum                vlblnumprv;
+
+    bsnddsptab[procnum] = (int) (bsnddatptr - bsnddattab);
+    for (dsnddatptr = dsnddattab + dsnddsptab[procnum], dsnddatend = dsnddatptr + dsndcnttab[procnum],
+         vertnumprv = vlblnumprv = 0; dsnddatptr < dsnddatend; ) {
+      Gnum                degrval;
+
+      degrval    = dsnddatptr[1];
+      bsnddatptr = commEncode (bsnddatptr, dsnddatptr,     1, vertnumprv); /* Encode vertex number, degree and label */
+      bsnddatptr = commEncode (bsnddatptr, dsnddatptr + 1, 1, 0);
+      bsnddatptr = commEncode (bsnddatptr, dsnddatptr + 2, 1, vlblnumprv);
+      vertnumprv = dsnddatptr[0];
+      vlblnumprv = dsnddatptr[2];
+      dsnddatptr += 3;
+      if (flveval > 3)                            /* Encode vertex load if any */
+        bsnddatptr = commEncode (bsnddatptr, dsnddatptr ++, 1, 0);
+      if (fledval > 1) {                          /* Encode edge loads if any */
+        bsnddatptr = commEncode (bsnddatptr, dsnddatptr, degrval, 0);
+        dsnddatptr += degrval;
+      }
+      bsnddatptr = commEncode (bsnddatptr, dsnddatptr, degrval, vertnumprv); /* Encode end vertices */
+      dsnddatptr += degrval;
+    }
+    bsndcnttab[procnum] = (int) (bsnddatptr - bsnddattab) - bsnddsptab[procnum];
+  }
+
+  if (MPI_Alltoall (bsndcnttab, 1, MPI_INT,       /* Get amounts of compressed data to receive */
+                    brcvcnttab, 1, MPI_INT, proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphRedist3: communication error (1)");
+    memFree    (bsndcnttab);                      /* Free group leader */
+    return     (1);
+  }
+
+  for (procnum = 0, brcvdatnbr = 0; procnum < procglbnbr; procnum ++) { /* Sum cannot overflow, as checked by caller */
+    brcvdsptab[procnum] = brcvdatnbr;
+    brcvdatnbr += brcvcnttab[procnum];
+  }
+
+  if ((brcvdattab = memAlloc (brcvdatnbr * sizeof (byte) + 1)) == NULL) { /* TRICK: "+1" to avoid empty allocation */
+    errorPrint ("dgraphRedist3: out of memory (2)");
+    memFree    (bsndcnttab);
+    return     (1);
+  }
+
+  if (MPI_Alltoallv (bsnddattab, bsndcnttab, bsnddsptab, MPI_BYTE, /* Exchange compressed graph data */
+                     brcvdattab, brcvcnttab, brcvdsptab, MPI_BYTE, proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphRedist3: communication error (2)");
+    memFree    (brcvdattab);
+    memFree    (bsndcnttab);
+    return     (1);
+  }
+
+  for (procnum = 0; procnum < procglbnbr; procnum ++) { /* Decode records of each source process */
+    const byte *        brcvdatptr;
+    Gnum *              drcvdatptr;
+    Gnum *              drcvdatend;
+    Gnum                vertnumprv;
+    Gnum                vlblnumprv;
+
+    for (brcvdatptr = brcvdattab + brcvdsptab[procnum],
+         drcvdatptr = drcvdattab + drcvdsptab[procnum], drcvdatend = drcvdatptr + drcvcnttab[procnum],
+         vertnumprv = vlblnumprv = 0; drcvdatptr < drcvdatend; ) {
+      Gnum                degrval;
+
+      brcvdatptr = commDecode (brcvdatptr, drcvdatptr,     1, vertnumprv);
+      brcvdatptr = commDecode (brcvdatptr, drcvdatptr + 1, 1, 0);
+      brcvdatptr = commDecode (brcvdatptr, drcvdatptr + 2, 1, vlblnumprv);
+      vertnumprv = drcvdatptr[0];
+      degrval    = drcvdatptr[1];
+      vlblnumprv = drcvdatptr[2];
+      drcvdatptr += 3;
+      if (flveval > 3)
+        brcvdatptr = commDecode (brcvdatptr, drcvdatptr ++, 1, 0);
+      if (fledval > 1) {
+        brcvdatptr = commDecode (brcvdatptr, drcvdatptr, degrval, 0);
+        drcvdatptr += degrval;
+      }
+      brcvdatptr = commDecode (brcvdatptr, drcvdatptr, degrval, vertnumprv);
+      drcvdatptr += degrval;
+    }
+#ifdef SCOTCH_DEBUG_DGRAPH2
+    if ((drcvdatptr != drcvdatend) ||
+        (brcvdatptr != (brcvdattab + brcvdsptab[procnum] + brcvcnttab[procnum]))) {
+      errorPrint ("dgraphRedist3: internal error");
+      memFree    (brcvdattab);
+      memFree    (bsndcnttab);
+      return     (1);
+    }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+  }
+
+  memFree (brcvdattab);
+  memFree (bsndcnttab);                           /* Free group leader, which also holds receive arrays */
+
+  return (0);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2012,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 10 may 2010     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -51,7 +51,8 @@
 */
 
 #ifdef SCOTCH_DGRAPH_REDIST
-static int                  dgraphRedist2       (Dgraph * restrict const, const Gnum * restrict const, const Gnum * restrict const, const Gnum * const, const Gnum * const, const Gnum, const Gnum, Dgraph * restrict const);
+static int                  dgraphRedist2       (Dgraph * restrict const, const Gnum * restrict const, const Gnum * restrict const, const Gnum * const, const Gnum * const, const Gnum, const Gnum, Dgraph * restrict const, const int);
+static int                  dgraphRedist3       (const Gnum * const, const int * const, const int * const, Gnum * const, const int * const, const int * const, const int, const int, const int, MPI_Comm);
 #endif /* SCOTCH_DGRAPH_REDIST */
 
-int                         dgraphRedist        (Dgraph * restrict const, const Gnum * restrict const, const Gnum * restrict const, const Gnum, const Gnum, Dgraph * restrict const);
+int                         dgraphRedist        (Dgraph * restrict const, const Gnum * restrict const, const Gnum * restrict const, const Gnum, const Gnum, Dgraph * restrict const, Context * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2008,2013,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2013,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**                # Version 6.0  : from : 03 sep 2013     **/
 /**                                 to   : 03 sep 2013     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -147,6 +147,102 @@ DmappingFrag * restrict const fragptr)
 #endif /* SCOTCH_PTHREAD */
 }
 
+/* This routine adds to the given distributed
+** mapping a fragment which holds all the local
+** vertices of the given distributed graph, mapped
+** according to the given array of terminal domain
+** numbers. It is the converse of dmapTerm().
+** It returns:
+** - 0   : if fragment successfully added.
+** - !0  : on error.
+*/
+
+int
+dmapAddTerm (
+Dmapping * restrict const       dmapptr,
+const Dgraph * restrict const   grafptr,
+const Gnum * restrict const     termloctab)
+{
+  DmappingFrag * restrict     fragptr;
+  DmappingTermSort * restrict sorttab;
+  Gnum                        vertlocnum;
+  Gnum                        termval;
+  Anum                        domnnbr;
+  Anum                        domnnum;
+
+  if ((sorttab = memAlloc ((grafptr->vertlocnbr + 1) * sizeof (DmappingTermSort))) == NULL) {
+    errorPrint ("dmapAddTerm: out of memory (1)");
+    return     (1);
+  }
+
+  for (vertlocnum = 0; vertlocnum < grafptr->vertlocnbr; vertlocnum ++) {
+    sorttab[vertlocnum].vertnum = termloctab[vertlocnum]; /* Sort vertices by terminal number */
+    sorttab[vertlocnum].termnum = vertlocnum;
+  }
+  intSort2asc1 (sorttab, grafptr->vertlocnbr);
+
+  for (vertlocnum = 0, domnnbr = 0, termval = -1; vertlocnum < grafptr->vertlocnbr; vertlocnum ++) { /* Count distinct terminal domains */
+    if (sorttab[vertlocnum].vertnum != termval) {
+      termval = sorttab[vertlocnum].vertnum;
+      domnnbr ++;
+    }
+  }
+
+  if ((fragptr = memAlloc (sizeof (DmappingFrag))) == NULL) {
+    errorPrint ("dmapAddTerm: out of memory (2)");
+    memFree    (sorttab);
+    return     (1);
+  }
+  fragptr->parttab = NULL;
+  fragptr->domntab = NULL;
+  if (((fragptr->vnumtab = memAlloc (grafptr->vertlocnbr * sizeof (Gnum)))    == NULL) ||
+      ((fragptr->parttab = memAlloc (grafptr->vertlocnbr * sizeof (Anum)))    == NULL) ||
+      ((fragptr->domntab = memAlloc (domnnbr             * sizeof (ArchDom))) == NULL)) {
+    errorPrint ("dmapAddTerm: out of memory (3)");
+    if (fragptr->vnumtab != NULL) {
+      if (fragptr->parttab != NULL)
+        memFree (fragptr->parttab);
+      memFree (fragptr->vnumtab);
+    }
+    memFree (fragptr);
+    memFree (sorttab);
+    return  (1);
+  }
+  fragptr->vertnbr = grafptr->vertlocnbr;
+  fragptr->domnnbr = domnnbr;
+
+  for (vertlocnum = 0, domnnum = -1, termval = -1; vertlocnum < grafptr->vertlocnbr; vertlocnum ++) {
+    if (sorttab[vertlocnum].vertnum != termval) { /* If new terminal domain */
+      termval = sorttab[vertlocnum].vertnum;
+      if (archDomTerm (&dmapptr->archdat, &fragptr->domntab[++ domnnum], (ArchDomNum) termval) != 0) {
+        errorPrint ("dmapAddTerm: invalid terminal domain number");
+        memFree    (fragptr->domntab);
+        memFree    (fragptr->parttab);
+        memFree    (fragptr->vnumtab);
+        memFree    (fragptr);
+        memFree    (sorttab);
+        return     (1);
+      }
+    }
+    fragptr->parttab[sorttab[vertlocnum].termnum] = domnnum;
+  }
+
+  if (grafptr->vnumloctax != NULL)
+    memCpy (fragptr->vnumtab, grafptr->vnumloctax + grafptr->baseval, grafptr->vertlocnbr * sizeof (Gnum));
+  else {
+    Gnum                vertlocadj;
+
+    for (vertlocnum = 0, vertlocadj = grafptr->procvrttab[grafptr->proclocnum]; vertlocnum < grafptr->vertlocnbr; vertlocnum ++)
+      fragptr->vnumtab[vertlocnum] = vertlocadj + vertlocnum;
+  }
+
+  memFree (sorttab);
+
+  dmapAdd (dmapptr, fragptr);
+
+  return (0);
+}
+
 /* This routine propagates back distributed mapping
 ** information to a part array associated with a
 ** distributed graph structure.
@@ -1,4 +1,4 @@
-/* Copyright 2008,2010,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2010,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -100,5 +100,6 @@ typedef struct DmappingTermSort_ {
 int                         dmapInit            (Dmapping * restrict const, const Arch * restrict const);
 void                        dmapExit            (Dmapping * const);
 void                        dmapAdd             (Dmapping * restrict const, DmappingFrag * restrict const);
+int                         dmapAddTerm         (Dmapping * restrict const, const Dgraph * restrict const, const Gnum * restrict const);
 int                         dmapSave            (const Dmapping * restrict const, const Dgraph * restrict const, FILE * restrict const);
 int                         dmapTerm            (const Dmapping * restrict const, const Dgraph * restrict const, Gnum * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 08 may 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -54,9 +54,11 @@
 **  The defines.
 */
 
-/*+ Tag for MPI communications. +*/
+/*+ Tags for MPI communications. +*/
 
 #define DORDERTAGPERI               0
+#define DORDERTAGLEAF               1
+#define DORDERTAGTREE               2
 
 /*+ Column block separation tree cell flags.
     The DORDERCBLKNEDI value must correspond
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2013,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2013,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 10 oct 2013     **/
 /**                                 to   : 10 oct 2013     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -55,6 +55,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "comm.h"
 #include "dgraph.h"
 #include "dgraph_allreduce.h"
 #include "order.h"
@@ -83,15 +84,13 @@ const Dorder * restrict const dordptr,
 Order * restrict const        cordptr)
 {
   Gnum                        leaflocnbr;
-  int                         leafrcvnbr;
+  Gnum                        leafrcvnbr;
   DorderGatherLeaf * restrict leafrcvtab;
-  int                         leafsndnbr;         /* "int" since used as count in MPI_Gatherv */
+  Gnum                        leafsndnbr;
   DorderGatherLeaf * restrict leafsndtab;
-  Gnum * restrict             perircvtab;
-  int                         perisndnbr;         /* "int" since used as count in MPI_Gatherv */
-  Gnum * restrict             perisndtab;
-  int * restrict              recvcnttab;
-  int * restrict              recvdsptab;
+  Gnum * restrict             vnodrcvtab;
+  Gnum * restrict             recvcnttab;         /* Counts and displacements in number of Gnum's */
+  Gnum * restrict             recvdsptab;
   const DorderLink * restrict linklocptr;
   Gnum                        vnodlocnbr;
   int                         procglbnbr;
@@ -128,19 +127,13 @@ Order * restrict const        cordptr)
   MPI_Comm_size (dordptr->proccomm, &procglbnbr);
 
   if (cordptr != NULL) {
-    Gnum                  vnodglbnbr;
-
     reduloctab[0] = (Gnum) dordptr->proclocnum;
     reduloctab[1] = 1;
 
-    vnodglbnbr = 2 * procglbnbr;                  /* TRICK: use perircvtab array as gather array        */
-    if (vnodglbnbr < (dordptr->vnodglbnbr - vnodlocnbr)) /* But should receive permutation indices too! */
-      vnodglbnbr = dordptr->vnodglbnbr - vnodlocnbr; /* TRICK: root will not receive from itself        */
-
     if (memAllocGroup ((void **) (void *)
-                       &recvcnttab, (size_t) (procglbnbr * sizeof (int)),
-                       &recvdsptab, (size_t) (procglbnbr * sizeof (int)),
-                       &perircvtab, (size_t) (vnodglbnbr * sizeof (Gnum)), NULL) == NULL) {
+                       &recvcnttab, (size_t) (procglbnbr * sizeof (Gnum)),
+                       &recvdsptab, (size_t) (procglbnbr * sizeof (Gnum)),
+                       &vnodrcvtab, (size_t) (procglbnbr * 2 * sizeof (Gnum)), NULL) == NULL) {
       errorPrint ("dorderGather: out of memory (1)");
       reduloctab[0] = (Gnum) procglbnbr;          /* Indicate memory error */
     }
@@ -167,7 +160,7 @@ Order * restrict const        cordptr)
 
   reduloctab[0] = leaflocnbr;
   reduloctab[1] = vnodlocnbr;
-  if (MPI_Gather (reduloctab, 2, GNUM_MPI, perircvtab, 2, GNUM_MPI, protnum, dordptr->proccomm) != MPI_SUCCESS) {
+  if (MPI_Gather (reduloctab, 2, GNUM_MPI, vnodrcvtab, 2, GNUM_MPI, protnum, dordptr->proccomm) != MPI_SUCCESS) {
     errorPrint ("dorderGather: communication error (2)");
     return     (1);
   }
@@ -175,27 +168,24 @@ Order * restrict const        cordptr)
   if (dordptr->proclocnum == protnum) {
     int                   procnum;
 
-    perircvtab[2 * protnum] = 0;                  /* TRICK: root will not send to nor receive from itself to avoid unnecessary memory copy */
+    vnodrcvtab[2 * protnum] = 0;                  /* TRICK: root will not send to nor receive from itself to avoid unnecessary memory copy */
     for (procnum = 0, leafrcvnbr = 0; procnum < procglbnbr; procnum ++) {
       recvdsptab[procnum] = leafrcvnbr;
-      recvcnttab[procnum] = (int) (perircvtab[2 * procnum] * 2); /* TRICK: DorderGatherLeaf structures are made of 2 GNUM_MPI fields */
+      recvcnttab[procnum] = vnodrcvtab[2 * procnum] * 2; /* TRICK: DorderGatherLeaf structures are made of 2 GNUM_MPI fields */
       leafrcvnbr         += recvcnttab[procnum];
     }
     leafrcvnbr /= 2;                              /* TRICK: restore real number of leaf structures to be received */
     leafsndnbr  = 0;
-    perisndnbr  = 0;
   }
   else {
     leafrcvnbr = 0;
-    leafsndnbr = (int) leaflocnbr;
-    perisndnbr = (int) vnodlocnbr;
+    leafsndnbr = leaflocnbr;
   }
 
   cheklocval = 0;
   if (memAllocGroup ((void **) (void *)
                      &leafrcvtab, (size_t) (leafrcvnbr * sizeof (DorderGatherLeaf)),
-                     &leafsndtab, (size_t) (leafsndnbr * sizeof (DorderGatherLeaf)),
-                     &perisndtab, (size_t) (perisndnbr * sizeof (Gnum)), NULL) == NULL) {
+                     &leafsndtab, (size_t) (leafsndnbr * sizeof (DorderGatherLeaf)), NULL) == NULL) {
     errorPrint ("dorderGather: out of memory (2)");
     cheklocval = 1;
   }
@@ -213,24 +203,10 @@ Order * restrict const        cordptr)
     return (1);
   }
 
-  if (dordptr->proclocnum == protnum) {           /* If root process */
-#ifdef SCOTCH_DEBUG_DORDER2
-    memSet (cordptr->peritab, ~0, dordptr->vnodglbnbr * sizeof (Gnum));
-#endif /* SCOTCH_DEBUG_DORDER2 */
-
-    for (linklocptr = dordptr->linkdat.nextptr; linklocptr != &dordptr->linkdat; linklocptr = linklocptr->nextptr) { /* For all nodes */
-      const DorderCblk * restrict cblklocptr;
-
-      cblklocptr = (DorderCblk *) linklocptr;     /* TRICK: FIRST                              */
-      if ((cblklocptr->typeval & DORDERCBLKLEAF) != 0)  /* If tree node is leaf, copy fragment */
-        memCpy (cordptr->peritab + cblklocptr->data.leaf.ordelocval, cblklocptr->data.leaf.periloctab, cblklocptr->data.leaf.vnodlocnbr * sizeof (Gnum));
-    }
-  }
-  else {
+  if (dordptr->proclocnum != protnum) {           /* If not root process */
     Gnum                  leaflocnum;
-    Gnum                  vnodlocnum;
 
-    for (linklocptr = dordptr->linkdat.nextptr, leaflocnum = vnodlocnum = 0;
+    for (linklocptr = dordptr->linkdat.nextptr, leaflocnum = 0;
          linklocptr != &dordptr->linkdat; linklocptr = linklocptr->nextptr) { /* For all nodes */
       const DorderCblk * restrict cblklocptr;
 
@@ -238,52 +214,79 @@ Order * restrict const        cordptr)
       if ((cblklocptr->typeval & DORDERCBLKLEAF) != 0) { /* If node is leaf */
         leafsndtab[leaflocnum].ordelocval = cblklocptr->data.leaf.ordelocval; /* Fill send structures with permutation data */
         leafsndtab[leaflocnum].vnodlocnbr = cblklocptr->data.leaf.vnodlocnbr;
-        memCpy (perisndtab + vnodlocnum, cblklocptr->data.leaf.periloctab, cblklocptr->data.leaf.vnodlocnbr * sizeof (Gnum));
-        vnodlocnum += cblklocptr->data.leaf.vnodlocnbr;
         leaflocnum ++;
       }
     }
     leafsndnbr *= 2;                              /* TRICK: DorderGatherLeaf structures are made of 2 GNUM_MPI fields */
   }
 
-  if (MPI_Gatherv (leafsndtab, leafsndnbr, GNUM_MPI, leafrcvtab, recvcnttab, recvdsptab, GNUM_MPI, protnum, dordptr->proccomm) != MPI_SUCCESS) {
+  if (commGathervChunk (leafsndtab, leafsndnbr, GNUM_MPI, leafrcvtab, recvcnttab, recvdsptab, protnum, DORDERTAGLEAF, dordptr->proccomm) != MPI_SUCCESS) {
     errorPrint ("dorderGather: communication error (4)");
     return     (1);
   }
 
-  if (dordptr->proclocnum == protnum) {
-    int                   vnodglbnbr;
+  if (dordptr->proclocnum == protnum) {           /* If root process, receive fragments in place */
+    MPI_Request           reqtab[COMMCHUNKREQNBR];
+    int                   reqnbr;
+    Gnum                  vnodglbnbr;
     int                   procnum;
+    int                   o;
+
+#ifdef SCOTCH_DEBUG_DORDER2
+    memSet (cordptr->peritab, ~0, dordptr->vnodglbnbr * sizeof (Gnum));
+#endif /* SCOTCH_DEBUG_DORDER2 */
 
-    perircvtab[2 * protnum + 1] = 0;              /* TRICK: root will not send to nor receive from itself to avoid unnecessary memory copy */
-    for (procnum = 0, vnodglbnbr = 0; procnum < procglbnbr; procnum ++) {
-      recvdsptab[procnum] = vnodglbnbr;
-      recvcnttab[procnum] = (int) perircvtab[2 * procnum + 1];
-      vnodglbnbr         += recvcnttab[procnum];
+    for (procnum = 0, vnodglbnbr = vnodlocnbr, reqnbr = 0, o = MPI_SUCCESS; /* Fragments are received in sending order */
+         (procnum < procglbnbr) && (o == MPI_SUCCESS); procnum ++) {
+      Gnum                  leafglbnum;
+      Gnum                  leafglbnnd;
+
+      for (leafglbnum = recvdsptab[procnum] / 2, leafglbnnd = leafglbnum + recvcnttab[procnum] / 2;
+           leafglbnum < leafglbnnd; leafglbnum ++) {
+        o = commRecvChunk (cordptr->peritab + leafrcvtab[leafglbnum].ordelocval, leafrcvtab[leafglbnum].vnodlocnbr,
+                           GNUM_MPI, procnum, DORDERTAGPERI, dordptr->proccomm, reqtab, &reqnbr);
+        if (o != MPI_SUCCESS)
+          break;
+        vnodglbnbr += leafrcvtab[leafglbnum].vnodlocnbr;
+      }
+    }
+
+    for (linklocptr = dordptr->linkdat.nextptr; linklocptr != &dordptr->linkdat; linklocptr = linklocptr->nextptr) { /* Copy local fragments while receiving */
+      const DorderCblk * restrict cblklocptr;
+
+      cblklocptr = (DorderCblk *) linklocptr;     /* TRICK: FIRST                              */
+      if ((cblklocptr->typeval & DORDERCBLKLEAF) != 0)  /* If tree node is leaf, copy fragment */
+        memCpy (cordptr->peritab + cblklocptr->data.leaf.ordelocval, cblklocptr->data.leaf.periloctab, cblklocptr->data.leaf.vnodlocnbr * sizeof (Gnum));
+    }
+
+    if ((reqnbr > 0) &&
+        (MPI_Waitall (reqnbr, reqtab, MPI_STATUSES_IGNORE) != MPI_SUCCESS))
+      o = 1;
+    if (o != MPI_SUCCESS) {
+      errorPrint ("dorderGather: communication error (5)");
+      return     (1);
     }
 #ifdef SCOTCH_DEBUG_DORDER2
-    if (((Gnum) vnodglbnbr + vnodlocnbr) != dordptr->vnodglbnbr) {
+    if (vnodglbnbr != dordptr->vnodglbnbr) {
       errorPrint ("dorderGather: internal error (2)");
       return     (1);
     }
 #endif /* SCOTCH_DEBUG_DORDER2 */
-  }
 
-  if (MPI_Gatherv (perisndtab, perisndnbr, GNUM_MPI, perircvtab, recvcnttab, recvdsptab, GNUM_MPI, protnum, dordptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dorderGather: communication error (5)");
-    return     (1);
+    memFree (recvcnttab);                         /* Free group leader */
   }
+  else {                                          /* Send fragments to root, without copying them */
+    for (linklocptr = dordptr->linkdat.nextptr; linklocptr != &dordptr->linkdat; linklocptr = linklocptr->nextptr) {
+      const DorderCblk * restrict cblklocptr;
 
-  if (dordptr->proclocnum == protnum) {           /* If root process */
-    int                   leafglbnum;
-    int                   vnodglbnum;
-
-    for (leafglbnum = vnodglbnum = 0; leafglbnum < leafrcvnbr; leafglbnum ++) {
-      memCpy (cordptr->peritab + leafrcvtab[leafglbnum].ordelocval, perircvtab + vnodglbnum, leafrcvtab[leafglbnum].vnodlocnbr * sizeof (Gnum));
-      vnodglbnum += leafrcvtab[leafglbnum].vnodlocnbr;
+      cblklocptr = (DorderCblk *) linklocptr;     /* TRICK: FIRST */
+      if (((cblklocptr->typeval & DORDERCBLKLEAF) != 0) &&
+          (commSendChunk (cblklocptr->data.leaf.periloctab, cblklocptr->data.leaf.vnodlocnbr,
+                          GNUM_MPI, protnum, DORDERTAGPERI, dordptr->proccomm) != MPI_SUCCESS)) {
+        errorPrint ("dorderGather: communication error (6)");
+        return     (1);
+      }
     }
-
-    memFree (recvcnttab);                         /* Free group leader */
   }
   memFree (leafrcvtab);                           /* Free group leader */
 
@@ -316,14 +319,14 @@ const Dorder * restrict const dordptr,
 Order * restrict const        cordptr,
 const int                     protnum)
 {
-  int                         treelocnbr;         /* "int" since used as way to fill count array in MPI_Allgather */
+  Gnum                        treelocnbr;
   Gnum                        treeglbnbr;
   DorderGatherNode * restrict treercvtab;
-  int                         treesndnbr;         /* "int" since used as count in MPI_Gatherv */
+  Gnum                        treesndnbr;
   DorderGatherNode *          treesndtab;
   DorderGatherNode * restrict treesndptr;
-  int * restrict              treecnttab;
-  int * restrict              treedsptab;
+  Gnum * restrict             treecnttab;
+  Gnum * restrict             treedsptab;
   DorderGatherCblk * restrict cblkglbtab;
   const DorderLink * restrict linklocptr;
   int                         procglbnbr;
@@ -348,7 +351,7 @@ const int                     protnum)
     if (cblklocptr->cblknum.proclocnum == dordptr->proclocnum) {
       treelocnbr ++;
       if ((cblklocptr->typeval & DORDERCBLKLEAF) != 0)
-        treelocnbr += (int) cblklocptr->data.leaf.nodelocnbr;
+        treelocnbr += cblklocptr->data.leaf.nodelocnbr;
     }
   }
 
@@ -357,8 +360,8 @@ const int                     protnum)
   treesndnbr = (dordptr->proclocnum == protnum) ? 0 : treelocnbr; /* TRICK: root will not send nor receive */
   cheklocval = 0;
   if (memAllocGroup ((void **) (void *)
-                     &treecnttab, (size_t) (procglbnbr * sizeof (int)),
-                     &treedsptab, (size_t) (procglbnbr * sizeof (int)),
+                     &treecnttab, (size_t) (procglbnbr * sizeof (Gnum)),
+                     &treedsptab, (size_t) (procglbnbr * sizeof (Gnum)),
                      &treesndtab, (size_t) (treesndnbr * sizeof (DorderGatherNode)), NULL) == NULL) {
     errorPrint ("dorderGatherTree: out of memory (1)");
     cheklocval = 1;
@@ -377,7 +380,7 @@ const int                     protnum)
     return (1);
   }
 
-  if (MPI_Allgather (&treelocnbr, 1, MPI_INT, treecnttab, 1, MPI_INT, dordptr->proccomm) != MPI_SUCCESS) {
+  if (MPI_Allgather (&treelocnbr, 1, GNUM_MPI, treecnttab, 1, GNUM_MPI, dordptr->proccomm) != MPI_SUCCESS) {
     errorPrint ("dorderGatherTree: communication error (2)");
     return     (1);
   }
@@ -466,8 +469,8 @@ const int                     protnum)
       treedsptab[procnum] *= DORDERGATHERNODESIZE;
     }
   }
-  if (MPI_Gatherv (treesndtab, treesndnbr * DORDERGATHERNODESIZE, GNUM_MPI,
-                   treercvtab, treecnttab, treedsptab, GNUM_MPI, protnum, dordptr->proccomm) != MPI_SUCCESS) {
+  if (commGathervChunk (treesndtab, treesndnbr * DORDERGATHERNODESIZE, GNUM_MPI,
+                        treercvtab, treecnttab, treedsptab, protnum, DORDERTAGTREE, dordptr->proccomm) != MPI_SUCCESS) {
     errorPrint ("dorderGatherTree: communication error (4)");
     return     (1);
   }
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**                # Version 5.1  : from : 30 jul 2010     **/
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -64,7 +64,182 @@
 /*                                  */
 /************************************/
 
+/* This routine saves a distributed ordering
+** as a set of distributed file fragments, one
+** per process. Each process writes the lines
+** of its local vertices, which it gets from
+** the distributed direct permutation, and the
+** first process also writes the header, such
+** that the concatenation of all fragments in
+** ascending process rank order yields the
+** centralized ordering file. Hence, no data
+** proportional to the global number of
+** vertices is ever gathered on any process.
+** The distributed graph structure is provided
+** to access the distribution of vertex labels,
+** whenever present.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dorderSaveDist (
+const Dorder * restrict const ordeptr,
+const Dgraph * restrict const grafptr,
+FILE * restrict const         stream)
+{
+  Gnum * restrict       permloctab;
+  Gnum * restrict       vlblloctab;               /* Labels of permuted vertices           */
+  Gnum * restrict       sortloctab;               /* Array of (permutation, vertex) pairs  */
+  Gnum * restrict       vlblrcvtab;               /* Receive array for label requests      */
+  int * restrict        sendcnttab;
+  int * restrict        senddsptab;
+  int * restrict        recvcnttab;
+  int * restrict        recvdsptab;
+  Gnum                  vertlocnbr;
+  Gnum                  vertlocnum;
+  Gnum                  vlbllocnbr;
+  Gnum                  vertglbadj;               /* Adjustment from local to based global vertex indices */
+  int                   procglbnbr;
+  int                   cheklocval;
+  int                   chekglbval;
+
+  procglbnbr = grafptr->procglbnbr;
+  vertlocnbr = grafptr->vertlocnbr;
+  vlbllocnbr = (grafptr->vlblloctax != NULL) ? vertlocnbr : 0;
+  vertglbadj = grafptr->procdsptab[grafptr->proclocnum];
+
+  cheklocval = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &senddsptab, (size_t) (procglbnbr     * sizeof (int)),
+                     &sendcnttab, (size_t) (procglbnbr     * sizeof (int)),
+                     &recvdsptab, (size_t) (procglbnbr     * sizeof (int)),
+                     &recvcnttab, (size_t) (procglbnbr     * sizeof (int)),
+                     &permloctab, (size_t) (vertlocnbr     * sizeof (Gnum)),
+                     &vlblloctab, (size_t) (vlbllocnbr     * sizeof (Gnum)),
+                     &sortloctab, (size_t) (vlbllocnbr * 2 * sizeof (Gnum)),
+                     &vlblrcvtab, (size_t) (vlbllocnbr     * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("dorderSaveDist: out of memory");
+    cheklocval = 1;
+  }
+#ifdef SCOTCH_DEBUG_DORDER1                       /* This communication cannot be covered by a useful one */
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, ordeptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dorderSaveDist: communication error (1)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (senddsptab != NULL)
+      memFree (senddsptab);                       /* Free group leader */
+    return (1);
+  }
+#else /* SCOTCH_DEBUG_DORDER1 */
+  if (cheklocval != 0)
+    return (1);
+#endif /* SCOTCH_DEBUG_DORDER1 */
+
+  if (dorderPerm (ordeptr, grafptr, permloctab) != 0) { /* Compute local part of direct permutation */
+    memFree (senddsptab);                         /* Free group leader */
+    return  (1);
+  }
+
+  if (grafptr->vlblloctax != NULL) {              /* If labels of permuted vertices have to be fetched */
+    const Gnum * restrict vlblloctax;
+    Gnum                  sortlocnum;
+    Gnum                  vlblrcvnbr;
+    Gnum                  vlblrcvnum;
+    int                   procnum;
+
+    for (vertlocnum = 0; vertlocnum < vertlocnbr; vertlocnum ++) { /* Build (permutation index, local vertex) pairs */
+      sortloctab[2 * vertlocnum]     = permloctab[vertlocnum];
+      sortloctab[2 * vertlocnum + 1] = vertlocnum;
+    }
+    intSort2asc1 (sortloctab, vertlocnbr);        /* Sort pairs by owner of permuted vertex */
+
+    for (procnum = 0, sortlocnum = 0; procnum < procglbnbr; procnum ++) { /* Count requests per process */
+      Gnum                procdspval;
+      Gnum                sortlocnnd;
+
+      procdspval = grafptr->procdsptab[procnum + 1];
+      for (sortlocnnd = sortlocnum; (sortlocnnd < vertlocnbr) && (sortloctab[2 * sortlocnnd] < procdspval); sortlocnnd ++) ;
+      sendcnttab[procnum] = (int) (sortlocnnd - sortlocnum);
+      sortlocnum = sortlocnnd;
+    }
+
+    if (MPI_Alltoall (sendcnttab, 1, MPI_INT, recvcnttab, 1, MPI_INT, ordeptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dorderSaveDist: communication error (2)");
+      memFree    (senddsptab);                    /* Free group leader */
+      return     (1);
+    }
+    for (procnum = 0, sortlocnum = vlblrcvnbr = 0; procnum < procglbnbr; procnum ++) {
+      senddsptab[procnum] = (int) sortlocnum;
+      sortlocnum += sendcnttab[procnum];
+      recvdsptab[procnum] = (int) vlblrcvnbr;
+      vlblrcvnbr += recvcnttab[procnum];
+    }
+#ifdef SCOTCH_DEBUG_DORDER2
+    if (vlblrcvnbr != vertlocnbr) {               /* Direct permutation is a bijection */
+      errorPrint ("dorderSaveDist: internal error");
+      memFree    (senddsptab);                    /* Free group leader */
+      return     (1);
+    }
+#endif /* SCOTCH_DEBUG_DORDER2 */
+
+    for (sortlocnum = 0; sortlocnum < vertlocnbr; sortlocnum ++) /* Gather requested indices in label array */
+      vlblloctab[sortlocnum] = sortloctab[2 * sortlocnum];
+    if (MPI_Alltoallv (vlblloctab, sendcnttab, senddsptab, GNUM_MPI,
+                       vlblrcvtab, recvcnttab, recvdsptab, GNUM_MPI, ordeptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dorderSaveDist: communication error (3)");
+      memFree    (senddsptab);                    /* Free group leader */
+      return     (1);
+    }
+
+    vlblloctax = grafptr->vlblloctax + grafptr->baseval - vertglbadj; /* Access labels through based global indices */
+    for (vlblrcvnum = 0; vlblrcvnum < vlblrcvnbr; vlblrcvnum ++) /* Replace requested indices by their labels */
+      vlblrcvtab[vlblrcvnum] = vlblloctax[vlblrcvtab[vlblrcvnum]];
+
+    if (MPI_Alltoallv (vlblrcvtab, recvcnttab, recvdsptab, GNUM_MPI, /* Send labels back in request order */
+                       vlblloctab, sendcnttab, senddsptab, GNUM_MPI, ordeptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dorderSaveDist: communication error (4)");
+      memFree    (senddsptab);                    /* Free group leader */
+      return     (1);
+    }
+
+    for (sortlocnum = 0; sortlocnum < vertlocnbr; sortlocnum ++) /* Put labels of permuted vertices in place of permutation */
+      permloctab[sortloctab[2 * sortlocnum + 1]] = vlblloctab[sortlocnum];
+  }
+
+  cheklocval = 0;
+  if ((ordeptr->proclocnum == 0) &&               /* First fragment holds header */
+      (fprintf (stream, GNUMSTRING "\n", (Gnum) ordeptr->vnodglbnbr) == EOF)) {
+    errorPrint ("dorderSaveDist: bad output (1)");
+    cheklocval = 1;
+  }
+  for (vertlocnum = 0; (cheklocval == 0) && (vertlocnum < vertlocnbr); vertlocnum ++) {
+    if (fprintf (stream, GNUMSTRING "\t" GNUMSTRING "\n",
+                 (Gnum) ((grafptr->vlblloctax != NULL) ? grafptr->vlblloctax[vertlocnum + grafptr->baseval] : (vertlocnum + vertglbadj)),
+                 (Gnum) permloctab[vertlocnum]) == EOF) {
+      errorPrint ("dorderSaveDist: bad output (2)");
+      cheklocval = 1;
+    }
+  }
+
+  memFree (senddsptab);                           /* Free group leader */
+
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, ordeptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dorderSaveDist: communication error (5)");
+    return     (1);
+  }
+
+  return (chekglbval);
+}
+
 /* This routine saves a distributed ordering.
+** If only one process provides a stream, the
+** whole ordering is written by this process.
+** If all processes provide a stream, each of
+** them writes its own fragment of the ordering.
 ** The distributed graph structure is provided
 ** to access the distribution of vertex labels,
 ** whenever present.
@@ -100,15 +275,17 @@ FILE * restrict const         stream)
     errorPrint ("dorderSave: communication error (1)");
     return     (1);
   }
-  if (reduglbtab[0] != 1) {
-    errorPrint ("dorderSave: should have only one root");
-    return     (1);
-  }
   MPI_Comm_size (ordeptr->proccomm, &procglbnbr);
   if ((reduglbtab[2] != 0) && (reduglbtab[2] != procglbnbr)) {
     errorPrint ("dorderSave: inconsistent parameters");
     return     (1);
   }
+  if ((reduglbtab[0] == procglbnbr) && (procglbnbr > 1)) /* If all processes provided a stream */
+    return (dorderSaveDist (ordeptr, grafptr, stream));
+  if (reduglbtab[0] != 1) {
+    errorPrint ("dorderSave: should have only one root, or all processes");
+    return     (1);
+  }
   protnum = (int) reduglbtab[1];                  /* Get rank of root process */
 
   reduloctab[0] = 0;
@@ -1,4 +1,4 @@
-/* Copyright 2007,2010,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2010,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**                # Version 5.1  : from : 30 jul 2010     **/
 /**                                 to   : 30 jul 2010     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +65,10 @@
 /************************************/
 
 /* This routine saves a distributed ordering.
+** If all processes provide a stream, the data
+** is written by the first process, such that the
+** concatenation of all fragments in ascending
+** process rank order yields the centralized file.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -99,16 +103,19 @@ int                        (* funcptr) (const Order * const, const Gnum * const,
     errorPrint ("dorderSaveTree2: communication error (1)");
     return     (1);
   }
-  if (reduglbtab[0] != 1) {
-    errorPrint ("dorderSaveTree2: should have only one root");
-    return     (1);
-  }
   MPI_Comm_size (ordeptr->proccomm, &procglbnbr);
   if ((reduglbtab[2] != 0) && (reduglbtab[2] != procglbnbr)) {
     errorPrint ("dorderSaveTree2: inconsistent parameters");
     return     (1);
   }
-  protnum = (int) reduglbtab[1];                  /* Get rank of root process */
+  if (reduglbtab[0] == procglbnbr)                /* If all processes provided a stream       */
+    protnum = 0;                                  /* Tree data is written in the first fragment */
+  else if (reduglbtab[0] == 1)
+    protnum = (int) reduglbtab[1];                /* Get rank of root process */
+  else {
+    errorPrint ("dorderSaveTree2: should have only one root, or all processes");
+    return     (1);
+  }
 
   cheklocval = 0;
   vlbltab = NULL;
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**                # Version 4.0  : from : 18 dec 2001     **/
 /**                                 to   : 26 nov 2003     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,6 +72,7 @@ geomInit (
 Geom * restrict const       geomptr)
 {
   geomptr->dimnnbr = 0;                           /* Initialize geometry */
+  geomptr->vertnbr = 0;
   geomptr->geomtab = NULL;
 
   return (0);
@@ -90,5 +91,6 @@ Geom * restrict const       geomptr)
     memFree (geomptr->geomtab);
 
   geomptr->dimnnbr = 0;
+  geomptr->vertnbr = 0;
   geomptr->geomtab = NULL;
 }
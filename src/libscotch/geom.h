@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,6 +68,7 @@
 
 typedef struct Geom_ {
   int                       dimnnbr;              /*+ Geometry type (1, 2, or 3D) +*/
+  INT                       vertnbr;              /*+ Number of vertices          +*/
   double *                  geomtab;              /*+ Geometrical vertex array    +*/
 } Geom;
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2012,2014,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2012,2014,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 09 sep 2012     **/
 /**                                 to   : 09 aug 2014     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -146,6 +146,8 @@ Graph * const               grafptr)
         ((grafptr->flagval & GRAPHEDGEGROUP) == 0))
       memFree (grafptr->edlotax + grafptr->baseval);
   }
+  if ((grafptr->flagval & (GRAPHHASHIER | GRAPHFREEHIER)) == (GRAPHHASHIER | GRAPHFREEHIER)) /* If graph owns its hierarchy */
+    graphHierFree (grafptr);
 
 #ifdef SCOTCH_DEBUG_GRAPH2
   memSet (grafptr, ~0, sizeof (Graph));           /* Purge graph fields */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014-2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014-2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -64,7 +64,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 10 may 2019     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -82,12 +82,14 @@
 #define GRAPHFREEVERT               0x0002        /*+ Free verttab array        +*/
 #define GRAPHFREEVNUM               0x0004        /*+ Free vnumtab array        +*/
 #define GRAPHFREEOTHR               0x0008        /*+ Free all other arrays     +*/
-#define GRAPHFREETABS               0x000F        /*+ Free all graph arrays     +*/
+#define GRAPHFREEHIER               0x0080        /*+ Free hierarchy, if any    +*/
+#define GRAPHFREETABS               0x008F        /*+ Free all graph arrays     +*/
 #define GRAPHVERTGROUP              0x0010        /*+ All vertex arrays grouped +*/
 #define GRAPHEDGEGROUP              0x0020        /*+ All edge arrays grouped   +*/
+#define GRAPHHASHIER                0x0040        /*+ Has coarsening hierarchy  +*/
 
-#define GRAPHBITSUSED               0x003F        /*+ Significant bits for plain graph routines               +*/
-#define GRAPHBITSNOTUSED            0x0040        /*+ Value above which bits not used by plain graph routines +*/
+#define GRAPHBITSUSED               0x00FF        /*+ Significant bits for plain graph routines               +*/
+#define GRAPHBITSNOTUSED            0x0100        /*+ Value above which bits not used by plain graph routines +*/
 
 #define GRAPHIONOLOADVERT           1             /*+ Remove vertex loads on loading +*/
 #define GRAPHIONOLOADEDGE           2             /*+ Remove edge loads on loading   +*/
@@ -141,6 +143,7 @@ typedef struct Graph_ {
   Gnum *                    edlotax;              /*+ Edge load array (if present)              +*/
   Gnum                      edlosum;              /*+ Sum of edge (in fact arc) loads           +*/
   Gnum                      degrmax;              /*+ Maximum degree                            +*/
+  struct GraphHier_ *       hierptr;              /*+ Coarsening hierarchy, if GRAPHHASHIER set +*/
 } Graph;
 
 /*
@@ -162,12 +165,14 @@ void                        graphFree           (Graph * const);
 Gnum                        graphBase           (Graph * const, const Gnum);
 int                         graphBand           (const Graph * restrict const, const Gnum, Gnum * restrict const, const Gnum, Gnum * restrict * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, const Gnum * restrict const, Gnum * restrict const);
 int                         graphCheck          (const Graph *);
+void                        graphHierFree       (Graph * const);
 int                         graphClone          (const Graph *, Graph *);
 Gnum                        graphDiamPV         (const Graph * restrict const, Context * restrict const);
 Gnum                        graphIelo           (const Graph * const, Gnum * const, Gnum * const);
 int                         graphInduceList     (const Graph * restrict const, const Gnum, const Gnum * restrict const, Graph * restrict const);
 int                         graphInducePart     (const Graph * restrict const, const GraphPart * restrict const, const Gnum, const GraphPart, Graph * restrict const);
 int                         graphLoad           (Graph * const, FILE * const, const Gnum, const GraphFlag);
+int                         graphLoadHead       (FILE * const, Gnum * const, Gnum * const, Gnum * const, char * const);
 int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * restrict const, const Gnum, const Gnum * const);
 int                         graphSave           (const Graph * const, FILE * const);
 
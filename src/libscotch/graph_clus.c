@@ -0,0 +1,475 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_clus.c                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the source graph   **/
+/**                size-constrained label propagation      **/
+/**                clustering routines, which can be used  **/
+/**                in place of matching for coarsening.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_CLUS
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "arch.h"
+#include "graph.h"
+#include "graph_coarsen.h"
+#include "graph_clus.h"
+
+/*************************************/
+/*                                   */
+/* The label propagation subroutines */
+/*                                   */
+/*************************************/
+
+#ifndef GRAPHCOARSENNOTHREAD
+
+/* This routine performs a prefix scan
+** sum operation on a single Gnum value,
+** backed by a temporary area.
+*/
+
+static
+void
+graphClusScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+#endif /* GRAPHCOARSENNOTHREAD */
+
+/* This routine performs one label propagation
+** pass on the given range of fine vertices.
+** Every vertex is moved to the neighboring
+** cluster to which it is most strongly
+** connected, provided that the load of this
+** cluster does not exceed the maximum cluster
+** load. When several threads run concurrently,
+** cluster loads are updated atomically.
+** It returns:
+** - the number of vertices moved.
+*/
+
+static
+Gnum
+graphClusPass (
+GraphCoarsenData * restrict const coarptr,
+GraphCoarsenHash * restrict const hashtab,        /* Cleared hash table of (local) thread */
+const Gnum                        hashmsk,
+const Gnum                        finevertbas,
+const Gnum                        finevertnnd,
+const int                         thrdflag)       /* Set if threads run concurrently */
+{
+  Gnum                finevertnum;
+  Gnum                movenbr;
+
+  const Graph * restrict const  finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const   fineverttax = finegrafptr->verttax;
+  const Gnum * restrict const   finevendtax = finegrafptr->vendtax;
+  const Gnum * restrict const   finevelotax = finegrafptr->velotax;
+  const Gnum * restrict const   fineedgetax = finegrafptr->edgetax;
+  const Gnum * restrict const   fineedlotax = finegrafptr->edlotax;
+  const Anum * restrict const   fineparotax = coarptr->fineparotax;
+  const Anum * restrict const   finepfixtax = coarptr->finepfixtax;
+  volatile Gnum * const         finecloatax = coarptr->finecloatax; /* [norestrict:async] */
+  volatile Gnum * const         fineclustax = coarptr->finematetax; /* [norestrict:async]; cluster label array is mate array */
+  const Gnum                    cloamax     = coarptr->cloamax;
+
+  for (finevertnum = finevertbas, movenbr = 0;
+       finevertnum < finevertnnd; finevertnum ++) {
+    Gnum                fineedgenum;
+    Gnum                fineedgennd;
+    Gnum                fineveloval;
+    Gnum                clusoldnum;               /* Current cluster of vertex         */
+    Gnum                clusbstnum;               /* Best cluster found to date        */
+    Gnum                edlooldval;               /* Connectivity to current cluster   */
+    Gnum                edlobstval;               /* Connectivity to best cluster      */
+
+    fineedgenum = fineverttax[finevertnum];
+    fineedgennd = finevendtax[finevertnum];
+    if (fineedgenum == fineedgennd)               /* Isolated vertices stay alone */
+      continue;
+
+    fineveloval = (finevelotax != NULL) ? finevelotax[finevertnum] : 1;
+    clusoldnum  =
+    clusbstnum  = fineclustax[finevertnum];
+    edlooldval  =
+    edlobstval  = 0;
+    for ( ; fineedgenum < fineedgennd; fineedgenum ++) {
+      Gnum                finevertend;
+      Gnum                clusendnum;
+      Gnum                edloval;
+      Gnum                h;
+
+      finevertend = fineedgetax[fineedgenum];
+      if (((finepfixtax != NULL) && (finepfixtax[finevertend] != finepfixtax[finevertnum])) || /* Only vertices of same fixed and old parts can be clustered */
+          ((fineparotax != NULL) && (fineparotax[finevertend] != fineparotax[finevertnum])))
+        continue;
+
+      clusendnum = fineclustax[finevertend];
+      edloval    = (fineedlotax != NULL) ? fineedlotax[fineedgenum] : 1;
+      for (h = (clusendnum * GRAPHCOARSENHASHPRIME) & hashmsk; ; h = (h + 1) & hashmsk) {
+        if (hashtab[h].vertorgnum != finevertnum) { /* If old slot, use it for current vertex */
+          hashtab[h].vertorgnum = finevertnum;
+          hashtab[h].vertendnum = clusendnum;
+          hashtab[h].edgenum    = edloval;        /* TRICK: edgenum holds accumulated connectivity */
+          break;
+        }
+        if (hashtab[h].vertendnum == clusendnum) { /* If cluster already found */
+          hashtab[h].edgenum += edloval;
+          break;
+        }
+      }
+      edloval = hashtab[h].edgenum;               /* Get connectivity to cluster to date */
+      if (clusendnum == clusoldnum)
+        edlooldval = edloval;
+      else if ((edloval > edlobstval) &&          /* If better cluster which can accept vertex */
+               ((finecloatax[clusendnum] + fineveloval) <= cloamax)) {
+        clusbstnum = clusendnum;
+        edlobstval = edloval;
+      }
+    }
+
+    if ((clusbstnum == clusoldnum) ||             /* If no strictly better cluster found */
+        (edlobstval <= edlooldval))
+      continue;
+
+    if (thrdflag != 0) {                          /* If concurrent threads, reserve load atomically */
+      Gnum                cloaval;
+
+      do {
+        cloaval = finecloatax[clusbstnum];
+        if ((cloaval + fineveloval) > cloamax)    /* If cluster has been filled in the meantime */
+          break;
+      } while (! __sync_bool_compare_and_swap (&finecloatax[clusbstnum], cloaval, cloaval + fineveloval));
+      if ((cloaval + fineveloval) > cloamax)
+        continue;
+      __sync_fetch_and_sub (&finecloatax[clusoldnum], fineveloval);
+    }
+    else {
+      finecloatax[clusbstnum] += fineveloval;
+      finecloatax[clusoldnum] -= fineveloval;
+    }
+    fineclustax[finevertnum] = clusbstnum;
+    movenbr ++;
+  }
+
+  return (movenbr);
+}
+
+/***********************************/
+/*                                 */
+/* The label propagation routines. */
+/*                                 */
+/***********************************/
+
+/* This routine initializes the global data
+** needed by the label propagation routines.
+** It returns:
+** - 0  : if initialization could be performed.
+** - 1  : on error.
+*/
+
+int
+graphClusInit (
+GraphCoarsenData * restrict coarptr,
+const int                   thrdnbr)
+{
+  Gnum                deteval;                    /* Flag set if deterministic behavior */
+
+  const Graph * restrict const  finegrafptr = coarptr->finegrafptr;
+
+  contextValuesGetInt (coarptr->contptr, CONTEXTOPTIONNUMDETERMINISTIC, &deteval);
+
+  if (memAllocGroup ((void **) (void *)
+                     &coarptr->finecloatax, (size_t) ((finegrafptr->vertnbr + 1) * sizeof (Gnum)),
+                     &coarptr->finevfintax, (size_t) (finegrafptr->vertnbr       * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphClusInit: out of memory");
+    return (1);
+  }
+  coarptr->finecloatax -= finegrafptr->baseval;
+  coarptr->finevfintax -= finegrafptr->baseval;
+
+  coarptr->fumaval = 0;                           /* Assume sequential (deterministic) processing */
+#ifndef GRAPHCOARSENNOTHREAD
+  if ((deteval == 0) && (thrdnbr > 1))            /* If non-deterministic behavior accepted and several threads available */
+    coarptr->fumaval = GRAPHCLUSTHREAD;           /* Run label propagation concurrently                                  */
+#endif /* GRAPHCOARSENNOTHREAD */
+
+  return (0);
+}
+
+/* This routine frees the global data
+** used by the label propagation routines.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphClusExit (
+GraphCoarsenData * restrict coarptr)
+{
+  memFree (coarptr->finecloatax + coarptr->finegrafptr->baseval); /* Free group leader */
+}
+
+/* This routine computes size-constrained
+** clusters of the vertices of the given
+** graph by label propagation, and turns
+** cluster labels into coarse vertex indices
+** in the fine-to-coarse array.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphClus (
+ThreadDescriptor * restrict const descptr,
+GraphCoarsenData * const          coarptr)        /* [norestrict] because of retuval in threaded contexts */
+{
+  GraphCoarsenHash * restrict hashtab;
+  Gnum                      hashnbr;
+  Gnum                      finevertbas;
+  Gnum                      finevertnnd;
+  Gnum                      finevertnum;
+  Gnum                      coarvertnum;
+  int                       passnum;
+  int                       thrdflag;
+
+#ifdef SCOTCH_PTHREAD
+  const int                   thrdnbr     = threadNbr (descptr);
+  const int                   thrdnum     = threadNum (descptr);
+  GraphCoarsenThread * const  thrdptr     = &coarptr->thrdtab[thrdnum];
+#else /* SCOTCH_PTHREAD */
+  GraphCoarsenThread * const  thrdptr     = &coarptr->thrdtab[0];
+#endif /* SCOTCH_PTHREAD */
+  const Graph * restrict const  finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const   finevelotax = finegrafptr->velotax;
+  Gnum * const                  finecloatax = coarptr->finecloatax; /* [norestrict:async] */
+  Gnum * const                  fineclustax = coarptr->finematetax; /* [norestrict:async] */
+  const Gnum                    baseval     = finegrafptr->baseval;
+
+  thrdflag = coarptr->fumaval & GRAPHCLUSTHREAD;
+  if (thrdflag == 0) {                            /* If sequential, deterministic processing wanted */
+#ifdef SCOTCH_PTHREAD
+    if (thrdnum != 0) {                           /* Only thread 0 will perform the work    */
+      threadBarrier (descptr);                    /* End-of-routine synchronization barrier */
+      return;
+    }
+#endif /* SCOTCH_PTHREAD */
+
+    finevertbas = baseval;                        /* Work on all graph fine vertices */
+    finevertnnd = finegrafptr->vertnnd;
+  }
+  else {
+    finevertbas = thrdptr->finevertbas;           /* Work on slice of fine graph */
+    finevertnnd = thrdptr->finevertnnd;
+  }
+
+  hashnbr = coarptr->coarhashmsk + 1;             /* Hash table size is based on maximum degree */
+  if ((hashtab = memAlloc (hashnbr * sizeof (GraphCoarsenHash))) == NULL) {
+    errorPrint ("graphClus: out of memory");
+    coarptr->retuval = 2;
+  }
+
+  for (finevertnum = finevertbas; finevertnum < finevertnnd; finevertnum ++) { /* Each vertex is its own cluster */
+    fineclustax[finevertnum] = finevertnum;
+    finecloatax[finevertnum] = (finevelotax != NULL) ? finevelotax[finevertnum] : 1;
+  }
+
+#ifndef GRAPHCOARSENNOTHREAD
+  if (thrdflag != 0)
+    threadBarrier (descptr);                      /* Synchronization for cluster arrays and retuval */
+#endif /* GRAPHCOARSENNOTHREAD */
+
+  if (coarptr->retuval != 0) {                    /* If some allocation failed */
+    if (hashtab != NULL)
+      memFree (hashtab);
+#ifdef SCOTCH_PTHREAD
+    if (thrdflag == 0)                            /* If only thread 0 is working */
+      threadBarrier (descptr);                    /* End-of-routine synchronization barrier */
+#endif /* SCOTCH_PTHREAD */
+    return;
+  }
+
+  for (passnum = 0; passnum < GRAPHCLUSPASSNBR; passnum ++) {
+    Gnum                movenbr;
+
+    memSet (hashtab, ~0, hashnbr * sizeof (GraphCoarsenHash)); /* Each vertex is met only once per pass */
+    movenbr = graphClusPass (coarptr, hashtab, coarptr->coarhashmsk, finevertbas, finevertnnd, thrdflag);
+#ifndef GRAPHCOARSENNOTHREAD
+    if (thrdflag != 0) {                          /* If concurrent threads, sum move counts */
+      int                 thrdtmp;
+
+      thrdptr->scantab[passnum & 1] = movenbr;    /* TRICK: alternate slots so that no barrier is needed after sum */
+      threadBarrier (descptr);
+      for (thrdtmp = 0, movenbr = 0; thrdtmp < thrdnbr; thrdtmp ++)
+        movenbr += coarptr->thrdtab[thrdtmp].scantab[passnum & 1];
+    }
+#endif /* GRAPHCOARSENNOTHREAD */
+    if (movenbr == 0)                             /* If convergence reached, stop here */
+      break;
+  }
+
+  memFree (hashtab);
+
+#ifndef GRAPHCOARSENNOTHREAD
+  if (thrdflag != 0) {                            /* If concurrent threads */
+    Gnum                coarvertnbr;
+
+    threadBarrier (descptr);                      /* Cluster loads are no longer used by any thread */
+    for (finevertnum = finevertbas; finevertnum < finevertnnd; finevertnum ++)
+      finecloatax[finevertnum] = 0;               /* Reset cluster flags */
+    threadBarrier (descptr);
+    for (finevertnum = finevertbas; finevertnum < finevertnnd; finevertnum ++)
+      finecloatax[fineclustax[finevertnum]] = 1;  /* Flag labels in use; concurrent writes are harmless */
+    threadBarrier (descptr);
+
+    for (finevertnum = finevertbas, coarvertnbr = 0; finevertnum < finevertnnd; finevertnum ++)
+      coarvertnbr += finecloatax[finevertnum];
+    thrdptr->scantab[0] = coarvertnbr;
+    threadScan (descptr, &thrdptr->scantab[0], sizeof (GraphCoarsenThread), (ThreadScanFunc) graphClusScan, NULL); /* Compute start indices for coarse vertices */
+    if (thrdnum == (thrdnbr - 1))
+      coarptr->coarvertnbr = thrdptr->scantab[0];
+
+    for (finevertnum = finevertbas, coarvertnum = thrdptr->scantab[0] - coarvertnbr + baseval;
+         finevertnum < finevertnnd; finevertnum ++) {
+      if (finecloatax[finevertnum] != 0)          /* If label in use, give it a coarse vertex number */
+        finecloatax[finevertnum] = coarvertnum ++;
+    }
+    threadBarrier (descptr);
+
+    for (finevertnum = finevertbas; finevertnum < finevertnnd; finevertnum ++)
+      fineclustax[finevertnum] = finecloatax[fineclustax[finevertnum]]; /* Turn labels into coarse vertex numbers */
+    threadBarrier (descptr);                      /* coarptr->coarvertnbr and fine-to-coarse array must be known to all */
+  }
+  else
+#endif /* GRAPHCOARSENNOTHREAD */
+  {
+    memSet (finecloatax + baseval, 0, finegrafptr->vertnbr * sizeof (Gnum));
+    for (finevertnum = baseval; finevertnum < finevertnnd; finevertnum ++)
+      finecloatax[fineclustax[finevertnum]] = 1;  /* Flag labels in use */
+    for (finevertnum = baseval, coarvertnum = baseval; finevertnum < finevertnnd; finevertnum ++) {
+      if (finecloatax[finevertnum] != 0)
+        finecloatax[finevertnum] = coarvertnum ++;
+    }
+    for (finevertnum = baseval; finevertnum < finevertnnd; finevertnum ++)
+      fineclustax[finevertnum] = finecloatax[fineclustax[finevertnum]];
+    coarptr->coarvertnbr = coarvertnum - baseval;
+
+#ifdef SCOTCH_PTHREAD
+    threadBarrier (descptr);                      /* End-of-routine synchronization barrier for thread 0 */
+#endif /* SCOTCH_PTHREAD */
+  }
+}
+
+/* This routine builds the lists of fine
+** vertices belonging to each coarse vertex,
+** once the fine-to-coarse array has been
+** computed. Coarse vertex indices are stored
+** in the cluster load array, and the edge
+** hash table mask is updated to account for
+** the degrees of the coarse vertices.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphClusList (
+GraphCoarsenData * restrict const coarptr)
+{
+  Gnum                finevertnum;
+  Gnum                coarvertnum;
+  Gnum                coarvertnnd;
+  Gnum                coardegrmax;
+  Gnum                coarhashmsk;
+
+  const Graph * restrict const  finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const   fineverttax = finegrafptr->verttax;
+  const Gnum * restrict const   finevendtax = finegrafptr->vendtax;
+  const Gnum * restrict const   finecoartax = coarptr->finematetax;
+  Gnum * restrict const         coarvfintax = coarptr->finecloatax; /* TRICK: cluster load array re-used as index array */
+  Gnum * restrict const         finevfintax = coarptr->finevfintax;
+  const Gnum                    baseval     = finegrafptr->baseval;
+  const Gnum                    finevertnnd = finegrafptr->vertnnd;
+
+  coarvertnnd = coarptr->coarvertnbr + baseval;
+  memSet (coarvfintax + baseval, 0, (coarptr->coarvertnbr + 1) * sizeof (Gnum));
+  for (finevertnum = baseval; finevertnum < finevertnnd; finevertnum ++) /* Count fine vertices per coarse vertex */
+    coarvfintax[finecoartax[finevertnum]] ++;
+  for (coarvertnum = baseval, finevertnum = baseval; coarvertnum < coarvertnnd; coarvertnum ++) { /* Compute start indices */
+    Gnum                finevertnbr;
+
+    finevertnbr = coarvfintax[coarvertnum];
+    coarvfintax[coarvertnum] = finevertnum;
+    finevertnum += finevertnbr;
+  }
+  for (finevertnum = baseval; finevertnum < finevertnnd; finevertnum ++) /* Fill lists; indices become end indices */
+    finevfintax[coarvfintax[finecoartax[finevertnum]] ++] = finevertnum;
+  for (coarvertnum = coarvertnnd; coarvertnum > baseval; coarvertnum --) /* Shift end indices to get start indices back */
+    coarvfintax[coarvertnum] = coarvfintax[coarvertnum - 1];
+  coarvfintax[baseval] = baseval;
+
+  for (coarvertnum = baseval, coardegrmax = 0; coarvertnum < coarvertnnd; coarvertnum ++) { /* Bound coarse degrees */
+    Gnum                finevfinnum;
+    Gnum                coardegrval;
+
+    for (finevfinnum = coarvfintax[coarvertnum], coardegrval = 0;
+         finevfinnum < coarvfintax[coarvertnum + 1]; finevfinnum ++) {
+      finevertnum  = finevfintax[finevfinnum];
+      coardegrval += finevendtax[finevertnum] - fineverttax[finevertnum];
+    }
+    if (coardegrmax < coardegrval)
+      coardegrmax = coardegrval;
+  }
+
+  for (coarhashmsk = 31; coarhashmsk < coardegrmax; coarhashmsk = coarhashmsk * 2 + 1) ; /* Compute size of hash table */
+  coarptr->coarhashmsk = coarhashmsk * 2 + 1;     /* Record it for (local) hash table allocation */
+}
@@ -0,0 +1,79 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_clus.h                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the source graph label propagation  **/
+/**                clustering routines.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Maximum number of label propagation passes. +*/
+
+#define GRAPHCLUSPASSNBR            5
+
+/*+ Maximum ratio between the load of a cluster
+    and the average load of fine vertices.      +*/
+
+#define GRAPHCLUSLOADRAT            8
+
+/*+ Flag set in the routine index when the
+    label propagation is run concurrently.  +*/
+
+#define GRAPHCLUSTHREAD             4
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_CLUS
+static Gnum                 graphClusPass       (GraphCoarsenData * restrict const, GraphCoarsenHash * restrict const, const Gnum, const Gnum, const Gnum, const int);
+#ifndef GRAPHCOARSENNOTHREAD
+static void                 graphClusScan       (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_GRAPH_CLUS */
+
+int                         graphClusInit       (GraphCoarsenData * restrict, const int);
+void                        graphClusExit       (GraphCoarsenData * restrict);
+void                        graphClus           (ThreadDescriptor * restrict const, GraphCoarsenData * const);
+void                        graphClusList       (GraphCoarsenData * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011-2016,2018,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011-2016,2018,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 29 apr 2019     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -74,6 +74,7 @@
 #include "arch.h"
 #include "graph.h"
 #include "graph_coarsen.h"
+#include "graph_clus.h"
 #include "graph_match.h"
 
 /****************************************/
@@ -100,6 +101,28 @@
 #undef GRAPHCOARSENEDGECOUNT
 #endif /* GRAPHCOARSENNOTHREAD */
 
+#define GRAPHCOARSENEDGECLUS                      /* Routines for contracted clusters */
+
+#define GRAPHCOARSENEDGENAME        graphCoarsenEdgeCl
+#define GRAPHCOARSENEDLOTAB
+#include "graph_coarsen_edge.c"
+#undef GRAPHCOARSENEDGENAME
+#undef GRAPHCOARSENEDLOTAB
+
+#define GRAPHCOARSENEDGENAME        graphCoarsenEdgeCu
+#include "graph_coarsen_edge.c"
+#undef GRAPHCOARSENEDGENAME
+
+#ifndef GRAPHCOARSENNOTHREAD
+#define GRAPHCOARSENEDGENAME        graphCoarsenEdgeCc
+#define GRAPHCOARSENEDGECOUNT
+#include "graph_coarsen_edge.c"
+#undef GRAPHCOARSENEDGENAME
+#undef GRAPHCOARSENEDGECOUNT
+#endif /* GRAPHCOARSENNOTHREAD */
+
+#undef GRAPHCOARSENEDGECLUS
+
 /***************************/
 /*                         */
 /* The coarsening routine. */
@@ -183,7 +206,10 @@ GraphCoarsenData * restrict const coarptr)
 #endif /* SCOTCH_PTHREAD */
 
   if ((coarptr->flagval & GRAPHCOARSENUSEMATE) == 0) { /* If matching data not provided */
-    graphMatch (descptr, coarptr);                /* Perform threaded matching          */
+    if ((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) /* If clusters wanted instead of pairs */
+      graphClus (descptr, coarptr);               /* Perform threaded label propagation     */
+    else
+      graphMatch (descptr, coarptr);              /* Perform threaded matching */
 
     if ((coarptr->retuval != 0) ||                /* If matching failed                    */
         (coargrafptr == NULL))                    /* Or if only matching wanted, stop here */
@@ -226,6 +252,13 @@ GraphCoarsenData * restrict const coarptr)
       Gnum                finematenum;            /* Number of current mate vertex */
 
       finematenum = finecoartax[finevertnum];
+      if ((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) { /* If fine-to-coarse array already computed */
+        if ((finematenum < baseval) || (finematenum >= (coarvertnbr + baseval))) {
+          errorPrint ("graphCoarsen3: invalid clustering");
+          return;
+        }
+        continue;
+      }
       if ((finematenum < baseval) || (finematenum >= finegrafptr->vertnnd)) {
         errorPrint ("graphCoarsen3: invalid matching (1)");
         return;
@@ -238,7 +271,7 @@ GraphCoarsenData * restrict const coarptr)
 #endif /* SCOTCH_DEBUG_GRAPH2 */
 
     coarvendsiz = ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) != 0) ? coarvertnbr : 1; /* TRICK: If not a compact graph, allocate a whole array for vendtab */
-    coarmultsiz = ((coarptr->flagval & GRAPHCOARSENHASMULT)   == 0) ? coarvertnbr : 0; /* If coarmulttab is not user-provided, allocate it among graph data */
+    coarmultsiz = ((coarptr->flagval & (GRAPHCOARSENHASMULT | GRAPHCOARSENCLUSTER)) == 0) ? coarvertnbr : 0; /* If coarmulttab is not user-provided, allocate it among graph data */
 
     memSet (coargrafptr, 0, sizeof (Graph));      /* Initialize coarse graph on thread 0 */
     coargrafptr->flagval = GRAPHFREEVERT | GRAPHVERTGROUP | GRAPHFREEEDGE;
@@ -271,9 +304,36 @@ GraphCoarsenData * restrict const coarptr)
       coargrafptr->edlotax  = coargrafptr->edgetax + finegrafptr->edgenbr;
       if (coarmultsiz > 0)                        /* If array created internally, record its location */
         coarptr->coarmulttab = coarmulttab;       /* Record un-based array location                   */
+      if ((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) /* If clusters contracted, build their vertex lists */
+        graphClusList (coarptr);                  /* Also sets size of hash table for coarse edges        */
     }
   }
 
+  if ((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) { /* If fine-to-coarse array already computed */
+    coarmulttax = NULL;                           /* No multinode array in this case            */
+#ifndef GRAPHCOARSENNOTHREAD
+    if (thrdnbr > 1) {                            /* If more than one thread           */
+      threadBarrier (descptr);                    /* Wait for cluster lists to be built */
+
+      if (coarptr->retuval != 0)                  /* After barrier, in case memory allocation failed */
+        return;
+
+      thrdptr->coarvertbas = baseval + DATASCAN (coarvertnbr, thrdnbr, thrdnum); /* Set bounds for coarse vertex processing */
+      thrdptr->coarvertnnd = baseval + DATASCAN (coarvertnbr, thrdnbr, thrdnum + 1);
+    }
+    else
+#endif /* GRAPHCOARSENNOTHREAD */
+    {
+#ifndef GRAPHCOARSENNOTHREAD
+      if (coarptr->retuval != 0)                  /* In case memory allocation failed */
+        return;
+#endif /* GRAPHCOARSENNOTHREAD */
+
+      thrdptr->coarvertbas = baseval;             /* Set bounds for coarse vertex processing */
+      thrdptr->coarvertnnd = coarvertnbr + baseval;
+    }
+  }
+  else
 #ifndef GRAPHCOARSENNOTHREAD
   if (thrdnbr > 1) {                              /* If more than one thread */
     Gnum                finevertnum;
@@ -394,23 +454,43 @@ GraphCoarsenData * restrict const coarptr)
       const Gnum * restrict const fineverttax = finegrafptr->verttax;
       const Gnum * restrict const finevendtax = finegrafptr->vendtax;
 
-      for (coarvertnum = thrdptr->coarvertbas, /* For all local coarse vertices */
-           coarvertnnd = thrdptr->coarvertnnd, coaredgenbr = 0;
-           coarvertnum < coarvertnnd; coarvertnum ++) {
-        Gnum                finevertnum;
-        int                 i;
-
-        i = 0;
-        do {                                      /* For all fine edges of multinode vertices */
-          finevertnum  = coarmulttax[coarvertnum].vertnum[i];
-          coaredgenbr += finevendtax[finevertnum] - fineverttax[finevertnum];
-        } while (i ++, finevertnum != coarmulttax[coarvertnum].vertnum[1]); /* Skip to next matched vertex if both vertices not equal */
+      if ((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) { /* If clusters contracted */
+        const Gnum * restrict const coarvfintax = coarptr->finecloatax;
+        const Gnum * restrict const finevfintax = coarptr->finevfintax;
+
+        for (coarvertnum = thrdptr->coarvertbas, /* For all local coarse vertices */
+             coarvertnnd = thrdptr->coarvertnnd, coaredgenbr = 0;
+             coarvertnum < coarvertnnd; coarvertnum ++) {
+          Gnum                finevfinnum;
+
+          for (finevfinnum = coarvfintax[coarvertnum]; /* For all fine edges of cluster vertices */
+               finevfinnum < coarvfintax[coarvertnum + 1]; finevfinnum ++) {
+            Gnum                finevertnum;
+
+            finevertnum  = finevfintax[finevfinnum];
+            coaredgenbr += finevendtax[finevertnum] - fineverttax[finevertnum];
+          }
+        }
+      }
+      else {
+        for (coarvertnum = thrdptr->coarvertbas, /* For all local coarse vertices */
+             coarvertnnd = thrdptr->coarvertnnd, coaredgenbr = 0;
+             coarvertnum < coarvertnnd; coarvertnum ++) {
+          Gnum                finevertnum;
+          int                 i;
+
+          i = 0;
+          do {                                    /* For all fine edges of multinode vertices */
+            finevertnum  = coarmulttax[coarvertnum].vertnum[i];
+            coaredgenbr += finevendtax[finevertnum] - fineverttax[finevertnum];
+          } while (i ++, finevertnum != coarmulttax[coarvertnum].vertnum[1]); /* Skip to next matched vertex if both vertices not equal */
+        }
       }
       thrdptr->coaredgebas = coaredgenbr;         /* Save upper bound on local number of coarse edges for scan */
     }
     else {
       thrdptr->coaredgebas = 0;                   /* No coarse edges accounted for yet                                */
-      graphCoarsenEdgeCt (coarptr, thrdptr);      /* Count number of coarse local edges in thrdptr->coaredgebas       */
+      (((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) ? graphCoarsenEdgeCc : graphCoarsenEdgeCt) (coarptr, thrdptr); /* Count number of coarse local edges in thrdptr->coaredgebas */
       memSet (thrdptr->coarhashtab, ~0, coarhashnbr * sizeof (GraphCoarsenHash)); /* Re-initialize (local) hash table */
     }
     thrdptr->scantab[0] = thrdptr->coaredgebas;
@@ -441,7 +521,10 @@ GraphCoarsenData * restrict const coarptr)
   }
   coaredgebas = thrdptr->coaredgebas;             /* Record edge start index */
 
-  ((finegrafptr->edlotax != NULL) ? graphCoarsenEdgeLl : graphCoarsenEdgeLu) (coarptr, thrdptr); /* Build coarse graph edge array */
+  if ((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) /* If clusters contracted */
+    ((finegrafptr->edlotax != NULL) ? graphCoarsenEdgeCl : graphCoarsenEdgeCu) (coarptr, thrdptr); /* Build coarse graph edge array */
+  else
+    ((finegrafptr->edlotax != NULL) ? graphCoarsenEdgeLl : graphCoarsenEdgeLu) (coarptr, thrdptr);
 
   memFree (thrdptr->coarhashtab);                 /* Free local hash table */
 
@@ -524,7 +607,9 @@ GraphCoarsenData * restrict const     coarptr)
     coarptr->flagval &= ~GRAPHCOARSENNOCOMPACT;   /* Non-compact graphs always imply more than one thread */
 
   if ((coarptr->flagval & GRAPHCOARSENUSEMATE) == 0) { /* If mating array not provided          */
-    if (graphMatchInit (coarptr, thrdnbr) != 0)   /* Initialize global data needed for matching */
+    if ((((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) /* Initialize global data needed for matching */
+         ? graphClusInit  (coarptr, thrdnbr)
+         : graphMatchInit (coarptr, thrdnbr)) != 0)
       return (2);
   }
 
@@ -542,6 +627,8 @@ GraphCoarsenData * restrict const     coarptr)
   contextThreadLaunch (coarptr->contptr, (ThreadFunc) graphCoarsen3, (void *) coarptr);
 
   memFree (coarptr->thrdtab);
+  if ((coarptr->flagval & (GRAPHCOARSENUSEMATE | GRAPHCOARSENCLUSTER)) == GRAPHCOARSENCLUSTER) /* If label propagation performed */
+    graphClusExit (coarptr);
 
   if ((coarptr->flagval & GRAPHCOARSENDSTMATE) == 0) /* If mating array destination not provided */
     memFree (finematetab);                        /* Do not keep mating data array               */
@@ -617,6 +704,14 @@ Context * restrict const                      contptr) /*+ Execution context
   coardat.coargrafptr = coargrafptr;
   coardat.coarmulttab = *coarmultptr;
   coardat.contptr     = contptr;
+  if ((flagval & GRAPHCOARSENCLUSTER) != 0) {     /* If clusters are to be contracted, bound their load */
+    Gnum                cloamax;
+
+    cloamax = (finegrafptr->velosum * GRAPHCLUSLOADRAT) / MAX (finegrafptr->vertnbr, 1); /* Bound growth of cluster loads per level */
+    if ((coarvertnbr > 0) && (cloamax > (finegrafptr->velosum / coarvertnbr))) /* Do not create fewer clusters than wanted  */
+      cloamax = finegrafptr->velosum / coarvertnbr;
+    coardat.cloamax = MAX (cloamax, 1);
+  }
 
   o = graphCoarsen2 (&coardat);
   if (o != 0)
@@ -663,7 +758,7 @@ Context * restrict const          contptr)        /*+ Execution context
   if (coardat.coarvertmax < *coarvertptr)         /* If there will be too few vertices in graph */
     return (1);                                   /* It is useless to go any further            */
 
-  coardat.flagval     = GRAPHCOARSENDSTMATE | (flagval & GRAPHCOARSENNOMERGE); /* Array will be provided and/or kept */
+  coardat.flagval     = GRAPHCOARSENDSTMATE | (flagval & (GRAPHCOARSENHOP | GRAPHCOARSENNOMERGE)); /* Array will be provided and/or kept */
   coardat.finematetax = (*finemateptr == NULL) ? NULL : (*finemateptr - finegrafptr->baseval);
   coardat.finegrafptr = finegrafptr;              /* Fill caller part of matching data structure */
   coardat.fineparotax = fineparotax;
@@ -723,3 +818,104 @@ Context * restrict const                      contptr) /*+ Execution context
 
   return (0);
 }
+
+/* This routine computes the coordinates of the
+** vertices of a coarse graph, as the load-weighted
+** barycenters of the coordinates of the fine
+** vertices they comprise. Fine vertices are linked
+** to their coarse vertex either by way of the
+** fine-to-coarse array, if it is provided, or
+** else by way of the multinode array.
+** It returns:
+** - 0   : if the coarse coordinate array has been built.
+** - !0  : on error.
+*/
+
+int
+graphCoarsenGeom (
+const Graph * restrict const              finegrafptr, /*+ Fine graph                                    +*/
+const Gnum                                coarvertnbr, /*+ Number of coarse vertices                     +*/
+const Gnum * restrict const               finecoartab, /*+ Un-based fine-to-coarse array, or NULL        +*/
+const GraphCoarsenMulti * restrict const  coarmulttab, /*+ Un-based multinode array, if no above array   +*/
+const int                                 dimnnbr,    /*+ Geometry dimension                             +*/
+const double * restrict const             finegeomtab, /*+ Un-based fine coordinate array                +*/
+double * restrict * restrict const        coargeomptr) /*+ Pointer to un-based coarse array to build     +*/
+{
+  double * restrict   coargeomtab;
+  Gnum                coarvertnum;
+  int                 dimnnum;
+
+  const Gnum * restrict const finevelotax = finegrafptr->velotax;
+  const Gnum                  finebaseval = finegrafptr->baseval;
+
+  if ((coargeomtab = (double *) memAlloc (coarvertnbr * dimnnbr * sizeof (double))) == NULL) {
+    errorPrint ("graphCoarsenGeom: out of memory (1)");
+    return     (1);
+  }
+
+  if (finecoartab != NULL) {                      /* If fine-to-coarse array provided */
+    double * restrict   coarloadtab;
+    Gnum                finevertnum;
+
+    if ((coarloadtab = (double *) memAlloc (coarvertnbr * sizeof (double))) == NULL) {
+      errorPrint ("graphCoarsenGeom: out of memory (2)");
+      memFree    (coargeomtab);
+      return     (1);
+    }
+    memSet (coargeomtab, 0, coarvertnbr * dimnnbr * sizeof (double));
+    memSet (coarloadtab, 0, coarvertnbr * sizeof (double));
+
+    for (finevertnum = 0; finevertnum < finegrafptr->vertnbr; finevertnum ++) {
+      double              fineloadval;
+
+      coarvertnum = finecoartab[finevertnum] - finebaseval;
+      fineloadval = (finevelotax != NULL) ? (double) finevelotax[finevertnum + finebaseval] : 1.0;
+      coarloadtab[coarvertnum] += fineloadval;
+      for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++)
+        coargeomtab[coarvertnum * dimnnbr + dimnnum] += fineloadval * finegeomtab[finevertnum * dimnnbr + dimnnum];
+    }
+    for (coarvertnum = 0; coarvertnum < coarvertnbr; coarvertnum ++) {
+      if (coarloadtab[coarvertnum] > 0.0) {
+        for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++)
+          coargeomtab[coarvertnum * dimnnbr + dimnnum] /= coarloadtab[coarvertnum];
+      }
+    }
+
+    memFree (coarloadtab);
+  }
+  else {
+    for (coarvertnum = 0; coarvertnum < coarvertnbr; coarvertnum ++) {
+      Gnum                finevertnum0;           /* First multinode vertex  */
+      Gnum                finevertnum1;           /* Second multinode vertex */
+
+      finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
+      finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
+      if (finevertnum0 != finevertnum1) {
+        double              fineloadval0;
+        double              fineloadval1;
+        double              coarloadval;
+
+        fineloadval0 = (finevelotax != NULL) ? (double) finevelotax[finevertnum0] : 1.0;
+        fineloadval1 = (finevelotax != NULL) ? (double) finevelotax[finevertnum1] : 1.0;
+        coarloadval  = fineloadval0 + fineloadval1;
+        if (coarloadval <= 0.0) {                 /* Guard against zero-load multinodes */
+          fineloadval0 =
+          fineloadval1 = 1.0;
+          coarloadval  = 2.0;
+        }
+        for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++)
+          coargeomtab[coarvertnum * dimnnbr + dimnnum] =
+            (fineloadval0 * finegeomtab[(finevertnum0 - finebaseval) * dimnnbr + dimnnum] +
+             fineloadval1 * finegeomtab[(finevertnum1 - finebaseval) * dimnnbr + dimnnum]) / coarloadval;
+      }
+      else {
+        for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++)
+          coargeomtab[coarvertnum * dimnnbr + dimnnum] = finegeomtab[(finevertnum0 - finebaseval) * dimnnbr + dimnnum];
+      }
+    }
+  }
+
+  *coargeomptr = coargeomtab;
+
+  return (0);
+}
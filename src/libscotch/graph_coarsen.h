@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011-2013,2015,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011-2013,2015,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,7 +57,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,6 +78,8 @@
 #define GRAPHCOARSENDSTMULT         0x0002        /* Multinode array destination provided               */
 #define GRAPHCOARSENHASMULT         0x0004        /* Multinode array provided                           */
 #define GRAPHCOARSENUSEMATE         0x0008        /* Matching array data provided                       */
+#define GRAPHCOARSENCLUSTER         0x0010        /* Contract label propagation clusters, not pairs     */
+#define GRAPHCOARSENHOP             0x0020        /* Pair unmatched vertices sharing a neighbor         */
 
 #define GRAPHCOARSENNOCOMPACT       0x1000        /* Create a non-compact graph                         */
 #define GRAPHCOARSENDETERMINISTIC   0x2000        /* Use deterministic algorithms only                  */
@@ -94,9 +96,11 @@
 /*+ Here are the edge matching function types for coarsening. +*/
 
 typedef enum GraphCoarsenType_ {
-  GRAPHCOARHEM,                                   /*+ Heavy-edge matching       +*/
-  GRAPHCOARSCN,                                   /*+ Scanning (first) matching +*/
-  GRAPHCOARNBR                                    /*+ Number of matching types  +*/
+  GRAPHCOARHEM,                                   /*+ Heavy-edge matching                +*/
+  GRAPHCOARSCN,                                   /*+ Scanning (first) matching          +*/
+  GRAPHCOARLBP,                                   /*+ Size-constrained label propagation +*/
+  GRAPHCOARHOP,                                   /*+ Matching with two-hop pairing      +*/
+  GRAPHCOARNBR                                    /*+ Number of matching types           +*/
 } GraphCoarsenType;
 
 /*+ The multinode table element, which contains
@@ -105,7 +109,10 @@ typedef enum GraphCoarsenType_ {
     As the base values of the fine and coarse graphs
     may be different, the values of the collapsed
     vertices are set with respect to the base value
-    of the fine graph.                               +*/
+    of the fine graph. When clusters are contracted
+    (GRAPHCOARSENCLUSTER flag), no multinode array
+    is built, and the fine-to-coarse array must be
+    used in its place.                               +*/
 
 typedef struct GraphCoarsenMulti_ {
   Gnum                      vertnum[2];           /*+ Numbers of the collapsed vertices of a multinode +*/
@@ -157,6 +164,9 @@ typedef struct GraphCoarsenData_ {
   Gnum                      coarmultsiz;          /*+ Size of multinode array allocated in graph      +*/
   Gnum                      coarhashmsk;          /*+ Hash table mask                                 +*/
   int *                     finelocktax;          /*+ Global matching lock array (if any)             +*/
+  Gnum *                    finecloatax;          /*+ Cluster load array, then coarse vertex index    +*/
+  Gnum *                    finevfintax;          /*+ Fine vertices sorted by cluster                 +*/
+  Gnum                      cloamax;              /*+ Maximum cluster load                            +*/
   GraphCoarsenThread *      thrdtab;              /*+ Array of thread-specific data                   +*/
   int                       fumaval;              /*+ Index of mating routine in function array       +*/
   volatile int              retuval;              /*+ Return value                                    +*/
@@ -173,8 +183,14 @@ static void                 graphCoarsenEdgeCt  (const GraphCoarsenData * restri
 #endif /* GRAPHCOARSENNOTHREAD */
 static void                 graphCoarsenEdgeLl  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
 static void                 graphCoarsenEdgeLu  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
+#ifndef GRAPHCOARSENNOTHREAD
+static void                 graphCoarsenEdgeCc  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
+#endif /* GRAPHCOARSENNOTHREAD */
+static void                 graphCoarsenEdgeCl  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
+static void                 graphCoarsenEdgeCu  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
 #endif /* SCOTCH_GRAPH_COARSEN */
 
 int                         graphCoarsen        (const Graph * restrict const, Graph * restrict const, Gnum * restrict * restrict const, GraphCoarsenMulti * restrict * restrict const, const Gnum, const double, const Gnum, const Anum * restrict const, const Anum * restrict const, const Gnum, Context * restrict const);
 int                         graphCoarsenMatch   (const Graph * restrict const, Gnum * restrict * restrict const, Gnum * restrict const, const double, const Gnum, const Anum * restrict const, const Anum * restrict const, const Gnum, Context * restrict const);
 int                         graphCoarsenBuild   (const Graph * restrict const, Graph * restrict const, Gnum * restrict const, GraphCoarsenMulti * restrict * restrict const, const Gnum, Context * restrict const);
+int                         graphCoarsenGeom    (const Graph * restrict const, const Gnum, const Gnum * restrict const, const GraphCoarsenMulti * restrict const, const int, const double * restrict const, double * restrict * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2012,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2012,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 28 oct 2012     **/
 /**                                 to   : 28 feb 2015     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 02 aug 2018     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -85,7 +85,12 @@ GraphCoarsenThread * restrict const     thrdptr)
 #endif /* GRAPHCOARSENEDGECOUNT */
   GraphCoarsenHash * restrict const         coarhashtab = thrdptr->coarhashtab; /* Hash table is thread-dependent for memory locality */
   const Gnum                                coarhashmsk = coarptr->coarhashmsk;
+#ifdef GRAPHCOARSENEDGECLUS
+  const Gnum * restrict const               coarvfintax = coarptr->finecloatax; /* Index of fine vertices of clusters */
+  const Gnum * restrict const               finevfintax = coarptr->finevfintax;
+#else /* GRAPHCOARSENEDGECLUS */
   const GraphCoarsenMulti * restrict const  coarmulttax = coarptr->coarmulttab - finegrafptr->baseval;
+#endif /* GRAPHCOARSENEDGECLUS */
 
 #ifndef GRAPHCOARSENEDGECOUNT
   coaredloadj = 0;
@@ -95,7 +100,11 @@ GraphCoarsenThread * restrict const     thrdptr)
        coarvertnnd = thrdptr->coarvertnnd, coaredgenum = thrdptr->coaredgebas;
        coarvertnum < coarvertnnd; coarvertnum ++) {
     Gnum                finevertnum;
+#ifdef GRAPHCOARSENEDGECLUS
+    Gnum                finevfinnum;
+#else /* GRAPHCOARSENEDGECLUS */
     int                 i;
+#endif /* GRAPHCOARSENEDGECLUS */
 
 #ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
     Gnum                coarveloval;              /* Load of coarse vertex           */
@@ -105,11 +114,19 @@ GraphCoarsenThread * restrict const     thrdptr)
     coaredgetmp = coaredgenum;
     coarveloval = 0;
 #endif /* GRAPHCOARSENEDGECOUNT */
+#ifdef GRAPHCOARSENEDGECLUS
+    for (finevfinnum = coarvfintax[coarvertnum];  /* For all fine edges of cluster vertices */
+         finevfinnum < coarvfintax[coarvertnum + 1]; finevfinnum ++) {
+      Gnum                fineedgenum;
+
+      finevertnum = finevfintax[finevfinnum];
+#else /* GRAPHCOARSENEDGECLUS */
     i = 0;
     do {                                          /* For all fine edges of multinode vertices */
       Gnum                fineedgenum;
 
       finevertnum = coarmulttax[coarvertnum].vertnum[i];
+#endif /* GRAPHCOARSENEDGECLUS */
 #ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
       coarveloval += (finevelotax != NULL) ? finevelotax[finevertnum] : 1;
 #endif /* GRAPHCOARSENEDGECOUNT */
@@ -159,7 +176,11 @@ GraphCoarsenThread * restrict const     thrdptr)
         }
 #endif /* GRAPHCOARSENEDGECOUNT */
       }
+#ifdef GRAPHCOARSENEDGECLUS
+    }
+#else /* GRAPHCOARSENEDGECLUS */
     } while (i ++, finevertnum != coarmulttax[coarvertnum].vertnum[1]); /* Skip to next matched vertex if both vertices not equal */
+#endif /* GRAPHCOARSENEDGECLUS */
 
 #ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count  */
     coarvelotax[coarvertnum] = coarveloval;       /* Create coarse vertex load array  */
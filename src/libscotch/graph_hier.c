@@ -0,0 +1,228 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_hier.c                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the coarsening      **/
+/**                hierarchies which can be attached to    **/
+/**                source graphs, so that multilevel       **/
+/**                methods called repeatedly on the same   **/
+/**                graph do not have to coarsen it anew.   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "arch.h"
+#include "graph.h"
+#include "graph_coarsen.h"
+#include "graph_hier.h"
+
+/*************************************/
+/*                                   */
+/* These routines handle coarsening  */
+/* hierarchies.                      */
+/*                                   */
+/*************************************/
+
+/* This routine builds the coarsening hierarchy
+** of the given graph, and attaches it to the
+** graph. Any previously attached hierarchy is
+** freed beforehand. Graphs are coarsened by
+** heavy-edge matching with the given ratio,
+** until the coarse graph would have fewer than
+** coarnbr vertices or the ratio is not met.
+** It returns:
+** - 0   : if hierarchy could be built.
+** - !0  : on error.
+*/
+
+int
+graphHierBuild (
+Graph * restrict const      grafptr,              /*+ Graph to attach hierarchy to   +*/
+const Gnum                  coarnbr,              /*+ Minimum number of vertices     +*/
+const double                coarval,              /*+ Coarsening ratio               +*/
+Context * restrict const    contptr)              /*+ Execution context              +*/
+{
+  GraphHier * restrict  hierptr;
+  const Graph *         finegrafptr;
+  Gnum                  levlmax;
+  int                   o;
+
+  graphHierFree (grafptr);                        /* Free previous hierarchy, if any */
+
+  levlmax = 8;                                    /* Initial size of level array */
+  if (((hierptr = (GraphHier *) memAlloc (sizeof (GraphHier))) == NULL) ||
+      ((hierptr->levltab = (GraphHierLevl *) memAlloc (levlmax * sizeof (GraphHierLevl))) == NULL)) {
+    errorPrint ("graphHierBuild: out of memory (1)");
+    if (hierptr != NULL)
+      memFree (hierptr);
+    return (1);
+  }
+  hierptr->verttax = grafptr->verttax;
+  hierptr->edgetax = grafptr->edgetax;
+  hierptr->vertnbr = grafptr->vertnbr;
+  hierptr->coarval = coarval;
+  hierptr->levlnbr = 0;
+  hierptr->usednbr = 0;
+
+  grafptr->hierptr  = hierptr;                    /* Attach hierarchy right now so that it can be freed */
+  grafptr->flagval |= GRAPHHASHIER | GRAPHFREEHIER;
+
+  for (finegrafptr = grafptr; ; ) {
+    GraphHierLevl *     levlptr;
+
+    if (hierptr->levlnbr >= levlmax) {            /* If level array must be resized */
+      GraphHierLevl *     levltmp;
+
+      levlmax += (levlmax >> 2) + 1;              /* Increase size by 25% */
+      if ((levltmp = (GraphHierLevl *) memRealloc (hierptr->levltab, levlmax * sizeof (GraphHierLevl))) == NULL) {
+        errorPrint ("graphHierBuild: out of memory (2)");
+        graphHierFree (grafptr);
+        return (1);
+      }
+      hierptr->levltab = levltmp;
+      if (hierptr->levlnbr > 0)                   /* Fine graph may have moved along with level array */
+        finegrafptr = &levltmp[hierptr->levlnbr - 1].grafdat;
+    }
+
+    levlptr = &hierptr->levltab[hierptr->levlnbr];
+    levlptr->multtab = NULL;                      /* Allocate multinode array along with coarse graph */
+    if ((o = graphCoarsen (finegrafptr, &levlptr->grafdat, NULL, &levlptr->multtab,
+                           coarnbr, coarval, GRAPHCOARSENNONE, NULL, NULL, 0, contptr)) != 0)
+      break;
+
+    finegrafptr = &levlptr->grafdat;              /* Coarsen next level from coarse graph */
+    hierptr->levlnbr ++;
+  }
+  if (o > 1) {                                    /* If coarsening failed on error */
+    errorPrint ("graphHierBuild: cannot coarsen graph");
+    graphHierFree (grafptr);
+    return (1);
+  }
+
+  return (0);
+}
+
+/* This routine detaches the coarsening
+** hierarchy attached to the given graph,
+** if any, and frees it if the graph owns
+** it.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphHierFree (
+Graph * const               grafptr)
+{
+  GraphHier *         hierptr;
+  Gnum                levlnum;
+
+  if ((grafptr->flagval & GRAPHHASHIER) == 0)     /* If no hierarchy attached */
+    return;
+
+  hierptr = grafptr->hierptr;
+  if ((grafptr->flagval & GRAPHFREEHIER) != 0) {  /* If graph owns its hierarchy */
+    for (levlnum = 0; levlnum < hierptr->levlnbr; levlnum ++)
+      graphExit (&hierptr->levltab[levlnum].grafdat); /* Also frees multinode array */
+    memFree (hierptr->levltab);
+    memFree (hierptr);
+  }
+
+  grafptr->flagval &= ~(GRAPHHASHIER | GRAPHFREEHIER);
+  grafptr->hierptr  = NULL;
+}
+
+/* This routine returns the level of the
+** coarsening hierarchy that can be used to
+** coarsen the given graph, assumed to be at
+** the given coarsening level, with the given
+** ratio, unless the coarse graph would have
+** fewer than coarnbr vertices, in which case
+** graphCoarsen() would not coarsen it either.
+** The given graph must either be the
+** graph the hierarchy is attached to (or a
+** clone of it), or the coarse graph of the
+** previous level.
+** It returns:
+** - !NULL  : pointer to the hierarchy level.
+** - NULL   : if no matching level available.
+*/
+
+const GraphHierLevl *
+graphHierLevl (
+const Graph * restrict const  grafptr,            /*+ Fine graph to coarsen       +*/
+const Gnum                    levlnum,            /*+ Level of fine graph         +*/
+const Gnum                    coarnbr,            /*+ Minimum number of vertices  +*/
+const double                  coarval)            /*+ Wanted coarsening ratio     +*/
+{
+  GraphHier *         hierptr;
+  const Gnum *        verttax;                    /* Vertex array of fine graph of level */
+  const Gnum *        edgetax;                    /* Edge array of fine graph of level   */
+
+  if ((grafptr->flagval & GRAPHHASHIER) == 0)     /* If no hierarchy attached */
+    return (NULL);
+
+  hierptr = grafptr->hierptr;
+  if ((levlnum < 0) || (levlnum >= hierptr->levlnbr) || /* If level not available */
+      (hierptr->coarval != coarval) ||            /* Or hierarchy built with another ratio */
+      ((Gnum) ((double) grafptr->vertnbr * coarval) < coarnbr)) /* Or graph would be too small */
+    return (NULL);
+
+  if (levlnum == 0) {
+    verttax = hierptr->verttax;
+    edgetax = hierptr->edgetax;
+  }
+  else {
+    verttax = hierptr->levltab[levlnum - 1].grafdat.verttax;
+    edgetax = hierptr->levltab[levlnum - 1].grafdat.edgetax;
+  }
+  if ((grafptr->verttax != verttax) ||            /* If graph is not the fine graph of the level */
+      (grafptr->edgetax != edgetax) ||
+      ((levlnum == 0) && (grafptr->vertnbr != hierptr->vertnbr)))
+    return (NULL);
+
+  hierptr->usednbr ++;                            /* Record reuse for checking purposes */
+  return (&hierptr->levltab[levlnum]);
+}
@@ -0,0 +1,85 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_hier.h                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the coarsening hierarchies which    **/
+/**                can be attached to source graphs.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The hierarchy level structure. Each level
+    holds the coarse graph obtained from the
+    graph of the previous level, or from the
+    attached graph for the first level, along
+    with its multinode array.                   +*/
+
+typedef struct GraphHierLevl_ {
+  Graph                     grafdat;              /*+ Coarse graph of level                       +*/
+  GraphCoarsenMulti *       multtab;              /*+ Multinode array, allocated along with graph +*/
+} GraphHierLevl;
+
+/*+ The coarsening hierarchy structure. Since
+    the coarsening hierarchy can only be used
+    with the very graph it has been built from,
+    the addresses of the vertex and edge arrays
+    of this graph are recorded, so as to check
+    that graphs sharing the hierarchy pointer
+    still are this graph.                        +*/
+
+typedef struct GraphHier_ {
+  const Gnum *              verttax;              /*+ Vertex array of attached graph       +*/
+  const Gnum *              edgetax;              /*+ Edge array of attached graph         +*/
+  Gnum                      vertnbr;              /*+ Number of vertices of attached graph +*/
+  double                    coarval;              /*+ Coarsening ratio of all levels       +*/
+  Gnum                      levlnbr;              /*+ Number of levels in array            +*/
+  GraphHierLevl *           levltab;              /*+ Array of hierarchy levels            +*/
+  Gnum                      usednbr;              /*+ Number of levels provided for reuse  +*/
+} GraphHier;
+
+/*
+**  The function prototypes.
+*/
+
+int                         graphHierBuild      (Graph * restrict const, const Gnum, const double, Context * restrict const);
+const GraphHierLevl *       graphHierLevl       (const Graph * restrict const, const Gnum, const Gnum, const double);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2016,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2016,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 03 aug 2016     **/
 /**                                 to   : 03 aug 2016     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,6 +78,54 @@
 /*                                         */
 /*******************************************/
 
+/* This routine reads the header of a
+** source graph file, that is, its version
+** number, its numbers of vertices and arcs,
+** its base value and its property flags.
+** It is shared by the graph loading and
+** the stream partitioning routines.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadHead (
+FILE * const                stream,               /* Stream from which to read graph header */
+Gnum * const                vertptr,              /* Pointer to number of vertices          */
+Gnum * const                edgeptr,              /* Pointer to number of arcs              */
+Gnum * const                baseptr,              /* Pointer to file base value             */
+char * const                proptab)              /* Property flags array of size 4         */
+{
+  Gnum                versval;
+  Gnum                propval;
+
+  if (intLoad (stream, &versval) != 1) {          /* Read version number */
+    errorPrint ("graphLoadHead: bad input (1)");
+    return     (1);
+  }
+  if (versval != 0) {                             /* If version not zero */
+    errorPrint ("graphLoadHead: old-style graph format no longer supported");
+    return     (1);
+  }
+
+  if ((intLoad (stream, vertptr)  != 1) ||        /* Read rest of header */
+      (intLoad (stream, edgeptr)  != 1) ||
+      (intLoad (stream, baseptr)  != 1) ||
+      (intLoad (stream, &propval) != 1) ||
+      (propval < 0)                     ||
+      (propval > 111)) {
+    errorPrint ("graphLoadHead: bad input (2)");
+    return     (1);
+  }
+  sprintf (proptab, "%3.3d", (int) propval);      /* Compute file properties */
+  proptab[0] -= '0';                              /* Vertex labels flag      */
+  proptab[1] -= '0';                              /* Edge weights flag       */
+  proptab[2] -= '0';                              /* Vertex loads flag       */
+
+  return (0);
+}
+
 /* This routine loads a source graph from
 ** the given stream.
 ** It returns:
@@ -102,36 +150,16 @@ const GraphFlag             flagval)              /* Graph loading flags
   Gnum                edlosum;                    /* Sum of edge loads                */
   Gnum                edgeval;                    /* Value where to read edge end     */
   Gnum                baseadj;
-  Gnum                versval;
   Gnum                degrmax;
-  Gnum                propval;
   char                proptab[4];
   Gnum                vertnum;
 
   memSet (grafptr, 0, sizeof (Graph));
 
-  if (intLoad (stream, &versval) != 1) {          /* Read version number */
-    errorPrint ("graphLoad: bad input (1)");
+  if (graphLoadHead (stream, &grafptr->vertnbr, &grafptr->edgenbr, &baseadj, proptab) != 0) {
+    errorPrint ("graphLoad: cannot read header");
     return     (1);
   }
-  if (versval != 0) {                             /* If version not zero */
-    errorPrint ("graphLoad: old-style graph format no longer supported");
-    return     (1);
-  }
-
-  if ((intLoad (stream, &grafptr->vertnbr) != 1) || /* Read rest of header */
-      (intLoad (stream, &grafptr->edgenbr) != 1) ||
-      (intLoad (stream, &baseadj)          != 1) ||
-      (intLoad (stream, &propval)          != 1) ||
-      (propval < 0)                              ||
-      (propval > 111)) {
-    errorPrint ("graphLoad: bad input (2)");
-    return     (1);
-  }
-  sprintf (proptab, "%3.3d", (int) propval);      /* Compute file properties */
-  proptab[0] -= '0';                              /* Vertex labels flag      */
-  proptab[1] -= '0';                              /* Edge weights flag       */
-  proptab[2] -= '0';                              /* Vertex loads flag       */
 
   grafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
   if (baseval == -1) {                            /* If keep file graph base     */
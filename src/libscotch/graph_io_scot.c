@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 5.1  : from : 11 aug 2010     **/
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -110,6 +110,9 @@ const char * const          dataptr)              /* No use           */
     return     (1);
   }
 
+  geomptr->dimnnbr = (int) dimnnbr;               /* Record geometry dimension */
+  geomptr->vertnbr = grafptr->vertnbr;            /* And number of vertices    */
+
   if (grafptr->vertnbr == 0)
     return (0);
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011,2012,2015,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011,2012,2015,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 05 oct 2012     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -177,6 +177,102 @@ Gnum                                finevertnnd)
   intPsort2asc1 (thrdptr->finequeutab, finequeunbr, 3);
 }
 
+/**************************/
+/*                        */
+/* The two-hop matching   */
+/* routine.               */
+/*                        */
+/**************************/
+
+/* This routine pairs fine vertices that were
+** left unmatched by the regular matching pass,
+** that is, vertices all the neighbors of which
+** had already been matched, and which share a
+** common neighbor. It typically applies to the
+** leaves of hub vertices, and to twin vertices.
+** Every vertex of the given range is considered
+** as a hub, the singleton neighbors of which are
+** mated pairwise, so that the cost of the pass
+** is linear in the number of edges.
+** When thrdval is set, concurrent threads may
+** process hubs having common neighbors, and
+** singleton vertices are acquired by atomic
+** compare-and-swap on their mate value.
+** It returns:
+** - the number of pairs created.
+*/
+
+static
+Gnum
+graphMatchHop (
+GraphCoarsenData * restrict const coarptr,
+const Gnum                        finevertbas,
+const Gnum                        finevertnnd,
+const int                         thrdval)        /* Flag set if concurrent processing */
+{
+  Gnum                finevertnum;
+  Gnum                finepairnbr;
+
+  const Graph * restrict const    finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const     fineverttax = finegrafptr->verttax;
+  const Gnum * restrict const     finevendtax = finegrafptr->vendtax;
+  const Gnum * restrict const     fineedgetax = finegrafptr->edgetax;
+  const Anum * restrict const     fineparotax = coarptr->fineparotax;
+  const Anum * restrict const     finepfixtax = coarptr->finepfixtax;
+  volatile Gnum * restrict const  finematetax = coarptr->finematetax;
+
+  for (finevertnum = finevertbas, finepairnbr = 0;
+       finevertnum < finevertnnd; finevertnum ++) {
+    Gnum                fineedgenum;
+    Gnum                fineedgennd;
+    Gnum                finevertpnd;              /* Pending singleton vertex, if any */
+
+    fineedgenum = fineverttax[finevertnum];
+    fineedgennd = finevendtax[finevertnum];
+    if ((fineedgennd - fineedgenum) < 2)          /* Hub must have at least two neighbors */
+      continue;
+
+    for (finevertpnd = -1; fineedgenum < fineedgennd; fineedgenum ++) {
+      Gnum                finevertend;
+
+      finevertend = fineedgetax[fineedgenum];
+      if (finematetax[finevertend] != finevertend) /* If neighbor is not a singleton */
+        continue;
+
+      if (finevertpnd < 0) {                      /* If no pending vertex yet */
+#ifndef GRAPHMATCHNOTHREAD
+        if ((thrdval != 0) &&                     /* Acquire vertex by setting its mate value to negative */
+            (! __sync_bool_compare_and_swap (&finematetax[finevertend], finevertend, -1)))
+          continue;
+#endif /* GRAPHMATCHNOTHREAD */
+        finevertpnd = finevertend;
+        continue;
+      }
+
+      if (((finepfixtax != NULL) && (finepfixtax[finevertend] != finepfixtax[finevertpnd])) || /* Vertices must have same fixed part */
+          ((fineparotax != NULL) && (fineparotax[finevertend] != fineparotax[finevertpnd]))) /* And same old part                    */
+        continue;
+
+#ifndef GRAPHMATCHNOTHREAD
+      if (thrdval != 0) {
+        if (! __sync_bool_compare_and_swap (&finematetax[finevertend], finevertend, finevertpnd)) /* If could not acquire end vertex */
+          continue;
+      }
+      else
+#endif /* GRAPHMATCHNOTHREAD */
+        finematetax[finevertend] = finevertpnd;
+      finematetax[finevertpnd] = finevertend;
+      finepairnbr ++;
+      finevertpnd = -1;                           /* No pending vertex any longer */
+    }
+
+    if (finevertpnd >= 0)                         /* If pending vertex not mated */
+      finematetax[finevertpnd] = finevertpnd;     /* Release it                  */
+  }
+
+  return (finepairnbr);
+}
+
 /***********************************/
 /*                                 */
 /* The matching handling routines. */
@@ -351,12 +447,32 @@ GraphCoarsenData * const          coarptr)        /* [norestrict] because of ret
     }
 
     threadBarrier (descptr);                      /* coarptr->coarvertnbr must be known to all */
+
+    if ((coarptr->flagval & GRAPHCOARSENHOP) != 0) { /* If two-hop matching wanted */
+      thrdptr->scantab[0] = graphMatchHop (coarptr, finevertbas, finevertnnd, 1); /* Pair singletons around local hubs */
+
+      threadBarrier (descptr);                    /* Barrier before reduction of pair counts */
+
+      if (thrdnum == 0) {
+        Gnum                finepairnbr;
+        int                 thrdtmp;
+
+        for (thrdtmp = 0, finepairnbr = 0; thrdtmp < thrdnbr; thrdtmp ++)
+          finepairnbr += coarptr->thrdtab[thrdtmp].scantab[0];
+        coarptr->coarvertnbr -= finepairnbr;
+      }
+
+      threadBarrier (descptr);                    /* Updated coarptr->coarvertnbr must be known to all */
+    }
   }
   else
 #endif /* SCOTCH_PTHREAD */
   {
     graphmatchfunctab[coarptr->fumaval & ~4] (coarptr, thrdptr); /* Call sequential matching routine                            */
     coarptr->coarvertnbr = thrdptr->coarvertnbr;  /* Global number of coarse vertices is that computed by (sequential) thread 0 */
+
+    if ((coarptr->flagval & GRAPHCOARSENHOP) != 0) /* If two-hop matching wanted */
+      coarptr->coarvertnbr -= graphMatchHop (coarptr, finevertbas, finevertnnd, 0);
   }
 
   memFree (thrdptr->finequeutab);
@@ -0,0 +1,308 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_strm.c                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes a partition of a   **/
+/**                source graph read from a stream, in a   **/
+/**                single pass, without loading the graph  **/
+/**                in memory.                              **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "arch.h"
+#include "graph.h"
+#include "graph_strm.h"
+
+/***************************************/
+/*                                     */
+/* This is the streaming partitioning  */
+/* routine.                            */
+/*                                     */
+/***************************************/
+
+/* This routine reads a source graph in Scotch
+** format from the given input stream and assigns
+** each vertex to a part as soon as it has been
+** read, according to the parts of its already
+** streamed neighbors. The scoring function is
+** either the Fennel objective or the linear
+** deterministic greedy (LDG) one, under a load
+** cap of (1 + balrat) times the average part load.
+** Only O(vertnbr + partnbr) memory is used: one
+** part number per vertex (or per label hash slot),
+** and the load and gain of each part. The mapping
+** is written on the fly to the output stream, in
+** the format read by SCOTCH_graphTabLoad().
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphStrmPart (
+FILE * const                instream,             /* Stream from which to read graph   */
+FILE * const                outstream,            /* Stream to which to write mapping  */
+const Anum                  partnbr,              /* Number of parts                   */
+const double                balrat,               /* Maximum load imbalance ratio      */
+const int                   flagval)              /* Scoring method                    */
+{
+  Gnum                vertnbr;
+  Gnum                edgenbr;
+  Gnum                baseval;
+  char                proptab[4];
+  Anum * restrict     parttab;                    /* Part array, if no vertex labels    */
+  GraphStrmHash * restrict hashtab;               /* Label hash table, if vertex labels */
+  Gnum                hashsiz;
+  Gnum                hashmsk;
+  Gnum * restrict     partloadtab;                /* Current load of each part          */
+  Gnum * restrict     partgaintab;                /* Gain of current vertex; -1 if none */
+  Anum * restrict     partlisttab;                /* List of parts with gains           */
+  Anum                partlistnbr;
+  double              alphval;                    /* Fennel penalty coefficient         */
+  Gnum                velosum;                    /* Sum of loads of streamed vertices  */
+  Gnum                vertnum;
+  int                 o;
+
+  if (partnbr < 1) {
+    errorPrint ("graphStrmPart: invalid number of parts");
+    return     (1);
+  }
+  if (graphLoadHead (instream, &vertnbr, &edgenbr, &baseval, proptab) != 0) {
+    errorPrint ("graphStrmPart: cannot read graph header");
+    return     (1);
+  }
+  if (vertnbr < 0) {
+    errorPrint ("graphStrmPart: bad input (1)");
+    return     (1);
+  }
+
+  if (proptab[0] != 0) {                          /* If vertex labels, hash them */
+    for (hashsiz = 16; hashsiz < (vertnbr * 2); hashsiz <<= 1) ;
+    hashmsk = hashsiz - 1;
+  }
+  else
+    hashsiz =
+    hashmsk = 0;
+
+  parttab = NULL;
+  hashtab = NULL;
+  if (memAllocGroup ((void **) (void *)
+                     &partloadtab, (size_t) (partnbr * sizeof (Gnum)),
+                     &partgaintab, (size_t) (partnbr * sizeof (Gnum)),
+                     &partlisttab, (size_t) (partnbr * sizeof (Anum)), NULL) == NULL) {
+    errorPrint ("graphStrmPart: out of memory (1)");
+    return     (1);
+  }
+  if (((hashsiz != 0) && ((hashtab = (GraphStrmHash *) memAlloc (hashsiz * sizeof (GraphStrmHash))) == NULL)) ||
+      ((hashsiz == 0) && ((parttab = (Anum *)          memAlloc ((vertnbr + 1) * sizeof (Anum)))    == NULL))) {
+    errorPrint ("graphStrmPart: out of memory (2)");
+    memFree    (partloadtab);                     /* Free group leader */
+    return     (1);
+  }
+  if (hashtab != NULL)
+    memSet (hashtab, ~0, hashsiz * sizeof (GraphStrmHash)); /* No part assigned yet */
+  else
+    memSet (parttab, ~0, vertnbr * sizeof (Anum));
+  memSet (partloadtab, 0, partnbr * sizeof (Gnum));
+  memSet (partgaintab, ~0, partnbr * sizeof (Gnum)); /* No gains yet */
+
+  alphval = ((vertnbr > 0) ? (((double) edgenbr / 2.0) * pow ((double) partnbr, GRAPHSTRMGAMMA - 1.0) / pow ((double) vertnbr, GRAPHSTRMGAMMA)) : 0.0);
+  velosum = 0;
+
+  o = 1;                                          /* Assume an error */
+  if (fprintf (outstream, GNUMSTRING "\n", (Gnum) vertnbr) == EOF) {
+    errorPrint ("graphStrmPart: bad output (1)");
+    goto abort;
+  }
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    Gnum                vlblval;
+    Gnum                veloval;
+    Gnum                degrval;
+    double              veloavg;                  /* Estimated average vertex load */
+    double              loadmax;                  /* Estimated maximum part load   */
+    double              scorbst;
+    Gnum                loadbst;
+    Anum                partbst;
+    Anum                partnum;
+
+    vlblval = vertnum + baseval;                  /* Default label is vertex number */
+    if ((proptab[0] != 0) &&                      /* If must read label             */
+        (intLoad (instream, &vlblval) != 1)) {
+      errorPrint ("graphStrmPart: bad input (2)");
+      goto abort;
+    }
+    veloval = 1;
+    if ((proptab[2] != 0) &&                      /* If must read vertex load */
+        ((intLoad (instream, &veloval) != 1) || (veloval < 0))) {
+      errorPrint ("graphStrmPart: bad input (3)");
+      goto abort;
+    }
+    if ((intLoad (instream, &degrval) != 1) || (degrval < 0)) {
+      errorPrint ("graphStrmPart: bad input (4)");
+      goto abort;
+    }
+
+    for (partlistnbr = 0; degrval > 0; degrval --) { /* Accumulate gains of streamed neighbors */
+      Gnum                edloval;
+      Gnum                edgeval;
+      Anum                partend;
+
+      edloval = 1;
+      if ((proptab[1] != 0) &&                    /* If must read edge load */
+          (intLoad (instream, &edloval) != 1)) {
+        errorPrint ("graphStrmPart: bad input (5)");
+        goto abort;
+      }
+      if (intLoad (instream, &edgeval) != 1) {
+        errorPrint ("graphStrmPart: bad input (6)");
+        goto abort;
+      }
+
+      if (hashtab != NULL) {
+        Gnum                hashnum;
+
+        for (hashnum = (edgeval * GRAPHSTRMHASHPRIME) & hashmsk; ; hashnum = (hashnum + 1) & hashmsk) {
+          if ((hashtab[hashnum].partval == ~0) || (hashtab[hashnum].vlblnum == edgeval))
+            break;
+        }
+        partend = hashtab[hashnum].partval;
+      }
+      else {
+        edgeval -= baseval;
+        if ((edgeval < 0) || (edgeval >= vertnbr)) {
+          errorPrint ("graphStrmPart: invalid edge end");
+          goto abort;
+        }
+        partend = parttab[edgeval];
+      }
+
+      if (partend == ~0)                          /* If neighbor not yet streamed */
+        continue;
+      if (partgaintab[partend] < 0) {             /* If part not yet in list */
+        partgaintab[partend]        = 0;
+        partlisttab[partlistnbr ++] = partend;
+      }
+      partgaintab[partend] += edloval;
+    }
+
+    velosum += veloval;
+    veloavg  = ((double) velosum / (double) (vertnum + 1));
+    if (veloavg <= 0.0)                           /* Guard against zero loads */
+      veloavg = 1.0;
+    loadmax  = (1.0 + balrat) * veloavg * (double) vertnbr / (double) partnbr;
+
+    scorbst = 0.0;                                /* Silence compiler warnings */
+    loadbst = GNUMMAX;
+    partbst = -1;
+    for (partnum = 0; partnum < partnbr; partnum ++) { /* Find best part */
+      Gnum                gainval;
+      Gnum                loadval;
+      double              scorval;
+
+      loadval = partloadtab[partnum];
+      if (((double) (loadval + veloval) > loadmax) && (loadval > 0)) /* If part would be overloaded */
+        continue;
+
+      gainval = (partgaintab[partnum] < 0) ? 0 : partgaintab[partnum];
+      scorval = (flagval == GRAPHSTRMLDG)
+                ? (double) gainval * (1.0 - (double) loadval / loadmax)
+                : (double) gainval - alphval * (pow ((double) (loadval + veloval) / veloavg, GRAPHSTRMGAMMA) -
+                                                pow ((double) loadval / veloavg, GRAPHSTRMGAMMA));
+      if ((partbst < 0) ||
+          (scorval > scorbst) ||
+          ((scorval == scorbst) && (loadval < loadbst))) {
+        scorbst = scorval;
+        loadbst = loadval;
+        partbst = partnum;
+      }
+    }
+    if (partbst < 0) {                            /* If all parts overloaded, pick least loaded one */
+      for (partnum = 0; partnum < partnbr; partnum ++) {
+        if (partloadtab[partnum] < loadbst) {
+          loadbst = partloadtab[partnum];
+          partbst = partnum;
+        }
+      }
+    }
+    partloadtab[partbst] += veloval;
+
+    while (partlistnbr > 0)                       /* Reset gains of neighbor parts */
+      partgaintab[partlisttab[-- partlistnbr]] = -1;
+
+    if (hashtab != NULL) {
+      Gnum                hashnum;
+
+      for (hashnum = (vlblval * GRAPHSTRMHASHPRIME) & hashmsk; ; hashnum = (hashnum + 1) & hashmsk) {
+        if (hashtab[hashnum].partval == ~0)
+          break;
+        if (hashtab[hashnum].vlblnum == vlblval) {
+          errorPrint ("graphStrmPart: duplicate vertex label");
+          goto abort;
+        }
+      }
+      hashtab[hashnum].vlblnum = vlblval;
+      hashtab[hashnum].partval = partbst;
+    }
+    else
+      parttab[vertnum] = partbst;
+
+    if (fprintf (outstream, GNUMSTRING "\t" ANUMSTRING "\n", (Gnum) vlblval, (Anum) partbst) == EOF) {
+      errorPrint ("graphStrmPart: bad output (2)");
+      goto abort;
+    }
+  }
+
+  o = 0;                                          /* Everything went well */
+
+abort:
+  if (hashtab != NULL)
+    memFree (hashtab);
+  if (parttab != NULL)
+    memFree (parttab);
+  memFree (partloadtab);                          /* Free group leader */
+
+  return (o);
+}
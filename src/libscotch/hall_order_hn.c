@@ -0,0 +1,822 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hall_order_hn.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes a sequential Halo  **/
+/**                Approximate Minimum Degree or Minimum   **/
+/**                Fill ordering of a quotient graph. It   **/
+/**                is a native alternative to the HAMD and **/
+/**                HAMF codes: vertex data are grouped in  **/
+/**                records, and the adjacency array is     **/
+/**                never compacted, since the lists of new **/
+/**                elements are stored in the segments of  **/
+/**                the pivot and of the elements absorbed  **/
+/**                by it.                                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_HALL_ORDER_HN
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "hall_order_hn.h"
+
+/*********************************/
+/*                               */
+/* The bucket handling routines. */
+/*                               */
+/*********************************/
+
+/* These routines add and remove variables
+** from the score buckets.
+*/
+
+static
+void
+hallOrderHnBuckDel (
+HallOrderHnData * restrict const  dataptr,
+const Gnum                        vertnum)
+{
+  HallOrderHnLink * restrict const  linktab = dataptr->linktab;
+  Gnum                              prevnum;
+  Gnum                              nextnum;
+
+  if (linktab[vertnum].keyval < 0)                /* If variable not in buckets */
+    return;
+
+  prevnum = linktab[vertnum].prevnum;
+  nextnum = linktab[vertnum].nextnum;
+  if (prevnum != -1)
+    linktab[prevnum].nextnum = nextnum;
+  else
+    dataptr->headtab[linktab[vertnum].keyval] = nextnum;
+  if (nextnum != -1)
+    linktab[nextnum].prevnum = prevnum;
+  linktab[vertnum].keyval = -1;
+}
+
+static
+void
+hallOrderHnBuckAdd (
+HallOrderHnData * restrict const  dataptr,
+const Gnum                        vertnum,
+const Gnum                        keyval)
+{
+  HallOrderHnLink * restrict const  linktab = dataptr->linktab;
+  Gnum                              nextnum;
+
+  nextnum = dataptr->headtab[keyval];
+  linktab[vertnum].nextnum = nextnum;
+  linktab[vertnum].prevnum = -1;
+  linktab[vertnum].keyval  = keyval;
+  if (nextnum != -1)
+    linktab[nextnum].prevnum = vertnum;
+  dataptr->headtab[keyval] = vertnum;
+  if (keyval < dataptr->keymin)
+    dataptr->keymin = keyval;
+}
+
+/* This routine computes the bucket key
+** of a variable from its score. As in the
+** HAMF code, scores beyond the number of
+** variables share buckets, so that the
+** number of buckets remains bounded.
+** It returns:
+** - the key value : in all cases.
+*/
+
+static
+Gnum
+hallOrderHnKey (
+const HallOrderHnData * restrict const  dataptr,
+const double                            scorval)
+{
+  double              keyval;
+
+  if (scorval <= (double) dataptr->keystp)        /* Small scores have their own bucket */
+    return ((Gnum) scorval);
+
+  keyval = (scorval - (double) dataptr->keystp) / (double) dataptr->keypas + (double) dataptr->keystp;
+  return ((keyval >= (double) dataptr->keymax) ? dataptr->keymax : (Gnum) keyval);
+}
+
+/* This routine returns a new mark value,
+** which is not yet held by any vertex.
+** It returns:
+** - the mark value : in all cases.
+*/
+
+static
+Gnum
+hallOrderHnMark (
+HallOrderHnData * restrict const  dataptr)
+{
+  if (dataptr->mrkval >= (GNUMMAX - 1)) {         /* If mark values about to wrap around */
+    Gnum * restrict const             marktab = dataptr->marktab;
+    Gnum                              vertnum;
+
+    for (vertnum = 0; vertnum < dataptr->vertnbr; vertnum ++)
+      marktab[vertnum] = 0;
+    dataptr->mrkval = 0;
+  }
+
+  return (++ dataptr->mrkval);
+}
+
+/*******************************/
+/*                             */
+/* The pivot elimination       */
+/* routines.                   */
+/*                             */
+/*******************************/
+
+/* This routine turns the given pivot into
+** a new element, the list of which is the
+** union of the lists of the elements it
+** absorbs and of its adjacent variables.
+** This list is first gathered in the work
+** array, then copied to the chain formed
+** by the segment of the pivot and by the
+** chains of the absorbed elements, which
+** is always large enough to hold it.
+** It returns:
+** - the number of vertices in the new element.
+*/
+
+static
+Gnum
+hallOrderHnElim1 (
+HallOrderHnData * restrict const  dataptr,
+const Gnum                        pivtnum)
+{
+  Gnum                listnum;
+  Gnum                listnbr;
+  Gnum                elemnbr;
+  Gnum                lpvtnum;
+  Gnum                lpvtnbr;
+  Gnum                wghtval;
+  Gnum                segnnum;
+  Gnum                mrkval;
+
+  HallOrderHnVert * restrict const        verttab = dataptr->verttab;
+  Gnum * restrict const                   marktab = dataptr->marktab;
+  const Gnum * restrict const             nvtab   = dataptr->nvtab;
+  Gnum * restrict const                   wghttab = dataptr->wghttab;
+  byte * restrict const                   stattab = dataptr->stattab;
+  Gnum * restrict const                   lpvttab = dataptr->lpvttab;
+  Gnum * restrict const                   iwtab   = dataptr->iwtab;
+  const Gnum * restrict const             listtab = iwtab + verttab[pivtnum].lstnum;
+
+  mrkval = hallOrderHnMark (dataptr);
+  marktab[pivtnum] = mrkval;                      /* Pivot is not part of its own element */
+
+  lpvtnbr = 0;
+  wghtval = 0;
+  elemnbr = verttab[pivtnum].elemnbr;
+  listnbr = verttab[pivtnum].lstnbr;
+  for (listnum = 0; listnum < elemnbr; listnum ++) { /* Absorb elements of pivot */
+    Gnum                elemnum;
+    Gnum                eelmnbr;
+
+    elemnum = listtab[listnum];
+    if (wghttab[elemnum] == 0)                    /* If element already absorbed */
+      continue;
+    wghttab[elemnum] = 0;
+    stattab[elemnum] = HALLORDERHNSTATDEAD;
+    verttab[elemnum].fathnum = pivtnum;
+
+    for (segnnum = elemnum, eelmnbr = verttab[elemnum].lstnbr; /* Scan all segments of element list */
+         eelmnbr > 0; segnnum = verttab[segnnum].segnnum) {
+      const Gnum * restrict eelmtab;
+      Gnum                  eelmnum;
+      Gnum                  eelmnnd;
+
+#ifdef SCOTCH_DEBUG_HALL2
+      if (segnnum == -1) {
+        errorPrint ("hallOrderHnElim1: internal error");
+        return     (0);
+      }
+#endif /* SCOTCH_DEBUG_HALL2 */
+      eelmtab = iwtab + verttab[segnnum].lstnum;
+      eelmnnd = MIN (verttab[segnnum].lstsiz, eelmnbr);
+      eelmnbr -= eelmnnd;
+      for (eelmnum = 0; eelmnum < eelmnnd; eelmnum ++) {
+        Gnum                vertend;
+        byte                statval;
+
+        vertend = eelmtab[eelmnum];
+        statval = stattab[vertend];
+        if (((statval == HALLORDERHNSTATVAR) || (statval == HALLORDERHNSTATHALO)) &&
+            (marktab[vertend] != mrkval)) {
+          marktab[vertend] = mrkval;
+          lpvttab[lpvtnbr ++] = vertend;
+          wghtval += nvtab[vertend];
+        }
+      }
+    }
+
+    verttab[verttab[pivtnum].segennd].segnnum = elemnum; /* Append segments of absorbed element */
+    verttab[pivtnum].segennd = verttab[elemnum].segennd;
+  }
+  for ( ; listnum < listnbr; listnum ++) {        /* Add variables adjacent to pivot */
+    Gnum                vertend;
+    byte                statval;
+
+    vertend = listtab[listnum];
+    statval = stattab[vertend];
+    if (((statval == HALLORDERHNSTATVAR) || (statval == HALLORDERHNSTATHALO)) &&
+        (marktab[vertend] != mrkval)) {
+      marktab[vertend] = mrkval;
+      lpvttab[lpvtnbr ++] = vertend;
+      wghtval += nvtab[vertend];
+    }
+  }
+
+  for (segnnum = pivtnum, lpvtnum = 0; lpvtnum < lpvtnbr; segnnum = verttab[segnnum].segnnum) { /* Store new element list */
+    Gnum                lpvtnnd;
+
+#ifdef SCOTCH_DEBUG_HALL2
+    if (segnnum == -1) {
+      errorPrint ("hallOrderHnElim1: internal error");
+      return     (0);
+    }
+#endif /* SCOTCH_DEBUG_HALL2 */
+    lpvtnnd = MIN (lpvtnum + verttab[segnnum].lstsiz, lpvtnbr);
+    memCpy (iwtab + verttab[segnnum].lstnum, lpvttab + lpvtnum, (lpvtnnd - lpvtnum) * sizeof (Gnum));
+    lpvtnum = lpvtnnd;
+  }
+
+  verttab[pivtnum].lstnbr  = lpvtnbr;             /* Pivot becomes new element */
+  verttab[pivtnum].elemnbr = 0;
+  verttab[pivtnum].degrval = wghtval;             /* For elements, weight of variables */
+  stattab[pivtnum] = HALLORDERHNSTATELEM;
+  wghttab[pivtnum] = 1;                           /* Element is live but not yet met */
+
+  dataptr->nleft -= nvtab[pivtnum];
+  dataptr->varinbr --;
+
+  return (lpvtnbr);
+}
+
+/* This routine updates the lists and the
+** approximate degrees of the non-halo
+** variables of the new element. Absorbed
+** elements and variables of the new element
+** are removed from their lists, the new
+** element is added to them, and elements
+** the variables of which all belong to the
+** new element are absorbed by it. Variables
+** which are only adjacent to the new element
+** are eliminated along with the pivot. The
+** hash values of the updated lists are
+** computed on the fly, and variables are
+** linked in the super-variable hash lists.
+** For minimum fill, the approximate fill
+** area of the HAMF code is computed as well.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHnElim2 (
+HallOrderHnData * restrict const  dataptr,
+const Gnum                        pivtnum,
+const Gnum                        lpvtnbr)
+{
+  Gnum                lpvtnum;
+  Gnum                wghtflg;                    /* Flag value for external weights of elements */
+
+  HallOrderHnVert * restrict const        verttab = dataptr->verttab;
+  HallOrderHnLink * restrict const        linktab = dataptr->linktab;
+  const Gnum * restrict const             marktab = dataptr->marktab;
+  Gnum * restrict const                   wghttab = dataptr->wghttab;
+  Gnum * restrict const                   nvtab   = dataptr->nvtab;
+  double * restrict const                 filltab = dataptr->filltab;
+  byte * restrict const                   stattab = dataptr->stattab;
+  Gnum * restrict const                   hashtab = dataptr->hashtab;
+  const Gnum * restrict const             lpvttab = dataptr->lpvttab;
+  Gnum * restrict const                   iwtab   = dataptr->iwtab;
+  const Gnum                              vertnbr = dataptr->vertnbr;
+  const Gnum                              mrkval  = dataptr->mrkval;
+
+  wghtflg = dataptr->wghtflg;
+  if (wghtflg > (GNUMMAX - 2 * (dataptr->keystp + 1))) { /* If flag values about to wrap around */
+    Gnum                vertnum;
+
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+      if (wghttab[vertnum] != 0)                  /* Keep dead elements flagged as such */
+        wghttab[vertnum] = 1;
+    }
+    wghtflg = 2;
+  }
+  dataptr->wghtflg = wghtflg + dataptr->keystp + 1; /* External weights never exceed initial weight */
+
+  for (lpvtnum = 0; lpvtnum < lpvtnbr; lpvtnum ++) { /* Compute external weights of elements */
+    const Gnum * restrict listtab;
+    Gnum                  listnum;
+    Gnum                  listnnd;
+    Gnum                  vertnum;
+    Gnum                  nvval;
+
+    vertnum = lpvttab[lpvtnum];
+    if (stattab[vertnum] != HALLORDERHNSTATVAR)
+      continue;
+
+    hallOrderHnBuckDel (dataptr, vertnum);
+
+    nvval   = nvtab[vertnum];
+    listtab = iwtab + verttab[vertnum].lstnum;
+    listnnd = verttab[vertnum].elemnbr;
+    for (listnum = 0; listnum < listnnd; listnum ++) {
+      Gnum                elemnum;
+
+      Gnum                wghtval;
+
+      elemnum = listtab[listnum];
+      wghtval = wghttab[elemnum];
+      if (wghtval == 0)                           /* If element absorbed */
+        continue;
+      if (wghtval < wghtflg)                      /* If element not yet met */
+        wghtval = wghtflg + verttab[elemnum].degrval;
+      wghttab[elemnum] = wghtval - nvval;
+    }
+  }
+
+  for (lpvtnum = 0; lpvtnum < lpvtnbr; lpvtnum ++) { /* Update variable lists and degrees */
+    Gnum * restrict     listtab;
+    Gnum                listnum;
+    Gnum                listnbr;
+    Gnum                listnew;
+    Gnum                elemnew;
+    Gnum                vertnum;
+    Gnum                nvval;
+    Gnum                degrval;
+    Gnum                hashval;
+    double              felmval;                  /* Fill area of elements        */
+    double              fvarval;                  /* Weight of adjacent variables */
+
+    vertnum = lpvttab[lpvtnum];
+    if (stattab[vertnum] != HALLORDERHNSTATVAR)
+      continue;
+
+    nvval   = nvtab[vertnum];
+    listtab = iwtab + verttab[vertnum].lstnum;
+    listnbr = verttab[vertnum].elemnbr;
+    degrval = 0;
+    felmval = 0.0;
+    hashval = pivtnum;
+    for (listnum = listnew = 0; listnum < listnbr; listnum ++) {
+      Gnum                elemnum;
+      Gnum                wgtval;
+
+      elemnum = listtab[listnum];
+      if (wghttab[elemnum] == 0)
+        continue;
+      wgtval = wghttab[elemnum] - wghtflg;
+      if (wgtval <= 0) {                          /* If element is a subset of new element */
+        wghttab[elemnum] = 0;                     /* Aggressive absorption                 */
+        stattab[elemnum] = HALLORDERHNSTATDEAD;
+        verttab[elemnum].fathnum = pivtnum;
+        continue;
+      }
+      listtab[listnew ++] = elemnum;
+      degrval += wgtval;
+      if (filltab != NULL)
+        felmval += (double) wgtval * (double) (2 * verttab[elemnum].degrval - wgtval - 1);
+      hashval += elemnum;
+      if (hashval >= vertnbr)
+        hashval -= vertnbr;
+    }
+    elemnew = listnew;
+    fvarval = (double) degrval;
+    for (listnbr = verttab[vertnum].lstnbr; listnum < listnbr; listnum ++) {
+      Gnum                vertend;
+      byte                statval;
+
+      vertend = listtab[listnum];
+      statval = stattab[vertend];
+      if (((statval != HALLORDERHNSTATVAR) && (statval != HALLORDERHNSTATHALO)) ||
+          (marktab[vertend] == mrkval))           /* Variables of new element are reached through it */
+        continue;
+      listtab[listnew ++] = vertend;
+      degrval += nvtab[vertend];
+      hashval += vertend;
+      if (hashval >= vertnbr)
+        hashval -= vertnbr;
+    }
+#ifdef SCOTCH_DEBUG_HALL2
+    if (listnew >= listnbr) {                     /* At least the pivot or one absorbed element must have been removed */
+      errorPrint ("hallOrderHnElim2: internal error");
+      return;
+    }
+#endif /* SCOTCH_DEBUG_HALL2 */
+    if (listnew > elemnew)                        /* Make room for new element after other elements */
+      listtab[listnew] = listtab[elemnew];
+    listtab[elemnew] = pivtnum;
+    verttab[vertnum].elemnbr = elemnew + 1;
+    verttab[vertnum].lstnbr  = listnew + 1;
+
+    if (degrval == 0) {                           /* Mass elimination */
+      nvtab[pivtnum] += nvval;
+      nvtab[vertnum]  = 0;
+      verttab[pivtnum].degrval -= nvval;
+      verttab[vertnum].fathnum  = pivtnum;
+      stattab[vertnum] = HALLORDERHNSTATDEAD;
+      dataptr->nleft -= nvval;
+      dataptr->varinbr --;
+      continue;
+    }
+
+    if (filltab != NULL) {
+      fvarval = (double) degrval - fvarval;
+      filltab[vertnum] = (degrval > verttab[vertnum].degrval) /* If approximate degree is loose, fill area cannot be subtracted */
+                         ? 0.0 : (felmval + 2.0 * (double) nvval * fvarval);
+    }
+    if (degrval > verttab[vertnum].degrval)       /* Degree bound is finalized once super-variables are merged */
+      degrval = verttab[vertnum].degrval;
+    verttab[vertnum].degrval = degrval;
+
+    linktab[vertnum].keyval  = hashval;           /* Link variable in its hash list */
+    linktab[vertnum].nextnum = hashtab[hashval];
+    hashtab[hashval] = vertnum;
+  }
+}
+
+/* This routine merges the variables of the
+** new element which have identical lists
+** into super-variables, and puts back the
+** remaining principal variables in the
+** buckets, with their final degrees. Lists
+** of a same hash list are compared by marking
+** the vertices of the first one.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHnElim3 (
+HallOrderHnData * restrict const  dataptr,
+const Gnum                        pivtnum,
+const Gnum                        lpvtnbr)
+{
+  Gnum                lpvtnum;
+  Gnum                wghtval;
+
+  HallOrderHnVert * restrict const        verttab = dataptr->verttab;
+  HallOrderHnLink * restrict const        linktab = dataptr->linktab;
+  Gnum * restrict const                   marktab = dataptr->marktab;
+  Gnum * restrict const                   nvtab   = dataptr->nvtab;
+  double * restrict const                 filltab = dataptr->filltab;
+  byte * restrict const                   stattab = dataptr->stattab;
+  Gnum * restrict const                   hashtab = dataptr->hashtab;
+  const Gnum * restrict const             lpvttab = dataptr->lpvttab;
+  const Gnum * restrict const             iwtab   = dataptr->iwtab;
+  const Gnum                              nleft   = dataptr->nleft;
+
+  for (lpvtnum = 0; lpvtnum < lpvtnbr; lpvtnum ++) {
+    Gnum                vertnum;
+    Gnum                hashval;
+
+    vertnum = lpvttab[lpvtnum];
+    if (stattab[vertnum] != HALLORDERHNSTATVAR)
+      continue;
+    hashval = linktab[vertnum].keyval;
+    if (hashtab[hashval] == -1)                   /* If hash list already processed */
+      continue;
+
+    for (vertnum = hashtab[hashval], hashtab[hashval] = -1; vertnum != -1; vertnum = linktab[vertnum].nextnum) {
+      const Gnum * restrict listtab;
+      Gnum                  listnum;
+      Gnum                  listnbr;
+      Gnum                  vertend;
+      Gnum                  mrkval;
+
+      if (stattab[vertnum] != HALLORDERHNSTATVAR) /* If variable already merged */
+        continue;
+      if (linktab[vertnum].nextnum == -1)         /* If no other variable to compare with */
+        break;
+
+      mrkval  = hallOrderHnMark (dataptr);
+      listtab = iwtab + verttab[vertnum].lstnum;
+      listnbr = verttab[vertnum].lstnbr;
+      for (listnum = 0; listnum < listnbr; listnum ++)
+        marktab[listtab[listnum]] = mrkval;
+
+      for (vertend = linktab[vertnum].nextnum; vertend != -1; vertend = linktab[vertend].nextnum) {
+        const Gnum * restrict listtnd;
+
+        if ((stattab[vertend] != HALLORDERHNSTATVAR) ||
+            (verttab[vertend].lstnbr  != listnbr)    ||
+            (verttab[vertend].elemnbr != verttab[vertnum].elemnbr))
+          continue;
+
+        listtnd = iwtab + verttab[vertend].lstnum;
+        for (listnum = 0; listnum < listnbr; listnum ++) {
+          if (marktab[listtnd[listnum]] != mrkval)
+            break;
+        }
+        if (listnum < listnbr)                    /* If lists differ */
+          continue;
+
+        if ((filltab != NULL) && (filltab[vertend] > filltab[vertnum]))
+          filltab[vertnum] = filltab[vertend];
+        nvtab[vertnum] += nvtab[vertend];         /* Merge variable into super-variable */
+        nvtab[vertend]  = 0;
+        stattab[vertend] = HALLORDERHNSTATDEAD;
+        verttab[vertend].fathnum = vertnum;
+        dataptr->varinbr --;
+      }
+    }
+  }
+
+  wghtval = verttab[pivtnum].degrval;
+  for (lpvtnum = 0; lpvtnum < lpvtnbr; lpvtnum ++) { /* Put principal variables back in buckets */
+    Gnum                vertnum;
+    Gnum                nvval;
+    Gnum                degrval;
+    double              scorval;
+
+    vertnum = lpvttab[lpvtnum];
+    if (stattab[vertnum] != HALLORDERHNSTATVAR)
+      continue;
+
+    nvval   = nvtab[vertnum];
+    degrval = verttab[vertnum].degrval;
+    if ((degrval + wghtval) > nleft) {
+      if (filltab != NULL) {                      /* Fill score of the HAMF code */
+        double              scortmp;
+        double              degrtmp;
+
+        degrtmp = (double) (nleft - nvval);
+        scortmp = (double) degrval * (double) (degrval - 1 + 2 * wghtval) - filltab[vertnum];
+        scorval = degrtmp * (degrtmp - 1.0) - (double) (wghtval - nvval) * (double) (wghtval - nvval - 1);
+        if (scorval > scortmp)
+          scorval = scortmp;
+      }
+      degrval = nleft - nvval;
+    }
+    else {
+      if (filltab != NULL)
+        scorval = (double) degrval * (double) (degrval - 1 + 2 * wghtval) - filltab[vertnum];
+      degrval += wghtval - nvval;
+    }
+    if (filltab != NULL) {
+      scorval /= (double) (nvval + 1);
+      if (scorval < 1.0)
+        scorval = 1.0;
+      filltab[vertnum] = scorval;
+    }
+    else
+      scorval = (double) degrval;
+
+    verttab[vertnum].degrval = degrval;
+    linktab[vertnum].keyval  = -1;
+    hallOrderHnBuckAdd (dataptr, vertnum, hallOrderHnKey (dataptr, scorval));
+  }
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine computes a halo approximate
+** minimum degree or minimum fill ordering of
+** the quotient graph described by the HAMD
+** input arrays, as filled by the hgraphOrderHxFill()
+** and hmeshOrderHxFill() routines. On output,
+** nvtab and petab hold the assembly tree in
+** the same format as the one produced by the
+** hallOrderHpHamd() routine.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+int
+hallOrderHnHamd (
+const Gnum                    vertnbr,            /*+ Number of variables and elements          +*/
+Gnum * restrict const         petab,              /*+ Start of adjacency lists; assembly tree   +*/
+const Gnum * restrict const   lentab,             /*+ Lengths of adjacency lists                +*/
+const Gnum * restrict const   iwtab,              /*+ Adjacency array (base 1)                  +*/
+Gnum * restrict const         nvtab,              /*+ Variable weights; front sizes             +*/
+const Gnum * restrict const   elentab,            /*+ Element flag array                        +*/
+const HallOrderHnType         typeval)            /*+ Score type                                +*/
+{
+  HallOrderHnData           datadat;
+  HallOrderHnVert * restrict verttab;
+  Gnum                      vertnum;
+  Gnum                      edgesum;
+  Gnum                      iwnnd;
+
+  for (vertnum = 0, edgesum = 0, datadat.nleft = 0; vertnum < vertnbr; vertnum ++) {
+    if (elentab[vertnum] == - (vertnbr + 1))      /* If element */
+      edgesum += lentab[vertnum];
+    else if (lentab[vertnum] >= 0) {              /* If non-halo variable */
+      edgesum += lentab[vertnum];
+      datadat.nleft += nvtab[vertnum];
+    }
+    else                                          /* Halo variable */
+      datadat.nleft += nvtab[vertnum];
+  }
+
+  datadat.vertnbr = vertnbr;
+  datadat.typeval = typeval;
+  datadat.keymax  = 2 * datadat.nleft;
+  datadat.keystp  = datadat.nleft;
+  datadat.keypas  = MAX (datadat.nleft / 8, 1);
+  datadat.keymin  = 0;
+  datadat.mrkval  = 0;
+  datadat.wghtflg = 2;
+  datadat.nvtab   = nvtab;
+
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.verttab, (size_t) (vertnbr              * sizeof (HallOrderHnVert)),
+                     &datadat.linktab, (size_t) (vertnbr              * sizeof (HallOrderHnLink)),
+                     &datadat.marktab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.wghttab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.headtab, (size_t) ((datadat.keymax + 1) * sizeof (Gnum)),
+                     &datadat.hashtab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.lpvttab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.filltab, (size_t) (((typeval == HALLORDERHNTYPEFILL) ? vertnbr : 0) * sizeof (double)),
+                     &datadat.iwtab,   (size_t) (edgesum              * sizeof (Gnum)),
+                     &datadat.stattab, (size_t) (vertnbr              * sizeof (byte)), NULL) == NULL) {
+    errorPrint ("hallOrderHnHamd: out of memory");
+    return     (1);
+  }
+  verttab = datadat.verttab;
+  if (typeval != HALLORDERHNTYPEFILL)
+    datadat.filltab = NULL;
+
+  memSet (datadat.linktab, ~0, vertnbr * sizeof (HallOrderHnLink));
+  memSet (datadat.marktab, 0,  vertnbr * sizeof (Gnum));
+  memSet (datadat.headtab, ~0, (datadat.keymax + 1) * sizeof (Gnum));
+  memSet (datadat.hashtab, ~0, vertnbr * sizeof (Gnum));
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Set vertex states */
+    if (elentab[vertnum] == - (vertnbr + 1)) {
+      datadat.stattab[vertnum] = HALLORDERHNSTATELEM;
+      nvtab[vertnum] = 0;                         /* Elements are not variables */
+    }
+    else
+      datadat.stattab[vertnum] = (lentab[vertnum] >= 0) ? HALLORDERHNSTATVAR : HALLORDERHNSTATHALO;
+  }
+
+  for (vertnum = 0, iwnnd = 0, datadat.varinbr = 0; /* Copy lists, with elements first for variables */
+       vertnum < vertnbr; vertnum ++) {
+    const Gnum * restrict iwlsttab;
+    Gnum                  listnum;
+    Gnum                  listnbr;
+    Gnum                  wghtval;
+
+    verttab[vertnum].lstnum  = iwnnd;
+    verttab[vertnum].elemnbr = 0;
+    verttab[vertnum].degrval = 0;
+    verttab[vertnum].segnnum = -1;
+    verttab[vertnum].segennd = vertnum;
+    verttab[vertnum].fathnum = -1;
+    datadat.wghttab[vertnum] = 1;                 /* All elements are live */
+    if (datadat.stattab[vertnum] != HALLORDERHNSTATHALO) { /* Halo variable lists are never used */
+      iwlsttab = iwtab + petab[vertnum] - 1;
+      listnbr  = lentab[vertnum];
+      if (datadat.stattab[vertnum] == HALLORDERHNSTATELEM) {
+        for (listnum = 0, wghtval = 0; listnum < listnbr; listnum ++) {
+          Gnum                vertend;
+
+          vertend = iwlsttab[listnum] - 1;
+          datadat.iwtab[iwnnd ++] = vertend;
+          wghtval += nvtab[vertend];
+        }
+        verttab[vertnum].degrval = wghtval;
+      }
+      else {
+        datadat.varinbr ++;
+        for (listnum = 0; listnum < listnbr; listnum ++) {
+          if (datadat.stattab[iwlsttab[listnum] - 1] == HALLORDERHNSTATELEM)
+            datadat.iwtab[iwnnd ++] = iwlsttab[listnum] - 1;
+        }
+        verttab[vertnum].elemnbr = iwnnd - verttab[vertnum].lstnum;
+        for (listnum = 0; listnum < listnbr; listnum ++) {
+          if (datadat.stattab[iwlsttab[listnum] - 1] != HALLORDERHNSTATELEM)
+            datadat.iwtab[iwnnd ++] = iwlsttab[listnum] - 1;
+        }
+      }
+    }
+    verttab[vertnum].lstnbr =
+    verttab[vertnum].lstsiz = iwnnd - verttab[vertnum].lstnum;
+  }
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Compute initial degrees and keys */
+    const Gnum * restrict listtab;
+    Gnum                  listnum;
+    Gnum                  listnnd;
+    Gnum                  nvval;
+    Gnum                  degrval;
+
+    if (datadat.stattab[vertnum] != HALLORDERHNSTATVAR)
+      continue;
+
+    nvval   = nvtab[vertnum];
+    listtab = datadat.iwtab + verttab[vertnum].lstnum;
+    listnnd = verttab[vertnum].elemnbr;
+    for (listnum = degrval = 0; listnum < listnnd; listnum ++)
+      degrval += verttab[listtab[listnum]].degrval - nvval;
+    for (listnnd = verttab[vertnum].lstnbr; listnum < listnnd; listnum ++)
+      degrval += nvtab[listtab[listnum]];
+    if (degrval > (datadat.nleft - nvval))
+      degrval = datadat.nleft - nvval;
+
+    verttab[vertnum].degrval = degrval;
+    if (datadat.filltab != NULL)                  /* Initial fill score is the degree, as in the HAMF code */
+      datadat.filltab[vertnum] = (double) degrval;
+    hallOrderHnBuckAdd (&datadat, vertnum, hallOrderHnKey (&datadat, (double) degrval));
+  }
+
+  while (datadat.varinbr > 0) {                   /* Eliminate pivots one at a time */
+    Gnum                pivtnum;
+    Gnum                lpvtnbr;
+
+    while (datadat.headtab[datadat.keymin] == -1)
+      datadat.keymin ++;
+    pivtnum = datadat.headtab[datadat.keymin];
+    hallOrderHnBuckDel (&datadat, pivtnum);
+
+    lpvtnbr = hallOrderHnElim1 (&datadat, pivtnum);
+    hallOrderHnElim2 (&datadat, pivtnum, lpvtnbr);
+    hallOrderHnElim3 (&datadat, pivtnum, lpvtnbr);
+  }
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Build assembly tree of principal variables */
+    Gnum                fathnum;
+
+    if ((datadat.stattab[vertnum] == HALLORDERHNSTATHALO) ||
+        (nvtab[vertnum] == 0))
+      continue;
+
+    fathnum = verttab[vertnum].fathnum;
+    petab[vertnum] = (fathnum >= 0) ? (- (fathnum + 1)) : 0;
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Link secondary variables to their principal variables */
+    Gnum                fathnum;
+
+    if ((datadat.stattab[vertnum] == HALLORDERHNSTATHALO) ||
+        (nvtab[vertnum] != 0))
+      continue;
+
+    for (fathnum = verttab[vertnum].fathnum; (fathnum >= 0) && (nvtab[fathnum] == 0); fathnum = verttab[fathnum].fathnum) ;
+    petab[vertnum] = (fathnum >= 0) ? (- (fathnum + 1)) : 0;
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Set front sizes of principal variables */
+    if ((datadat.stattab[vertnum] != HALLORDERHNSTATHALO) &&
+        (nvtab[vertnum] != 0))
+      nvtab[vertnum] += verttab[vertnum].degrval;
+  }
+
+  memFree (datadat.verttab);                      /* Free group leader */
+
+  return (0);
+}
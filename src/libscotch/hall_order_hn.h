@@ -0,0 +1,149 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hall_order_hn.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the native sequential Halo          **/
+/**                Approximate Minimum Degree and Minimum  **/
+/**                Fill ordering routine.                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Vertex states. +*/
+
+#define HALLORDERHNSTATVAR          0             /*+ Live variable                       +*/
+#define HALLORDERHNSTATHALO         1             /*+ Halo variable, never eliminated     +*/
+#define HALLORDERHNSTATELEM         2             /*+ Live element                        +*/
+#define HALLORDERHNSTATDEAD         3             /*+ Absorbed element or merged variable +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Ordering kernel types, for the methods
+    which can use either the original HAMD
+    and HAMF codes or the native kernel.   +*/
+
+typedef enum HallOrderHnKern_ {
+  HALLORDERHNKERNHAMD = 0,                        /*+ Original HAMD or HAMF code +*/
+  HALLORDERHNKERNNATV                             /*+ Native kernel              +*/
+} HallOrderHnKern;
+
+/*+ Ordering score types. +*/
+
+typedef enum HallOrderHnType_ {
+  HALLORDERHNTYPEDEG = 0,                         /*+ Approximate minimum degree +*/
+  HALLORDERHNTYPEFILL                             /*+ Approximate minimum fill   +*/
+} HallOrderHnType;
+
+/*+ The vertex structure. All the data
+    accessed when scanning a vertex are
+    kept in the same record. The list of
+    an element may span several segments,
+    which are chained through the segnnum
+    field, starting from its own segment.  +*/
+
+typedef struct HallOrderHnVert_ {
+  Gnum                      lstnum;               /*+ Start index of own list segment          +*/
+  Gnum                      lstsiz;               /*+ Size of own list segment                 +*/
+  Gnum                      lstnbr;               /*+ Length of list                           +*/
+  Gnum                      elemnbr;              /*+ Number of elements in variable list      +*/
+  Gnum                      degrval;              /*+ Degree of variable or weight of element  +*/
+  Gnum                      segnnum;              /*+ Vertex owning next list segment, or -1   +*/
+  Gnum                      segennd;              /*+ Vertex owning last list segment          +*/
+  Gnum                      fathnum;              /*+ Father in assembly tree, or -1           +*/
+} HallOrderHnVert;
+
+/*+ The bucket link structure. +*/
+
+typedef struct HallOrderHnLink_ {
+  Gnum                      prevnum;              /*+ Previous variable in bucket     +*/
+  Gnum                      nextnum;              /*+ Next variable in bucket or hash +*/
+  Gnum                      keyval;               /*+ Bucket key or hash value, or -1 +*/
+} HallOrderHnLink;
+
+/*+ The ordering data block. All lists
+    are stored in the same adjacency array,
+    which is never compacted: element lists
+    re-use the segments of the elements
+    they absorb.                            +*/
+
+typedef struct HallOrderHnData_ {
+  Gnum                      vertnbr;              /*+ Number of vertices (variables and elements) +*/
+  HallOrderHnType           typeval;              /*+ Score type                                  +*/
+  Gnum                      varinbr;              /*+ Number of live non-halo principal variables +*/
+  Gnum                      nleft;                /*+ Weight of not yet eliminated variables      +*/
+  Gnum                      keymax;               /*+ Maximum bucket key                          +*/
+  Gnum                      keystp;               /*+ Score above which buckets are shared        +*/
+  Gnum                      keypas;               /*+ Range of scores of shared buckets           +*/
+  Gnum                      keymin;               /*+ Current lower bound of bucket keys          +*/
+  Gnum                      mrkval;               /*+ Current mark value                          +*/
+  Gnum                      wghtflg;              /*+ Current external weight flag value          +*/
+  HallOrderHnVert *         verttab;              /*+ Vertex array                                +*/
+  HallOrderHnLink *         linktab;              /*+ Bucket link array                           +*/
+  Gnum *                    marktab;              /*+ Mark array                                  +*/
+  Gnum *                    wghttab;              /*+ Element external weight array; 0 if dead    +*/
+  Gnum *                    nvtab;                /*+ Variable weights; 0 if merged               +*/
+  byte *                    stattab;              /*+ Vertex state                                +*/
+  Gnum *                    headtab;              /*+ Bucket heads                                +*/
+  Gnum *                    hashtab;              /*+ Super-variable hash heads                   +*/
+  Gnum *                    lpvttab;              /*+ Work array for new element lists            +*/
+  double *                  filltab;              /*+ Fill area or score of variables, or NULL    +*/
+  Gnum *                    iwtab;                /*+ Adjacency array                             +*/
+} HallOrderHnData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_HALL_ORDER_HN
+static void                 hallOrderHnBuckDel  (HallOrderHnData * restrict const, const Gnum);
+static void                 hallOrderHnBuckAdd  (HallOrderHnData * restrict const, const Gnum, const Gnum);
+static Gnum                 hallOrderHnKey      (const HallOrderHnData * restrict const, const double);
+static Gnum                 hallOrderHnMark     (HallOrderHnData * restrict const);
+static Gnum                 hallOrderHnElim1    (HallOrderHnData * restrict const, const Gnum);
+static void                 hallOrderHnElim2    (HallOrderHnData * restrict const, const Gnum, const Gnum);
+static void                 hallOrderHnElim3    (HallOrderHnData * restrict const, const Gnum, const Gnum);
+#endif /* SCOTCH_HALL_ORDER_HN */
+
+int                         hallOrderHnHamd     (const Gnum, Gnum * restrict const, const Gnum * restrict const, const Gnum * restrict const, Gnum * restrict const, const Gnum * restrict const, const HallOrderHnType);
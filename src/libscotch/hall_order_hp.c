@@ -0,0 +1,1205 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hall_order_hp.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes a multi-threaded   **/
+/**                Halo Approximate Minimum Degree or      **/
+/**                Minimum Fill ordering of a quotient     **/
+/**                graph. Rather than eliminating one      **/
+/**                pivot at a time, it selects, at each    **/
+/**                round, a set of low-score pivots whose  **/
+/**                reach sets are pairwise disjoint, and   **/
+/**                eliminates them concurrently.           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_HALL_ORDER_HP
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "hall_order_hp.h"
+
+/*********************************/
+/*                               */
+/* The bucket handling routines. */
+/*                               */
+/*********************************/
+
+/* These routines add and remove variables
+** from the score buckets. They are only
+** called by the first thread.
+*/
+
+static
+void
+hallOrderHpBuckDel (
+HallOrderHpData * restrict const  dataptr,
+const Gnum                        vertnum)
+{
+  Gnum                prevnum;
+  Gnum                nextnum;
+
+  if (dataptr->keytab[vertnum] < 0)               /* If variable not in buckets */
+    return;
+
+  prevnum = dataptr->prevtab[vertnum];
+  nextnum = dataptr->nexttab[vertnum];
+  if (prevnum != -1)
+    dataptr->nexttab[prevnum] = nextnum;
+  else
+    dataptr->headtab[dataptr->keytab[vertnum]] = nextnum;
+  if (nextnum != -1)
+    dataptr->prevtab[nextnum] = prevnum;
+  dataptr->keytab[vertnum] = -1;
+}
+
+static
+void
+hallOrderHpBuckAdd (
+HallOrderHpData * restrict const  dataptr,
+const Gnum                        vertnum,
+const Gnum                        keyval)
+{
+  Gnum                nextnum;
+
+  nextnum = dataptr->headtab[keyval];
+  dataptr->nexttab[vertnum] = nextnum;
+  dataptr->prevtab[vertnum] = -1;
+  if (nextnum != -1)
+    dataptr->prevtab[nextnum] = vertnum;
+  dataptr->headtab[keyval]  = vertnum;
+  dataptr->keytab[vertnum]  = keyval;
+  if (keyval < dataptr->keymin)
+    dataptr->keymin = keyval;
+}
+
+/* This routine computes the bucket key
+** of a variable from its approximate
+** degree and from the size of the
+** largest clique it already belongs to.
+** It returns:
+** - the key value : in all cases.
+*/
+
+static
+Gnum
+hallOrderHpKey (
+const HallOrderHpData * restrict const  dataptr,
+const Gnum                              degrval,
+Gnum                                    clqeval)
+{
+  double              fillval;
+
+  if (dataptr->typeval == HALLORDERHPTYPEDEG)
+    return (degrval);
+
+  if (clqeval > degrval)
+    clqeval = degrval;
+  fillval = ((double) degrval * (double) (degrval - 1) - (double) clqeval * (double) (clqeval - 1)) * 0.5;
+  return ((fillval >= (double) dataptr->keymax) ? dataptr->keymax : (Gnum) fillval);
+}
+
+/************************************/
+/*                                  */
+/* The pivot selection routines.    */
+/*                                  */
+/************************************/
+
+/* This routine raises, if needed, the
+** priority value of the given variable.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHpPrir (
+Gnum * const                prirptr,
+const Gnum                  prirval)
+{
+#ifndef HALLORDERHPNOTHREAD
+  Gnum                prirold;
+
+  while ((prirold = *((volatile Gnum *) prirptr)) < prirval) {
+    if (__sync_bool_compare_and_swap (prirptr, prirold, prirval))
+      break;
+  }
+#else /* HALLORDERHPNOTHREAD */
+  if (*prirptr < prirval)
+    *prirptr = prirval;
+#endif /* HALLORDERHPNOTHREAD */
+}
+
+/* This routine traverses the reach set of a
+** candidate pivot, that is, the candidate
+** itself and all the live non-halo variables
+** adjacent to it or to its elements. When
+** flagval is 0, it spreads the priority of
+** the candidate on its reach set. Else, it
+** checks that the candidate holds the maximum
+** priority over all its reach set, so that
+** the reach sets of winning candidates are
+** pairwise disjoint.
+** It returns:
+** - -1  : if candidate lost (check mode only).
+** - >=0 : upper bound on the size of the new
+**         element list of the candidate.
+*/
+
+static
+Gnum
+hallOrderHpReach (
+HallOrderHpData * restrict const  dataptr,
+const Gnum                        vertnum,
+const Gnum                        prirval,
+const int                         flagval)
+{
+  Gnum                listnum;
+  Gnum                listnnd;
+  Gnum                elemnnd;
+  Gnum                bndval;
+
+  const Gnum * restrict const iwtab   = dataptr->iwtab;
+  const Gnum * restrict const lsttab  = dataptr->lsttab;
+  const Gnum * restrict const lentab  = dataptr->lentab;
+  const byte * restrict const stattab = dataptr->stattab;
+  Gnum * const                prirtab = dataptr->prirtab;
+
+  listnum = lsttab[vertnum];
+  elemnnd = listnum + dataptr->elentab[vertnum];
+  listnnd = listnum + lentab[vertnum];
+  bndval  = listnnd - elemnnd;
+
+  if (flagval == 0)
+    hallOrderHpPrir (&prirtab[vertnum], prirval);
+  else if (prirtab[vertnum] != prirval)
+    return (-1);
+
+  for ( ; listnum < elemnnd; listnum ++) {
+    Gnum                elemnum;
+    Gnum                eelmnum;
+    Gnum                eelmnnd;
+
+    elemnum = iwtab[listnum];
+    if (stattab[elemnum] != HALLORDERHPSTATELEM)  /* Skip absorbed elements */
+      continue;
+
+    bndval += lentab[elemnum];
+    for (eelmnum = lsttab[elemnum], eelmnnd = eelmnum + lentab[elemnum];
+         eelmnum < eelmnnd; eelmnum ++) {
+      Gnum                vertend;
+
+      vertend = iwtab[eelmnum];
+      if (stattab[vertend] != HALLORDERHPSTATVAR)
+        continue;
+      if (flagval == 0)
+        hallOrderHpPrir (&prirtab[vertend], prirval);
+      else if (prirtab[vertend] != prirval)
+        return (-1);
+    }
+  }
+  for ( ; listnum < listnnd; listnum ++) {
+    Gnum                vertend;
+
+    vertend = iwtab[listnum];
+    if (stattab[vertend] != HALLORDERHPSTATVAR)
+      continue;
+    if (flagval == 0)
+      hallOrderHpPrir (&prirtab[vertend], prirval);
+    else if (prirtab[vertend] != prirval)
+      return (-1);
+  }
+
+  return (bndval);
+}
+
+/* This routine updates the buckets according
+** to the eliminations of the previous round,
+** and selects the candidate pivots of the
+** next round. It is only called by the
+** first thread.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHpSelect (
+HallOrderHpData * restrict const  dataptr,
+const Gnum                        candmax)
+{
+  Gnum                pivtnum;
+  Gnum                candnbr;
+  Gnum                keynum;
+  Gnum                keynnd;
+
+  const Gnum * restrict const iwtab   = dataptr->iwtab;
+  const byte * restrict const stattab = dataptr->stattab;
+
+  for (pivtnum = 0; pivtnum < dataptr->pivtnbr; pivtnum ++) {
+    Gnum                vertnum;
+    Gnum                listnum;
+    Gnum                listnnd;
+
+    vertnum = dataptr->pivttab[pivtnum];
+    hallOrderHpBuckDel (dataptr, vertnum);
+    dataptr->varinbr --;
+    dataptr->nleft -= dataptr->nvtab[vertnum];
+
+    for (listnum = dataptr->lsttab[vertnum], listnnd = listnum + dataptr->elentab[vertnum]; /* For all non-halo variables of new element */
+         listnum < listnnd; listnum ++) {
+      Gnum                vertend;
+
+      vertend = iwtab[listnum];
+      if (dataptr->keytab[vertend] < 0)           /* If variable already processed */
+        continue;
+      hallOrderHpBuckDel (dataptr, vertend);
+      if (stattab[vertend] == HALLORDERHPSTATDEAD) /* If variable merged in this round */
+        dataptr->varinbr --;
+      else
+        hallOrderHpBuckAdd (dataptr, vertend, dataptr->keyntab[vertend]);
+    }
+  }
+
+  if ((dataptr->varinbr <= 0) || (dataptr->abrtval != 0)) { /* If nothing left to do */
+    dataptr->candnbr = 0;
+    return;
+  }
+
+  while (dataptr->headtab[dataptr->keymin] == -1)
+    dataptr->keymin ++;
+  keynnd = dataptr->keymin + dataptr->keymin / HALLORDERHPRELAXDIV;
+  if (keynnd > dataptr->keymax)
+    keynnd = dataptr->keymax;
+  for (keynum = dataptr->keymin, candnbr = 0; keynum <= keynnd; keynum ++) {
+    Gnum                vertnum;
+
+    for (vertnum = dataptr->headtab[keynum]; vertnum != -1; vertnum = dataptr->nexttab[vertnum]) {
+      dataptr->candtab[candnbr ++] = vertnum;
+      if (candnbr >= candmax)
+        goto done;
+    }
+  }
+done :
+  if (dataptr->candbas > (GNUMMAX - 2 * (candmax + 1))) { /* If priority values may overflow */
+    memSet (dataptr->prirtab, ~0, dataptr->vertnbr * sizeof (Gnum)); /* Reset all priorities */
+    dataptr->candbas = 0;
+  }
+  dataptr->candbas += candnbr + 1;                /* Priorities of this round are above all previous ones */
+  dataptr->candnbr  = candnbr;
+}
+
+/* This routine compacts the adjacency
+** array when there is not enough space
+** left to store the new element lists.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+hallOrderHpCompact (
+HallOrderHpData * restrict const  dataptr,
+const Gnum                        needval)
+{
+  Gnum * restrict     iwnwtab;
+  Gnum                iwnwsiz;
+  Gnum                iwnwnnd;
+  Gnum                vertnum;
+
+  for (vertnum = 0, iwnwsiz = needval; vertnum < dataptr->vertnbr; vertnum ++) {
+    if ((dataptr->stattab[vertnum] == HALLORDERHPSTATVAR) ||
+        (dataptr->stattab[vertnum] == HALLORDERHPSTATELEM))
+      iwnwsiz += dataptr->lentab[vertnum];
+  }
+  iwnwsiz = (Gnum) ((double) iwnwsiz * HALLORDERHPCOMPRAT) + dataptr->vertnbr;
+
+  if ((iwnwtab = memAlloc (iwnwsiz * sizeof (Gnum))) == NULL) {
+    errorPrint ("hallOrderHpCompact: out of memory");
+    return     (1);
+  }
+
+  for (vertnum = 0, iwnwnnd = 0; vertnum < dataptr->vertnbr; vertnum ++) {
+    if ((dataptr->stattab[vertnum] == HALLORDERHPSTATVAR) ||
+        (dataptr->stattab[vertnum] == HALLORDERHPSTATELEM)) {
+      memCpy (iwnwtab + iwnwnnd, dataptr->iwtab + dataptr->lsttab[vertnum], dataptr->lentab[vertnum] * sizeof (Gnum));
+      dataptr->lsttab[vertnum] = iwnwnnd;
+      iwnwnnd += dataptr->lentab[vertnum];
+    }
+  }
+
+  memFree (dataptr->iwtab);
+  dataptr->iwtab = iwnwtab;
+  dataptr->iwsiz = iwnwsiz;
+  dataptr->iwnnd = iwnwnnd;
+
+  return (0);
+}
+
+/* This routine gathers the winning candidates
+** as pivots, and reserves space for their new
+** element lists. It is only called by the
+** first thread.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHpPivot (
+HallOrderHpData * restrict const  dataptr)
+{
+  Gnum                candnum;
+  Gnum                pivtnbr;
+  Gnum                pivtnum;
+  Gnum                needval;
+
+  for (candnum = pivtnbr = needval = 0; candnum < dataptr->candnbr; candnum ++) {
+    if (dataptr->cbndtab[candnum] >= 0) {
+      dataptr->pivttab[pivtnbr] = dataptr->candtab[candnum];
+      dataptr->pofftab[pivtnbr] = needval;
+      needval += dataptr->cbndtab[candnum];
+      pivtnbr ++;
+    }
+  }
+
+  if ((dataptr->iwnnd + needval) > dataptr->iwsiz) {
+    if (hallOrderHpCompact (dataptr, needval) != 0) {
+      dataptr->abrtval = 1;
+      dataptr->pivtnbr = 0;
+      return;
+    }
+  }
+
+  for (pivtnum = 0; pivtnum < pivtnbr; pivtnum ++)
+    dataptr->pofftab[pivtnum] += dataptr->iwnnd;
+  dataptr->iwnnd  += needval;
+  dataptr->pivtnbr = pivtnbr;
+}
+
+/******************************/
+/*                            */
+/* The elimination routines.  */
+/*                            */
+/******************************/
+
+/* This routine builds the list of the new
+** element of the given pivot, and absorbs
+** the elements adjacent to the pivot. The
+** list holds non-halo variables first, then
+** the sorted halo variables.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHpElim1 (
+HallOrderHpData * restrict const  dataptr,
+const Gnum                        pivtnum)
+{
+  Gnum                vertnum;
+  Gnum                listnum;
+  Gnum                listnnd;
+  Gnum                elemnnd;
+  Gnum                lpvtnbr;                    /* Number of non-halo variables in new element */
+  Gnum                lpvtnnd;                    /* End of new element list                     */
+  Gnum                lpvtsiz;
+  Gnum                lpvthal;
+  Gnum                wghtval;
+  Gnum *              lpvttab;                    /* Pointer to new element list, within iwtab   */
+
+  Gnum * const                iwtab   = dataptr->iwtab; /* [norestrict] because of lpvttab */
+  Gnum * restrict const       lsttab  = dataptr->lsttab;
+  Gnum * restrict const       lentab  = dataptr->lentab;
+  const Gnum * restrict const nvtab   = dataptr->nvtab;
+  Gnum * restrict const       owntab  = dataptr->owntab;
+  byte * restrict const       stattab = dataptr->stattab;
+
+  vertnum = dataptr->pivttab[pivtnum];
+  lpvttab = iwtab + dataptr->pofftab[pivtnum];
+
+  lpvtsiz = (pivtnum < (dataptr->pivtnbr - 1)) ? (dataptr->pofftab[pivtnum + 1] - dataptr->pofftab[pivtnum])
+                                                : (dataptr->iwnnd - dataptr->pofftab[pivtnum]);
+  lpvtnbr = 0;
+  lpvthal = lpvtsiz;                              /* Halo variables are temporarily put at the end */
+  wghtval = 0;
+
+  listnum = lsttab[vertnum];
+  elemnnd = listnum + dataptr->elentab[vertnum];
+  listnnd = listnum + lentab[vertnum];
+  for ( ; listnum < listnnd; listnum ++) {
+    Gnum                eelmnum;
+    Gnum                eelmnnd;
+
+    if (listnum < elemnnd) {                      /* If element of pivot */
+      Gnum                elemnum;
+
+      elemnum = iwtab[listnum];
+      if (stattab[elemnum] != HALLORDERHPSTATELEM)
+        continue;
+      stattab[elemnum] = HALLORDERHPSTATDEAD;     /* Element is absorbed by new element */
+      dataptr->fathtab[elemnum] = vertnum;
+      eelmnum = lsttab[elemnum];
+      eelmnnd = eelmnum + lentab[elemnum];
+    }
+    else {                                        /* Variable adjacent to pivot */
+      eelmnum = listnum;
+      eelmnnd = listnum + 1;
+    }
+
+    for ( ; eelmnum < eelmnnd; eelmnum ++) {
+      Gnum                vertend;
+
+      vertend = iwtab[eelmnum];
+      if (vertend == vertnum)
+        continue;
+      if (stattab[vertend] == HALLORDERHPSTATVAR) {
+        if (owntab[vertend] != vertnum) {         /* If variable not yet in new element */
+          owntab[vertend] = vertnum;
+          lpvttab[lpvtnbr ++] = vertend;
+          wghtval += nvtab[vertend];
+        }
+      }
+      else if (stattab[vertend] == HALLORDERHPSTATHALO)
+        lpvttab[-- lpvthal] = vertend;
+    }
+  }
+
+  intSort1asc1 (lpvttab + lpvthal, lpvtsiz - lpvthal); /* Remove duplicate halo variables */
+  for (lpvtnnd = lpvtnbr; lpvthal < lpvtsiz; lpvthal ++) {
+    Gnum                vertend;
+
+    vertend = lpvttab[lpvthal];
+    if ((lpvtnnd > lpvtnbr) && (lpvttab[lpvtnnd - 1] == vertend))
+      continue;
+    lpvttab[lpvtnnd ++] = vertend;
+    wghtval += nvtab[vertend];
+  }
+
+  lsttab[vertnum]           = lpvttab - iwtab;    /* Pivot becomes new element */
+  lentab[vertnum]           = lpvtnnd;
+  dataptr->elentab[vertnum] = lpvtnbr;            /* For elements, number of non-halo variables */
+  dataptr->degrtab[vertnum] = wghtval;            /* For elements, weight of variables          */
+  stattab[vertnum]          = HALLORDERHPSTATELEM;
+}
+
+/* This routine updates the lists of the
+** non-halo variables of the new element of
+** the given pivot: absorbed elements and
+** variables of the new element are removed,
+** and the new element is added.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHpElim2 (
+HallOrderHpData * restrict const  dataptr,
+const Gnum                        pivtnum)
+{
+  Gnum                vertnum;
+  Gnum                lpvtnum;
+  Gnum                lpvtnnd;
+
+  Gnum * restrict const       iwtab   = dataptr->iwtab;
+  Gnum * restrict const       elentab = dataptr->elentab;
+  Gnum * restrict const       lentab  = dataptr->lentab;
+  const Gnum * restrict const owntab  = dataptr->owntab;
+  const byte * restrict const stattab = dataptr->stattab;
+
+  vertnum = dataptr->pivttab[pivtnum];
+  for (lpvtnum = dataptr->lsttab[vertnum], lpvtnnd = lpvtnum + elentab[vertnum];
+       lpvtnum < lpvtnnd; lpvtnum ++) {
+    Gnum                vertend;
+    Gnum                listnum;
+    Gnum                listnnd;
+    Gnum                listbas;
+    Gnum                listnew;
+    Gnum                elennew;
+
+    vertend = iwtab[lpvtnum];
+    listbas = dataptr->lsttab[vertend];
+    listnnd = listbas + lentab[vertend];
+    for (listnum = listnew = listbas; listnum < listbas + elentab[vertend]; listnum ++) {
+      Gnum                elemnum;
+
+      elemnum = iwtab[listnum];
+      if (stattab[elemnum] == HALLORDERHPSTATELEM)
+        iwtab[listnew ++] = elemnum;
+    }
+    elennew = listnew - listbas;
+    for ( ; listnum < listnnd; listnum ++) {
+      Gnum                vertadj;
+
+      vertadj = iwtab[listnum];
+      if ((stattab[vertadj] == HALLORDERHPSTATHALO) ||
+          ((stattab[vertadj] == HALLORDERHPSTATVAR) && (owntab[vertadj] != vertnum)))
+        iwtab[listnew ++] = vertadj;
+    }
+
+#ifdef SCOTCH_DEBUG_ORDER2
+    if (listnew >= listnnd) {                     /* At least one element or adjacent pivot must have been removed */
+      errorPrint ("hallOrderHpElim2: internal error");
+      dataptr->abrtval = 1;
+      return;
+    }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+
+    if (listnew > (listbas + elennew))            /* Move first variable to end to make room for new element */
+      iwtab[listnew] = iwtab[listbas + elennew];
+    iwtab[listbas + elennew] = vertnum;
+    lentab[vertend]  = listnew + 1 - listbas;
+    elentab[vertend] = elennew + 1;
+  }
+}
+
+/* This routine checks whether the lists
+** of two variables are identical. Lists
+** must have been sorted beforehand.
+** It returns:
+** - 0   : if lists differ.
+** - !0  : if lists are identical.
+*/
+
+static
+int
+hallOrderHpSame (
+const HallOrderHpData * restrict const  dataptr,
+const Gnum                              vertnum,
+const Gnum                              vertend)
+{
+  if ((dataptr->lentab[vertnum]  != dataptr->lentab[vertend]) ||
+      (dataptr->elentab[vertnum] != dataptr->elentab[vertend]))
+    return (0);
+
+  return (memcmp (dataptr->iwtab + dataptr->lsttab[vertnum],
+                  dataptr->iwtab + dataptr->lsttab[vertend],
+                  dataptr->lentab[vertnum] * sizeof (Gnum)) == 0);
+}
+
+/* This routine detects indistinguishable
+** variables within the new element of the
+** given pivot, and merges them into super-
+** variables.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHpElim3 (
+HallOrderHpData * restrict const    dataptr,
+HallOrderHpThread * restrict const  thrdptr,
+const Gnum                          pivtnum)
+{
+  Gnum                vertnum;
+  Gnum                lpvtbas;
+  Gnum                lpvtnbr;
+  Gnum                sortnum;
+  Gnum                sortnnd;
+  Gnum * restrict     sorttab;
+
+  Gnum * restrict const       iwtab   = dataptr->iwtab;
+  const Gnum * restrict const lsttab  = dataptr->lsttab;
+  const Gnum * restrict const lentab  = dataptr->lentab;
+  const Gnum * restrict const elentab = dataptr->elentab;
+  Gnum * restrict const       nvtab   = dataptr->nvtab;
+
+  vertnum = dataptr->pivttab[pivtnum];
+  lpvtbas = lsttab[vertnum];
+  lpvtnbr = elentab[vertnum];
+  if (lpvtnbr < 2)                                /* No possible merge */
+    return;
+
+  if (thrdptr->sortsiz < lpvtnbr) {               /* If sort array too small */
+    Gnum * restrict     sorttmp;
+
+    if ((sorttmp = memAlloc (lpvtnbr * 2 * sizeof (Gnum))) == NULL) {
+      errorPrint ("hallOrderHpElim3: out of memory");
+      dataptr->abrtval = 1;
+      return;
+    }
+    if (thrdptr->sorttab != NULL)
+      memFree (thrdptr->sorttab);
+    thrdptr->sorttab = sorttmp;
+    thrdptr->sortsiz = lpvtnbr;
+  }
+  sorttab = thrdptr->sorttab;
+
+  for (sortnum = 0; sortnum < lpvtnbr; sortnum ++) {
+    Gunum               hashval;
+    Gnum                vertend;
+    Gnum                listnum;
+    Gnum                listnnd;
+
+    vertend = iwtab[lpvtbas + sortnum];
+    for (listnum = lsttab[vertend], listnnd = listnum + lentab[vertend], hashval = (Gunum) lentab[vertend];
+         listnum < listnnd; listnum ++)
+      hashval += (Gunum) iwtab[listnum];
+    sorttab[2 * sortnum]     = (Gnum) (hashval & (Gunum) GNUMMAX);
+    sorttab[2 * sortnum + 1] = vertend;
+  }
+  intSort2asc2 (sorttab, lpvtnbr);
+
+  for (sortnum = 0; sortnum < lpvtnbr; sortnum = sortnnd) {
+    Gnum                sorttmp;
+
+    for (sortnnd = sortnum + 1; (sortnnd < lpvtnbr) && (sorttab[2 * sortnnd] == sorttab[2 * sortnum]); sortnnd ++) ;
+    if ((sortnnd - sortnum) < 2)                  /* If no candidate for merging */
+      continue;
+
+    for (sorttmp = sortnum; sorttmp < sortnnd; sorttmp ++) { /* Sort lists of candidates for comparison */
+      Gnum                vertend;
+
+      vertend = sorttab[2 * sorttmp + 1];
+      intSort1asc1 (iwtab + lsttab[vertend], elentab[vertend]);
+      intSort1asc1 (iwtab + lsttab[vertend] + elentab[vertend], lentab[vertend] - elentab[vertend]);
+    }
+    for ( ; sortnum < sortnnd; sortnum ++) {
+      Gnum                vertend;
+
+      vertend = sorttab[2 * sortnum + 1];
+      if (nvtab[vertend] == 0)                    /* If variable already merged */
+        continue;
+      for (sorttmp = sortnum + 1; sorttmp < sortnnd; sorttmp ++) {
+        Gnum                vertmrg;
+
+        vertmrg = sorttab[2 * sorttmp + 1];
+        if ((nvtab[vertmrg] == 0) ||
+            (hallOrderHpSame (dataptr, vertend, vertmrg) == 0))
+          continue;
+
+        nvtab[vertend] += nvtab[vertmrg];         /* Merge variable into super-variable */
+        nvtab[vertmrg]  = 0;
+        dataptr->fathtab[vertmrg] = vertend;
+        dataptr->stattab[vertmrg] = HALLORDERHPSTATDEAD;
+      }
+    }
+  }
+}
+
+/* This routine computes the approximate
+** degrees and the new keys of the non-halo
+** variables of the new element of the given
+** pivot, and performs aggressive absorption
+** of elements contained in the new element.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHpElim4 (
+HallOrderHpData * restrict const    dataptr,
+HallOrderHpThread * restrict const  thrdptr,
+const Gnum                          pivtnum)
+{
+  Gnum                vertnum;
+  Gnum                lpvtbas;
+  Gnum                lpvtnbr;
+  Gnum                lpvtnum;
+  Gnum                lpvtnnd;
+  Gnum                lpvtwgt;
+  Gnum                hashnbr;
+  Gnum                hashmsk;
+  HallOrderHpHash * restrict  hashtab;
+
+  const Gnum * restrict const iwtab   = dataptr->iwtab;
+  const Gnum * restrict const lsttab  = dataptr->lsttab;
+  const Gnum * restrict const lentab  = dataptr->lentab;
+  const Gnum * restrict const elentab = dataptr->elentab;
+  const Gnum * restrict const nvtab   = dataptr->nvtab;
+  Gnum * restrict const       degrtab = dataptr->degrtab;
+  byte * restrict const       stattab = dataptr->stattab;
+
+  vertnum = dataptr->pivttab[pivtnum];
+  lpvtbas = lsttab[vertnum];
+  lpvtnbr = elentab[vertnum];
+  lpvtnnd = lpvtbas + lentab[vertnum];            /* Halo variables are in [lpvtbas + lpvtnbr, lpvtnnd) */
+  lpvtwgt = degrtab[vertnum];
+
+  for (lpvtnum = 0, hashnbr = 0; lpvtnum < lpvtnbr; lpvtnum ++) {
+    Gnum                vertend;
+
+    vertend = iwtab[lpvtbas + lpvtnum];
+    if (nvtab[vertend] != 0)
+      hashnbr += elentab[vertend];
+  }
+  for (hashmsk = 15; hashmsk < (2 * hashnbr); hashmsk = hashmsk * 2 + 1) ;
+  if (hashmsk > thrdptr->hashmsk) {               /* If hash table too small */
+    HallOrderHpHash * restrict  hashtmp;
+
+    if ((hashtmp = memAlloc ((hashmsk + 1) * sizeof (HallOrderHpHash))) == NULL) {
+      errorPrint ("hallOrderHpElim4: out of memory");
+      dataptr->abrtval = 1;
+      return;
+    }
+    if (thrdptr->hashtab != NULL)
+      memFree (thrdptr->hashtab);
+    memSet (hashtmp, ~0, (hashmsk + 1) * sizeof (HallOrderHpHash));
+    thrdptr->hashtab = hashtmp;
+    thrdptr->hashmsk = hashmsk;
+  }
+  hashtab = thrdptr->hashtab;
+  hashmsk = thrdptr->hashmsk;
+
+  for (lpvtnum = lpvtbas; lpvtnum < lpvtbas + lpvtnbr; lpvtnum ++) { /* Compute weights of elements within new element */
+    Gnum                vertend;
+    Gnum                listnum;
+    Gnum                listnnd;
+
+    vertend = iwtab[lpvtnum];
+    if (nvtab[vertend] == 0)                      /* Skip merged variables */
+      continue;
+
+    for (listnum = lsttab[vertend], listnnd = listnum + elentab[vertend];
+         listnum < listnnd; listnum ++) {
+      Gnum                elemnum;
+      Gnum                hashnum;
+
+      elemnum = iwtab[listnum];
+      if ((elemnum == vertnum) || (stattab[elemnum] != HALLORDERHPSTATELEM))
+        continue;
+
+      for (hashnum = (elemnum * HALLORDERHPHASHPRIME) & hashmsk; ; hashnum = (hashnum + 1) & hashmsk) {
+        if (hashtab[hashnum].pivtnum != vertnum) { /* If empty slot */
+          hashtab[hashnum].pivtnum = vertnum;
+          hashtab[hashnum].elemnum = elemnum;
+          hashtab[hashnum].cntval  = nvtab[vertend];
+          break;
+        }
+        if (hashtab[hashnum].elemnum == elemnum) {
+          hashtab[hashnum].cntval += nvtab[vertend];
+          break;
+        }
+      }
+    }
+  }
+
+  for (lpvtnum = lpvtbas; lpvtnum < lpvtbas + lpvtnbr; lpvtnum ++) { /* Compute approximate degrees */
+    Gnum                vertend;
+    Gnum                listnum;
+    Gnum                listnnd;
+    Gnum                elemnnd;
+    Gnum                nvval;
+    Gnum                degrval;
+    Gnum                degrext;
+    Gnum                clqeval;
+
+    vertend = iwtab[lpvtnum];
+    nvval   = nvtab[vertend];
+    if (nvval == 0)
+      continue;
+
+    clqeval = lpvtwgt - nvval;                    /* Size of clique of new element */
+    degrext = lpvtwgt - nvval;
+    listnum = lsttab[vertend];
+    elemnnd = listnum + elentab[vertend];
+    listnnd = listnum + lentab[vertend];
+    for ( ; listnum < elemnnd; listnum ++) {
+      Gnum                elemnum;
+      Gnum                hashnum;
+      Gnum                elemwgt;
+
+      elemnum = iwtab[listnum];
+      if ((elemnum == vertnum) || (stattab[elemnum] != HALLORDERHPSTATELEM))
+        continue;
+
+      for (hashnum = (elemnum * HALLORDERHPHASHPRIME) & hashmsk; hashtab[hashnum].elemnum != elemnum; hashnum = (hashnum + 1) & hashmsk) ;
+      elemwgt = degrtab[elemnum] - hashtab[hashnum].cntval; /* Weight of element outside new element */
+      if (elemwgt <= 0) {                         /* If element is included in new element */
+        stattab[elemnum] = HALLORDERHPSTATDEAD;   /* Absorb it aggressively                */
+        dataptr->fathtab[elemnum] = vertnum;
+        continue;
+      }
+      degrext += elemwgt;
+      if ((degrtab[elemnum] - nvval) > clqeval)
+        clqeval = degrtab[elemnum] - nvval;
+    }
+    for ( ; listnum < listnnd; listnum ++) {
+      Gnum                vertadj;
+
+      vertadj = iwtab[listnum];
+      if (stattab[vertadj] == HALLORDERHPSTATHALO) { /* If halo variable, skip it if already in new element */
+        Gnum                halonum;
+        Gnum                halonnd;
+
+        for (halonum = lpvtbas + lpvtnbr, halonnd = lpvtnnd; halonum < halonnd; ) { /* Dichotomy search */
+          Gnum                halomed;
+
+          halomed = (halonum + halonnd) / 2;
+          if (iwtab[halomed] < vertadj)
+            halonum = halomed + 1;
+          else
+            halonnd = halomed;
+        }
+        if ((halonum < lpvtnnd) && (iwtab[halonum] == vertadj))
+          continue;
+        degrext += nvtab[vertadj];
+      }
+      else if (stattab[vertadj] == HALLORDERHPSTATVAR)
+        degrext += nvtab[vertadj];
+    }
+
+    degrval = degrtab[vertend] + lpvtwgt - nvval; /* Compute approximate degree as minimum of bounds */
+    if (degrval > degrext)
+      degrval = degrext;
+    if (degrval > (dataptr->nleft - nvval))
+      degrval = dataptr->nleft - nvval;
+    if (degrval < 0)
+      degrval = 0;
+    degrtab[vertend] = degrval;
+    dataptr->keyntab[vertend] = hallOrderHpKey (dataptr, degrval, clqeval);
+  }
+}
+
+/******************************/
+/*                            */
+/* The threaded loop routine. */
+/*                            */
+/******************************/
+
+/* This routine performs the elimination
+** rounds. Sequential bookkeeping is done by
+** the first thread, while candidate selection
+** and pivot elimination are shared among all
+** threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hallOrderHpLoop (
+ThreadDescriptor * restrict const descptr,
+HallOrderHpData * restrict const  dataptr)
+{
+  const int                 thrdnbr = threadNbr (descptr);
+  const int                 thrdnum = threadNum (descptr);
+  HallOrderHpThread * const thrdptr = &dataptr->thrdtab[thrdnum];
+  const Gnum                candmax = (Gnum) thrdnbr * HALLORDERHPCANDNBR;
+
+  while (1) {
+    Gnum                candnbr;
+    Gnum                candnum;
+    Gnum                candnnd;
+    Gnum                candbas;
+    Gnum                pivtnbr;
+    Gnum                pivtnum;
+    Gnum                pivtnnd;
+
+    if (thrdnum == 0)
+      hallOrderHpSelect (dataptr, candmax);
+    threadBarrier (descptr);
+
+    candnbr = dataptr->candnbr;
+    if (candnbr <= 0)                             /* If all variables eliminated or abort */
+      break;
+
+    candbas = dataptr->candbas;
+    candnnd = DATASCAN (candnbr, thrdnbr, thrdnum + 1);
+    for (candnum = DATASCAN (candnbr, thrdnbr, thrdnum); candnum < candnnd; candnum ++)
+      hallOrderHpReach (dataptr, dataptr->candtab[candnum], candbas - candnum, 0);
+    threadBarrier (descptr);
+
+    for (candnum = DATASCAN (candnbr, thrdnbr, thrdnum); candnum < candnnd; candnum ++)
+      dataptr->cbndtab[candnum] = hallOrderHpReach (dataptr, dataptr->candtab[candnum], candbas - candnum, 1);
+    threadBarrier (descptr);
+
+    if (thrdnum == 0)
+      hallOrderHpPivot (dataptr);
+    threadBarrier (descptr);
+
+    pivtnbr = dataptr->pivtnbr;
+    pivtnnd = DATASCAN (pivtnbr, thrdnbr, thrdnum + 1);
+    for (pivtnum = DATASCAN (pivtnbr, thrdnbr, thrdnum); pivtnum < pivtnnd; pivtnum ++)
+      hallOrderHpElim1 (dataptr, pivtnum);
+    threadBarrier (descptr);
+
+    for (pivtnum = DATASCAN (pivtnbr, thrdnbr, thrdnum); pivtnum < pivtnnd; pivtnum ++)
+      hallOrderHpElim2 (dataptr, pivtnum);
+    threadBarrier (descptr);
+
+    for (pivtnum = DATASCAN (pivtnbr, thrdnbr, thrdnum); pivtnum < pivtnnd; pivtnum ++)
+      hallOrderHpElim3 (dataptr, thrdptr, pivtnum);
+    threadBarrier (descptr);
+
+    for (pivtnum = DATASCAN (pivtnbr, thrdnbr, thrdnum); pivtnum < pivtnnd; pivtnum ++)
+      hallOrderHpElim4 (dataptr, thrdptr, pivtnum);
+    threadBarrier (descptr);
+  }
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine computes a halo approximate
+** minimum degree or minimum fill ordering of
+** the quotient graph described by the HAMD
+** input arrays, as filled by the hgraphOrderHxFill()
+** and hmeshOrderHxFill() routines. On output,
+** nvtab and petab hold the assembly tree in
+** the format expected by hallOrderHxBuild():
+** for principal variables, nvtab holds the
+** front size and petab the opposite of the
+** father index (base 1), or 0 for roots; for
+** secondary variables, nvtab is 0 and petab
+** holds the opposite of the principal variable.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+int
+hallOrderHpHamd (
+Context * restrict const      contptr,
+const Gnum                    vertnbr,            /*+ Number of variables and elements          +*/
+Gnum * restrict const         petab,              /*+ Start of adjacency lists; assembly tree   +*/
+const Gnum * restrict const   lentab,             /*+ Lengths of adjacency lists                +*/
+const Gnum * restrict const   iwtab,              /*+ Adjacency array (base 1)                  +*/
+Gnum * restrict const         nvtab,              /*+ Variable weights; front sizes             +*/
+const Gnum * restrict const   elentab,            /*+ Element flag array                        +*/
+const HallOrderHpType         typeval)            /*+ Score type                                +*/
+{
+  HallOrderHpData     datadat;
+  Gnum                vertnum;
+  Gnum                edgesum;
+  Gnum                thrdnum;
+  int                 o;
+
+  const int           thrdnbr = contextThreadNbr (contptr);
+  const Gnum          candmax = (Gnum) thrdnbr * HALLORDERHPCANDNBR;
+
+  for (vertnum = 0, edgesum = 0, datadat.nleft = 0; vertnum < vertnbr; vertnum ++) {
+    if (elentab[vertnum] == - (vertnbr + 1))      /* If element */
+      edgesum += lentab[vertnum];
+    else if (lentab[vertnum] >= 0) {              /* If non-halo variable */
+      edgesum += lentab[vertnum];
+      datadat.nleft += nvtab[vertnum];
+    }
+    else                                          /* Halo variable */
+      datadat.nleft += nvtab[vertnum];
+  }
+
+  datadat.vertnbr = vertnbr;
+  datadat.typeval = typeval;
+  datadat.keymax  = datadat.nleft;
+  datadat.keymin  = 0;
+  datadat.candbas = 0;
+  datadat.candnbr = 0;
+  datadat.pivtnbr = 0;
+  datadat.abrtval = 0;
+  datadat.nvtab   = nvtab;
+  datadat.iwsiz   = (Gnum) ((double) edgesum * HALLORDERHPCOMPRAT) + vertnbr;
+
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.lsttab,  (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.lentab,  (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.elentab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.degrtab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.fathtab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.owntab,  (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.prirtab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.keyntab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.nexttab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.prevtab, (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.keytab,  (size_t) (vertnbr              * sizeof (Gnum)),
+                     &datadat.headtab, (size_t) ((datadat.keymax + 1) * sizeof (Gnum)),
+                     &datadat.candtab, (size_t) (candmax              * sizeof (Gnum)),
+                     &datadat.cbndtab, (size_t) (candmax              * sizeof (Gnum)),
+                     &datadat.pivttab, (size_t) (candmax              * sizeof (Gnum)),
+                     &datadat.pofftab, (size_t) (candmax              * sizeof (Gnum)),
+                     &datadat.thrdtab, (size_t) (thrdnbr              * sizeof (HallOrderHpThread)),
+                     &datadat.stattab, (size_t) (vertnbr              * sizeof (byte)), NULL) == NULL) {
+    errorPrint ("hallOrderHpHamd: out of memory (1)");
+    return     (1);
+  }
+  if ((datadat.iwtab = memAlloc (datadat.iwsiz * sizeof (Gnum))) == NULL) {
+    errorPrint ("hallOrderHpHamd: out of memory (2)");
+    memFree    (datadat.lsttab);                  /* Free group leader */
+    return     (1);
+  }
+
+  memSet (datadat.fathtab, ~0, vertnbr * sizeof (Gnum));
+  memSet (datadat.owntab,  ~0, vertnbr * sizeof (Gnum));
+  memSet (datadat.prirtab, ~0, vertnbr * sizeof (Gnum));
+  memSet (datadat.keytab,  ~0, vertnbr * sizeof (Gnum));
+  memSet (datadat.headtab, ~0, (datadat.keymax + 1) * sizeof (Gnum));
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    datadat.thrdtab[thrdnum].hashtab = NULL;
+    datadat.thrdtab[thrdnum].hashmsk = 0;
+    datadat.thrdtab[thrdnum].sorttab = NULL;
+    datadat.thrdtab[thrdnum].sortsiz = 0;
+  }
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Set vertex states */
+    if (elentab[vertnum] == - (vertnbr + 1)) {
+      datadat.stattab[vertnum] = HALLORDERHPSTATELEM;
+      nvtab[vertnum] = 0;                         /* Elements are not variables */
+    }
+    else
+      datadat.stattab[vertnum] = (lentab[vertnum] >= 0) ? HALLORDERHPSTATVAR : HALLORDERHPSTATHALO;
+  }
+
+  for (vertnum = 0, datadat.iwnnd = 0, datadat.varinbr = 0; /* Copy lists, with elements first for variables */
+       vertnum < vertnbr; vertnum ++) {
+    const Gnum * restrict iwlsttab;
+    Gnum                  listnum;
+    Gnum                  listnbr;
+    Gnum                  wghtval;
+
+    datadat.lsttab[vertnum]  = datadat.iwnnd;
+    datadat.lentab[vertnum]  = 0;
+    datadat.elentab[vertnum] = 0;
+    if (datadat.stattab[vertnum] == HALLORDERHPSTATHALO) /* Halo variable lists are never used */
+      continue;
+
+    iwlsttab = iwtab + petab[vertnum] - 1;
+    listnbr  = lentab[vertnum];
+    if (datadat.stattab[vertnum] == HALLORDERHPSTATELEM) {
+      for (listnum = 0, wghtval = 0; listnum < listnbr; listnum ++) {
+        Gnum                vertend;
+
+        vertend = iwlsttab[listnum] - 1;
+        datadat.iwtab[datadat.iwnnd ++] = vertend;
+        wghtval += nvtab[vertend];
+      }
+      datadat.degrtab[vertnum] = wghtval;
+    }
+    else {
+      datadat.varinbr ++;
+      for (listnum = 0; listnum < listnbr; listnum ++) {
+        if (datadat.stattab[iwlsttab[listnum] - 1] == HALLORDERHPSTATELEM)
+          datadat.iwtab[datadat.iwnnd ++] = iwlsttab[listnum] - 1;
+      }
+      datadat.elentab[vertnum] = datadat.iwnnd - datadat.lsttab[vertnum];
+      for (listnum = 0; listnum < listnbr; listnum ++) {
+        if (datadat.stattab[iwlsttab[listnum] - 1] != HALLORDERHPSTATELEM)
+          datadat.iwtab[datadat.iwnnd ++] = iwlsttab[listnum] - 1;
+      }
+    }
+    datadat.lentab[vertnum] = datadat.iwnnd - datadat.lsttab[vertnum];
+  }
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Compute initial degrees and keys */
+    Gnum                listnum;
+    Gnum                listnnd;
+    Gnum                elemnnd;
+    Gnum                nvval;
+    Gnum                degrval;
+    Gnum                clqeval;
+
+    if (datadat.stattab[vertnum] != HALLORDERHPSTATVAR)
+      continue;
+
+    nvval   = nvtab[vertnum];
+    listnum = datadat.lsttab[vertnum];
+    elemnnd = listnum + datadat.elentab[vertnum];
+    listnnd = listnum + datadat.lentab[vertnum];
+    for (degrval = clqeval = 0; listnum < elemnnd; listnum ++) {
+      Gnum                elemwgt;
+
+      elemwgt = datadat.degrtab[datadat.iwtab[listnum]] - nvval;
+      degrval += elemwgt;
+      if (elemwgt > clqeval)
+        clqeval = elemwgt;
+    }
+    for ( ; listnum < listnnd; listnum ++)
+      degrval += nvtab[datadat.iwtab[listnum]];
+    if (degrval > (datadat.nleft - nvval))
+      degrval = datadat.nleft - nvval;
+
+    datadat.degrtab[vertnum] = degrval;
+    hallOrderHpBuckAdd (&datadat, vertnum, hallOrderHpKey (&datadat, degrval, clqeval));
+  }
+
+  contextThreadLaunch (contptr, (ThreadFunc) hallOrderHpLoop, (void *) &datadat);
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    if (datadat.thrdtab[thrdnum].hashtab != NULL)
+      memFree (datadat.thrdtab[thrdnum].hashtab);
+    if (datadat.thrdtab[thrdnum].sorttab != NULL)
+      memFree (datadat.thrdtab[thrdnum].sorttab);
+  }
+
+  o = datadat.abrtval;
+  if (o == 0) {
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Build assembly tree of principal variables */
+      Gnum                fathnum;
+
+      if ((datadat.stattab[vertnum] == HALLORDERHPSTATHALO) ||
+          (nvtab[vertnum] == 0))
+        continue;
+
+      fathnum = datadat.fathtab[vertnum];
+      petab[vertnum] = (fathnum >= 0) ? (- (fathnum + 1)) : 0;
+    }
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Link secondary variables to their principal variables */
+      Gnum                fathnum;
+
+      if ((datadat.stattab[vertnum] == HALLORDERHPSTATHALO) ||
+          (nvtab[vertnum] != 0))
+        continue;
+
+      for (fathnum = datadat.fathtab[vertnum]; (fathnum >= 0) && (nvtab[fathnum] == 0); fathnum = datadat.fathtab[fathnum]) ;
+      petab[vertnum] = (fathnum >= 0) ? (- (fathnum + 1)) : 0;
+    }
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Set front sizes of principal variables */
+      if ((datadat.stattab[vertnum] != HALLORDERHPSTATHALO) &&
+          (nvtab[vertnum] != 0))
+        nvtab[vertnum] += datadat.degrtab[vertnum];
+    }
+  }
+
+  memFree (datadat.iwtab);
+  memFree (datadat.lsttab);                       /* Free group leader */
+
+  return (o);
+}
@@ -0,0 +1,172 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hall_order_hp.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the data declara-  **/
+/**                tions for the multi-threaded Halo       **/
+/**                Approximate Minimum Degree and Minimum  **/
+/**                Fill ordering routine.                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined HALLORDERHPNOTHREAD)
+#define HALLORDERHPNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined HALLORDERHPNOTHREAD) */
+
+/*+ Extra space ratio for the adjacency array. +*/
+
+#define HALLORDERHPCOMPRAT          1.2L
+
+/*+ Number of pivot candidates per thread
+    and per round.                         +*/
+
+#define HALLORDERHPCANDNBR          32
+
+/*+ Relaxation divisor of minimum score for
+    pivot candidate selection: candidates
+    have a score at most (1 + 1/DIV) times
+    the minimum score.                      +*/
+
+#define HALLORDERHPRELAXDIV         10
+
+/*+ Prime number for hashing. +*/
+
+#define HALLORDERHPHASHPRIME        17
+
+/*+ Vertex states. +*/
+
+#define HALLORDERHPSTATVAR          0             /*+ Live variable                       +*/
+#define HALLORDERHPSTATHALO         1             /*+ Halo variable, never eliminated     +*/
+#define HALLORDERHPSTATELEM         2             /*+ Live element                        +*/
+#define HALLORDERHPSTATDEAD         3             /*+ Absorbed element or merged variable +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Ordering score types. +*/
+
+typedef enum HallOrderHpType_ {
+  HALLORDERHPTYPEDEG = 0,                         /*+ Approximate minimum degree +*/
+  HALLORDERHPTYPEFILL                             /*+ Approximate minimum fill   +*/
+} HallOrderHpType;
+
+/*+ The element count hash structure. +*/
+
+typedef struct HallOrderHpHash_ {
+  Gnum                      pivtnum;              /*+ Pivot for which slot is in use +*/
+  Gnum                      elemnum;              /*+ Element number                 +*/
+  Gnum                      cntval;               /*+ Weight of element within pivot +*/
+} HallOrderHpHash;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct HallOrderHpThread_ {
+  HallOrderHpHash *         hashtab;              /*+ Element count hash table          +*/
+  Gnum                      hashmsk;              /*+ Hash table mask                   +*/
+  Gnum *                    sorttab;              /*+ Sort array for super-variables    +*/
+  Gnum                      sortsiz;              /*+ Number of pairs in sort array     +*/
+} HallOrderHpThread;
+
+/*+ The thread-independent data block.
+    All lists are stored in the same
+    adjacency array, variable lists
+    holding their elements first.     +*/
+
+typedef struct HallOrderHpData_ {
+  Gnum                      vertnbr;              /*+ Number of vertices (variables and elements) +*/
+  HallOrderHpType           typeval;              /*+ Score type                                  +*/
+  Gnum                      varinbr;              /*+ Number of live non-halo principal variables +*/
+  Gnum                      nleft;                /*+ Weight of not yet eliminated variables      +*/
+  Gnum                      keymax;               /*+ Maximum bucket key                          +*/
+  Gnum                      keymin;               /*+ Current lower bound of bucket keys          +*/
+  Gnum *                    lsttab;               /*+ Start index of vertex lists                 +*/
+  Gnum *                    lentab;               /*+ Length of vertex lists                      +*/
+  Gnum *                    elentab;              /*+ Number of elements in variable lists        +*/
+  Gnum *                    nvtab;                /*+ Variable weights; 0 if merged               +*/
+  Gnum *                    degrtab;              /*+ Degree of variable or weight of element     +*/
+  Gnum *                    fathtab;              /*+ Father in assembly tree, or -1              +*/
+  Gnum *                    owntab;               /*+ Pivot owning variable in current round      +*/
+  Gnum *                    prirtab;              /*+ Minimum candidate rank of variable          +*/
+  Gnum *                    keyntab;              /*+ New key or super-variable hash value        +*/
+  Gnum *                    headtab;              /*+ Bucket heads                                +*/
+  Gnum *                    nexttab;              /*+ Next variable in bucket                     +*/
+  Gnum *                    prevtab;              /*+ Previous variable in bucket                 +*/
+  Gnum *                    keytab;               /*+ Current bucket key, or -1                   +*/
+  byte *                    stattab;              /*+ Vertex state                                +*/
+  Gnum                      candbas;              /*+ Priority of first candidate of round        +*/
+  Gnum                      candnbr;              /*+ Number of candidates in current round       +*/
+  Gnum *                    candtab;              /*+ Array of candidates                         +*/
+  Gnum *                    cbndtab;              /*+ Storage bound of winning candidates, or -1  +*/
+  Gnum                      pivtnbr;              /*+ Number of pivots in current round           +*/
+  Gnum *                    pivttab;              /*+ Array of pivots                             +*/
+  Gnum *                    pofftab;              /*+ Start index of pivot element lists          +*/
+  Gnum *                    iwtab;                /*+ Adjacency array                             +*/
+  Gnum                      iwsiz;                /*+ Size of adjacency array                     +*/
+  Gnum                      iwnnd;                /*+ First free index in adjacency array         +*/
+  HallOrderHpThread *       thrdtab;              /*+ Array of thread-specific data               +*/
+  int                       abrtval;              /*+ Abort flag                                  +*/
+} HallOrderHpData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_HALL_ORDER_HP
+static void                 hallOrderHpBuckDel  (HallOrderHpData * restrict const, const Gnum);
+static void                 hallOrderHpBuckAdd  (HallOrderHpData * restrict const, const Gnum, const Gnum);
+static Gnum                 hallOrderHpKey      (const HallOrderHpData * restrict const, const Gnum, Gnum);
+static void                 hallOrderHpPrir     (Gnum * const, const Gnum);
+static Gnum                 hallOrderHpReach    (HallOrderHpData * restrict const, const Gnum, const Gnum, const int);
+static void                 hallOrderHpSelect   (HallOrderHpData * restrict const, const Gnum);
+static int                  hallOrderHpCompact  (HallOrderHpData * restrict const, const Gnum);
+static void                 hallOrderHpPivot    (HallOrderHpData * restrict const);
+static void                 hallOrderHpElim1    (HallOrderHpData * restrict const, const Gnum);
+static void                 hallOrderHpElim2    (HallOrderHpData * restrict const, const Gnum);
+static int                  hallOrderHpSame     (const HallOrderHpData * restrict const, const Gnum, const Gnum);
+static void                 hallOrderHpElim3    (HallOrderHpData * restrict const, HallOrderHpThread * restrict const, const Gnum);
+static void                 hallOrderHpElim4    (HallOrderHpData * restrict const, HallOrderHpThread * restrict const, const Gnum);
+static void                 hallOrderHpLoop     (ThreadDescriptor * restrict const, HallOrderHpData * restrict const);
+#endif /* SCOTCH_HALL_ORDER_HP */
+
+int                         hallOrderHpHamd     (Context * restrict const, const Gnum, Gnum * restrict const, const Gnum * restrict const, const Gnum * restrict const, Gnum * restrict const, const Gnum * restrict const, const HallOrderHpType);
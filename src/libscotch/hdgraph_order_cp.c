@@ -0,0 +1,888 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hdgraph_order_cp.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module orders distributed graphs   **/
+/**                by compressing vertices with identical  **/
+/**                adjacency structure.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # Only vertices located on the same     **/
+/**                  process are merged, but their         **/
+/**                  neighborhoods may comprise ghost and  **/
+/**                  halo vertices.                        **/
+/**                                                        **/
+/**                # The compressed graph is ordered in    **/
+/**                  place, within the column block of     **/
+/**                  the fine graph, and all the column    **/
+/**                  blocks and inverse permutation        **/
+/**                  fragments created in the process are  **/
+/**                  expanded afterwards.                  **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_HDGRAPH_ORDER_CP
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "dgraph.h"
+#include "dorder.h"
+#include "hdgraph.h"
+#include "hdgraph_order_cp.h"
+#include "hdgraph_order_st.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine orders the given distributed
+** halo graph, by first compressing it if its
+** compression ratio is good enough.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+int
+hdgraphOrderCp (
+Hdgraph * restrict const                    finegrafptr,
+DorderCblk * restrict const                 cblkptr,
+const HdgraphOrderCpParam * restrict const  paraptr)
+{
+  Hdgraph             coargrafdat;                /* Compressed halo graph                          */
+  Gnum *              coarmembtab;                /* Index of fine vertex lists of coarse vertices  */
+  Gnum *              finemembtab;                /* Fine vertex lists                              */
+  DorderLink *        linkptr;                    /* Last column block before compressed ordering   */
+  int                 o;
+
+  switch (hdgraphOrderCpCompress (finegrafptr, &coargrafdat, &coarmembtab, &finemembtab, paraptr->comprat)) {
+    case 0 :                                      /* If compressed graph built */
+      break;
+    case 1 :                                      /* If compression not worth it */
+      return (hdgraphOrderSt (finegrafptr, cblkptr, paraptr->stratunc));
+    default :
+      errorPrint ("hdgraphOrderCp: cannot build compressed graph");
+      return     (1);
+  }
+
+  linkptr = cblkptr->ordelocptr->linkdat.prevptr; /* All column blocks created by the compressed ordering will be linked after it */
+  cblkptr->vnodglbnbr = coargrafdat.s.vertglbnbr; /* Column block temporarily holds coarse vertices                              */
+
+  o = hdgraphOrderSt (&coargrafdat, cblkptr, paraptr->stratcpr);
+  if (MPI_Allreduce (MPI_IN_PLACE, &o, 1, MPI_INT, MPI_MAX, finegrafptr->s.proccomm) != MPI_SUCCESS) { /* Expansion is collective */
+    errorPrint ("hdgraphOrderCp: communication error");
+    o = 1;
+  }
+  if (o == 0)
+    o = hdgraphOrderCpExpand (&coargrafdat, cblkptr, linkptr, coarmembtab, finemembtab);
+
+  memFree     (coarmembtab);                      /* Free group leader */
+  hdgraphExit (&coargrafdat);
+
+#ifdef SCOTCH_DEBUG_HDGRAPH2
+  if ((o == 0) && (cblkptr->vnodglbnbr != finegrafptr->s.vertglbnbr)) {
+    errorPrint ("hdgraphOrderCp: internal error");
+    o = 1;
+  }
+#endif /* SCOTCH_DEBUG_HDGRAPH2 */
+
+  return (o);
+}
+
+/* This routine builds the compressed graph
+** of the given distributed halo graph. Two
+** local vertices are merged when their closed
+** neighborhoods, comprising ghost and halo
+** vertices, are identical. The representative
+** of a set of merged vertices is its vertex
+** of smallest index. The coarse vertex array
+** coarmembtab, of size (coarvertlocnbr + 1),
+** indexes the original numbers of the fine
+** vertices of each coarse vertex, which are
+** stored in finemembtab, representative first.
+** It returns:
+** - 0  : if the compressed graph has been built.
+** - 1  : if the compression ratio is not good enough.
+** - 2  : on error.
+*/
+
+static
+int
+hdgraphOrderCpCompress (
+Hdgraph * restrict const      finegrafptr,
+Hdgraph * restrict const      coargrafptr,
+Gnum ** const                 coarmembptr,
+Gnum ** const                 finemembptr,
+const double                  comprat)
+{
+  const Gnum * restrict finevertloctax;
+  const Gnum * restrict finevendloctax;
+  const Gnum * restrict finevhndloctax;
+  const Gnum * restrict fineveloloctax;
+  const Gnum * restrict fineedgeloctax;
+  const Gnum * restrict fineedgegsttax;
+  Gnum * restrict       finecoargsttax;           /* Coarse global index of fine vertices; negative if not representative */
+  Gnum * restrict       finerpsttax;              /* Local index of representative of fine vertex                         */
+  Gnum * restrict       finehashtax;              /* Neighborhood hash value of fine vertices                             */
+  Gnum * restrict       fineflagtax;              /* Flag array for closed neighborhood comparisons                       */
+  Gnum                  finevertlocnum;
+  Gnum                  finevertlocnnd;
+  Gnum                  finevertglbadj;           /* Global adjustment of fine vertex indices                             */
+  Gnum                  finehaloglbadj;           /* Global adjustment of halo vertex indices for hashing                 */
+  Gnum                  finehalolocadj;           /* Adjustment of halo vertex indices in flag array                      */
+  Gnum * restrict       coarvertloctax;
+  Gnum * restrict       coarvendloctax;
+  Gnum * restrict       coarveloloctax;
+  Gnum * restrict       coarvnumloctax;
+  Gnum * restrict       coaredgeloctax;
+  Gnum                  coarvertlocnbr;
+  Gnum                  coarvertlocnum;
+  Gnum                  coarvertglbadj;           /* Global adjustment of coarse vertex indices                           */
+  Gnum                  coaredgelocnum;
+  Gnum                  coaredgelocnbr;
+  Gnum                  coardegrlocmax;
+  Gnum * restrict       coarmembtab;
+  Gnum * restrict       finemembtab;
+  Gnum                  baseval;
+  Gnum                  procnum;
+  Gnum                  reduloctab[2];
+  Gnum                  reduglbtab[2];
+  int                   cheklocval;
+
+  if (dgraphGhst (&finegrafptr->s) != 0) {        /* Compute ghost edge array if not already present */
+    errorPrint ("hdgraphOrderCpCompress: cannot compute ghost edge array");
+    return     (2);
+  }
+
+  baseval        = finegrafptr->s.baseval;
+  finevertlocnnd = finegrafptr->s.vertlocnnd;
+  finevertloctax = finegrafptr->s.vertloctax;
+  finevendloctax = finegrafptr->s.vendloctax;
+  finevhndloctax = finegrafptr->vhndloctax;
+  fineveloloctax = finegrafptr->s.veloloctax;
+  fineedgeloctax = finegrafptr->s.edgeloctax;
+  fineedgegsttax = finegrafptr->s.edgegsttax;
+  finevertglbadj = finegrafptr->s.procvrttab[finegrafptr->s.proclocnum] - baseval;
+  finehaloglbadj = finegrafptr->s.procvrttab[finegrafptr->s.procglbnbr]; /* Halo vertices are hashed beyond all global indices */
+  finehalolocadj = finegrafptr->s.vertgstnbr;     /* Halo vertices are flagged after ghost vertices                             */
+
+  memSet (coargrafptr, 0, sizeof (Hdgraph));      /* Pre-initialize graph fields */
+  coargrafptr->s.proccomm   = finegrafptr->s.proccomm;
+  coargrafptr->s.procglbnbr = finegrafptr->s.procglbnbr;
+  coargrafptr->s.proclocnum = finegrafptr->s.proclocnum;
+  coargrafptr->s.flagval    = (DGRAPHFREEALL ^ DGRAPHFREECOMM) | DGRAPHVERTGROUP | DGRAPHEDGEGROUP; /* Do not free vhndloctab as it is grouped with vertloctab */
+
+  cheklocval     = 0;
+  coarvertlocnbr = 0;
+  finecoargsttax = NULL;
+  if (memAllocGroup ((void **) (void *)
+                     &finecoargsttax, (size_t) (finegrafptr->s.vertgstnbr                          * sizeof (Gnum)),
+                     &finerpsttax,    (size_t) (finegrafptr->s.vertlocnbr                          * sizeof (Gnum)),
+                     &finehashtax,    (size_t) (finegrafptr->s.vertlocnbr                          * sizeof (Gnum)),
+                     &fineflagtax,    (size_t) ((finegrafptr->s.vertgstnbr + finegrafptr->vhallocnbr) * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hdgraphOrderCpCompress: out of memory (1)");
+    cheklocval = 1;
+  }
+  else if (memAllocGroup ((void **) (void *)      /* Allocate distributed graph private data */
+                          &coargrafptr->s.procdsptab, (size_t) ((finegrafptr->s.procglbnbr + 1) * sizeof (Gnum)),
+                          &coargrafptr->s.proccnttab, (size_t) (finegrafptr->s.procglbnbr       * sizeof (Gnum)),
+                          &coargrafptr->s.procngbtab, (size_t) (finegrafptr->s.procglbnbr       * sizeof (int)),
+                          &coargrafptr->s.procrcvtab, (size_t) (finegrafptr->s.procglbnbr       * sizeof (int)),
+                          &coargrafptr->s.procsndtab, (size_t) (finegrafptr->s.procglbnbr       * sizeof (int)), NULL) == NULL) {
+    errorPrint ("hdgraphOrderCpCompress: out of memory (2)");
+    cheklocval = 1;
+  }
+  else {
+    finecoargsttax -= baseval;
+    finerpsttax    -= baseval;
+    finehashtax    -= baseval;
+    fineflagtax    -= baseval;
+
+    memSet (fineflagtax + baseval, ~0, (finegrafptr->s.vertgstnbr + finegrafptr->vhallocnbr) * sizeof (Gnum)); /* No vertex flagged yet */
+
+    for (finevertlocnum = baseval; finevertlocnum < finevertlocnnd; finevertlocnum ++) { /* Compute neighborhood hash values */
+      Gnum                fineedgelocnum;
+      Gnum                finehashval;
+
+      finehashval = finevertlocnum + finevertglbadj; /* Closed neighborhood comprises vertex itself */
+      for (fineedgelocnum = finevertloctax[finevertlocnum];
+           fineedgelocnum < finevendloctax[finevertlocnum]; fineedgelocnum ++)
+        finehashval += fineedgeloctax[fineedgelocnum];
+      for ( ; fineedgelocnum < finevhndloctax[finevertlocnum]; fineedgelocnum ++)
+        finehashval += fineedgeloctax[fineedgelocnum] + finehaloglbadj;
+      finehashtax[finevertlocnum] = finehashval;
+    }
+
+    for (finevertlocnum = baseval; finevertlocnum < finevertlocnnd; finevertlocnum ++) { /* Find representatives of fine vertices */
+      Gnum                finehashval;
+      Gnum                finedegrval;
+      Gnum                fineedgelocnum;
+      Gnum                finerpstnum;
+      int                 fineflagval;
+
+      finehashval = finehashtax[finevertlocnum];
+      finedegrval = finevhndloctax[finevertlocnum] - finevertloctax[finevertlocnum];
+      finerpstnum = finevertlocnum;               /* Assume vertex is its own representative */
+      fineflagval = 0;                            /* Closed neighborhood not flagged yet     */
+      for (fineedgelocnum = finevertloctax[finevertlocnum];
+           fineedgelocnum < finevendloctax[finevertlocnum]; fineedgelocnum ++) {
+        Gnum                finevertlocend;
+        Gnum                fineedgelocend;
+
+        finevertlocend = fineedgegsttax[fineedgelocnum];
+        if ((finevertlocend >= finevertlocnum) || /* Only consider smaller local representatives */
+            (finerpsttax[finevertlocend] != finevertlocend) ||
+            (finehashtax[finevertlocend] != finehashval) ||
+            ((finevhndloctax[finevertlocend] - finevertloctax[finevertlocend]) != finedegrval))
+          continue;
+
+        if (fineflagval == 0) {                   /* Flag closed neighborhood of current vertex */
+          Gnum                fineedgetmp;
+
+          fineflagtax[finevertlocnum] = finevertlocnum;
+          for (fineedgetmp = finevertloctax[finevertlocnum];
+               fineedgetmp < finevendloctax[finevertlocnum]; fineedgetmp ++)
+            fineflagtax[fineedgegsttax[fineedgetmp]] = finevertlocnum;
+          for ( ; fineedgetmp < finevhndloctax[finevertlocnum]; fineedgetmp ++)
+            fineflagtax[fineedgeloctax[fineedgetmp] + finehalolocadj] = finevertlocnum;
+          fineflagval = 1;
+        }
+
+        for (fineedgelocend = finevertloctax[finevertlocend]; /* Check that closed neighborhoods match */
+             fineedgelocend < finevendloctax[finevertlocend]; fineedgelocend ++) {
+          if ((fineedgegsttax[fineedgelocend] != finevertlocnum) &&
+              (fineflagtax[fineedgegsttax[fineedgelocend]] != finevertlocnum))
+            break;
+        }
+        if (fineedgelocend < finevendloctax[finevertlocend])
+          continue;
+        for ( ; fineedgelocend < finevhndloctax[finevertlocend]; fineedgelocend ++) {
+          if (fineflagtax[fineedgeloctax[fineedgelocend] + finehalolocadj] != finevertlocnum)
+            break;
+        }
+        if (fineedgelocend < finevhndloctax[finevertlocend])
+          continue;
+
+        finerpstnum = finevertlocend;             /* Representatives are unique, so first match is the one */
+        break;
+      }
+      finerpsttax[finevertlocnum] = finerpstnum;
+      if (finerpstnum == finevertlocnum)          /* One more coarse vertex */
+        coarvertlocnbr ++;
+    }
+  }
+
+  reduloctab[0] = coarvertlocnbr;
+  reduloctab[1] = (Gnum) cheklocval;
+  if (MPI_Allreduce (reduloctab, reduglbtab, 2, GNUM_MPI, MPI_SUM, finegrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpCompress: communication error (1)");
+    reduglbtab[1] = 1;
+  }
+  if (reduglbtab[1] != 0) {
+    if (finecoargsttax != NULL)
+      memFree (finecoargsttax + ((cheklocval == 0) ? baseval : 0)); /* Free group leader */
+    hdgraphExit (coargrafptr);
+    return (2);
+  }
+  if ((double) reduglbtab[0] > (comprat * (double) finegrafptr->s.vertglbnbr)) { /* If compression ratio not good enough */
+    memFree     (finecoargsttax + baseval);       /* Free group leader */
+    hdgraphExit (coargrafptr);
+    return (1);
+  }
+
+  coarmembtab = NULL;
+  if (memAllocGroup ((void **) (void *)           /* Allocate distributed graph public data */
+                     &coargrafptr->s.vertloctax, (size_t) ((coarvertlocnbr + 1) * sizeof (Gnum)), /* Compact vertex arrays                  */
+                     &coargrafptr->s.vendloctax, (size_t) (coarvertlocnbr       * sizeof (Gnum)), /* Vertex end array for non-halo vertices */
+                     &coargrafptr->s.vnumloctax, (size_t) (coarvertlocnbr       * sizeof (Gnum)),
+                     &coargrafptr->s.veloloctax, (size_t) (coarvertlocnbr       * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hdgraphOrderCpCompress: out of memory (3)");
+    cheklocval = 1;
+  }
+  else if ((coargrafptr->s.edgeloctax = (Gnum *) memAlloc (finegrafptr->s.edgelocsiz * sizeof (Gnum))) == NULL) { /* Upper bound on number of coarse edges */
+    errorPrint ("hdgraphOrderCpCompress: out of memory (4)");
+    cheklocval = 1;
+  }
+  else if (memAllocGroup ((void **) (void *)
+                          &coarmembtab, (size_t) ((coarvertlocnbr + 1)        * sizeof (Gnum)),
+                          &finemembtab, (size_t) (finegrafptr->s.vertlocnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hdgraphOrderCpCompress: out of memory (5)");
+    cheklocval = 1;
+  }
+
+  coargrafptr->s.proccnttab[coargrafptr->s.proclocnum] = (cheklocval == 0) ? coarvertlocnbr : -1;
+  if (MPI_Allgather (MPI_IN_PLACE, 1, GNUM_MPI,   /* Use in-place operation as receive buffer is already allocated */
+                     coargrafptr->s.proccnttab, 1, GNUM_MPI, coargrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpCompress: communication error (2)");
+    cheklocval = 1;
+  }
+  coargrafptr->s.procvrttab    = coargrafptr->s.procdsptab; /* Graph does not have holes */
+  coargrafptr->s.procdsptab[0] = baseval;         /* Build vertex-to-process array   */
+  for (procnum = 0; procnum < coargrafptr->s.procglbnbr; procnum ++) {
+    if (coargrafptr->s.proccnttab[procnum] < 0) { /* If error notified by another process */
+      cheklocval = 1;
+      break;
+    }
+    coargrafptr->s.procdsptab[procnum + 1] = coargrafptr->s.procdsptab[procnum] + coargrafptr->s.proccnttab[procnum];
+  }
+  if (cheklocval != 0) {                          /* If something went wrong in all of the above */
+    if (coarmembtab != NULL)
+      memFree (coarmembtab);
+    memFree     (finecoargsttax + baseval);       /* Free group leader */
+    hdgraphExit (coargrafptr);
+    return (2);
+  }
+
+  coargrafptr->s.vertloctax -= baseval;
+  coargrafptr->s.vendloctax -= baseval;
+  coargrafptr->s.vnumloctax -= baseval;
+  coargrafptr->s.veloloctax -= baseval;
+  coargrafptr->s.edgeloctax -= baseval;
+  coarvertloctax = coargrafptr->s.vertloctax;
+  coarvendloctax = coargrafptr->s.vendloctax;
+  coarveloloctax = coargrafptr->s.veloloctax;
+  coarvnumloctax = coargrafptr->s.vnumloctax;
+  coaredgeloctax = coargrafptr->s.edgeloctax;
+  coarvertglbadj = coargrafptr->s.procdsptab[coargrafptr->s.proclocnum] - baseval;
+
+  for (finevertlocnum = baseval, coarvertlocnum = baseval; /* Number coarse vertices */
+       finevertlocnum < finevertlocnnd; finevertlocnum ++) {
+    Gnum                finerpstnum;
+
+    finerpstnum = finerpsttax[finevertlocnum];
+    if (finerpstnum == finevertlocnum) {
+      coarveloloctax[coarvertlocnum] = 0;
+      coarvnumloctax[coarvertlocnum] =            /* Coarse vertices are numbered by their global index */
+      finecoargsttax[finevertlocnum] = coarvertlocnum + coarvertglbadj;
+      coarmembtab[coarvertlocnum - baseval + 1] = 0;
+      coarvertlocnum ++;
+    }
+    else                                          /* Representative has already been numbered */
+      finecoargsttax[finevertlocnum] = -1 - finecoargsttax[finerpstnum];
+  }
+#ifdef SCOTCH_DEBUG_HDGRAPH2
+  if (coarvertlocnum != (coarvertlocnbr + baseval)) {
+    errorPrint ("hdgraphOrderCpCompress: internal error (1)");
+    return     (2);
+  }
+#endif /* SCOTCH_DEBUG_HDGRAPH2 */
+
+  if (dgraphHaloSync (&finegrafptr->s, (byte *) (finecoargsttax + baseval), GNUM_MPI) != 0) { /* Share coarse indices of ghost vertices */
+    errorPrint ("hdgraphOrderCpCompress: cannot perform halo exchange");
+    memFree     (coarmembtab);
+    memFree     (finecoargsttax + baseval);       /* Free group leader */
+    hdgraphExit (coargrafptr);
+    return (2);
+  }
+
+  for (finevertlocnum = baseval; finevertlocnum < finevertlocnnd; finevertlocnum ++) { /* Accumulate loads and sizes of coarse vertices */
+    coarvertlocnum = finecoargsttax[finerpsttax[finevertlocnum]] - coarvertglbadj;
+    coarveloloctax[coarvertlocnum] += (fineveloloctax != NULL) ? fineveloloctax[finevertlocnum] : 1;
+    coarmembtab[coarvertlocnum - baseval + 1] ++;
+  }
+  coarmembtab[0] = 0;                             /* Turn sizes into start indices of fine vertex lists */
+  for (coarvertlocnum = 0; coarvertlocnum < coarvertlocnbr; coarvertlocnum ++)
+    coarmembtab[coarvertlocnum + 1] += coarmembtab[coarvertlocnum];
+  for (finevertlocnum = baseval; finevertlocnum < finevertlocnnd; finevertlocnum ++) { /* Fill fine vertex lists in ascending order */
+    coarvertlocnum = finecoargsttax[finerpsttax[finevertlocnum]] - coarvertglbadj - baseval;
+    finemembtab[coarmembtab[coarvertlocnum] ++] = (finegrafptr->s.vnumloctax != NULL)
+                                                  ? finegrafptr->s.vnumloctax[finevertlocnum]
+                                                  : finevertlocnum + finevertglbadj;
+  }
+  for (coarvertlocnum = coarvertlocnbr; coarvertlocnum > 0; coarvertlocnum --) /* Restore start indices */
+    coarmembtab[coarvertlocnum] = coarmembtab[coarvertlocnum - 1];
+  coarmembtab[0] = 0;
+
+  for (finevertlocnum = coarvertlocnum = coaredgelocnum = baseval, coaredgelocnbr = coardegrlocmax = 0; /* Build coarse adjacency */
+       finevertlocnum < finevertlocnnd; finevertlocnum ++) {
+    Gnum                fineedgelocnum;
+    Gnum                coardegrlocval;
+
+    if (finerpsttax[finevertlocnum] != finevertlocnum) /* Only representatives carry coarse adjacency */
+      continue;
+
+    coarvertloctax[coarvertlocnum] = coaredgelocnum;
+    for (fineedgelocnum = finevertloctax[finevertlocnum];
+         fineedgelocnum < finevendloctax[finevertlocnum]; fineedgelocnum ++) {
+      Gnum                coarvertglbend;
+
+      coarvertglbend = finecoargsttax[fineedgegsttax[fineedgelocnum]];
+      if (coarvertglbend >= 0)                    /* Only keep edges to representatives, including ghost ones */
+        coaredgeloctax[coaredgelocnum ++] = coarvertglbend;
+    }
+    coarvendloctax[coarvertlocnum] = coaredgelocnum;
+    coardegrlocval  = coaredgelocnum - coarvertloctax[coarvertlocnum];
+    coaredgelocnbr += coardegrlocval;
+    if (coardegrlocmax < coardegrlocval)
+      coardegrlocmax = coardegrlocval;
+
+    for ( ; fineedgelocnum < finevhndloctax[finevertlocnum]; fineedgelocnum ++) /* Keep halo vertices as is */
+      coaredgeloctax[coaredgelocnum ++] = fineedgeloctax[fineedgelocnum];
+
+    coarvertlocnum ++;
+  }
+  coarvertloctax[coarvertlocnum] = coaredgelocnum; /* Mark end of edge array for vhndloctax */
+
+  memFree (finecoargsttax + baseval);             /* Free group leader of fine work arrays */
+
+  coargrafptr->s.edgeloctax = memRealloc (coaredgeloctax + baseval, (coaredgelocnum - baseval) * sizeof (Gnum));
+  coargrafptr->s.edgeloctax -= baseval;
+
+  coargrafptr->vhallocnbr = finegrafptr->vhallocnbr; /* Halo vertices are all kept */
+  coargrafptr->vhndloctax = coarvertloctax + 1;   /* Compact edge array with halo vertices   */
+  coargrafptr->ehallocnbr = coaredgelocnum - baseval - coaredgelocnbr;
+  coargrafptr->levlnum    = finegrafptr->levlnum;
+  coargrafptr->contptr    = finegrafptr->contptr;
+
+  coargrafptr->s.baseval    = baseval;
+  coargrafptr->s.vertlocnbr = coarvertlocnbr;
+  coargrafptr->s.vertlocnnd = coarvertlocnbr + baseval;
+  coargrafptr->s.velolocsum = (fineveloloctax != NULL) ? finegrafptr->s.velolocsum : finegrafptr->s.vertlocnbr;
+  coargrafptr->s.edgelocnbr = coaredgelocnbr;
+  coargrafptr->s.edgelocsiz = coaredgelocnum - baseval;
+  coargrafptr->s.degrglbmax = coardegrlocmax;
+  if (dgraphBuild4 (&coargrafptr->s) != 0) {
+    errorPrint  ("hdgraphOrderCpCompress: cannot build compressed graph");
+    memFree     (coarmembtab);
+    hdgraphExit (coargrafptr);
+    return (2);
+  }
+#ifdef SCOTCH_DEBUG_HDGRAPH2
+  if (hdgraphCheck (coargrafptr) != 0) {
+    errorPrint  ("hdgraphOrderCpCompress: internal error (2)");
+    memFree     (coarmembtab);
+    hdgraphExit (coargrafptr);
+    return (2);
+  }
+#endif /* SCOTCH_DEBUG_HDGRAPH2 */
+
+  *coarmembptr = coarmembtab;
+  *finemembptr = finemembtab;
+
+  return (0);
+}
+
+/* This routine returns the fine start index
+** of the given coarse index, which must be a
+** fragment boundary, from the sorted global
+** array of fragments.
+** It returns:
+** - the fine start index : in all cases.
+*/
+
+static
+Gnum
+hdgraphOrderCpFine (
+const HdgraphOrderCpFrag * restrict const fragtab,
+const Gnum                                fragnbr,
+const Gnum                                finennd, /* Fine end index */
+const Gnum                                ordenum)
+{
+  Gnum                fragmin;
+  Gnum                fragmax;
+
+  for (fragmin = 0, fragmax = fragnbr; fragmin < fragmax; ) { /* Find first fragment starting at or after ordenum */
+    Gnum                fragmed;
+
+    fragmed = (fragmin + fragmax) / 2;
+    if (fragtab[fragmed].ordenum < ordenum)
+      fragmin = fragmed + 1;
+    else
+      fragmax = fragmed;
+  }
+
+  return ((fragmin < fragnbr) ? fragtab[fragmin].finenum : finennd);
+}
+
+/* This routine expands all the column blocks
+** of the compressed ordering, which are the
+** given column block and all of the blocks
+** linked after the given link, from coarse
+** to fine indices. The fine vertex lists of
+** the coarse vertices held in the inverse
+** permutation fragments are requested from
+** their owner processes, after which the
+** global list of fragments provides the fine
+** start index of every column block.
+** It returns:
+** - 0   : if the ordering could be expanded.
+** - !0  : on error.
+*/
+
+static
+int
+hdgraphOrderCpExpand (
+const Hdgraph * restrict const  coargrafptr,
+DorderCblk * restrict const     cblkptr,
+DorderLink * const              linkptr,
+const Gnum * restrict const     coarmembtab,
+const Gnum * restrict const     finemembtab)
+{
+  Dorder * restrict               ordeptr;
+  DorderLink *                    linktmp;
+  DorderCblk ** restrict          cblkloctab;     /* Column blocks of compressed ordering        */
+  Gnum                            cblklocnbr;
+  Gnum                            cblklocnum;
+  HdgraphOrderCpSort * restrict   sortsndtab;     /* Sorted requests of fine vertex lists        */
+  HdgraphOrderCpSort * restrict   sortrcvtab;
+  HdgraphOrderCpFrag * restrict   fragloctab;     /* Local inverse permutation fragments         */
+  HdgraphOrderCpFrag * restrict   fragglbtab;     /* Global inverse permutation fragments        */
+  Gnum                            fragglbnbr;
+  Gnum                            fraglocnbr;
+  Gnum                            fragglbnum;
+  Gnum * restrict                 entridxtab;     /* Reply index of each local fragment entry    */
+  Gnum                            entrlocnbr;
+  Gnum                            entrlocnum;
+  Gnum * restrict                 rplysndtab;     /* Fine vertex list replies                    */
+  Gnum * restrict                 rplyrcvtab;
+  Gnum                            rplyrcvnbr;
+  Gnum                            rplyrcvnum;
+  Gnum                            rplysndnum;
+  int * restrict                  sendcnttab;
+  int * restrict                  senddsptab;
+  int * restrict                  recvcnttab;
+  int * restrict                  recvdsptab;
+  int                             sendglbnbr;
+  int                             recvglbnbr;
+  Gnum                            finevertlocnbr;
+  Gnum                            finennd;
+  Gnum                            sortlocnum;
+  int                             procglbnbr;
+  int                             procnum;
+  Gnum                            reduloctab[2];
+  Gnum                            reduglbtab[2];
+  int                             o;
+
+  ordeptr    = cblkptr->ordelocptr;
+  procglbnbr = coargrafptr->s.procglbnbr;
+
+  for (linktmp = linkptr->nextptr, cblklocnbr = 1; /* Count column blocks of compressed ordering, including given one */
+       linktmp != &ordeptr->linkdat; linktmp = linktmp->nextptr)
+    cblklocnbr ++;
+
+  reduloctab[1] = 0;
+  if ((cblkloctab = (DorderCblk **) memAlloc (cblklocnbr * sizeof (DorderCblk *))) == NULL) {
+    errorPrint ("hdgraphOrderCpExpand: out of memory (1)");
+    reduloctab[1] = 1;
+    fraglocnbr    =
+    entrlocnbr    = 0;
+  }
+  else {
+    cblkloctab[0] = cblkptr;
+    for (linktmp = linkptr->nextptr, cblklocnum = 1; linktmp != &ordeptr->linkdat; linktmp = linktmp->nextptr)
+      cblkloctab[cblklocnum ++] = (DorderCblk *) linktmp; /* TRICK: FIRST */
+
+    for (cblklocnum = fraglocnbr = entrlocnbr = 0; cblklocnum < cblklocnbr; cblklocnum ++) {
+      if ((cblkloctab[cblklocnum]->typeval & DORDERCBLKLEAF) != 0) { /* If column block holds a fragment */
+        fraglocnbr ++;
+        entrlocnbr += cblkloctab[cblklocnum]->data.leaf.vnodlocnbr;
+      }
+    }
+
+    finevertlocnbr = coarmembtab[coargrafptr->s.vertlocnbr];
+    if (memAllocGroup ((void **) (void *)
+                       &senddsptab, (size_t) (procglbnbr                                       * sizeof (int)),
+                       &sendcnttab, (size_t) (procglbnbr                                       * sizeof (int)),
+                       &recvdsptab, (size_t) (procglbnbr                                       * sizeof (int)),
+                       &recvcnttab, (size_t) (procglbnbr                                       * sizeof (int)),
+                       &sortsndtab, (size_t) ((entrlocnbr + 1)                                 * sizeof (HdgraphOrderCpSort)), /* "+1" for end marker */
+                       &sortrcvtab, (size_t) (coargrafptr->s.vertlocnbr                        * sizeof (HdgraphOrderCpSort)),
+                       &entridxtab, (size_t) (entrlocnbr                                       * sizeof (Gnum)),
+                       &rplysndtab, (size_t) ((coargrafptr->s.vertlocnbr + finevertlocnbr)     * sizeof (Gnum)),
+                       &fragloctab, (size_t) (fraglocnbr                                       * sizeof (HdgraphOrderCpFrag)), NULL) == NULL) {
+      errorPrint ("hdgraphOrderCpExpand: out of memory (2)");
+      memFree    (cblkloctab);
+      cblkloctab    = NULL;
+      reduloctab[1] = 1;
+    }
+  }
+
+  reduloctab[0] = fraglocnbr;
+  if (MPI_Allreduce (reduloctab, reduglbtab, 2, GNUM_MPI, MPI_SUM, coargrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpExpand: communication error (1)");
+    reduglbtab[1] = 1;
+  }
+  if (reduglbtab[1] != 0) {
+    if (cblkloctab != NULL) {
+      memFree (senddsptab);                       /* Free group leader */
+      memFree (cblkloctab);
+    }
+    return (1);
+  }
+  fragglbnbr = reduglbtab[0];
+
+  for (cblklocnum = entrlocnum = 0; cblklocnum < cblklocnbr; cblklocnum ++) { /* Build requests for all fragment entries */
+    const DorderCblk * restrict cblktmp;
+    Gnum                        leaflocnum;
+
+    cblktmp = cblkloctab[cblklocnum];
+    if ((cblktmp->typeval & DORDERCBLKLEAF) == 0)
+      continue;
+
+    for (leaflocnum = 0; leaflocnum < cblktmp->data.leaf.vnodlocnbr; leaflocnum ++, entrlocnum ++) {
+      sortsndtab[entrlocnum].vertnum = cblktmp->data.leaf.periloctab[leaflocnum];
+      sortsndtab[entrlocnum].entrnum = entrlocnum;
+    }
+  }
+  sortsndtab[entrlocnbr].vertnum =                /* Set end marker */
+  sortsndtab[entrlocnbr].entrnum = GNUMMAX;
+  intSort2asc1 (sortsndtab, entrlocnbr);          /* Sort requests by coarse vertex numbers, without marker */
+
+  for (sortlocnum = 0, procnum = 0; procnum < procglbnbr; procnum ++) {
+    Gnum                sortsndnbr;
+    Gnum                procdspval;
+
+    procdspval = coargrafptr->s.procdsptab[procnum + 1];
+    for (sortsndnbr = 0; sortsndtab[sortlocnum].vertnum < procdspval; sortlocnum ++)
+      sortsndnbr ++;
+    sendcnttab[procnum] = (int) (sortsndnbr * 2); /* "*2" because a Sort is 2 Gnums */
+  }
+#ifdef SCOTCH_DEBUG_HDGRAPH2
+  if (sortlocnum != entrlocnbr) {
+    errorPrint ("hdgraphOrderCpExpand: internal error (1)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_HDGRAPH2 */
+
+  if (MPI_Alltoall (sendcnttab, 1, MPI_INT, recvcnttab, 1, MPI_INT, coargrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpExpand: communication error (2)");
+    return     (1);
+  }
+  for (procnum = 0, sendglbnbr = recvglbnbr = 0; procnum < procglbnbr; procnum ++) {
+    senddsptab[procnum] = sendglbnbr;
+    sendglbnbr += sendcnttab[procnum];
+    recvdsptab[procnum] = recvglbnbr;
+    recvglbnbr += recvcnttab[procnum];
+  }
+  if (MPI_Alltoallv (sortsndtab, sendcnttab, senddsptab, GNUM_MPI,
+                     sortrcvtab, recvcnttab, recvdsptab, GNUM_MPI, coargrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpExpand: communication error (3)");
+    return     (1);
+  }
+
+  for (procnum = 0, sortlocnum = rplysndnum = 0; procnum < procglbnbr; procnum ++) { /* Reply with size and fine vertex list of requested vertices */
+    Gnum                sortlocnnd;
+    Gnum                rplysndbas;
+
+    rplysndbas = rplysndnum;
+    for (sortlocnnd = sortlocnum + recvcnttab[procnum] / 2; sortlocnum < sortlocnnd; sortlocnum ++) {
+      Gnum                coarvertlocnum;
+      Gnum                finemembnum;
+
+      coarvertlocnum = sortrcvtab[sortlocnum].vertnum - coargrafptr->s.procdsptab[coargrafptr->s.proclocnum];
+#ifdef SCOTCH_DEBUG_HDGRAPH2
+      if ((coarvertlocnum < 0) || (coarvertlocnum >= coargrafptr->s.vertlocnbr)) {
+        errorPrint ("hdgraphOrderCpExpand: internal error (2)");
+        return     (1);
+      }
+#endif /* SCOTCH_DEBUG_HDGRAPH2 */
+      rplysndtab[rplysndnum ++] = coarmembtab[coarvertlocnum + 1] - coarmembtab[coarvertlocnum];
+      for (finemembnum = coarmembtab[coarvertlocnum]; finemembnum < coarmembtab[coarvertlocnum + 1]; finemembnum ++)
+        rplysndtab[rplysndnum ++] = finemembtab[finemembnum];
+    }
+    sendcnttab[procnum] = (int) (rplysndnum - rplysndbas);
+  }
+
+  if (MPI_Alltoall (sendcnttab, 1, MPI_INT, recvcnttab, 1, MPI_INT, coargrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpExpand: communication error (4)");
+    return     (1);
+  }
+  for (procnum = 0, sendglbnbr = recvglbnbr = 0; procnum < procglbnbr; procnum ++) {
+    senddsptab[procnum] = sendglbnbr;
+    sendglbnbr += sendcnttab[procnum];
+    recvdsptab[procnum] = recvglbnbr;
+    recvglbnbr += recvcnttab[procnum];
+  }
+  rplyrcvnbr = (Gnum) recvglbnbr;
+
+  o = 1;                                          /* Assume an error */
+  if ((rplyrcvtab = (Gnum *) memAlloc ((rplyrcvnbr + 1) * sizeof (Gnum))) == NULL) { /* "+1" in case no reply is received */
+    errorPrint ("hdgraphOrderCpExpand: out of memory (3)");
+    goto abort1;
+  }
+  if (MPI_Alltoallv (rplysndtab, sendcnttab, senddsptab, GNUM_MPI,
+                     rplyrcvtab, recvcnttab, recvdsptab, GNUM_MPI, coargrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpExpand: communication error (5)");
+    goto abort2;
+  }
+
+  for (sortlocnum = rplyrcvnum = 0; sortlocnum < entrlocnbr; sortlocnum ++) { /* Replies come in the order of sorted requests */
+    entridxtab[sortsndtab[sortlocnum].entrnum] = rplyrcvnum;
+    rplyrcvnum += rplyrcvtab[rplyrcvnum] + 1;
+  }
+#ifdef SCOTCH_DEBUG_HDGRAPH2
+  if (rplyrcvnum != rplyrcvnbr) {
+    errorPrint ("hdgraphOrderCpExpand: internal error (3)");
+    goto abort2;
+  }
+#endif /* SCOTCH_DEBUG_HDGRAPH2 */
+
+  for (cblklocnum = entrlocnum = 0, fraglocnbr = 0; cblklocnum < cblklocnbr; cblklocnum ++) { /* Compute fine sizes of local fragments */
+    const DorderCblk * restrict cblktmp;
+    Gnum                        entrlocnnd;
+    Gnum                        finesizval;
+
+    cblktmp = cblkloctab[cblklocnum];
+    if ((cblktmp->typeval & DORDERCBLKLEAF) == 0)
+      continue;
+
+    for (entrlocnnd = entrlocnum + cblktmp->data.leaf.vnodlocnbr, finesizval = 0; entrlocnum < entrlocnnd; entrlocnum ++)
+      finesizval += rplyrcvtab[entridxtab[entrlocnum]];
+    fragloctab[fraglocnbr].ordenum   = cblktmp->data.leaf.ordelocval;
+    fragloctab[fraglocnbr ++].finenum = finesizval;
+  }
+
+  if ((fragglbtab = (HdgraphOrderCpFrag *) memAlloc ((fragglbnbr + 1) * sizeof (HdgraphOrderCpFrag))) == NULL) {
+    errorPrint ("hdgraphOrderCpExpand: out of memory (4)");
+    goto abort2;
+  }
+  sendglbnbr = (int) (fraglocnbr * 2);            /* "*2" because a Frag is 2 Gnums */
+  if (MPI_Allgather (&sendglbnbr, 1, MPI_INT, recvcnttab, 1, MPI_INT, coargrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpExpand: communication error (6)");
+    goto abort3;
+  }
+  for (procnum = 0, recvglbnbr = 0; procnum < procglbnbr; procnum ++) {
+    recvdsptab[procnum] = recvglbnbr;
+    recvglbnbr += recvcnttab[procnum];
+  }
+  if (MPI_Allgatherv (fragloctab, sendglbnbr, GNUM_MPI,
+                      fragglbtab, recvcnttab, recvdsptab, GNUM_MPI, coargrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("hdgraphOrderCpExpand: communication error (7)");
+    goto abort3;
+  }
+  intSort2asc1 (fragglbtab, fragglbnbr);          /* Sort fragments by coarse start index */
+  for (fragglbnum = 0, finennd = cblkptr->ordeglbval; fragglbnum < fragglbnbr; fragglbnum ++) { /* Turn fine sizes into fine start indices */
+    Gnum                finesizval;
+
+    finesizval = fragglbtab[fragglbnum].finenum;
+    fragglbtab[fragglbnum].finenum = finennd;
+    finennd += finesizval;
+  }
+
+  for (cblklocnum = entrlocnum = 0; cblklocnum < cblklocnbr; cblklocnum ++) { /* Expand all column blocks */
+    DorderCblk * restrict cblktmp;
+    Gnum                  ordeglbnnd;
+
+    cblktmp = cblkloctab[cblklocnum];
+
+    ordeglbnnd = cblktmp->ordeglbval + cblktmp->vnodglbnbr;
+    cblktmp->ordeglbval = hdgraphOrderCpFine (fragglbtab, fragglbnbr, finennd, cblktmp->ordeglbval);
+    cblktmp->vnodglbnbr = hdgraphOrderCpFine (fragglbtab, fragglbnbr, finennd, ordeglbnnd) - cblktmp->ordeglbval;
+
+    if ((cblktmp->typeval & DORDERCBLKLEAF) != 0) {
+      Gnum * restrict     perifinetab;
+      Gnum                perifinenum;
+      Gnum                entrlocbas;
+      Gnum                entrlocnnd;
+      Gnum                nodelocnum;
+
+      entrlocbas = entrlocnum;
+      entrlocnnd = entrlocnum + cblktmp->data.leaf.vnodlocnbr;
+      for (perifinenum = 0; entrlocnum < entrlocnnd; entrlocnum ++) /* Compute fine size of fragment */
+        perifinenum += rplyrcvtab[entridxtab[entrlocnum]];
+
+      if ((perifinetab = (Gnum *) memAlloc ((perifinenum + 1) * sizeof (Gnum))) == NULL) { /* "+1" for empty fragments */
+        errorPrint ("hdgraphOrderCpExpand: out of memory (5)");
+        goto abort3;
+      }
+      for (entrlocnum = entrlocbas, perifinenum = 0; entrlocnum < entrlocnnd; entrlocnum ++) { /* Expand inverse permutation fragment */
+        Gnum                rplyrcvnnd;
+
+        rplyrcvnum = entridxtab[entrlocnum];
+        for (rplyrcvnnd = rplyrcvnum + rplyrcvtab[rplyrcvnum] + 1, rplyrcvnum ++; rplyrcvnum < rplyrcvnnd; rplyrcvnum ++)
+          perifinetab[perifinenum ++] = rplyrcvtab[rplyrcvnum];
+      }
+
+      if (cblktmp->data.leaf.nodelocnbr > 0) {    /* If fragment holds a sequential sub-tree, expand node sizes */
+        DorderNode * restrict nodeloctab;
+        Gnum                  nodelocnbr;
+
+        nodeloctab = cblktmp->data.leaf.nodeloctab;
+        nodelocnbr = cblktmp->data.leaf.nodelocnbr;
+        for (nodelocnum = 0, entrlocnum = entrlocbas; nodelocnum < nodelocnbr; nodelocnum ++) { /* Nodes are in prefix order */
+          Gnum                entrlocend;
+          Gnum                vnodfinnbr;
+
+          if (((nodelocnum + 1) < nodelocnbr) &&  /* If node has sons, its size is the sum of theirs */
+              (nodeloctab[nodelocnum + 1].fathnum == nodelocnum)) {
+            nodeloctab[nodelocnum].vnodnbr = 0;
+            continue;
+          }
+          for (entrlocend = entrlocnum + nodeloctab[nodelocnum].vnodnbr, vnodfinnbr = 0; entrlocnum < entrlocend; entrlocnum ++)
+            vnodfinnbr += rplyrcvtab[entridxtab[entrlocnum]];
+          nodeloctab[nodelocnum].vnodnbr = vnodfinnbr;
+        }
+#ifdef SCOTCH_DEBUG_HDGRAPH2
+        if (entrlocnum != entrlocnnd) {
+          errorPrint ("hdgraphOrderCpExpand: internal error (4)");
+          memFree    (perifinetab);
+          goto abort3;
+        }
+#endif /* SCOTCH_DEBUG_HDGRAPH2 */
+        for (nodelocnum = nodelocnbr - 1; nodelocnum >= 0; nodelocnum --) { /* Accumulate sizes of sons into fathers */
+          if (nodeloctab[nodelocnum].fathnum >= 0)
+            nodeloctab[nodeloctab[nodelocnum].fathnum].vnodnbr += nodeloctab[nodelocnum].vnodnbr;
+        }
+      }
+
+      memFree (cblktmp->data.leaf.periloctab);
+      cblktmp->data.leaf.periloctab = perifinetab;
+      cblktmp->data.leaf.ordelocval = hdgraphOrderCpFine (fragglbtab, fragglbnbr, finennd, cblktmp->data.leaf.ordelocval);
+      cblktmp->data.leaf.vnodlocnbr = perifinenum;
+      entrlocnum = entrlocnnd;
+    }
+  }
+
+  o = 0;                                          /* Expansion succeeded */
+abort3 :
+  memFree (fragglbtab);
+abort2 :
+  memFree (rplyrcvtab);
+abort1 :
+  memFree (senddsptab);                           /* Free group leader */
+  memFree (cblkloctab);
+
+  return (o);
+}
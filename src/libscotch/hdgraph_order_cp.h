@@ -0,0 +1,88 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hdgraph_order_cp.h                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the data declara-  **/
+/**                tions for the distributed graph         **/
+/**                compression ordering routine.           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct HdgraphOrderCpParam_ {
+  double                    comprat;              /*+ Compression ratio threshold             +*/
+  Strat *                   stratcpr;             /*+ Compressed subgraph ordering strategy   +*/
+  Strat *                   stratunc;             /*+ Uncompressed subgraph ordering strategy +*/
+} HdgraphOrderCpParam;
+
+/*+ This structure holds the sort pairs used
+    to request the fine vertex lists of the
+    coarse vertices held in local fragments. +*/
+
+typedef struct HdgraphOrderCpSort_ {
+  Gnum                      vertnum;              /*+ Global coarse vertex number     +*/
+  Gnum                      entrnum;              /*+ Index in local fragment entries +*/
+} HdgraphOrderCpSort;
+
+/*+ This structure holds the inverse permutation
+    fragments of the compressed ordering. The
+    finenum field first holds the fine size of
+    the fragment, then its fine start index.     +*/
+
+typedef struct HdgraphOrderCpFrag_ {
+  Gnum                      ordenum;              /*+ Coarse start index of fragment +*/
+  Gnum                      finenum;              /*+ Fine size, then fine start     +*/
+} HdgraphOrderCpFrag;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_HDGRAPH_ORDER_CP
+static int                  hdgraphOrderCpCompress (Hdgraph * restrict const, Hdgraph * restrict const, Gnum ** const, Gnum ** const, const double);
+static Gnum                 hdgraphOrderCpFine  (const HdgraphOrderCpFrag * restrict const, const Gnum, const Gnum, const Gnum);
+static int                  hdgraphOrderCpExpand (const Hdgraph * restrict const, DorderCblk * restrict const, DorderLink * const, const Gnum * restrict const, const Gnum * restrict const);
+#endif /* SCOTCH_HDGRAPH_ORDER_CP */
+
+int                         hdgraphOrderCp      (Hdgraph * restrict const, DorderCblk * restrict const, const HdgraphOrderCpParam * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2012,2019,2022,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2012,2019,2022,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 12 sep 2012     **/
 /**                                 to   : 01 may 2019     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -204,11 +204,13 @@ HdgraphOrderNdGraph * restrict const  fldgrafptr)
     Hdgraph             orggrafdat;               /* Structure for copying graph fields except communicator */
 
     orggrafdat = *orggrafptr;                     /* Create a separate graph structure to change its communicator */
+    orggrafdat.s.flagval &= ~(DGRAPHHASNGBCOMM | DGRAPHFREENGBCOMM); /* Neighborhood communicator of copy will be built on new communicator */
     fldthrdtab[1].orggrafptr = &orggrafdat;
     MPI_Comm_dup (orggrafptr->s.proccomm, &orggrafdat.s.proccomm); /* Duplicate communicator to avoid interferences in communications */
 
     contextThreadLaunch (orggrafptr->contptr, (ThreadFunc) hdgraphOrderNdFold3, (void *) fldthrdtab); /* Only threads 0 and 1 will work */
 
+    dgraphNgbFree (&orggrafdat.s);                /* Free neighborhood communicator of copy, if any */
     MPI_Comm_free (&orggrafdat.s.proccomm);
 
     o = ((fldthrdtab[0].orggrafptr == NULL) ||    /* See if an error occured */
@@ -301,6 +303,8 @@ const HdgraphOrderNdParam * restrict const  paraptr)
     goto abort;
 
   vspgrafdat.partgsttax -= vspgrafdat.s.baseval;
+  vspgrafdat.dwgttab[0]  =                        /* Both parts are evenly weighted                       */
+  vspgrafdat.dwgttab[1]  = 1;
   vspgrafdat.levlnum     = grafptr->levlnum;      /* Set level of separation graph as level of halo graph */
   vspgrafdat.contptr     = grafptr->contptr;
   vdgraphZero (&vspgrafdat);                      /* Set all local vertices to part 0 */
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 5.1  : from : 11 nov 2008     **/
 /**                                 to   : 11 nov 2008     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -62,6 +62,7 @@
 #include "dgraph.h"
 #include "dorder.h"
 #include "hdgraph.h"
+#include "hdgraph_order_cp.h"
 #include "hdgraph_order_nd.h"
 #include "hdgraph_order_si.h"
 #include "hdgraph_order_sq.h"
@@ -75,6 +76,11 @@
 
 static Hdgraph              hdgraphorderstgraphdummy; /* Dummy graph for offset computations */
 
+static union {                                    /* Default parameters for compression method */
+  HdgraphOrderCpParam       param;
+  StratNodeMethodData       padding;
+} hdgraphorderstdefaultcp = { { 0.70L, &stratdummy, &stratdummy } };
+
 static union {                                    /* Default parameters for nested dissection method */
   HdgraphOrderNdParam       param;
   StratNodeMethodData       padding;
@@ -86,12 +92,25 @@ static union {                                    /* Default parameters for sequ
 } hdgraphorderstdefaultsq = { { &stratdummy } };
 
 static StratMethodTab       hdgraphorderstmethtab[] = { /* Graph ordering methods array */
+                              { HDGRAPHORDERSTMETHCP, "c",  hdgraphOrderCp, &hdgraphorderstdefaultcp },
                               { HDGRAPHORDERSTMETHND, "n",  hdgraphOrderNd, &hdgraphorderstdefaultnd },
                               { HDGRAPHORDERSTMETHSI, "s",  hdgraphOrderSi, NULL },
                               { HDGRAPHORDERSTMETHSQ, "q",  hdgraphOrderSq, &hdgraphorderstdefaultsq },
                               { -1,                   NULL, NULL,           NULL } };
 
 static StratParamTab        hdgraphorderstparatab[] = { /* The method parameter list */
+                              { HDGRAPHORDERSTMETHCP,  STRATPARAMDOUBLE, "rat",
+                                (byte *) &hdgraphorderstdefaultcp.param,
+                                (byte *) &hdgraphorderstdefaultcp.param.comprat,
+                                NULL },
+                              { HDGRAPHORDERSTMETHCP,  STRATPARAMSTRAT,  "cpr",
+                                (byte *) &hdgraphorderstdefaultcp.param,
+                                (byte *) &hdgraphorderstdefaultcp.param.stratcpr,
+                                (void *) &hdgraphorderststratab },
+                              { HDGRAPHORDERSTMETHCP,  STRATPARAMSTRAT,  "unc",
+                                (byte *) &hdgraphorderstdefaultcp.param,
+                                (byte *) &hdgraphorderstdefaultcp.param.stratunc,
+                                (void *) &hdgraphorderststratab },
                               { HDGRAPHORDERSTMETHND,  STRATPARAMSTRAT,  "sep",
                                 (byte *) &hdgraphorderstdefaultnd.param,
                                 (byte *) &hdgraphorderstdefaultnd.param.sepstrat,
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,6 +45,8 @@
 /**                                 to   : 11 nov 2008     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -55,7 +57,8 @@
 /*+ Method types. +*/
 
 typedef enum HdgraphOrderStMethodType_ {
-  HDGRAPHORDERSTMETHND = 0,                       /*+ Nested Dissection +*/
+  HDGRAPHORDERSTMETHCP = 0,                       /*+ Compression       +*/
+  HDGRAPHORDERSTMETHND,                           /*+ Nested Dissection +*/
   HDGRAPHORDERSTMETHSI,                           /*+ Simple            +*/
   HDGRAPHORDERSTMETHSQ,                           /*+ Sequential method +*/
   HDGRAPHORDERSTMETHNBR                           /*+ Number of methods +*/
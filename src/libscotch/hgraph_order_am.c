@@ -0,0 +1,509 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hgraph_order_am.c                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module post-processes the column   **/
+/**                block tree of an ordering, by merging   **/
+/**                small leaf column blocks under a fill   **/
+/**                tolerance, and by reordering            **/
+/**                independent sibling subtrees.           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # Column counts are computed on the     **/
+/**                  non-halo part of the subgraph only,   **/
+/**                  so that the fill estimates of the     **/
+/**                  merged blocks are exact only when     **/
+/**                  the method is applied to the whole    **/
+/**                  graph.                                **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_HGRAPH_ORDER_AM
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "order.h"
+#include "order_stat.h"
+#include "hgraph.h"
+#include "hgraph_order_am.h"
+#include "hgraph_order_st.h"
+
+/*
+**  The static routines.
+*/
+
+/* This routine sorts an array of
+** sibling subtrees by ascending
+** order of their keys.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+#define INTSORTQUAL                 static
+#define INTSORTNAME                 hgraphOrderAmSort
+#define INTSORTSIZE                 (sizeof (HgraphOrderAmSort))
+#define INTSORTSWAP(p,q)            do {                                                           \
+                                      HgraphOrderAmSort t;                                         \
+                                      t = *((HgraphOrderAmSort *) (p));                            \
+                                      *((HgraphOrderAmSort *) (p)) = *((HgraphOrderAmSort *) (q)); \
+                                      *((HgraphOrderAmSort *) (q)) = t;                            \
+                                    } while (0)
+#define INTSORTCMP(p,q)             ((((HgraphOrderAmSort *) (p))->keyval < ((HgraphOrderAmSort *) (q))->keyval) || \
+                                     ((((HgraphOrderAmSort *) (p))->keyval == ((HgraphOrderAmSort *) (q))->keyval) && \
+                                      (((HgraphOrderAmSort *) (p))->cblknum < ((HgraphOrderAmSort *) (q))->cblknum)))
+#include "common_sort.c"
+#undef INTSORTQUAL
+#undef INTSORTNAME
+#undef INTSORTSIZE
+#undef INTSORTSWAP
+#undef INTSORTCMP
+
+/* This routine computes the statistics
+** of the leaf column block of given
+** permuted range.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+hgraphOrderAmLeaf (
+const HgraphOrderAmData * restrict const  dataptr,
+const Gnum                                vnodbas,
+const Gnum                                vnodnbr,
+HgraphOrderAmStat * restrict const        statptr)
+{
+  Gnum                vnodnum;
+  double              wghtsum;
+  double              wghtsqr;
+  double              mdifval;
+  double              fnnzval;
+
+  const Gnum * restrict const velotax = dataptr->velotax;
+  const Gnum * restrict const peritab = dataptr->peritab;
+  const Gnum * restrict const ccnttab = dataptr->ccnttab;
+
+  wghtsum =
+  wghtsqr =
+  mdifval =
+  fnnzval = 0.0;
+  for (vnodnum = vnodbas + vnodnbr - 1; vnodnum >= vnodbas; vnodnum --) { /* Scan block backwards to get trailing sizes */
+    double              veloval;
+    double              ccntval;
+
+    veloval  = (velotax != NULL) ? (double) velotax[peritab[vnodnum]] : 1.0;
+    ccntval  = (double) ccnttab[vnodnum];
+    wghtsum += veloval;
+    wghtsqr += veloval * veloval;
+    fnnzval += veloval * ccntval;
+    if ((ccntval - wghtsum) > mdifval)            /* Rows of column beyond end of block */
+      mdifval = ccntval - wghtsum;
+  }
+
+  statptr->wghtsum = wghtsum;
+  statptr->wghtsqr = wghtsqr;
+  statptr->mdifval = mdifval;
+  statptr->fnnzval = fnnzval;
+  statptr->peakval = (wghtsum + mdifval) * (wghtsum + mdifval + 1.0) * 0.5; /* Frontal matrix        */
+  statptr->cbsival = mdifval * (mdifval + 1.0) * 0.5; /* Contribution block passed to father */
+}
+
+/* This routine computes the statistics
+** of the leaf column block resulting
+** from the merging of two adjacent
+** leaf blocks.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+hgraphOrderAmMerge (
+const HgraphOrderAmStat * restrict const  fstaptr, /*+ First block  +*/
+const HgraphOrderAmStat * restrict const  lstaptr, /*+ Second block +*/
+HgraphOrderAmStat * restrict const        statptr)
+{
+  double              mdifval;
+
+  mdifval = fstaptr->mdifval - lstaptr->wghtsum;  /* Trailing sizes of first block columns now include second block */
+  if (mdifval < lstaptr->mdifval)
+    mdifval = lstaptr->mdifval;
+
+  statptr->wghtsum = fstaptr->wghtsum + lstaptr->wghtsum;
+  statptr->wghtsqr = fstaptr->wghtsqr + lstaptr->wghtsqr;
+  statptr->mdifval = mdifval;
+  statptr->fnnzval = fstaptr->fnnzval + lstaptr->fnnzval;
+  statptr->peakval = (statptr->wghtsum + mdifval) * (statptr->wghtsum + mdifval + 1.0) * 0.5;
+  statptr->cbsival = mdifval * (mdifval + 1.0) * 0.5;
+}
+
+/* This routine tells whether a merged
+** block can be accepted, given the
+** weight of its smaller part. The
+** block is considered dense, and its
+** extra fill is compared to its size.
+** It returns:
+** - 0   : if the merged block is rejected.
+** - !0  : if it is accepted.
+*/
+
+static
+int
+hgraphOrderAmAccept (
+const HgraphOrderAmParam * restrict const paraptr,
+const HgraphOrderAmStat * restrict const  statptr,
+const double                              wghtval)
+{
+  double              dnnzval;                    /* Number of terms of dense block */
+
+  if (statptr->wghtsum > (double) paraptr->colmax) /* If merged block would be too large */
+    return (0);
+  if (wghtval < (double) paraptr->colmin)         /* If part is too small, always merge */
+    return (1);
+
+  dnnzval = (statptr->wghtsum * statptr->wghtsum + statptr->wghtsqr) * 0.5 + statptr->wghtsum * statptr->mdifval;
+  return ((dnnzval - statptr->fnnzval) <= (dnnzval * paraptr->fillrat));
+}
+
+/* This routine post-processes the given
+** column block subtree, which starts at
+** the given permuted index. Sons are
+** processed first, then independent sons
+** are reordered, and adjacent leaf sons
+** are merged whenever possible.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+hgraphOrderAmTree (
+HgraphOrderAmData * restrict const  dataptr,
+OrderCblk * restrict const          cblkptr,
+const Gnum                          vnodbas,
+HgraphOrderAmStat * restrict const  statptr)
+{
+  HgraphOrderAmStat * restrict  stattab;          /* Statistics of sons                     */
+  HgraphOrderAmStat * restrict  stattmp;          /* Statistics of sons while reordering    */
+  HgraphOrderAmSort * restrict  sorttab;          /* Sort array for independent sons        */
+  OrderCblk * restrict          cblktmp;          /* Column blocks of sons while reordering */
+  Gnum * restrict               vnodtab;          /* Start index of sons                    */
+  Gnum                          cblknbr;
+  Gnum                          cblknum;
+  Gnum                          cblkcur;
+  Gnum                          cblkidp;          /* Number of independent sons, if any     */
+  Gnum                          vnodnum;
+  double                        peakval;
+  double                        cbsival;
+  double                        wghtsum;
+
+  const HgraphOrderAmParam * restrict const paraptr = dataptr->paraptr;
+
+  if (cblkptr->cblktab == NULL) {                 /* If leaf column block */
+    hgraphOrderAmLeaf (dataptr, vnodbas, cblkptr->vnodnbr, statptr);
+    return (0);
+  }
+
+  cblknbr = cblkptr->cblknbr;
+  if (memAllocGroup ((void **) (void *)
+                     &stattab, (size_t) (cblknbr * sizeof (HgraphOrderAmStat)),
+                     &stattmp, (size_t) (cblknbr * sizeof (HgraphOrderAmStat)),
+                     &sorttab, (size_t) (cblknbr * sizeof (HgraphOrderAmSort)),
+                     &cblktmp, (size_t) (cblknbr * sizeof (OrderCblk)),
+                     &vnodtab, (size_t) (cblknbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hgraphOrderAmTree: out of memory");
+    return     (1);
+  }
+
+  for (cblknum = 0, vnodnum = vnodbas; cblknum < cblknbr; cblknum ++) { /* Process sons first */
+    vnodtab[cblknum] = vnodnum;
+    if (hgraphOrderAmTree (dataptr, &cblkptr->cblktab[cblknum], vnodnum, &stattab[cblknum]) != 0) {
+      memFree (stattab);                          /* Free group leader */
+      return  (1);
+    }
+    vnodnum += cblkptr->cblktab[cblknum].vnodnbr;
+  }
+
+  switch (cblkptr->typeval) {                     /* Sons which can be freely reordered come first */
+    case ORDERCBLKDICO :
+      cblkidp = cblknbr;
+      break;
+    case ORDERCBLKNEDI :
+      cblkidp = (cblknbr == 3) ? 2 : cblknbr;     /* Do not move separator, if any */
+      break;
+    default :
+      cblkidp = 0;                                /* Dependencies between sons are not known */
+  }
+
+  if ((paraptr->sortval != HGRAPHORDERAMTYPENONE) && (cblkidp > 1)) {
+    for (cblknum = 0; cblknum < cblkidp; cblknum ++) {
+      sorttab[cblknum].keyval = (paraptr->sortval == HGRAPHORDERAMTYPEMEMO) /* Liu's order for multifrontal peak memory */
+                                ? (stattab[cblknum].cbsival - stattab[cblknum].peakval)
+                                : stattab[cblknum].wghtsum;
+      sorttab[cblknum].cblknum = cblknum;
+    }
+    hgraphOrderAmSort (sorttab, cblkidp);
+
+    for (cblknum = 0; cblknum < cblkidp; cblknum ++) { /* Check whether permutation is identity */
+      if (sorttab[cblknum].cblknum != cblknum)
+        break;
+    }
+    if (cblknum < cblkidp) {                      /* If sons have to be moved */
+      Gnum * restrict const wperitab = dataptr->wperitab;
+      Gnum * restrict const wccnttab = dataptr->wccnttab;
+
+      for (cblknum = 0, vnodnum = vnodbas; cblknum < cblkidp; cblknum ++) {
+        Gnum                cblkold;
+        Gnum                vnodnbr;
+
+        cblkold = sorttab[cblknum].cblknum;
+        vnodnbr = cblkptr->cblktab[cblkold].vnodnbr;
+        memCpy (wperitab + vnodnum, dataptr->peritab + vnodtab[cblkold], vnodnbr * sizeof (Gnum));
+        memCpy (wccnttab + vnodnum, dataptr->ccnttab + vnodtab[cblkold], vnodnbr * sizeof (Gnum));
+        cblktmp[cblknum] = cblkptr->cblktab[cblkold];
+        stattmp[cblknum] = stattab[cblkold];
+        vnodnum += vnodnbr;
+      }
+      memCpy (dataptr->peritab + vnodbas, wperitab + vnodbas, (vnodnum - vnodbas) * sizeof (Gnum));
+      memCpy (dataptr->ccnttab + vnodbas, wccnttab + vnodbas, (vnodnum - vnodbas) * sizeof (Gnum));
+      memCpy (cblkptr->cblktab, cblktmp, cblkidp * sizeof (OrderCblk));
+      memCpy (stattab,          stattmp, cblkidp * sizeof (HgraphOrderAmStat));
+    }
+  }
+
+  if ((cblkptr->typeval == ORDERCBLKNEDI) && (cblknbr == 3)) { /* Nested dissection node can only be merged as a whole */
+    if ((cblkptr->cblktab[0].cblktab == NULL) &&
+        (cblkptr->cblktab[1].cblktab == NULL) &&
+        (cblkptr->cblktab[2].cblktab == NULL)) {
+      hgraphOrderAmMerge (&stattab[0], &stattab[1], &stattmp[0]);
+      hgraphOrderAmMerge (&stattmp[0], &stattab[2], &stattmp[1]);
+      if (hgraphOrderAmAccept (paraptr, &stattmp[1], stattmp[0].wghtsum)) {
+        *statptr = stattmp[1];
+        memFree (cblkptr->cblktab);
+        cblkptr->typeval  = ORDERCBLKOTHR;        /* Node becomes a leaf */
+        cblkptr->cblknbr  = 0;
+        cblkptr->cblktab  = NULL;
+        dataptr->treenbr += 3;
+        dataptr->cblknbr += 2;
+        memFree (stattab);                        /* Free group leader */
+        return  (0);
+      }
+    }
+  }
+  else {                                          /* Sequence of sons: merge adjacent leaves backwards */
+    Gnum                cblkend;
+
+    for (cblkcur = cblknbr - 1, cblknum = cblknbr - 2; cblknum >= 0; cblknum --) {
+      if ((cblkptr->cblktab[cblknum].cblktab == NULL) &&
+          (cblkptr->cblktab[cblkcur].cblktab == NULL)) {
+        hgraphOrderAmMerge (&stattab[cblknum], &stattab[cblkcur], &stattmp[0]);
+        if (hgraphOrderAmAccept (paraptr, &stattmp[0], stattab[cblknum].wghtsum)) {
+          cblkptr->cblktab[cblkcur].vnodnbr += cblkptr->cblktab[cblknum].vnodnbr;
+          cblkptr->cblktab[cblknum].vnodnbr  = 0; /* Flag block as merged */
+          stattab[cblkcur] = stattmp[0];
+          continue;
+        }
+      }
+      cblkcur = cblknum;
+    }
+
+    for (cblknum = cblkend = 0; cblknum < cblknbr; cblknum ++) { /* Compact remaining sons */
+      if (cblkptr->cblktab[cblknum].vnodnbr == 0)
+        continue;
+      cblkptr->cblktab[cblkend] = cblkptr->cblktab[cblknum];
+      stattab[cblkend ++]       = stattab[cblknum];
+    }
+    dataptr->treenbr += cblknbr - cblkend;
+    dataptr->cblknbr += cblknbr - cblkend;
+
+    if ((cblkend == 1) && (cblkptr->cblktab[0].cblktab == NULL)) { /* If only one leaf remains */
+      *statptr = stattab[0];
+      memFree (cblkptr->cblktab);
+      cblkptr->typeval  = ORDERCBLKOTHR;          /* Node becomes this leaf */
+      cblkptr->cblknbr  = 0;
+      cblkptr->cblktab  = NULL;
+      dataptr->treenbr ++;
+      memFree (stattab);                          /* Free group leader */
+      return  (0);
+    }
+    cblknbr          =
+    cblkptr->cblknbr = cblkend;
+  }
+
+  for (cblknum = 0, wghtsum = 0.0; cblknum < cblknbr; cblknum ++)
+    wghtsum += stattab[cblknum].wghtsum;
+  if ((cblkptr->typeval == ORDERCBLKNEDI) && (cblknbr == 3)) { /* Contribution blocks of parts are assembled into separator */
+    peakval = MAX (stattab[0].peakval, stattab[0].cbsival + stattab[1].peakval);
+    peakval = MAX (peakval, stattab[0].cbsival + stattab[1].cbsival + stattab[2].peakval);
+    cbsival = stattab[2].cbsival;
+  }
+  else {                                          /* Contribution blocks of sons are stacked */
+    for (cblknum = 0, peakval = cbsival = 0.0; cblknum < cblknbr; cblknum ++) {
+      peakval  = MAX (peakval, cbsival + stattab[cblknum].peakval);
+      cbsival += stattab[cblknum].cbsival;
+    }
+    if (cblkptr->typeval == ORDERCBLKOTHR)        /* Sequence of dependent blocks ends with root block */
+      cbsival = stattab[cblknbr - 1].cbsival;
+  }
+
+  statptr->wghtsum = wghtsum;
+  statptr->wghtsqr =
+  statptr->mdifval =
+  statptr->fnnzval = 0.0;                         /* Compound nodes are never merged */
+  statptr->peakval = peakval;
+  statptr->cbsival = cbsival;
+
+  memFree (stattab);                              /* Free group leader */
+
+  return (0);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the ordering.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+int
+hgraphOrderAm (
+const Hgraph * restrict const             grafptr,
+Order * restrict const                    ordeptr,
+const Gnum                                ordenum, /*+ Zero-based ordering number +*/
+OrderCblk * restrict const                cblkptr, /*+ Single column-block        +*/
+const HgraphOrderAmParam * restrict const paraptr)
+{
+  Hgraph              grafdat;                    /* Copy of subgraph, without vertex numbers */
+  Graph               statgrafdat;                /* Non-halo part of subgraph                */
+  Order               ordedat;                    /* Local ordering of subgraph               */
+  HgraphOrderAmData   datadat;
+  HgraphOrderAmStat   statdat;
+  Gnum *              peritab;
+  Gnum *              ccnttab;
+  Gnum *              wperitab;
+  Gnum *              wccnttab;
+
+  const Gnum                  baseval = grafptr->s.baseval;
+  const Gnum                  vnohnbr = grafptr->vnohnbr;
+  const Gnum * restrict const vnumtax = grafptr->s.vnumtax;
+
+  if (memAllocGroup ((void **) (void *)
+                     &peritab,  (size_t) (vnohnbr * sizeof (Gnum)),
+                     &ccnttab,  (size_t) (vnohnbr * sizeof (Gnum)),
+                     &wperitab, (size_t) (vnohnbr * sizeof (Gnum)),
+                     &wccnttab, (size_t) (vnohnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hgraphOrderAm: out of memory");
+    return     (1);
+  }
+
+  grafdat = *grafptr;                             /* Order subgraph with local vertex numbers */
+  grafdat.s.flagval &= ~GRAPHFREETABS;
+  grafdat.s.vnumtax  = NULL;
+  orderInit (&ordedat, baseval, vnohnbr, peritab);
+  if (hgraphOrderSt (&grafdat, &ordedat, 0, &ordedat.cblktre, paraptr->strat) != 0) {
+    orderExit (&ordedat);
+    memFree   (peritab);                          /* Free group leader */
+    return    (1);
+  }
+
+  memSet (&statgrafdat, 0, sizeof (Graph));       /* Only consider non-halo vertices and edges */
+  statgrafdat.baseval = baseval;
+  statgrafdat.vertnbr = vnohnbr;
+  statgrafdat.vertnnd = grafptr->vnohnnd;
+  statgrafdat.verttax = grafptr->s.verttax;
+  statgrafdat.vendtax = grafptr->vnhdtax;
+  statgrafdat.velotax = grafptr->s.velotax;
+  statgrafdat.edgetax = grafptr->s.edgetax;
+  if (orderStat (&ordedat, &statgrafdat, wperitab - baseval, ccnttab - baseval, NULL, NULL) != 0) {
+    errorPrint ("hgraphOrderAm: cannot compute column counts");
+    orderExit  (&ordedat);
+    memFree    (peritab);
+    return     (1);
+  }
+
+  datadat.paraptr  = paraptr;
+  datadat.velotax  = grafptr->s.velotax;
+  datadat.peritab  = peritab;
+  datadat.ccnttab  = ccnttab;
+  datadat.wperitab = wperitab;
+  datadat.wccnttab = wccnttab;
+  datadat.treenbr  =
+  datadat.cblknbr  = 0;
+  if (hgraphOrderAmTree (&datadat, &ordedat.cblktre, 0, &statdat) != 0) {
+    orderExit (&ordedat);
+    memFree   (peritab);
+    return    (1);
+  }
+
+  *cblkptr = ordedat.cblktre;                     /* Link sub-tree to ordering         */
+  ordedat.cblktre.cblktab = NULL;                 /* Unlink sub-tree from sub-ordering */
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_lock (&ordeptr->mutedat);
+#endif /* SCOTCH_PTHREAD */
+  ordeptr->treenbr += ordedat.treenbr - datadat.treenbr - 1; /* Adjust number of tree nodes    */
+  ordeptr->cblknbr += ordedat.cblknbr - datadat.cblknbr - 1; /* Adjust number of column blocks */
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_unlock (&ordeptr->mutedat);
+#endif /* SCOTCH_PTHREAD */
+
+  if (vnumtax == NULL)                            /* If graph is original graph */
+    memCpy (ordeptr->peritab + ordenum, peritab, vnohnbr * sizeof (Gnum));
+  else {
+    Gnum                vnodnum;
+
+    for (vnodnum = 0; vnodnum < vnohnbr; vnodnum ++)
+      ordeptr->peritab[ordenum + vnodnum] = vnumtax[peritab[vnodnum]];
+  }
+
+  orderExit (&ordedat);
+  memFree   (peritab);                            /* Free group leader */
+
+  return (0);
+}
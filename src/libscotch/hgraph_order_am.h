@@ -0,0 +1,119 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : hgraph_order_am.h                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the column block amalgamation and   **/
+/**                subtree reordering post-processing      **/
+/**                method.                                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Subtree reordering types. +*/
+
+typedef enum HgraphOrderAmType_ {
+  HGRAPHORDERAMTYPENONE = 0,                      /*+ Keep subtree order          +*/
+  HGRAPHORDERAMTYPEMEMO,                          /*+ Minimize peak memory        +*/
+  HGRAPHORDERAMTYPEBLOK                           /*+ Group small blocks together +*/
+} HgraphOrderAmType;
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct HgraphOrderAmParam_ {
+  Strat *                   strat;                /*+ Ordering strategy         +*/
+  INT                       colmin;               /*+ Minimum number of columns +*/
+  INT                       colmax;               /*+ Maximum number of columns +*/
+  double                    fillrat;              /*+ Fill-in ratio             +*/
+  HgraphOrderAmType         sortval;              /*+ Subtree reordering type   +*/
+} HgraphOrderAmParam;
+
+/*+ This structure holds the statistics
+    of a column block subtree. The sizes
+    of leaf blocks are expressed in terms
+    of column weights, so that merging two
+    adjacent blocks can be evaluated in
+    constant time.                         +*/
+
+typedef struct HgraphOrderAmStat_ {
+  double                    wghtsum;              /*+ Sum of column weights                       +*/
+  double                    wghtsqr;              /*+ Sum of squared column weights               +*/
+  double                    mdifval;              /*+ Maximum of column count minus trailing size +*/
+  double                    fnnzval;              /*+ Number of non-zeroes of block columns       +*/
+  double                    peakval;              /*+ Peak memory of multifrontal factorization   +*/
+  double                    cbsival;              /*+ Size of contribution block of subtree root  +*/
+} HgraphOrderAmStat;
+
+/*+ This structure holds the data shared
+    by the tree traversal routines.      +*/
+
+typedef struct HgraphOrderAmData_ {
+  const HgraphOrderAmParam * paraptr;             /*+ Method parameters                          +*/
+  const Gnum *              velotax;              /*+ Vertex load array of subgraph, if any      +*/
+  Gnum *                    peritab;              /*+ Local inverse permutation array [unbased]  +*/
+  Gnum *                    ccnttab;              /*+ Column count array, by permuted index      +*/
+  Gnum *                    wperitab;             /*+ Work array for moving peritab segments     +*/
+  Gnum *                    wccnttab;             /*+ Work array for moving ccnttab segments     +*/
+  Gnum                      treenbr;              /*+ Number of tree nodes removed               +*/
+  Gnum                      cblknbr;              /*+ Number of column blocks removed            +*/
+} HgraphOrderAmData;
+
+/*+ The sort structure, used to reorder
+    independent sibling subtrees.       +*/
+
+typedef struct HgraphOrderAmSort_ {
+  double                    keyval;               /*+ Sort key           +*/
+  Gnum                      cblknum;              /*+ Column block index +*/
+} HgraphOrderAmSort;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_HGRAPH_ORDER_AM
+static int                  hgraphOrderAmAccept (const HgraphOrderAmParam * restrict const, const HgraphOrderAmStat * restrict const, const double);
+static void                 hgraphOrderAmLeaf   (const HgraphOrderAmData * restrict const, const Gnum, const Gnum, HgraphOrderAmStat * restrict const);
+static void                 hgraphOrderAmMerge  (const HgraphOrderAmStat * restrict const, const HgraphOrderAmStat * restrict const, HgraphOrderAmStat * restrict const);
+static int                  hgraphOrderAmTree   (HgraphOrderAmData * restrict const, OrderCblk * restrict const, const Gnum, HgraphOrderAmStat * restrict const);
+#endif /* SCOTCH_HGRAPH_ORDER_AM */
+
+int                         hgraphOrderAm       (const Hgraph * const, Order * const, const Gnum, OrderCblk * const, const HgraphOrderAmParam * const);
@@ -1,4 +1,4 @@
-/* Copyright 2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 04 apr 2018     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 26 apr 2021     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -50,6 +50,8 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_HGRAPH_ORDER_CC
+
 #include "module.h"
 #include "common.h"
 #include "parser.h"
@@ -59,50 +61,42 @@
 #include "hgraph_order_cc.h"
 #include "hgraph_order_st.h"
 
-/*****************************/
-/*                           */
-/* This is the main routine. */
-/*                           */
-/*****************************/
+/*************************************/
+/*                                   */
+/* These routines compute connected  */
+/* components.                       */
+/*                                   */
+/*************************************/
 
-/* This routine performs the ordering.
+/* This routine computes the connected
+** components of the non-halo part of the
+** given graph by breadth-first traversal.
+** Vertices of every component are stored
+** contiguously in queutab, starting from
+** the index held in roottab.
 ** It returns:
-** - 0   : if the ordering could be computed.
-** - !0  : on error.
+** - >0  : number of connected components.
+** - -1  : on error.
 */
 
-int
-hgraphOrderCc (
-const Hgraph * restrict const             grafptr,
-Order * restrict const                    ordeptr,
-const Gnum                                ordenum, /*+ Zero-based ordering number +*/
-OrderCblk * restrict const                cblkptr, /*+ Single column-block        +*/
-const HgraphOrderCcParam * restrict const paraptr)
+static
+Gnum
+hgraphOrderCcComp (
+const Hgraph * restrict const grafptr,
+Gnum * restrict const         flagtax,            /*+ Flag array                 +*/
+Gnum * restrict const         queutab,            /*+ Vertex queue and sub-lists +*/
+Gnum * restrict const         roottab)            /*+ Array of root indices      +*/
 {
-  Hgraph                indgrafdat;
-  Gnum                  indordenum;
-  Gnum * restrict       flagtax;                  /* Flag array                       */
-  Gnum * restrict       roottab;                  /* Array of root indices in queutab */
-  Gnum                  rootnbr;                  /* Number of connected components   */
-  Gnum                  rootnum;
-  Gnum                  vrotnum;                  /* Number of found root vertex      */
-  Gnum * restrict       queutab;                  /* Vertex queue and sub-lists       */
-  Gnum                  qhedidx;
-  Gnum                  qtalidx;
+  Gnum                rootnbr;                    /* Number of connected components */
+  Gnum                vrotnum;                    /* Number of found root vertex    */
+  Gnum                qhedidx;
+  Gnum                qtalidx;
 
   const Gnum * restrict const verttax = grafptr->s.verttax;
   const Gnum * restrict const vnhdtax = grafptr->vnhdtax;
   const Gnum * restrict const edgetax = grafptr->s.edgetax;
 
-  if (memAllocGroup ((void **) (void *)
-                     &queutab, (size_t) ( grafptr->vnohnbr      * sizeof (Gnum)),
-                     &roottab, (size_t) ((grafptr->vnohnbr + 1) * sizeof (Gnum)), /* TRICK: +1 to store end index */
-                     &flagtax, (size_t) ( grafptr->vnohnbr      * sizeof (Gnum)), NULL) == NULL) {
-    errorPrint ("hgraphOrderCc: out of memory");
-    return     (1);
-  }
-  memSet (flagtax, ~0, grafptr->vnohnbr * sizeof (Gnum)); /* Initialize flag array */
-  flagtax -= grafptr->s.baseval;
+  memSet (flagtax + grafptr->s.baseval, ~0, grafptr->vnohnbr * sizeof (Gnum)); /* Initialize flag array */
 
   rootnbr = 0;
   qhedidx =
@@ -122,8 +116,8 @@ const HgraphOrderCcParam * restrict const paraptr)
       vertnum = queutab[qhedidx ++];              /* Get vertex from queue */
 #ifdef SCOTCH_DEBUG_ORDER2
       if ((vertnum < grafptr->s.baseval) || (vertnum >= grafptr->vnohnnd)) {
-        errorPrint ("hgraphOrderCc: internal error (1)");
-        return     (1);
+        errorPrint ("hgraphOrderCcComp: internal error (1)");
+        return     (-1);
       }
 #endif /* SCOTCH_DEBUG_ORDER2 */
 
@@ -138,8 +132,8 @@ const HgraphOrderCcParam * restrict const paraptr)
 #ifdef SCOTCH_DEBUG_ORDER2
         else {
           if (flagtax[vertend] != rootnbr) {
-            errorPrint ("hgraphOrderCc: internal error (2)");
-            return     (1);
+            errorPrint ("hgraphOrderCcComp: internal error (2)");
+            return     (-1);
           }
         }
 #endif /* SCOTCH_DEBUG_ORDER2 */
@@ -150,7 +144,407 @@ const HgraphOrderCcParam * restrict const paraptr)
   }
   roottab[rootnbr] = qtalidx;                     /* Record end index */
 
-  if (rootnbr == 1) {                             /* If only one connected component                                  */
+  return (rootnbr);
+}
+
+#ifndef HGRAPHORDERCCNOTHREAD
+
+/* This routine performs a prefix scan
+** sum operation on a single Gnum value,
+** backed by a temporary area.
+*/
+
+static
+void
+hgraphOrderCcScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* This routine is the threaded core of the
+** computation of connected components. It
+** merges vertex trees by lock-free union,
+** always linking the root of highest number
+** to the root of smallest number, so that
+** every component is rooted by its smallest
+** vertex. Components are therefore numbered
+** in the same order as with the sequential
+** routine, whatever the number of threads.
+** Vertices of every component are stored by
+** ascending number in their sub-list.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hgraphOrderCcComp3 (
+ThreadDescriptor * restrict const   descptr,
+HgraphOrderCcData * restrict const  dataptr)
+{
+  Gnum                vertbas;                    /* Bounds of local vertex range       */
+  Gnum                vertnnd;
+  Gnum                vertnum;
+  Gnum                rootbas;                    /* Bounds of local component range    */
+  Gnum                rootnnd;
+  Gnum                rootnum;
+  Gnum                rootnbr;
+
+  const Hgraph * restrict const         grafptr = dataptr->grafptr;
+  const Gnum * restrict const           verttax = grafptr->s.verttax;
+  const Gnum * restrict const           vnhdtax = grafptr->vnhdtax;
+  const Gnum * restrict const           edgetax = grafptr->s.edgetax;
+  Gnum * restrict const                 flagtax = dataptr->flagtax;
+  Gnum * restrict const                 queutab = dataptr->queutab;
+  Gnum * restrict const                 roottab = dataptr->roottab;
+  const int                             thrdnbr = threadNbr (descptr);
+  const int                             thrdnum = threadNum (descptr);
+  HgraphOrderCcThread * restrict const  thrdptr = &dataptr->thrdtab[thrdnum];
+
+  vertbas = grafptr->s.baseval + DATASCAN (grafptr->vnohnbr, thrdnbr, thrdnum);
+  vertnnd = grafptr->s.baseval + DATASCAN (grafptr->vnohnbr, thrdnbr, thrdnum + 1);
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* Every vertex is its own root */
+    flagtax[vertnum] = vertnum;
+
+  threadBarrier (descptr);                        /* All parent slots must be initialized */
+
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) {
+    Gnum                edgenum;
+
+    for (edgenum = verttax[vertnum]; edgenum < vnhdtax[vertnum]; edgenum ++) {
+      Gnum                vertend;
+
+      vertend = edgetax[edgenum];
+      if (vertend >= vertnum)                     /* Process every edge only once */
+        continue;
+
+      while (1) {
+        Gnum                rootsrc;
+        Gnum                rootend;
+
+        for (rootsrc = vertnum; flagtax[rootsrc] != rootsrc; rootsrc = flagtax[rootsrc]) ;
+        for (rootend = vertend; flagtax[rootend] != rootend; rootend = flagtax[rootend]) ;
+        if (rootsrc == rootend)                   /* If both vertices already in same tree */
+          break;
+        if (rootsrc < rootend) {                  /* Always link highest root to smallest one */
+          Gnum                roottmp;
+
+          roottmp = rootsrc;
+          rootsrc = rootend;
+          rootend = roottmp;
+        }
+        if (__sync_bool_compare_and_swap (&flagtax[rootsrc], rootsrc, rootend)) /* If root not linked meanwhile */
+          break;
+      }
+    }
+  }
+
+  threadBarrier (descptr);                        /* All trees must be complete */
+
+  for (vertnum = vertbas, rootnbr = 0; vertnum < vertnnd; vertnum ++) { /* Flatten trees and count roots */
+    for (rootnum = vertnum; flagtax[rootnum] != rootnum; rootnum = flagtax[rootnum]) ;
+    if (rootnum == vertnum)
+      rootnbr ++;
+    else
+      flagtax[vertnum] = rootnum;
+  }
+
+  thrdptr->scantab[0] = rootnbr;
+  threadScan (descptr, &thrdptr->scantab[0], sizeof (HgraphOrderCcThread), (ThreadScanFunc) hgraphOrderCcScan, NULL); /* Compute start indices of components */
+
+  for (vertnum = vertbas, rootnum = thrdptr->scantab[0] - rootnbr; vertnum < vertnnd; vertnum ++) { /* Number roots as negative values */
+    if (flagtax[vertnum] == vertnum) {
+      flagtax[vertnum] = -1 - rootnum;
+      roottab[rootnum ++] = 0;
+    }
+  }
+  rootnbr = dataptr->thrdtab[thrdnbr - 1].scantab[0];
+
+  threadBarrier (descptr);                        /* All roots must be numbered */
+
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) { /* Compute component sizes */
+    Gnum                flagval;
+
+    flagval = flagtax[vertnum];
+    if (flagval >= 0) {                           /* If vertex is not a root, get component of its root */
+      flagval = flagtax[flagval];
+      flagtax[vertnum] = flagval;
+    }
+    __sync_fetch_and_add (&roottab[-1 - flagval], 1);
+  }
+
+  threadBarrier (descptr);                        /* All sizes must be known */
+
+  if (thrdnum == 0) {                             /* First thread computes end indices of sub-lists */
+    Gnum                queunnd;
+
+    for (rootnum = 0, queunnd = 0; rootnum < rootnbr; rootnum ++) {
+      queunnd += roottab[rootnum];
+      roottab[rootnum] = queunnd;
+    }
+    roottab[rootnbr] = queunnd;                   /* Record end index */
+    dataptr->rootnbr = rootnbr;
+  }
+
+  threadBarrier (descptr);                        /* End indices must be known */
+
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* Fill sub-lists from their ends; roottab ends as start indices */
+    queutab[__sync_sub_and_fetch (&roottab[-1 - flagtax[vertnum]], 1)] = vertnum;
+
+  threadBarrier (descptr);                        /* Sub-lists must be complete */
+
+  rootbas = DATASCAN (rootnbr, thrdnbr, thrdnum);
+  rootnnd = DATASCAN (rootnbr, thrdnbr, thrdnum + 1);
+  for (rootnum = rootbas; rootnum < rootnnd; rootnum ++) /* Sort sub-lists so that result does not depend on thread timing */
+    intSort1asc1 (queutab + roottab[rootnum], roottab[rootnum + 1] - roottab[rootnum]);
+}
+
+/* This routine computes the connected
+** components of the non-halo part of the
+** given graph, by means of concurrent
+** union-find.
+** It returns:
+** - >0  : number of connected components.
+** - -1  : on error.
+*/
+
+static
+Gnum
+hgraphOrderCcComp2 (
+const Hgraph * restrict const grafptr,
+Gnum * restrict const         flagtax,            /*+ Parent array           +*/
+Gnum * restrict const         queutab,            /*+ Array of sub-lists     +*/
+Gnum * restrict const         roottab)            /*+ Array of root indices  +*/
+{
+  HgraphOrderCcData   datadat;
+
+  if ((datadat.thrdtab = (HgraphOrderCcThread *) memAlloc (contextThreadNbr (grafptr->contptr) * sizeof (HgraphOrderCcThread))) == NULL) {
+    errorPrint ("hgraphOrderCcComp2: out of memory");
+    return     (-1);
+  }
+  datadat.grafptr = grafptr;
+  datadat.flagtax = flagtax;
+  datadat.queutab = queutab;
+  datadat.roottab = roottab;
+
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) hgraphOrderCcComp3, (void *) &datadat);
+
+  memFree (datadat.thrdtab);
+
+#ifdef SCOTCH_DEBUG_ORDER2
+  {
+    Gnum                vertnum;
+
+    for (vertnum = grafptr->s.baseval; vertnum < grafptr->vnohnnd; vertnum ++) {
+      Gnum                edgenum;
+
+      for (edgenum = grafptr->s.verttax[vertnum]; edgenum < grafptr->vnhdtax[vertnum]; edgenum ++) {
+        if (flagtax[grafptr->s.edgetax[edgenum]] != flagtax[vertnum]) {
+          errorPrint ("hgraphOrderCcComp2: internal error");
+          return     (-1);
+        }
+      }
+    }
+  }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+
+  return (datadat.rootnbr);
+}
+
+#endif /* HGRAPHORDERCCNOTHREAD */
+
+/*************************************/
+/*                                   */
+/* These routines order ranges of    */
+/* connected components.             */
+/*                                   */
+/*************************************/
+
+#ifndef HGRAPHORDERCCNOTHREAD
+
+/* This routine orders the range of
+** components associated with the
+** given sub-context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hgraphOrderCc3 (
+Context * restrict const          contptr,        /*+ (Sub-)context                          +*/
+const int                         spltnum,        /*+ Rank of sub-context in initial context +*/
+const HgraphOrderCcSplit * const  spltptr)
+{
+  Hgraph              grafdat;
+
+  grafdat = *spltptr->grafptr;                    /* Assign new context to work graph */
+  grafdat.contptr = contptr;
+
+  if (hgraphOrderCc2 (&grafdat, spltptr->ordeptr, spltptr->ordenum, spltptr->cblkptr,
+                      spltptr->queutab, spltptr->roottab, spltptr->splttab[spltnum].rootbas,
+                      spltptr->splttab[spltnum].rootnnd, spltptr->paraptr) != 0) {
+    pthread_mutex_lock (&spltptr->ordeptr->mutedat); /* Use ordering lock to avoid race condition */
+    *spltptr->revaptr = 1;
+    pthread_mutex_unlock (&spltptr->ordeptr->mutedat);
+  }
+}
+
+#endif /* HGRAPHORDERCCNOTHREAD */
+
+/* This routine orders the given range of
+** connected components. When several threads
+** are available, the range is split in two
+** sub-ranges of vertex loads proportional to
+** the sizes of the two sub-contexts, which
+** are then processed concurrently.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+hgraphOrderCc2 (
+const Hgraph * restrict const             grafptr,
+Order * restrict const                    ordeptr,
+const Gnum                                ordenum, /*+ Zero-based ordering number of graph  +*/
+OrderCblk * restrict const                cblkptr, /*+ Disconnected components node         +*/
+const Gnum * restrict const               queutab, /*+ Array of vertex sub-lists            +*/
+const Gnum * restrict const               roottab, /*+ Array of sub-list start indices      +*/
+const Gnum                                rootbas, /*+ Index of first component to order    +*/
+const Gnum                                rootnnd, /*+ Index of after-last component        +*/
+const HgraphOrderCcParam * restrict const paraptr)
+{
+  Hgraph              indgrafdat;
+  Gnum                rootnum;
+
+#ifndef HGRAPHORDERCCNOTHREAD
+  const int           thrdnbr = contextThreadNbr (grafptr->contptr);
+
+  if ((thrdnbr > 1) && ((rootnnd - rootbas) > 1)) { /* If range can be split across sub-contexts */
+    HgraphOrderCcSplit  spltdat;                  /* Parameters for context splitting         */
+    Gnum                rootmin;                  /* Bounds for dichotomy search of median    */
+    Gnum                rootmax;
+    Gnum                vertmed;                  /* Median sub-list index                    */
+    int                 o;
+
+    vertmed = roottab[rootbas] + (Gnum) (((double) (roottab[rootnnd] - roottab[rootbas]) * (double) ((thrdnbr + 1) / 2)) / (double) thrdnbr);
+    for (rootmin = rootbas + 1, rootmax = rootnnd - 1; rootmin < rootmax; ) { /* Find first component starting after median */
+      Gnum                rootmed;
+
+      rootmed = (rootmin + rootmax) / 2;
+      if (roottab[rootmed] < vertmed)
+        rootmin = rootmed + 1;
+      else
+        rootmax = rootmed;
+    }
+    if ((rootmin > (rootbas + 1)) &&              /* Keep closest boundary to median */
+        ((vertmed - roottab[rootmin - 1]) < (roottab[rootmin] - vertmed)))
+      rootmin --;
+
+    spltdat.splttab[0].rootbas = rootbas;
+    spltdat.splttab[0].rootnnd = rootmin;
+    spltdat.splttab[1].rootbas = rootmin;
+    spltdat.splttab[1].rootnnd = rootnnd;
+    spltdat.grafptr = grafptr;
+    spltdat.ordeptr = ordeptr;
+    spltdat.ordenum = ordenum;
+    spltdat.cblkptr = cblkptr;
+    spltdat.queutab = queutab;
+    spltdat.roottab = roottab;
+    spltdat.paraptr = paraptr;
+    spltdat.revaptr = &o;
+
+    o = 0;
+    if (contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) hgraphOrderCc3, &spltdat) != 0) { /* If could not split context to run concurrently */
+      hgraphOrderCc3 (grafptr->contptr, 0, &spltdat); /* Run tasks in sequence */
+      if (o == 0)
+        hgraphOrderCc3 (grafptr->contptr, 1, &spltdat);
+    }
+
+    return (o);
+  }
+#endif /* HGRAPHORDERCCNOTHREAD */
+
+  for (rootnum = rootbas; rootnum < rootnnd; rootnum ++) {
+    Gnum                indvnohnbr;
+    int                 o;
+
+    indvnohnbr = roottab[rootnum + 1] - roottab[rootnum];
+
+    if (hgraphInduceList (grafptr, indvnohnbr, (Gnum *) &queutab[roottab[rootnum]], grafptr->s.vertnbr - grafptr->vnohnbr, &indgrafdat) != 0) {
+      errorPrint ("hgraphOrderCc2: cannot create induced graph");
+      return     (1);
+    }
+
+    o = hgraphOrderSt (&indgrafdat, ordeptr, ordenum + roottab[rootnum], &cblkptr->cblktab[rootnum], paraptr->straptr); /* Perform strategy on induced subgraph */
+
+    hgraphExit (&indgrafdat);
+
+    if (o != 0) {
+      errorPrint ("hgraphOrderCc2: cannot compute ordering on induced graph");
+      return     (1);
+    }
+  }
+
+  return (0);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the ordering.
+** It returns:
+** - 0   : if the ordering could be computed.
+** - !0  : on error.
+*/
+
+int
+hgraphOrderCc (
+const Hgraph * restrict const             grafptr,
+Order * restrict const                    ordeptr,
+const Gnum                                ordenum, /*+ Zero-based ordering number +*/
+OrderCblk * restrict const                cblkptr, /*+ Single column-block        +*/
+const HgraphOrderCcParam * restrict const paraptr)
+{
+  Gnum * restrict     flagtax;                    /* Flag array                       */
+  Gnum * restrict     roottab;                    /* Array of root indices in queutab */
+  Gnum                rootnbr;                    /* Number of connected components   */
+  Gnum                rootnum;
+  Gnum * restrict     queutab;                    /* Vertex queue and sub-lists       */
+  int                 o;
+
+  if (memAllocGroup ((void **) (void *)
+                     &queutab, (size_t) ( grafptr->vnohnbr      * sizeof (Gnum)),
+                     &roottab, (size_t) ((grafptr->vnohnbr + 1) * sizeof (Gnum)), /* TRICK: +1 to store end index */
+                     &flagtax, (size_t) ( grafptr->vnohnbr      * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hgraphOrderCc: out of memory");
+    return     (1);
+  }
+  flagtax -= grafptr->s.baseval;
+
+#ifndef HGRAPHORDERCCNOTHREAD
+  if (contextThreadNbr (grafptr->contptr) > 1)    /* If several threads available, compute components concurrently */
+    rootnbr = hgraphOrderCcComp2 (grafptr, flagtax, queutab, roottab);
+  else
+#endif /* HGRAPHORDERCCNOTHREAD */
+    rootnbr = hgraphOrderCcComp (grafptr, flagtax, queutab, roottab);
+  if (rootnbr < 0) {
+    errorPrint ("hgraphOrderCc: cannot compute connected components");
+    memFree    (queutab);
+    return     (1);
+  }
+
+  if (rootnbr <= 1) {                             /* If only one connected component                                  */
     memFree (queutab);                            /* Free group leader                                                */
     return (hgraphOrderSt (grafptr, ordeptr, ordenum, cblkptr, paraptr->straptr)); /* Perform strategy on whole graph */
   }
@@ -177,32 +571,9 @@ const HgraphOrderCcParam * restrict const paraptr)
     cblkptr->cblktab[rootnum].cblktab = NULL;
   }
 
-  for (rootnum = 0, indordenum = 0; rootnum < rootnbr; rootnum ++) {
-    Gnum                indvnohnbr;
-    int                 o;
-
-    indvnohnbr = roottab[rootnum + 1] - roottab[rootnum];
-
-    if (hgraphInduceList (grafptr, indvnohnbr, &queutab[roottab[rootnum]], grafptr->s.vertnbr - grafptr->vnohnbr, &indgrafdat) != 0) {
-      errorPrint ("hgraphOrderCc: cannot create induced graph");
-      memFree    (queutab);
-      return     (1);
-    }
-
-    o = hgraphOrderSt (&indgrafdat, ordeptr, indordenum, &cblkptr->cblktab[rootnum], paraptr->straptr); /* Perform strategy on induced subgraph */
-
-    hgraphExit (&indgrafdat);
-
-    if (o != 0) {
-      errorPrint ("hgraphOrderCc: cannot compute ordering on induced graph");
-      memFree    (queutab);
-      return     (1);
-    }
-
-    indordenum += indvnohnbr;
-  }
+  o = hgraphOrderCc2 (grafptr, ordeptr, ordenum, cblkptr, queutab, roottab, 0, rootnbr, paraptr);
 
   memFree (queutab);
 
-  return (0);
+  return (o);
 }
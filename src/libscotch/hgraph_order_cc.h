@@ -41,9 +41,22 @@
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 04 apr 2018     **/
 /**                                 to   : 05 apr 2018     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Flag for compiling the multi-threaded
+    versions of the component routines.  +*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined HGRAPHORDERCCNOTHREAD)
+#define HGRAPHORDERCCNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined HGRAPHORDERCCNOTHREAD) */
+
 /*
 **  The type and structure definitions.
 */
@@ -54,8 +67,55 @@ typedef struct HgraphOrderCcParam_ {
   Strat *                   straptr;              /*+ Ordering strategy for connected components +*/
 } HgraphOrderCcParam;
 
+/*+ The thread-specific data block. +*/
+
+typedef struct HgraphOrderCcThread_ {
+  Gnum                      scantab[2];           /*+ Scan area for component indices +*/
+} HgraphOrderCcThread;
+
+/*+ The thread-independent data block. +*/
+
+typedef struct HgraphOrderCcData_ {
+  const Hgraph *            grafptr;              /*+ Halo graph                              +*/
+  Gnum *                    flagtax;              /*+ Parent array; then component array      +*/
+  Gnum *                    queutab;              /*+ Array of vertex sub-lists               +*/
+  Gnum *                    roottab;              /*+ Array of start indices of sub-lists     +*/
+  Gnum                      rootnbr;              /*+ Number of connected components          +*/
+  HgraphOrderCcThread *     thrdtab;              /*+ Array of thread-specific data           +*/
+} HgraphOrderCcData;
+
+/*+ This structure holds the splitting parameters. +*/
+
+typedef struct HgraphOrderCcSplit2_ {
+  Gnum                      rootbas;              /*+ Index of first component of range +*/
+  Gnum                      rootnnd;              /*+ Index of after-last component     +*/
+} HgraphOrderCcSplit2;
+
+typedef struct HgraphOrderCcSplit_ {
+  HgraphOrderCcSplit2         splttab[2];         /*+ Array of component ranges      +*/
+  const Hgraph *              grafptr;            /*+ Original graph                 +*/
+  Order *                     ordeptr;            /*+ Pointer to ordering            +*/
+  Gnum                        ordenum;            /*+ Start index of graph ordering  +*/
+  OrderCblk *                 cblkptr;            /*+ Disconnected components node   +*/
+  const Gnum *                queutab;            /*+ Array of vertex sub-lists      +*/
+  const Gnum *                roottab;            /*+ Array of sub-list indices     +*/
+  const HgraphOrderCcParam *  paraptr;            /*+ Method parameters              +*/
+  int *                       revaptr;            /*+ Pointer to return value        +*/
+} HgraphOrderCcSplit;
+
 /*
 **  The function prototypes.
 */
 
+#ifdef SCOTCH_HGRAPH_ORDER_CC
+static Gnum                 hgraphOrderCcComp   (const Hgraph * const, Gnum * const, Gnum * const, Gnum * const);
+#ifndef HGRAPHORDERCCNOTHREAD
+static void                 hgraphOrderCcScan   (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+static void                 hgraphOrderCcComp3  (ThreadDescriptor * restrict const, HgraphOrderCcData * restrict const);
+static Gnum                 hgraphOrderCcComp2  (const Hgraph * const, Gnum * const, Gnum * const, Gnum * const);
+static void                 hgraphOrderCc3      (Context * restrict const, const int, const HgraphOrderCcSplit * const);
+#endif /* HGRAPHORDERCCNOTHREAD */
+static int                  hgraphOrderCc2      (const Hgraph * const, Order * const, const Gnum, OrderCblk * const, const Gnum * const, const Gnum * const, const Gnum, const Gnum, const HgraphOrderCcParam * const);
+#endif /* SCOTCH_HGRAPH_ORDER_CC */
+
 int                         hgraphOrderCc       (const Hgraph * const, Order * const, const Gnum, OrderCblk * const, const HgraphOrderCcParam * const);
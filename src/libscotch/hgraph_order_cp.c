@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2014,2015,2018,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2014,2015,2018,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 04 aug 2014     **/
 /**                                 to   : 27 jan 2020     **/
 /**                # Version 7.0  : from : 05 may 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Pre-hashing proves itself extremely   **/
 /**                  efficient, since for graphs that      **/
@@ -103,6 +103,122 @@ const HgraphOrderCpParam * const  paraptr)
   Order                         coarordedat;      /* Ordering of compressed halo subgraph                                  */
   Gnum *                        coarperitab;      /* Coarse permutation array                                              */
   const Gnum * restrict         coarperitax;      /* Temporary based access to coarperitab                                 */
+  Gnum                          coarvertnum;      /* Number of current compressed vertex                                   */
+  Gnum *                        coarvsiztax;      /* Array of coarse vertex sizes (as number of merged fine vertices)      */
+  Gnum * restrict               coarvpostax;      /* Position in fine permutation of fine vertices merged into same vertex */
+  Gnum *                        finecoartax;      /* Original to compressed vertex number array                            */
+  Gnum                          finevertnum;      /* Number of current original vertex                                     */
+  Gnum                          finevsizsum;      /* Sum of compressed vertex sizes to build fine inverse permutation      */
+  int                           o;
+#ifdef SCOTCH_DEBUG_ORDER2
+  Gnum                          finevertnbr;      /* Number of fine vertices in compressed elimination tree                */
+#endif /* SCOTCH_DEBUG_ORDER2 */
+
+  Gnum * restrict const         fineperitab = fineordeptr->peritab;
+  const Gnum * restrict const   finevnumtax = finegrafptr->s.vnumtax;
+
+  finecoartax =                                   /* Set by compression routines only on success */
+  coarvsiztax = NULL;
+#ifndef HGRAPHORDERCPNOTHREAD
+  if (contextThreadNbr (finegrafptr->contptr) > 1) /* If several threads available, build compressed graph concurrently */
+    o = hgraphOrderCpCompress2 (finegrafptr, &coargrafdat, &finecoartax, &coarvsiztax, paraptr->comprat);
+  else
+#endif /* HGRAPHORDERCPNOTHREAD */
+    o = hgraphOrderCpCompress (finegrafptr, &coargrafdat, &finecoartax, &coarvsiztax, paraptr->comprat);
+  if (o != 0)                                     /* If graph not compressed */
+    return ((o == 1) ? hgraphOrderSt (finegrafptr, fineordeptr, ordenum, cblkptr, paraptr->stratunc) : 1);
+
+#ifdef SCOTCH_DEBUG_ORDER2
+  if (hgraphCheck (&coargrafdat) != 0) {
+    errorPrint ("hgraphOrderCp: internal error (3)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+
+  if ((coarperitab = memAlloc (coargrafdat.vnohnbr * sizeof (Gnum))) == NULL) { /* Coarse permutation only for non-halo vertices */
+    errorPrint ("hgraphOrderCp: out of memory (3)");
+    hgraphExit (&coargrafdat);
+    memFree    (finecoartax + finegrafptr->s.baseval);
+    return     (1);
+  }
+  orderInit (&coarordedat, coargrafdat.s.baseval, coargrafdat.vnohnbr, coarperitab); /* Build ordering of compressed subgraph */
+  if (hgraphOrderSt (&coargrafdat, &coarordedat, 0, &coarordedat.cblktre, paraptr->stratcpr) != 0) {
+    memFree    (coarperitab);
+    hgraphExit (&coargrafdat);
+    memFree    (finecoartax + finegrafptr->s.baseval);
+    return     (1);
+  }
+
+  *cblkptr = coarordedat.cblktre;                 /* Link sub-tree to ordering         */
+  coarordedat.cblktre.cblktab = NULL;             /* Unlink sub-tree from sub-ordering */
+#ifdef SCOTCH_DEBUG_ORDER2
+  finevertnbr =
+#endif /* SCOTCH_DEBUG_ORDER2 */
+  hgraphOrderCpTree (coarordedat.peritab, coarvsiztax, cblkptr, 0); /* Expand sub-tree */
+#ifdef SCOTCH_DEBUG_ORDER2
+  if (finevertnbr != finegrafptr->vnohnbr) {
+    errorPrint ("hgraphOrderCp: internal error (4)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_lock (&fineordeptr->mutedat);
+#endif /* SCOTCH_PTHREAD */
+  fineordeptr->treenbr += coarordedat.treenbr - 1; /* Adjust number of tree nodes    */
+  fineordeptr->cblknbr += coarordedat.cblknbr - 1; /* Adjust number of column blocks */
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_unlock (&fineordeptr->mutedat);
+#endif /* SCOTCH_PTHREAD */
+
+  coarvpostax = coargrafdat.s.verttax;            /* Re-cycle verttab (not velotab as may be merged with coarvsiztab) */
+  coarperitax = coarperitab - coargrafdat.s.baseval;
+
+  for (coarvertnum = coargrafdat.s.baseval, finevsizsum = ordenum; /* Compute initial indices for inverse permutation expansion */
+       coarvertnum < coargrafdat.vnohnnd; coarvertnum ++) {
+    coarvpostax[coarperitax[coarvertnum]] = finevsizsum;
+    finevsizsum += coarvsiztax[coarperitax[coarvertnum]];
+  }
+  if (finevnumtax == NULL) {                      /* If fine graph is original graph */
+    for (finevertnum = finegrafptr->s.baseval; finevertnum < finegrafptr->vnohnnd; finevertnum ++) /* Compute fine permutation */
+      fineperitab[coarvpostax[finecoartax[finevertnum]] ++] = finevertnum;
+  }
+  else {                                          /* Graph is not original graph */
+    for (finevertnum = finegrafptr->s.baseval; finevertnum < finegrafptr->vnohnnd; finevertnum ++) /* Compute fine permutation */
+      fineperitab[coarvpostax[finecoartax[finevertnum]] ++] = finevnumtax[finevertnum];
+  }
+
+  memFree    (coarperitab);
+  memFree    (finecoartax + finegrafptr->s.baseval);
+  orderExit  (&coarordedat);
+  hgraphExit (&coargrafdat);                      /* Free coarvsiztab as part of vertex group */
+
+  return (0);
+}
+
+/************************************/
+/*                                  */
+/* These routines build the         */
+/* compressed graph.                */
+/*                                  */
+/************************************/
+
+/* This routine sequentially builds the compressed
+** halo graph, if compression is worth it.
+** It returns:
+** - 0   : if the compressed graph was built.
+** - 1   : if the graph needs not be compressed.
+** - 2   : on error.
+*/
+
+static
+int
+hgraphOrderCpCompress (
+const Hgraph * restrict const     finegrafptr,
+Hgraph * restrict const           coargrafptr,
+Gnum ** restrict const            finecoarptr,    /*+ Pointer to based fine to coarse array +*/
+Gnum ** restrict const            coarvsizptr,    /*+ Pointer to coarse vertex size array   +*/
+const double                      comprat)
+{
   Gnum                          coarvertnbr;      /* Number of compressed vertices                                         */
   Gnum                          coarvertnum;      /* Number of current compressed vertex                                   */
   Gnum                          coarvnhdsiz;      /* Size of non-halo end vertex array; zero if graph has no halo          */
@@ -111,7 +227,6 @@ const HgraphOrderCpParam * const  paraptr)
   Gnum                          coaredgenbr;      /* Number of compressed edges                                            */
   Gnum                          coaredgenum;      /* Number of current compressed edge                                     */
   Gnum                          coarenohnnd;      /* Position in edge array of first edge of first halo vertex             */
-  Gnum * restrict               coarvpostax;      /* Position in fine permutation of fine vertices merged into same vertex */
   Gnum * restrict               finecoartax;      /* Original to compressed vertex number array                            */
   HgraphOrderCpMate * restrict  finematetab;      /* Array of fine vertices that may be compressed with current vertex     */
   HgraphOrderCpHash * restrict  finehashtab;      /* Neighbor hash table                                                   */
@@ -120,18 +235,11 @@ const HgraphOrderCpParam * const  paraptr)
   Gnum                          finehaspmsk;      /* Mask for access to pre-hashing table                                  */
   Gnum * restrict               finehsumtax;      /* Array of hash values for each original vertex                         */
   Gnum                          finevertnum;      /* Number of current original vertex                                     */
-  Gnum                          finevsizsum;      /* Sum of compressed vertex sizes to build fine inverse permutation      */
   void *                        dataptr;          /* Flag of memory allocation success                                     */
-#ifdef SCOTCH_DEBUG_ORDER2
-  Gnum                          finevertnbr;      /* Number of fine vertices in compressed elimination tree                */
-#endif /* SCOTCH_DEBUG_ORDER2 */
 
-
-  Gnum * restrict const         fineperitab = fineordeptr->peritab;
   const Gnum * restrict const   fineverttax = finegrafptr->s.verttax;
   const Gnum * restrict const   finevelotax = finegrafptr->s.velotax;
   const Gnum * restrict const   finevendtax = finegrafptr->s.vendtax;
-  const Gnum * restrict const   finevnumtax = finegrafptr->s.vnumtax;
   const Gnum * restrict const   finevnhdtax = finegrafptr->vnhdtax;
   const Gnum * restrict const   fineedgetax = finegrafptr->s.edgetax;
 
@@ -145,13 +253,13 @@ const HgraphOrderCpParam * const  paraptr)
                       &finehashtab, (size_t) ((finehashmsk + 1)      * sizeof (HgraphOrderCpHash)),
                       &finematetab, (size_t) (finegrafptr->s.degrmax * sizeof (HgraphOrderCpMate)), NULL) == NULL) ||
       ((finehsumtax = (Gnum *) memAlloc (finegrafptr->vnohnbr * sizeof (Gnum))) == NULL)) {
-    errorPrint ("hgraphOrderCp: out of memory (1)");
+    errorPrint ("hgraphOrderCpCompress: out of memory (1)");
     if (finecoartax != NULL) {
       if (finehashtab != NULL)
         memFree (finehashtab);
       memFree (finecoartax);
     }
-    return (1);
+    return (2);
   }
   finehsumtax -= finegrafptr->s.baseval;          /* TRICK: do not base finecoartax yet (see later) */
 
@@ -184,21 +292,21 @@ const HgraphOrderCpParam * const  paraptr)
     finehasptab[finehsumval] |= (1 << finehsumbit); /* Put value into pre-hash table anyway                                                     */
   }
 
-  if ((double) coarvertnbr > ((double) finegrafptr->vnohnbr * paraptr->comprat)) { /* If graph needs not be compressed */
+  if ((double) coarvertnbr > ((double) finegrafptr->vnohnbr * comprat)) { /* If graph needs not be compressed */
     memFree (finehsumtax + finegrafptr->s.baseval);
     memFree (finehashtab);
     memFree (finecoartax);                        /* Not yet based */
-    return (hgraphOrderSt (finegrafptr, fineordeptr, ordenum, cblkptr, paraptr->stratunc));
+    return  (1);
   }
 
   finecoartax -= finegrafptr->s.baseval;          /* Base finecoartab array */
 
   memSet (finehashtab, ~0, (finehashmsk + 1) * sizeof (HgraphOrderCpHash));
 
-  hgraphInit (&coargrafdat);                      /* Initialize compressed halo graph structure                               */
-  coargrafdat.s.baseval = 1;                      /* Base coarse graph to 1 because hgraphOrderHb and hgraphOrderHf prefer it */
+  hgraphInit (coargrafptr);                      /* Initialize compressed halo graph structure                               */
+  coargrafptr->s.baseval = 1;                     /* Base coarse graph to 1 because hgraphOrderHb and hgraphOrderHf prefer it */
 
-  for (finevertnum = finegrafptr->s.baseval, coarvertnbr = coargrafdat.s.baseval, coaredgenbr = finegrafptr->s.edgenbr; /* For all non-halo vertices */
+  for (finevertnum = finegrafptr->s.baseval, coarvertnbr = coargrafptr->s.baseval, coaredgenbr = finegrafptr->s.edgenbr; /* For all non-halo vertices */
        finevertnum < finegrafptr->vnohnnd; finevertnum ++) {
     Gnum                finedegrval;              /* Degree of current fine vertex     */
     Gnum                finehsumval;              /* Current hash sum value            */
@@ -283,62 +391,62 @@ loop_failed: ;
     }
   }
 
-  coargrafdat.vnohnnd = coarvertnbr;              /* Save number of non-halo vertices */
+  coargrafptr->vnohnnd = coarvertnbr;             /* Save number of non-halo vertices */
 
   memFree (finehsumtax + finegrafptr->s.baseval);
 
-  if ((double) (coarvertnbr - coargrafdat.s.baseval) > ((double) finegrafptr->vnohnbr * paraptr->comprat)) { /* If graph needs not be compressed */
+  if ((double) (coarvertnbr - coargrafptr->s.baseval) > ((double) finegrafptr->vnohnbr * comprat)) { /* If graph needs not be compressed */
     memFree (finehashtab);
     memFree (finecoartax + finegrafptr->s.baseval);
-    return (hgraphOrderSt (finegrafptr, fineordeptr, ordenum, cblkptr, paraptr->stratunc));
+    return  (1);
   }
 
   for ( ; finevertnum < finegrafptr->s.vertnnd; finevertnum ++) /* For all halo vertices */
     finecoartax[finevertnum] = coarvertnbr ++;    /* Halo vertices are never compressed  */
 
-  coargrafdat.s.flagval = GRAPHFREETABS | GRAPHVERTGROUP; /* Do not set HGRAPHFREEVNHD since vnhdtax allocated in group */
-  coargrafdat.s.vertnbr = coarvertnbr - coargrafdat.s.baseval;
-  coargrafdat.s.vertnnd = coarvertnbr;
-  coargrafdat.s.velosum = finegrafptr->s.velosum;
-  coargrafdat.s.degrmax = finegrafptr->s.degrmax;
-  coargrafdat.vnohnbr   = coargrafdat.vnohnnd - coargrafdat.s.baseval;
-  coargrafdat.vnlosum   = finegrafptr->vnlosum;
+  coargrafptr->s.flagval = GRAPHFREETABS | GRAPHVERTGROUP; /* Do not set HGRAPHFREEVNHD since vnhdtax allocated in group */
+  coargrafptr->s.vertnbr = coarvertnbr - coargrafptr->s.baseval;
+  coargrafptr->s.vertnnd = coarvertnbr;
+  coargrafptr->s.velosum = finegrafptr->s.velosum;
+  coargrafptr->s.degrmax = finegrafptr->s.degrmax;
+  coargrafptr->vnohnbr   = coargrafptr->vnohnnd - coargrafptr->s.baseval;
+  coargrafptr->vnlosum   = finegrafptr->vnlosum;
 
-  coarvnhdsiz = (finegrafptr->s.vertnbr == finegrafptr->vnohnbr) ? 0 : coargrafdat.vnohnbr; /* If no halo, no need for vnhdtax; will use vendtax */
+  coarvnhdsiz = (finegrafptr->s.vertnbr == finegrafptr->vnohnbr) ? 0 : coargrafptr->vnohnbr; /* If no halo, no need for vnhdtax; will use vendtax */
   coarvsizsiz = (finevelotax == NULL) ? 0 : coarvertnbr; /* If no fine vertex loads, use coarse velotax as coarvsiztax                           */
   if ((dataptr = memAllocGroup ((void **) (void *)
-                                &coargrafdat.s.verttax, (size_t) ((coarvertnbr + 1) * sizeof (Gnum)),
-                                &coargrafdat.vnhdtax,   (size_t) (coarvnhdsiz       * sizeof (Gnum)),
-                                &coargrafdat.s.velotax, (size_t) (coarvertnbr       * sizeof (Gnum)),
+                                &coargrafptr->s.verttax, (size_t) ((coarvertnbr + 1) * sizeof (Gnum)),
+                                &coargrafptr->vnhdtax,   (size_t) (coarvnhdsiz       * sizeof (Gnum)),
+                                &coargrafptr->s.velotax, (size_t) (coarvertnbr       * sizeof (Gnum)),
                                 &coarvsiztax,           (size_t) (coarvsizsiz       * sizeof (Gnum)), NULL)) != NULL) {
     dataptr               =
-    coargrafdat.s.edgetax = (Gnum *) memAlloc (coaredgenbr * sizeof (Gnum));
+    coargrafptr->s.edgetax = (Gnum *) memAlloc (coaredgenbr * sizeof (Gnum));
   }
   if (dataptr == NULL) {
-    errorPrint ("hgraphOrderCp: out of memory (2)");
-    hgraphExit (&coargrafdat);
+    errorPrint ("hgraphOrderCpCompress: out of memory (2)");
+    hgraphExit (coargrafptr);
     memFree    (finehashtab);
     memFree    (finecoartax + finegrafptr->s.baseval);
-    return     (1);
+    return     (2);
   }
-  coargrafdat.s.verttax -= coargrafdat.s.baseval;
-  coargrafdat.s.vendtax  = coargrafdat.s.verttax + 1; /* Use compact representation of arrays */
-  coargrafdat.s.velotax -= coargrafdat.s.baseval;
-  coargrafdat.s.edgetax -= coargrafdat.s.baseval;
-  coargrafdat.vnhdtax    = (finegrafptr->s.vertnbr == finegrafptr->vnohnbr) ? coargrafdat.s.vendtax : coargrafdat.vnhdtax - coargrafdat.s.baseval;
-  coarvsiztax            = (finevelotax == NULL) ? coargrafdat.s.velotax : coarvsiztax - coargrafdat.s.baseval;
+  coargrafptr->s.verttax -= coargrafptr->s.baseval;
+  coargrafptr->s.vendtax  = coargrafptr->s.verttax + 1; /* Use compact representation of arrays */
+  coargrafptr->s.velotax -= coargrafptr->s.baseval;
+  coargrafptr->s.edgetax -= coargrafptr->s.baseval;
+  coargrafptr->vnhdtax    = (finegrafptr->s.vertnbr == finegrafptr->vnohnbr) ? coargrafptr->s.vendtax : coargrafptr->vnhdtax - coargrafptr->s.baseval;
+  coarvsiztax            = (finevelotax == NULL) ? coargrafptr->s.velotax : coarvsiztax - coargrafptr->s.baseval;
 
   memSet (finehashtab, ~0, (finehashmsk + 1) * sizeof (HgraphOrderCpHash));
 
-  for (finevertnum = finegrafptr->s.baseval, coarvertnum = coaredgenum = coargrafdat.s.baseval; /* For all non-halo vertices */
+  for (finevertnum = finegrafptr->s.baseval, coarvertnum = coaredgenum = coargrafptr->s.baseval; /* For all non-halo vertices */
        finevertnum < finegrafptr->vnohnnd; finevertnum ++) {
     Gnum                fineedgenum;              /* Current edge number */
 
     if (finecoartax[finevertnum] != coarvertnum)  /* Skip fine vertices until we find one that is part of current coarse vertex */
       continue;
 
-    coargrafdat.s.verttax[coarvertnum] = coaredgenum;
-    coarvsiztax[coarvertnum] = 1;                 /* Fill coargrafdat.s.velotax if finegrafptr has no vertex loads */
+    coargrafptr->s.verttax[coarvertnum] = coaredgenum;
+    coarvsiztax[coarvertnum] = 1;                 /* Fill coargrafptr->s.velotax if finegrafptr has no vertex loads */
 
     for (fineedgenum = fineverttax[finevertnum];  /* For all non-halo edges of vertex */
          fineedgenum < finevnhdtax[finevertnum]; fineedgenum ++) {
@@ -347,7 +455,7 @@ loop_failed: ;
 
       finevertend = fineedgetax[fineedgenum];
       if (finecoartax[finevertend] == coarvertnum) { /* If neighbor is merged into us, merge load but do not write edge */
-        coarvsiztax[coarvertnum] ++;              /* Fill coargrafdat.s.velotax if finegrafptr has no vertex loads      */
+        coarvsiztax[coarvertnum] ++;              /* Fill coargrafptr->s.velotax if finegrafptr has no vertex loads      */
         continue;
       }
       for (finehashnum = (finecoartax[finevertend] * HGRAPHORDERCPHASHPRIME) & finehashmsk; ; /* Search for end vertex in hash table */
@@ -355,20 +463,20 @@ loop_failed: ;
         if (finehashtab[finehashnum].vertnum != coarvertnum) {
           finehashtab[finehashnum].vertnum = coarvertnum;
           finehashtab[finehashnum].vertend =
-          coargrafdat.s.edgetax[coaredgenum ++] = finecoartax[finevertend];
+          coargrafptr->s.edgetax[coaredgenum ++] = finecoartax[finevertend];
           break;
         }
         if (finehashtab[finehashnum].vertend == finecoartax[finevertend])
           break;                                  /* If edge already exists */
       }
     }
-    coargrafdat.vnhdtax[coarvertnum] = coaredgenum; /* Set end of non-halo edge sub-array */
+    coargrafptr->vnhdtax[coarvertnum] = coaredgenum; /* Set end of non-halo edge sub-array */
 
     for ( ; fineedgenum < finegrafptr->s.vendtax[finevertnum]; fineedgenum ++) { /* For edges linking to halo vertices */
       Gnum                finevertend;
 
       finevertend = fineedgetax[fineedgenum];
-      coargrafdat.s.edgetax[coaredgenum ++] = finecoartax[finevertend]; /* Halo vertices are always defined and unique */
+      coargrafptr->s.edgetax[coaredgenum ++] = finecoartax[finevertend]; /* Halo vertices are always defined and unique */
     }
     coarvertnum ++;
   }
@@ -377,13 +485,13 @@ loop_failed: ;
 
 #ifdef SCOTCH_DEBUG_ORDER2
     if (finecoartax[finevertnum] != coarvertnum) {
-      errorPrint ("hgraphOrderCp: internal error (1)");
-      return     (1);
+      errorPrint ("hgraphOrderCpCompress: internal error (1)");
+      return     (2);
     }
 #endif /* SCOTCH_DEBUG_ORDER2 */
 
-    coargrafdat.s.verttax[coarvertnum] = coaredgenum;
-    coarvsiztax[coarvertnum] = 1;                 /* Fill coargrafdat.s.velotax if finegrafptr has no vertex loads */
+    coargrafptr->s.verttax[coarvertnum] = coaredgenum;
+    coarvsiztax[coarvertnum] = 1;                 /* Fill coargrafptr->s.velotax if finegrafptr has no vertex loads */
 
     for (fineedgenum = fineverttax[finevertnum];  /* For all edges of halo vertex */
          fineedgenum < finevendtax[finevertnum]; fineedgenum ++) {
@@ -393,8 +501,8 @@ loop_failed: ;
       finevertend = fineedgetax[fineedgenum];
 #ifdef SCOTCH_DEBUG_ORDER2
       if (finecoartax[finevertend] == coarvertnum) { /* No neighbor can be merged into us since halo vertices are unique */
-        errorPrint ("hgraphOrderCp: internal error (2)");
-        return     (1);
+        errorPrint ("hgraphOrderCpCompress: internal error (2)");
+        return     (2);
       }
 #endif /* SCOTCH_DEBUG_ORDER2 */
       for (finehashnum = (finecoartax[finevertend] * HGRAPHORDERCPHASHPRIME) & finehashmsk; ; /* Search for end vertex in hash table */
@@ -402,7 +510,7 @@ loop_failed: ;
         if (finehashtab[finehashnum].vertnum != coarvertnum) {
           finehashtab[finehashnum].vertnum = coarvertnum;
           finehashtab[finehashnum].vertend =
-          coargrafdat.s.edgetax[coaredgenum ++] = finecoartax[finevertend];
+          coargrafptr->s.edgetax[coaredgenum ++] = finecoartax[finevertend];
           break;
         }
         if (finehashtab[finehashnum].vertend == finecoartax[finevertend])
@@ -411,92 +519,454 @@ loop_failed: ;
     }
     coarvertnum ++;
   }
-  coargrafdat.s.verttax[coarvertnum] = coaredgenum; /* Set end of compact vertex array */
-  coargrafdat.s.edlosum =
-  coargrafdat.s.edgenbr = coaredgenum - coargrafdat.s.baseval;
-  coargrafdat.enlosum   =
-  coargrafdat.enohnbr   = coargrafdat.s.edgenbr - 2 * (coaredgenum - coarenohnnd);
-  coargrafdat.levlnum   = finegrafptr->levlnum;   /* Keep level  */
-  coargrafdat.contptr   = finegrafptr->contptr;   /* Use context */
+  coargrafptr->s.verttax[coarvertnum] = coaredgenum; /* Set end of compact vertex array */
+  coargrafptr->s.edlosum =
+  coargrafptr->s.edgenbr = coaredgenum - coargrafptr->s.baseval;
+  coargrafptr->enlosum   =
+  coargrafptr->enohnbr   = coargrafptr->s.edgenbr - 2 * (coaredgenum - coarenohnnd);
+  coargrafptr->levlnum   = finegrafptr->levlnum;  /* Keep level  */
+  coargrafptr->contptr   = finegrafptr->contptr;  /* Use context */
 
   if (finevelotax != NULL) {                      /* If fine graph has vertex loads */
-    memSet (coargrafdat.s.velotax + coargrafdat.s.baseval, 0, coargrafdat.s.vertnbr * sizeof (Gnum));
+    memSet (coargrafptr->s.velotax + coargrafptr->s.baseval, 0, coargrafptr->s.vertnbr * sizeof (Gnum));
 
     for (finevertnum = finegrafptr->s.baseval; finevertnum < finegrafptr->s.vertnnd; finevertnum ++) /* Compute vertex loads for compressed graph */
-      coargrafdat.s.velotax[finecoartax[finevertnum]] += finevelotax[finevertnum];
+      coargrafptr->s.velotax[finecoartax[finevertnum]] += finevelotax[finevertnum];
   }
 
   memFree (finehashtab);
 
-  coargrafdat.s.edgetax = (Gnum *) memRealloc (coargrafdat.s.edgetax + coargrafdat.s.baseval, coargrafdat.s.edgenbr * sizeof (Gnum)) - coargrafdat.s.baseval;
+  coargrafptr->s.edgetax = (Gnum *) memRealloc (coargrafptr->s.edgetax + coargrafptr->s.baseval, coargrafptr->s.edgenbr * sizeof (Gnum)) - coargrafptr->s.baseval;
 
-#ifdef SCOTCH_DEBUG_ORDER2
-  if (hgraphCheck (&coargrafdat) != 0) {
-    errorPrint ("hgraphOrderCp: internal error (3)");
-    return     (1);
+  *finecoarptr = finecoartax;
+  *coarvsizptr = coarvsiztax;
+
+  return (0);
+}
+
+#ifndef HGRAPHORDERCPNOTHREAD
+
+/* This routine performs a prefix scan
+** sum operation on a single Gnum value,
+** backed by a temporary area.
+*/
+
+static
+void
+hgraphOrderCpScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* This routine is the threaded core of the
+** building of the compressed graph. Every
+** non-halo vertex is merged into its smallest
+** neighbor having the same closed neighborhood,
+** which yields the same compressed graph as
+** the sequential routine, whatever the number
+** of threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hgraphOrderCpCompress3 (
+ThreadDescriptor * restrict const descptr,
+HgraphOrderCpData * restrict const dataptr)
+{
+  Gnum                          finevertbas;      /* Bounds of local fine non-halo vertex range   */
+  Gnum                          finevertnnd;
+  Gnum                          finevertnum;
+  Gnum                          coarvertbas;      /* Bounds of local coarse vertex range          */
+  Gnum                          coarvertnnd;
+  Gnum                          coarvertnbr;      /* Number of coarse vertices, halo included     */
+  Gnum                          coarvertnum;
+  Gnum                          coarvnohnnd;      /* End of non-halo coarse vertices              */
+  Gnum                          coaredgenum;
+  Gnum * restrict               coarfinetax;      /* Coarse to fine representative vertex array   */
+  Gnum * restrict               coarverttax;
+  Gnum * restrict               coarvnhdtax;
+  Gnum * restrict               coarvelotax;
+  Gnum * restrict               coarvsiztax;
+  Gnum * restrict               coaredgetax;
+
+  const Hgraph * restrict const     finegrafptr = dataptr->finegrafptr;
+  Hgraph * restrict const           coargrafptr = dataptr->coargrafptr;
+  const Gnum * restrict const       fineverttax = finegrafptr->s.verttax;
+  const Gnum * restrict const       finevendtax = finegrafptr->s.vendtax;
+  const Gnum * restrict const       finevelotax = finegrafptr->s.velotax;
+  const Gnum * restrict const       finevnhdtax = finegrafptr->vnhdtax;
+  const Gnum * restrict const       fineedgetax = finegrafptr->s.edgetax;
+  Gnum * restrict const             finecoartax = dataptr->finecoartax;
+  Gnum * restrict const             finehsumtax = dataptr->finehsumtax;
+  const Gnum                        finehashmsk = dataptr->finehashmsk;
+  const Gnum                        finebaseval = finegrafptr->s.baseval;
+  const Gnum                        coarbaseval = coargrafptr->s.baseval;
+  const int                         thrdnbr     = threadNbr (descptr);
+  const int                         thrdnum     = threadNum (descptr);
+  HgraphOrderCpThread * restrict const  thrdptr     = &dataptr->thrdtab[thrdnum];
+  HgraphOrderCpHash * restrict const    finehashtab = thrdptr->hashtab;
+
+  memSet (finehashtab, ~0, (finehashmsk + 1) * sizeof (HgraphOrderCpHash));
+
+  finevertbas = finebaseval + DATASCAN (finegrafptr->vnohnbr, thrdnbr, thrdnum);
+  finevertnnd = finebaseval + DATASCAN (finegrafptr->vnohnbr, thrdnbr, thrdnum + 1);
+  for (finevertnum = finevertbas; finevertnum < finevertnnd; finevertnum ++) { /* Compute hash sums of local non-halo vertices */
+    Gnum                fineedgenum;
+    Gnum                finehsumval;
+
+    for (fineedgenum = fineverttax[finevertnum], finehsumval = finevertnum; /* For all edges, including halo edges */
+         fineedgenum < finevendtax[finevertnum]; fineedgenum ++)
+      finehsumval += fineedgetax[fineedgenum];
+
+    finehsumtax[finevertnum] = finehsumval;
   }
-#endif /* SCOTCH_DEBUG_ORDER2 */
 
-  if ((coarperitab = memAlloc (coargrafdat.vnohnbr * sizeof (Gnum))) == NULL) { /* Coarse permutation only for non-halo vertices */
-    errorPrint ("hgraphOrderCp: out of memory (3)");
-    hgraphExit (&coargrafdat);
-    memFree    (finecoartax + finegrafptr->s.baseval);
-    return     (1);
+  threadBarrier (descptr);                        /* Hash sums of neighbors must be known */
+
+  for (finevertnum = finevertbas, coarvertnbr = 0; /* For all local non-halo vertices */
+       finevertnum < finevertnnd; finevertnum ++) {
+    Gnum                finedegrval;
+    Gnum                finehsumval;
+    Gnum                finevertbst;              /* Smallest vertex found to have same closed neighborhood */
+    Gnum                fineedgenum;
+    int                 finehashflg;              /* Flag set when vertex adjacency is in hash table        */
+
+    finedegrval = finevendtax[finevertnum] - fineverttax[finevertnum];
+    finehsumval = finehsumtax[finevertnum];
+    finevertbst = finevertnum;
+    finehashflg = 0;
+
+    for (fineedgenum = fineverttax[finevertnum];  /* For all edges, including halo edges */
+         fineedgenum < finevendtax[finevertnum]; fineedgenum ++) {
+      Gnum                finevertend;
+      Gnum                fineedgetmp;
+      Gnum                finehashnum;
+
+      finevertend = fineedgetax[fineedgenum];
+      if ((finevertend >= finevertbst) ||         /* Smaller vertices are non-halo vertices */
+          (finehsumval != finehsumtax[finevertend]) ||
+          (finedegrval != (finevendtax[finevertend] - fineverttax[finevertend])))
+        continue;
+
+      if (finehashflg == 0) {                     /* If closed neighborhood not yet in hash table */
+        for (fineedgetmp = fineverttax[finevertnum];
+             fineedgetmp < finevendtax[finevertnum]; fineedgetmp ++) {
+          Gnum                finevertngb;
+
+          finevertngb = fineedgetax[fineedgetmp];
+          for (finehashnum = (finevertngb * HGRAPHORDERCPHASHPRIME) & finehashmsk;
+               finehashtab[finehashnum].vertnum == finevertnum; finehashnum = (finehashnum + 1) & finehashmsk) ;
+          finehashtab[finehashnum].vertnum = finevertnum;
+          finehashtab[finehashnum].vertend = finevertngb;
+        }
+        for (finehashnum = (finevertnum * HGRAPHORDERCPHASHPRIME) & finehashmsk;
+             finehashtab[finehashnum].vertnum == finevertnum; finehashnum = (finehashnum + 1) & finehashmsk) ;
+        finehashtab[finehashnum].vertnum = finevertnum;
+        finehashtab[finehashnum].vertend = finevertnum;
+        finehashflg = 1;
+      }
+
+      for (fineedgetmp = fineverttax[finevertend]; /* Check that all neighbors of mate are in closed neighborhood */
+           fineedgetmp < finevendtax[finevertend]; fineedgetmp ++) {
+        Gnum                finevertngb;
+
+        finevertngb = fineedgetax[fineedgetmp];
+        for (finehashnum = (finevertngb * HGRAPHORDERCPHASHPRIME) & finehashmsk; ;
+             finehashnum = (finehashnum + 1) & finehashmsk) {
+          if (finehashtab[finehashnum].vertnum != finevertnum) /* If mate neighbor not found in hash table */
+            goto loop_failed;
+          if (finehashtab[finehashnum].vertend == finevertngb) /* Else if mate neighbor found in hash table */
+            break;
+        }
+      }
+      finevertbst = finevertend;                  /* Mate has same closed neighborhood and smaller number */
+loop_failed: ;
+    }
+
+    if (finevertbst == finevertnum) {             /* If vertex is representative of its class */
+      finecoartax[finevertnum] = 0;               /* Flag it as such                          */
+      coarvertnbr ++;
+    }
+    else                                          /* Record representative as negative value */
+      finecoartax[finevertnum] = -1 - finevertbst;
   }
-  orderInit (&coarordedat, coargrafdat.s.baseval, coargrafdat.vnohnbr, coarperitab); /* Build ordering of compressed subgraph */
-  if (hgraphOrderSt (&coargrafdat, &coarordedat, 0, &coarordedat.cblktre, paraptr->stratcpr) != 0) {
-    memFree    (coarperitab);
-    hgraphExit (&coargrafdat);
-    memFree    (finecoartax + finegrafptr->s.baseval);
-    return     (1);
+
+  thrdptr->vertnbr    = coarvertnbr;
+  thrdptr->scantab[0] = coarvertnbr;
+  threadScan (descptr, &thrdptr->scantab[0], sizeof (HgraphOrderCpThread), (ThreadScanFunc) hgraphOrderCpScan, NULL); /* Compute start indices of coarse vertices */
+
+  coarvnohnnd = dataptr->thrdtab[thrdnbr - 1].scantab[0] + coarbaseval;
+  if ((coarvnohnnd - coarbaseval) > dataptr->coarvnohmax) { /* If graph needs not be compressed */
+    if (thrdnum == 0)
+      dataptr->retuval = 1;
+    return;
+  }
+  coarvertnbr = (coarvnohnnd - coarbaseval) + (finegrafptr->s.vertnbr - finegrafptr->vnohnbr);
+
+  if (thrdnum == 0) {                             /* First thread allocates compressed vertex arrays */
+    Gnum                coarvnhdsiz;
+    Gnum                coarvsizsiz;
+
+    coarvnhdsiz = (finegrafptr->s.vertnbr == finegrafptr->vnohnbr) ? 0 : (coarvnohnnd - coarbaseval);
+    coarvsizsiz = (finevelotax == NULL) ? 0 : coarvertnbr;
+    if (memAllocGroup ((void **) (void *)
+                       &coargrafptr->s.verttax, (size_t) ((coarvertnbr + 1) * sizeof (Gnum)),
+                       &coargrafptr->vnhdtax,   (size_t) (coarvnhdsiz       * sizeof (Gnum)),
+                       &coargrafptr->s.velotax, (size_t) (coarvertnbr       * sizeof (Gnum)),
+                       &dataptr->coarvsiztax,   (size_t) (coarvsizsiz       * sizeof (Gnum)), NULL) == NULL) {
+      errorPrint ("hgraphOrderCpCompress3: out of memory (1)");
+      dataptr->retuval = 2;
+    }
+    else {
+      coargrafptr->s.verttax -= coarbaseval;
+      coargrafptr->s.vendtax  = coargrafptr->s.verttax + 1; /* Use compact representation of arrays */
+      coargrafptr->s.velotax -= coarbaseval;
+      coargrafptr->vnhdtax    = (coarvnhdsiz == 0) ? coargrafptr->s.vendtax : coargrafptr->vnhdtax - coarbaseval;
+      dataptr->coarvsiztax    = (finevelotax == NULL) ? coargrafptr->s.velotax : dataptr->coarvsiztax - coarbaseval;
+      coargrafptr->s.vertnbr  = coarvertnbr;
+      coargrafptr->s.vertnnd  = coarvertnbr + coarbaseval;
+      coargrafptr->vnohnnd    = coarvnohnnd;
+      coargrafptr->vnohnbr    = coarvnohnnd - coarbaseval;
+    }
+  }
+
+  coarfinetax = finehsumtax + (finebaseval - coarbaseval); /* Hash sums no longer needed after scan barrier */
+  for (finevertnum = finevertbas, coarvertnum = thrdptr->scantab[0] - thrdptr->vertnbr + coarbaseval;
+       finevertnum < finevertnnd; finevertnum ++) {
+    if (finecoartax[finevertnum] >= 0) {          /* If vertex is representative of its class */
+      finecoartax[finevertnum] = coarvertnum;
+      coarfinetax[coarvertnum] = finevertnum;
+      coarvertnum ++;
+    }
+  }
+  for (finevertnum = finegrafptr->vnohnnd + DATASCAN (finegrafptr->s.vertnbr - finegrafptr->vnohnbr, thrdnbr, thrdnum), /* Halo vertices are never compressed */
+       finevertnnd = finegrafptr->vnohnnd + DATASCAN (finegrafptr->s.vertnbr - finegrafptr->vnohnbr, thrdnbr, thrdnum + 1);
+       finevertnum < finevertnnd; finevertnum ++) {
+    coarvertnum = finevertnum - finegrafptr->vnohnnd + coarvnohnnd;
+    finecoartax[finevertnum] = coarvertnum;
+    coarfinetax[coarvertnum] = finevertnum;
+  }
+
+  threadBarrier (descptr);                        /* Representatives must be numbered */
+
+  if (dataptr->retuval != 0)                      /* If memory allocation failed */
+    return;
+
+  finevertnnd = finebaseval + DATASCAN (finegrafptr->vnohnbr, thrdnbr, thrdnum + 1);
+  for (finevertnum = finevertbas; finevertnum < finevertnnd; finevertnum ++) { /* Propagate coarse numbers to merged vertices */
+    if (finecoartax[finevertnum] < 0)
+      finecoartax[finevertnum] = finecoartax[-1 - finecoartax[finevertnum]];
+  }
+
+  threadBarrier (descptr);                        /* Fine to coarse array must be complete */
+
+  coarverttax = coargrafptr->s.verttax;
+  coarvnhdtax = coargrafptr->vnhdtax;
+  coarvelotax = coargrafptr->s.velotax;
+  coarvsiztax = dataptr->coarvsiztax;
+  coarvertbas = coarbaseval + DATASCAN (coarvertnbr, thrdnbr, thrdnum);
+  coarvertnnd = coarbaseval + DATASCAN (coarvertnbr, thrdnbr, thrdnum + 1);
+  for (coarvertnum = coarvertbas, coaredgenum = 0; /* Compute sizes, loads and degrees of local coarse vertices */
+       coarvertnum < coarvertnnd; coarvertnum ++) {
+    Gnum                finevertnum;
+    Gnum                fineedgenum;
+    Gnum                fineedgennd;
+    Gnum                coarvsizval;
+    Gnum                coarveloval;
+
+    finevertnum = coarfinetax[coarvertnum];
+    fineedgennd = (coarvertnum < coarvnohnnd) ? finevnhdtax[finevertnum] : finevendtax[finevertnum];
+    coarvsizval = 1;
+    coarveloval = (finevelotax != NULL) ? finevelotax[finevertnum] : 1;
+    for (fineedgenum = fineverttax[finevertnum]; fineedgenum < fineedgennd; fineedgenum ++) {
+      Gnum                finevertend;
+      Gnum                coarvertend;
+
+      finevertend = fineedgetax[fineedgenum];
+      coarvertend = finecoartax[finevertend];
+      if (coarvertend == coarvertnum) {           /* If neighbor is merged into us */
+        coarvsizval ++;
+        coarveloval += (finevelotax != NULL) ? finevelotax[finevertend] : 1;
+      }
+      else if (coarfinetax[coarvertend] == finevertend) /* Count each neighboring class once, through its representative */
+        coaredgenum ++;
+    }
+    coaredgenum += finevendtax[finevertnum] - fineedgennd; /* Add edges to halo vertices, if any */
+
+    coarvelotax[coarvertnum] = coarveloval;       /* Fill coarse vertex size array if it is merged with load array */
+    coarvsiztax[coarvertnum] = coarvsizval;
+  }
+
+  thrdptr->edgenbr    = coaredgenum;
+  thrdptr->scantab[0] = coaredgenum;
+  threadScan (descptr, &thrdptr->scantab[0], sizeof (HgraphOrderCpThread), (ThreadScanFunc) hgraphOrderCpScan, NULL); /* Compute start indices of coarse edges */
+
+  if (thrdnum == 0) {                             /* First thread allocates compressed edge array */
+    Gnum                coaredgenbr;
+
+    coaredgenbr = dataptr->thrdtab[thrdnbr - 1].scantab[0];
+    if ((coargrafptr->s.edgetax = (Gnum *) memAlloc ((coaredgenbr + 1) * sizeof (Gnum))) == NULL) { /* TRICK: "+1" to avoid zero-size allocation */
+      errorPrint ("hgraphOrderCpCompress3: out of memory (2)");
+      dataptr->retuval = 2;
+    }
+    else {
+      coargrafptr->s.edgetax -= coarbaseval;
+      coarverttax[coarbaseval + coarvertnbr] = coarbaseval + coaredgenbr; /* Set end of compact vertex array */
+    }
+  }
+
+  threadBarrier (descptr);
+
+  if (dataptr->retuval != 0)                      /* If memory allocation failed */
+    return;
+
+  memSet (finehashtab, ~0, (finehashmsk + 1) * sizeof (HgraphOrderCpHash)); /* Hash table now indexed by coarse vertices */
+
+  coaredgetax = coargrafptr->s.edgetax;
+  for (coarvertnum = coarvertbas, coaredgenum = thrdptr->scantab[0] - thrdptr->edgenbr + coarbaseval; /* Build edges of local coarse vertices */
+       coarvertnum < coarvertnnd; coarvertnum ++) {
+    Gnum                finevertnum;
+    Gnum                fineedgenum;
+    Gnum                fineedgennd;
+
+    coarverttax[coarvertnum] = coaredgenum;
+
+    finevertnum = coarfinetax[coarvertnum];
+    fineedgennd = (coarvertnum < coarvnohnnd) ? finevnhdtax[finevertnum] : finevendtax[finevertnum];
+    for (fineedgenum = fineverttax[finevertnum]; fineedgenum < fineedgennd; fineedgenum ++) {
+      Gnum                coarvertend;
+      Gnum                finehashnum;
+
+      coarvertend = finecoartax[fineedgetax[fineedgenum]];
+      if (coarvertend == coarvertnum)             /* If neighbor is merged into us, do not write edge */
+        continue;
+      for (finehashnum = (coarvertend * HGRAPHORDERCPHASHPRIME) & finehashmsk; ; /* Search for end vertex in hash table */
+           finehashnum = (finehashnum + 1) & finehashmsk) {
+        if (finehashtab[finehashnum].vertnum != coarvertnum) {
+          finehashtab[finehashnum].vertnum = coarvertnum;
+          finehashtab[finehashnum].vertend =
+          coaredgetax[coaredgenum ++]      = coarvertend;
+          break;
+        }
+        if (finehashtab[finehashnum].vertend == coarvertend)
+          break;                                  /* If edge already exists */
+      }
+    }
+    if (coarvertnum < coarvnohnnd) {              /* If non-halo coarse vertex */
+      if (coarvnhdtax != coargrafptr->s.vendtax)  /* If graph has a halo       */
+        coarvnhdtax[coarvertnum] = coaredgenum;   /* Set end of non-halo edge sub-array */
+
+      for ( ; fineedgenum < finevendtax[finevertnum]; fineedgenum ++) /* For edges linking to halo vertices */
+        coaredgetax[coaredgenum ++] = finecoartax[fineedgetax[fineedgenum]]; /* Halo vertices are always unique */
+    }
   }
 
-  *cblkptr = coarordedat.cblktre;                 /* Link sub-tree to ordering         */
-  coarordedat.cblktre.cblktab = NULL;             /* Unlink sub-tree from sub-ordering */
-#ifdef SCOTCH_DEBUG_ORDER2
-  finevertnbr =
-#endif /* SCOTCH_DEBUG_ORDER2 */
-  hgraphOrderCpTree (coarordedat.peritab, coarvsiztax, cblkptr, 0); /* Expand sub-tree */
 #ifdef SCOTCH_DEBUG_ORDER2
-  if (finevertnbr != finegrafptr->vnohnbr) {
-    errorPrint ("hgraphOrderCp: internal error (4)");
-    return     (1);
+  if (coaredgenum != (thrdptr->scantab[0] + coarbaseval)) {
+    errorPrint ("hgraphOrderCpCompress3: internal error");
+    dataptr->retuval = 2;                         /* Benign race, as only value 2 can be written */
   }
 #endif /* SCOTCH_DEBUG_ORDER2 */
-#ifdef SCOTCH_PTHREAD
-  pthread_mutex_lock (&fineordeptr->mutedat);
-#endif /* SCOTCH_PTHREAD */
-  fineordeptr->treenbr += coarordedat.treenbr - 1; /* Adjust number of tree nodes    */
-  fineordeptr->cblknbr += coarordedat.cblknbr - 1; /* Adjust number of column blocks */
-#ifdef SCOTCH_PTHREAD
-  pthread_mutex_unlock (&fineordeptr->mutedat);
-#endif /* SCOTCH_PTHREAD */
+}
 
-  coarvpostax = coargrafdat.s.verttax;            /* Re-cycle verttab (not velotab as may be merged with coarvsiztab) */
-  coarperitax = coarperitab - coargrafdat.s.baseval;
+/* This routine builds the compressed halo
+** graph concurrently, if compression is
+** worth it.
+** It returns:
+** - 0   : if the compressed graph was built.
+** - 1   : if the graph needs not be compressed.
+** - 2   : on error.
+*/
 
-  for (coarvertnum = coargrafdat.s.baseval, finevsizsum = 0; /* Compute initial indices for inverse permutation expansion */
-       coarvertnum < coargrafdat.vnohnnd; coarvertnum ++) {
-    coarvpostax[coarperitax[coarvertnum]] = finevsizsum;
-    finevsizsum += coarvsiztax[coarperitax[coarvertnum]];
+static
+int
+hgraphOrderCpCompress2 (
+const Hgraph * restrict const     finegrafptr,
+Hgraph * restrict const           coargrafptr,
+Gnum ** restrict const            finecoarptr,    /*+ Pointer to based fine to coarse array +*/
+Gnum ** restrict const            coarvsizptr,    /*+ Pointer to coarse vertex size array   +*/
+const double                      comprat)
+{
+  HgraphOrderCpData             datadat;
+  HgraphOrderCpHash * restrict  hashtab;
+  Gnum                          finehashmsk;
+  Gnum * restrict               finecoartab;
+  Gnum *                        finehsumtab;
+  Gnum                          coarenohnnd;
+  int                           thrdnum;
+
+  const int                     thrdnbr = contextThreadNbr (finegrafptr->contptr);
+
+  for (finehashmsk = 15;                          /* Set neighbor hash table sizes */
+       finehashmsk < finegrafptr->s.degrmax;
+       finehashmsk = finehashmsk * 2 + 1) ;
+  finehashmsk = finehashmsk * 4 + 3;              /* Fill hash table at 1/4 of capacity */
+
+  if ((finecoartab = (Gnum *) memAlloc (finegrafptr->s.vertnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("hgraphOrderCpCompress2: out of memory (1)");
+    return     (2);
   }
-  if (finevnumtax == NULL) {                      /* If fine graph is original graph */
-    for (finevertnum = finegrafptr->s.baseval; finevertnum < finegrafptr->vnohnnd; finevertnum ++) /* Compute fine permutation */
-      fineperitab[coarvpostax[finecoartax[finevertnum]] ++] = finevertnum;
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.thrdtab, (size_t) (thrdnbr                 * sizeof (HgraphOrderCpThread)),
+                     &hashtab,         (size_t) (thrdnbr * (finehashmsk + 1) * sizeof (HgraphOrderCpHash)),
+                     &finehsumtab,     (size_t) (finegrafptr->s.vertnbr  * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hgraphOrderCpCompress2: out of memory (2)");
+    memFree    (finecoartab);
+    return     (2);
   }
-  else {                                          /* Graph is not original graph */
-    for (finevertnum = finegrafptr->s.baseval; finevertnum < finegrafptr->vnohnnd; finevertnum ++) /* Compute fine permutation */
-      fineperitab[coarvpostax[finecoartax[finevertnum]] ++] = finevnumtax[finevertnum];
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    datadat.thrdtab[thrdnum].hashtab = hashtab + thrdnum * (finehashmsk + 1);
+
+  hgraphInit (coargrafptr);                       /* Initialize compressed halo graph structure                               */
+  coargrafptr->s.baseval = 1;                     /* Base coarse graph to 1 because hgraphOrderHb and hgraphOrderHf prefer it */
+
+  datadat.finegrafptr = finegrafptr;
+  datadat.coargrafptr = coargrafptr;
+  datadat.finecoartax = finecoartab - finegrafptr->s.baseval;
+  datadat.finehsumtax = finehsumtab - finegrafptr->s.baseval;
+  datadat.coarvsiztax = NULL;
+  datadat.coarvnohmax = (Gnum) ((double) finegrafptr->vnohnbr * comprat);
+  datadat.finehashmsk = finehashmsk;
+  datadat.retuval     = 0;
+
+  contextThreadLaunch (finegrafptr->contptr, (ThreadFunc) hgraphOrderCpCompress3, (void *) &datadat);
+
+  memFree (datadat.thrdtab);                      /* Free group leader */
+
+  if (datadat.retuval != 0) {
+    hgraphExit (coargrafptr);                     /* Free arrays that may have been allocated */
+    memFree    (finecoartab);
+    return     (datadat.retuval);
   }
 
-  memFree    (coarperitab);
-  memFree    (finecoartax + finegrafptr->s.baseval);
-  orderExit  (&coarordedat);
-  hgraphExit (&coargrafdat);                      /* Free coarvsiztab as part of vertex group */
+  coarenohnnd = coargrafptr->s.verttax[coargrafptr->vnohnnd]; /* Position of first edge of first halo vertex */
+  coargrafptr->s.flagval = GRAPHFREETABS | GRAPHVERTGROUP; /* Do not set HGRAPHFREEVNHD since vnhdtax allocated in group */
+  coargrafptr->s.velosum = finegrafptr->s.velosum;
+  coargrafptr->s.degrmax = finegrafptr->s.degrmax;
+  coargrafptr->s.edlosum =
+  coargrafptr->s.edgenbr = coargrafptr->s.verttax[coargrafptr->s.vertnnd] - coargrafptr->s.baseval;
+  coargrafptr->vnlosum   = finegrafptr->vnlosum;
+  coargrafptr->levlnum   = finegrafptr->levlnum;  /* Keep level  */
+  coargrafptr->contptr   = finegrafptr->contptr;  /* Use context */
+  coargrafptr->enlosum   =
+  coargrafptr->enohnbr   = coargrafptr->s.edgenbr - 2 * (coargrafptr->s.verttax[coargrafptr->s.vertnnd] - coarenohnnd);
+
+  *finecoarptr = datadat.finecoartax;
+  *coarvsizptr = datadat.coarvsiztax;
 
   return (0);
 }
 
+#endif /* HGRAPHORDERCPNOTHREAD */
+
+
 /* This routine turns the coarse elimination
 ** tree produced by the ordering of the coarse
 ** graph into a fine elimination tree, according
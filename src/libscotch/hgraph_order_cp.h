@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2014,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2014,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.0  : from : 09 nov 2014     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -58,6 +58,13 @@
 **  The defines.
 */
 
+/*+ Flag for compiling the multi-threaded
+    version of the compression routine.  +*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined HGRAPHORDERCPNOTHREAD)
+#define HGRAPHORDERCPNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined HGRAPHORDERCPNOTHREAD) */
+
 /*+ Prime number for hashing vertex numbers. +*/
 
 #define HGRAPHORDERCPHASHPRIME      17            /* Prime number */
@@ -88,11 +95,40 @@ typedef struct HgraphOrderCpMate_ {
   Gnum                      finevertend;          /*+ Adjacent end vertex number        +*/
 } HgraphOrderCpMate;
 
+/*+ The thread-specific data block. +*/
+
+typedef struct HgraphOrderCpThread_ {
+  HgraphOrderCpHash *       hashtab;              /*+ Thread-local neighbor hash table      +*/
+  Gnum                      vertnbr;              /*+ Number of local coarse vertices       +*/
+  Gnum                      edgenbr;              /*+ Number of local coarse edges          +*/
+  Gnum                      scantab[2];           /*+ Scan area for vertex and edge indices +*/
+} HgraphOrderCpThread;
+
+/*+ The thread-independent data block. +*/
+
+typedef struct HgraphOrderCpData_ {
+  const Hgraph *            finegrafptr;          /*+ Fine halo graph                               +*/
+  Hgraph *                  coargrafptr;          /*+ Compressed halo graph                         +*/
+  Gnum *                    finecoartax;          /*+ Fine to coarse array; first holds mates       +*/
+  Gnum *                    finehsumtax;          /*+ Hash sum array; re-used as coarse to fine one +*/
+  Gnum *                    coarvsiztax;          /*+ Array of coarse vertex sizes                  +*/
+  Gnum                      coarvnohmax;          /*+ Maximum number of non-halo coarse vertices    +*/
+  Gnum                      finehashmsk;          /*+ Mask for access to thread-local hash tables   +*/
+  HgraphOrderCpThread *     thrdtab;              /*+ Array of thread-specific data                 +*/
+  int                       retuval;              /*+ Compression return value                      +*/
+} HgraphOrderCpData;
+
 /*
 **  The function prototypes.
 */
 
 #ifdef SCOTCH_HGRAPH_ORDER_CP
+static int                  hgraphOrderCpCompress (const Hgraph * const, Hgraph * const, Gnum ** const, Gnum ** const, const double);
+#ifndef HGRAPHORDERCPNOTHREAD
+static void                 hgraphOrderCpScan   (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+static void                 hgraphOrderCpCompress3 (ThreadDescriptor * restrict const, HgraphOrderCpData * restrict const);
+static int                  hgraphOrderCpCompress2 (const Hgraph * const, Hgraph * const, Gnum ** const, Gnum ** const, const double);
+#endif /* HGRAPHORDERCPNOTHREAD */
 static Gnum                 hgraphOrderCpTree   (const Gnum * const, const Gnum * const, OrderCblk * const, const Gnum);
 #endif /* SCOTCH_HGRAPH_ORDER_CP */
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2019-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2019-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -54,7 +54,7 @@
 /**                # Version 6.1  : from : 11 nov 2019     **/
 /**                                 to   : 11 feb 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,6 +69,7 @@
 #include "hgraph.h"
 #include "hall_order_hx.h"
 #include "hall_order_hd.h"
+#include "hall_order_hn.h"
 #include "hgraph_order_hd.h"
 #include "hgraph_order_hx.h"
 #include "hgraph_order_si.h"
@@ -140,13 +141,22 @@ const HgraphOrderHdParam * restrict const paraptr)
 
   hgraphOrderHxFill (grafptr, petab, lentab, iwtab, nvartab, elentab, &pfree);
 
-  hallOrderHdR2Halmd (norig, n, 0, iwlen, petab, pfree, /* No elements here */
-                      lentab, iwtab, nvartab, elentab, lasttab, &ncmpa,
-                      leaftab, secntab, nexttab, frsttab);
-  if (ncmpa < 0) {
-    errorPrint ("hgraphOrderHd: internal error");
-    memFree    (petab);                           /* Free group leader */
-    return     (1);
+  if (paraptr->kernval == HALLORDERHNKERNNATV) {  /* If native kernel requested */
+    if (hallOrderHnHamd (n, petab, lentab, iwtab, nvartab, elentab, HALLORDERHNTYPEDEG) != 0) {
+      errorPrint ("hgraphOrderHd: cannot compute ordering");
+      memFree    (petab);                         /* Free group leader */
+      return     (1);
+    }
+  }
+  else {
+    hallOrderHdR2Halmd (norig, n, 0, iwlen, petab, pfree, /* No elements here */
+                        lentab, iwtab, nvartab, elentab, lasttab, &ncmpa,
+                        leaftab, secntab, nexttab, frsttab);
+    if (ncmpa < 0) {
+      errorPrint ("hgraphOrderHd: internal error");
+      memFree    (petab);                         /* Free group leader */
+      return     (1);
+    }
   }
 
   if (grafptr->s.velotax != NULL) {
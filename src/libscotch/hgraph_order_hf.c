@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 29 oct 2019     **/
 /**                                 to   : 18 jan 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,6 +66,7 @@
 #include "order.h"
 #include "hgraph.h"
 #include "hall_order_hf.h"
+#include "hall_order_hn.h"
 #include "hall_order_hx.h"
 #include "hgraph_order_hf.h"
 #include "hgraph_order_hx.h"
@@ -142,13 +143,22 @@ const HgraphOrderHfParam * restrict const paraptr)
 
   hgraphOrderHxFill (grafptr, petab, lentab, iwtab, nvtab, elentab, &pfree);
 
-  hallOrderHfR3Hamdf4 (norig, n, 0, nbbuck, iwlen, petab, pfree,
-                       lentab, iwtab, nvtab, elentab, lasttab, &ncmpa,
-                       leaftab, secntab, nexttab, frsttab, headtab);
-  if (ncmpa < 0) {
-    errorPrint ("hgraphOrderHf: internal error");
-    memFree    (petab);                           /* Free group leader */
-    return     (1);
+  if (paraptr->kernval == HALLORDERHNKERNNATV) {  /* If native kernel requested */
+    if (hallOrderHnHamd (n, petab, lentab, iwtab, nvtab, elentab, HALLORDERHNTYPEFILL) != 0) {
+      errorPrint ("hgraphOrderHf: cannot compute ordering");
+      memFree    (petab);                         /* Free group leader */
+      return     (1);
+    }
+  }
+  else {
+    hallOrderHfR3Hamdf4 (norig, n, 0, nbbuck, iwlen, petab, pfree,
+                         lentab, iwtab, nvtab, elentab, lasttab, &ncmpa,
+                         leaftab, secntab, nexttab, frsttab, headtab);
+    if (ncmpa < 0) {
+      errorPrint ("hgraphOrderHf: internal error");
+      memFree    (petab);                         /* Free group leader */
+      return     (1);
+    }
   }
 
   if (grafptr->s.velotax != NULL) {
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,6 +48,8 @@
 /**                                 to   : 01 oct 2009     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,6 +69,7 @@ typedef struct HgraphOrderHfParam_ {
   INT                       colmin;               /*+ Minimum number of columns +*/
   INT                       colmax;               /*+ Maximum number of columns +*/
   double                    fillrat;              /*+ Fill-in ratio             +*/
+  HallOrderHnKern           kernval;              /*+ Ordering kernel           +*/
 } HgraphOrderHfParam;
 
 /*
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2012,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2012,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.0  : from : 17 oct 2012     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,12 +66,16 @@
 #include "mapping.h"
 #include "order.h"
 #include "hgraph.h"
+#include "hgraph_order_am.h"
 #include "hgraph_order_bl.h"
 #include "hgraph_order_cc.h"
 #include "hgraph_order_cp.h"
 #include "hgraph_order_gp.h"
+#include "hall_order_hn.h"
 #include "hgraph_order_hd.h"
 #include "hgraph_order_hf.h"
+#include "hall_order_hp.h"
+#include "hgraph_order_hp.h"
 #include "hgraph_order_kp.h"
 #include "hgraph_order_nd.h"
 #include "hgraph_order_si.h"
@@ -87,6 +91,11 @@
 
 static Hgraph               hgraphorderstgraphdummy; /* Dummy graph for offset computations */
 
+static union {                                    /* Default parameters for block amalgamation method */
+  HgraphOrderAmParam        param;                /* Parameter zone                                   */
+  StratNodeMethodData       padding;              /* To avoid reading out of structure                */
+} hgraphorderstdefaultam = { { &stratdummy, 1, 100000, 0.08L, HGRAPHORDERAMTYPENONE } };
+
 static union {                                    /* Default parameters for block splitting method */
   HgraphOrderBlParam        param;                /* Parameter zone                                */
   StratNodeMethodData       padding;              /* To avoid reading out of structure             */
@@ -110,12 +119,17 @@ static union {
 static union {
   HgraphOrderHdParam        param;
   StratNodeMethodData       padding;
-} hgraphorderstdefaulthd = { { 1, 10000, 0.08L } };
+} hgraphorderstdefaulthd = { { 1, 10000, 0.08L, HALLORDERHNKERNHAMD } };
 
 static union {
   HgraphOrderHfParam        param;
   StratNodeMethodData       padding;
-} hgraphorderstdefaulthf = { { 1, 1000000, 0.08L } };
+} hgraphorderstdefaulthf = { { 1, 1000000, 0.08L, HALLORDERHNKERNHAMD } };
+
+static union {
+  HgraphOrderHpParam        param;
+  StratNodeMethodData       padding;
+} hgraphorderstdefaulthp = { { 1, 10000, 0.08L, HALLORDERHPTYPEDEG } };
 
 static union {
   HgraphOrderKpParam        param;
@@ -128,18 +142,40 @@ static union {                                    /* Default parameters for nest
 } hgraphorderstdefaultnd = { { &stratdummy, &stratdummy, &stratdummy } };
 
 static StratMethodTab       hgraphorderstmethtab[] = { /* Graph ordering methods array */
+                              { HGRAPHORDERSTMETHAM, "a",  hgraphOrderAm, &hgraphorderstdefaultam },
                               { HGRAPHORDERSTMETHBL, "b",  hgraphOrderBl, &hgraphorderstdefaultbl },
                               { HGRAPHORDERSTMETHCC, "o",  hgraphOrderCc, &hgraphorderstdefaultcc },
                               { HGRAPHORDERSTMETHCP, "c",  hgraphOrderCp, &hgraphorderstdefaultcp },
                               { HGRAPHORDERSTMETHGP, "g",  hgraphOrderGp, &hgraphorderstdefaultgp },
                               { HGRAPHORDERSTMETHHD, "d",  hgraphOrderHd, &hgraphorderstdefaulthd },
                               { HGRAPHORDERSTMETHHF, "f",  hgraphOrderHf, &hgraphorderstdefaulthf },
+                              { HGRAPHORDERSTMETHHP, "p",  hgraphOrderHp, &hgraphorderstdefaulthp },
                               { HGRAPHORDERSTMETHKP, "k",  hgraphOrderKp, &hgraphorderstdefaultkp },
                               { HGRAPHORDERSTMETHND, "n",  hgraphOrderNd, &hgraphorderstdefaultnd },
                               { HGRAPHORDERSTMETHSI, "s",  hgraphOrderSi, NULL },
                               { -1,                  NULL, NULL,          NULL } };
 
 static StratParamTab        hgraphorderstparatab[] = { /* The method parameter list */
+                              { HGRAPHORDERSTMETHAM,  STRATPARAMSTRAT,  "strat",
+                                (byte *) &hgraphorderstdefaultam.param,
+                                (byte *) &hgraphorderstdefaultam.param.strat,
+                                (void *) &hgraphorderststratab },
+                              { HGRAPHORDERSTMETHAM,  STRATPARAMINT,    "cmin",
+                                (byte *) &hgraphorderstdefaultam.param,
+                                (byte *) &hgraphorderstdefaultam.param.colmin,
+                                NULL },
+                              { HGRAPHORDERSTMETHAM,  STRATPARAMINT,    "cmax",
+                                (byte *) &hgraphorderstdefaultam.param,
+                                (byte *) &hgraphorderstdefaultam.param.colmax,
+                                NULL },
+                              { HGRAPHORDERSTMETHAM,  STRATPARAMDOUBLE, "frat",
+                                (byte *) &hgraphorderstdefaultam.param,
+                                (byte *) &hgraphorderstdefaultam.param.fillrat,
+                                NULL },
+                              { HGRAPHORDERSTMETHAM,  STRATPARAMCASE,   "sort",
+                                (byte *) &hgraphorderstdefaultam.param,
+                                (byte *) &hgraphorderstdefaultam.param.sortval,
+                                (void *) "nmb" },
                               { HGRAPHORDERSTMETHBL,  STRATPARAMSTRAT,  "strat",
                                 (byte *) &hgraphorderstdefaultbl.param,
                                 (byte *) &hgraphorderstdefaultbl.param.strat,
@@ -180,6 +216,10 @@ static StratParamTab        hgraphorderstparatab[] = { /* The method parameter l
                                 (byte *) &hgraphorderstdefaulthd.param,
                                 (byte *) &hgraphorderstdefaulthd.param.fillrat,
                                 NULL },
+                              { HGRAPHORDERSTMETHHD,  STRATPARAMCASE,   "kern",
+                                (byte *) &hgraphorderstdefaulthd.param,
+                                (byte *) &hgraphorderstdefaulthd.param.kernval,
+                                (void *) "hn" },
                               { HGRAPHORDERSTMETHHF,  STRATPARAMINT,    "cmin",
                                 (byte *) &hgraphorderstdefaulthf.param,
                                 (byte *) &hgraphorderstdefaulthf.param.colmin,
@@ -192,6 +232,26 @@ static StratParamTab        hgraphorderstparatab[] = { /* The method parameter l
                                 (byte *) &hgraphorderstdefaulthf.param,
                                 (byte *) &hgraphorderstdefaulthf.param.fillrat,
                                 NULL },
+                              { HGRAPHORDERSTMETHHF,  STRATPARAMCASE,   "kern",
+                                (byte *) &hgraphorderstdefaulthf.param,
+                                (byte *) &hgraphorderstdefaulthf.param.kernval,
+                                (void *) "hn" },
+                              { HGRAPHORDERSTMETHHP,  STRATPARAMINT,    "cmin",
+                                (byte *) &hgraphorderstdefaulthp.param,
+                                (byte *) &hgraphorderstdefaulthp.param.colmin,
+                                NULL },
+                              { HGRAPHORDERSTMETHHP,  STRATPARAMINT,    "cmax",
+                                (byte *) &hgraphorderstdefaulthp.param,
+                                (byte *) &hgraphorderstdefaulthp.param.colmax,
+                                NULL },
+                              { HGRAPHORDERSTMETHHP,  STRATPARAMDOUBLE, "frat",
+                                (byte *) &hgraphorderstdefaulthp.param,
+                                (byte *) &hgraphorderstdefaulthp.param.fillrat,
+                                NULL },
+                              { HGRAPHORDERSTMETHHP,  STRATPARAMCASE,   "type",
+                                (byte *) &hgraphorderstdefaulthp.param,
+                                (byte *) &hgraphorderstdefaulthp.param.typeval,
+                                (void *) "df" },
                               { HGRAPHORDERSTMETHKP,  STRATPARAMINT,    "siz",
                                 (byte *) &hgraphorderstdefaultkp.param,
                                 (byte *) &hgraphorderstdefaultkp.param.partsiz,
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2012,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2012,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,6 +47,8 @@
 /**                                 to   : 15 jan 2003     **/
 /**                # Version 6.0  : from : 17 oct 2012     **/
 /**                                 to   : 05 apr 2018     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -57,12 +59,14 @@
 /*+ Method types. +*/
 
 typedef enum HgraphOrderStMethodType_ {
-  HGRAPHORDERSTMETHBL = 0,                        /*+ Block splitting post-processing       +*/
+  HGRAPHORDERSTMETHAM = 0,                        /*+ Block amalgamation post-processing    +*/
+  HGRAPHORDERSTMETHBL,                            /*+ Block splitting post-processing       +*/
   HGRAPHORDERSTMETHCC,                            /*+ Splitting of connected components     +*/
   HGRAPHORDERSTMETHCP,                            /*+ Graph compression                     +*/
   HGRAPHORDERSTMETHGP,                            /*+ Gibbs-Poole-Stockmeyer                +*/
   HGRAPHORDERSTMETHHD,                            /*+ Block Halo Approximate Minimum Degree +*/
   HGRAPHORDERSTMETHHF,                            /*+ Block Halo Approximate Minimum Fill   +*/
+  HGRAPHORDERSTMETHHP,                            /*+ Multi-threaded Halo Approximate MD/MF +*/
   HGRAPHORDERSTMETHKP,                            /*+ K-way block partitioning              +*/
   HGRAPHORDERSTMETHND,                            /*+ Nested Dissection                     +*/
   HGRAPHORDERSTMETHSI,                            /*+ Simple                                +*/
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 28 apr 2019     **/
 /**                                 to   : 28 apr 2019     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # From a given halo mesh is created a   **/
 /**                  halo graph, such that all vertices of **/
@@ -121,6 +121,7 @@ Hgraph * restrict const       grafptr)            /*+ Graph to build +*/
   grafptr->vnohnbr   = meshptr->vnohnbr;
   grafptr->vnohnnd   = meshptr->vnohnbr + grafptr->s.baseval;
   grafptr->vnlosum   = meshptr->vnhlsum;
+  grafptr->contptr   = meshptr->contptr;          /* Halo graph shares execution context of mesh */
 
   for (hashsiz = 2, hashnbr = meshptr->m.degrmax * meshptr->m.degrmax * 2; /* Compute size of hash table */
        hashsiz < hashnbr; hashsiz <<= 1) ;
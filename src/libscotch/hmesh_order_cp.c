@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 06 jun 2018     **/
 /**                                 to   : 09 feb 2020     **/
 /**                # Version 7.0  : from : 28 aug 2020     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -86,21 +86,18 @@ const Gnum                                ordenum, /*+ Zero-based ordering numbe
 OrderCblk * restrict const                cblkptr, /*+ Single column-block        +*/
 const HmeshOrderCpParam * restrict const  paraptr)
 {
+  HmeshOrderCpData              datadat;          /* Compression data                                                      */
   Hmesh                         coarmeshdat;      /* Compressed halo submesh                                               */
   Order                         coarordedat;      /* Ordering of compressed halo submesh                                   */
   Gnum * restrict               coarperitab;      /* Coarse permutation array                                              */
   const Gnum * restrict         coarperitax;      /* Temporary based access to coarperitab                                 */
-  Gnum                          coarvertnum;      /* Number of current compressed vertex                                   */
   Gnum * restrict               coarvsiztax;      /* Array of coarse vertex sizes (as number of merged fine vertices)      */
-  Gnum                          coaredgenum;      /* Number of current compressed edge                                     */
   Gnum * restrict               coarvpostax;      /* Position in fine permutation of fine vertices merged into same vertex */
   Gnum                          coarvnodmax;
   Gnum                          coarvertmax;
   Gnum * restrict               finecoartax;      /* Original to compressed vertex number array                            */
   HmeshOrderCpHash * restrict   finehashtab;      /* Neighbor hash table                                                   */
   Gnum                          finehashmsk;      /* Mask for access to hash table                                         */
-  int * restrict                finehasptab;      /* Pre-hashing table                                                     */
-  Gnum                          finehaspmsk;      /* Mask for access to pre-hashing table                                  */
   Gnum * restrict               finehsumtax;      /* Array of hash values for each original vertex                         */
   Gnum                          finevsizsum;      /* Sum of compressed vertex sizes to build fine inverse permutation      */
   Gnum                          coarvsizsiz;      /* Size of array of sizes of coarse nodes                                */
@@ -110,11 +107,8 @@ const HmeshOrderCpParam * restrict const  paraptr)
   Gnum * restrict               coaredgetax;
   Gnum * restrict               coarfinetax;
   Gnum                          finevnodnum;
-  Gnum                          coarvnodnbr;
-  Gnum                          finevelmnum;
-  Gnum                          coarvnodnnd;
-  Gnum                          coardegrmax;
   Gnum                          coarvnodnum;
+  int                           o;
 #ifdef SCOTCH_DEBUG_ORDER2
   Gnum                          finevertnbr;      /* Number of fine vertices in compressed elimination tree                */
 #endif /* SCOTCH_DEBUG_ORDER2 */
@@ -150,8 +144,173 @@ const HmeshOrderCpParam * restrict const  paraptr)
   }
 /* TODO : resize after success */
 
-  finehsumtax -= finemeshptr->m.vnodbas;          /* TRICK: do not base finecoartax yet (see later) */
-  finehasptab  = (int *) finecoartax;             /* Use finecoartab as temporary pre-hash table    */
+  memSet (&coarmeshdat, 0, sizeof (Hmesh));       /* Initialize compressed halo mesh structure   */
+  coarmeshdat.m.flagval = MESHFREEVERT | MESHVERTGROUP; /* Free only coarverttab as group leader */
+  coarmeshdat.m.baseval = finemeshptr->m.baseval;
+  coarmeshdat.m.velmbas = coarmeshdat.m.baseval;
+  coarmeshdat.m.velmnbr = coarvelmnbr;            /* Mesh compression does not touch elements, apart from isolated elements */
+  coarmeshdat.m.velmnnd =
+  coarmeshdat.m.vnodbas = coarvelmnbr + coarmeshdat.m.baseval;
+  coarmeshdat.m.veisnbr = finemeshptr->m.veisnbr; /* To date, keep all isolated element vertices, if any */
+  coarmeshdat.m.velosum = finemeshptr->m.velosum;
+  coarmeshdat.m.vnlosum = finemeshptr->m.vnlosum;
+
+  coarverttax -= coarmeshdat.m.baseval;
+  coarvsiztax -= coarmeshdat.m.vnodbas;           /* TRICK: if no vertex loads, coarvsiztax points to coarvnodtax */
+  coarvnlotax -= coarmeshdat.m.vnodbas;
+  coaredgetax -= coarmeshdat.m.baseval;
+  finecoartax -= finemeshptr->m.vnodbas;
+  finehsumtax -= finemeshptr->m.vnodbas;
+
+  coarmeshdat.m.verttax = coarverttax;
+  coarmeshdat.m.vendtax = coarverttax + 1;        /* Use compact representation of arrays     */
+  coarmeshdat.m.velotax = finemeshptr->m.velotax; /* Re-use element vertex load array, if any */
+  coarmeshdat.m.vnlotax = coarvnlotax;
+  coarmeshdat.m.edgetax = coaredgetax;
+
+  coarfinetax -= coarmeshdat.m.vnodbas;
+
+  datadat.finemeshptr = finemeshptr;
+  datadat.coarmeshptr = &coarmeshdat;
+  datadat.finecoartax = finecoartax;
+  datadat.finehsumtax = finehsumtax;
+  datadat.finerpsttax = NULL;
+  datadat.coarfinetax = coarfinetax;
+  datadat.coarvsiztax = coarvsiztax;
+  datadat.coarvnodmax = coarvnodmax;
+  datadat.finehashtab = finehashtab;
+  datadat.finehashmsk = finehashmsk;
+  datadat.thrdtab     = NULL;
+
+#ifndef HMESHORDERCPNOTHREAD
+  if (contextThreadNbr (finemeshptr->contptr) > 1) /* If several threads available, build compressed mesh concurrently */
+    o = hmeshOrderCpCompress2 (&datadat);
+  else
+#endif /* HMESHORDERCPNOTHREAD */
+    o = hmeshOrderCpCompress (&datadat);
+  if (o != 0) {                                   /* If mesh not compressed */
+    memFree (coarverttax + coarmeshdat.m.baseval); /* Free group leader     */
+    return  ((o == 1) ? hmeshOrderSt (finemeshptr, fineordeptr, ordenum, cblkptr, paraptr->stratunc) : 1);
+  }
+
+  coarmeshdat.vnohnbr   = coarmeshdat.m.vnodnbr;  /* Halo meshes not yet supported */
+  coarmeshdat.vnohnnd   = coarmeshdat.m.vnodnnd;
+  coarmeshdat.vehdtax   = coarmeshdat.m.vendtax;  /* Only element part of vendtab will be accessed through vehdtab */
+  coarmeshdat.vnhlsum   = coarmeshdat.m.vnlosum;
+  coarmeshdat.enohnbr   = coarmeshdat.m.edgenbr;
+  coarmeshdat.levlnum   = finemeshptr->levlnum;   /* Compression does not change level */
+  coarmeshdat.contptr   = finemeshptr->contptr;
+
+
+#ifdef SCOTCH_DEBUG_ORDER2
+  if (hmeshCheck (&coarmeshdat) != 0) {
+    errorPrint ("hmeshOrderCp: internal error (4)");
+    hmeshExit  (&coarmeshdat);
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+
+  orderInit (&coarordedat, coarmeshdat.m.baseval, coarmeshdat.m.vnodnbr, coarperitab); /* Build ordering of compressed submesh */
+  if (hmeshOrderSt (&coarmeshdat, &coarordedat, 0, &coarordedat.cblktre, paraptr->stratcpr) != 0) {
+    hmeshExit (&coarmeshdat);
+    return    (1);
+  }
+
+  coarvsiztax += (coarmeshdat.m.vnodbas - coarmeshdat.m.baseval); /* Adjust array to match permutation bounds */
+
+  *cblkptr = coarordedat.cblktre;                 /* Link sub-tree to ordering         */
+  coarordedat.cblktre.cblktab = NULL;             /* Unlink sub-tree from sub-ordering */
+
+#ifdef SCOTCH_DEBUG_ORDER2
+  finevertnbr =
+#endif /* SCOTCH_DEBUG_ORDER2 */
+  hmeshOrderCpTree (coarordedat.peritab, coarvsiztax, cblkptr, 0); /* Expand sub-tree */
+#ifdef SCOTCH_DEBUG_ORDER2
+  if (finevertnbr != finemeshptr->m.vnodnbr) {
+    errorPrint ("hmeshOrderCp: internal error (5)");
+    hmeshExit  (&coarmeshdat);
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_lock (&fineordeptr->mutedat);
+#endif /* SCOTCH_PTHREAD */
+  fineordeptr->treenbr += coarordedat.treenbr - 1; /* Adjust number of tree nodes    */
+  fineordeptr->cblknbr += coarordedat.cblknbr - 1; /* Adjust number of column blocks */
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_unlock (&fineordeptr->mutedat);
+#endif /* SCOTCH_PTHREAD */
+
+  coarvpostax = coarmeshdat.m.verttax;            /* Recycle verttab (not velotab as may be merged with coarvsiztab) */
+  coarperitax = coarperitab - coarmeshdat.m.vnodbas;
+
+  for (coarvnodnum = coarmeshdat.m.vnodbas, finevsizsum = ordenum; /* Compute initial indices for inverse permutation expansion */
+       coarvnodnum < coarmeshdat.m.vnodnnd; coarvnodnum ++) {
+    coarvpostax[coarperitax[coarvnodnum]] = finevsizsum;
+    finevsizsum += coarvsiztax[coarperitax[coarvnodnum]];
+  }
+  coarvpostax = coarmeshdat.m.verttax + (coarmeshdat.m.baseval - coarmeshdat.m.vnodbas);
+  for (finevnodnum = finemeshptr->m.vnodbas; finevnodnum < finemeshptr->m.vnodnnd; finevnodnum ++) { /* Compute fine permutation */
+    Gnum                coarvnodnum;
+
+    coarvnodnum = finecoartax[finevnodnum];       /* Get index of corresponding coarse node */
+    if (coarvnodnum < 0)                          /* If node is not cluster leader          */
+      coarvnodnum = -2 - coarvnodnum;             /* Get index of cluster leader            */
+    fineordeptr->peritab[coarvpostax[coarvnodnum] ++] = (finemeshptr->m.vnumtax == NULL) /* If mesh is original mesh */
+                                                        ? finevnodnum + (finemeshptr->m.baseval - finemeshptr->m.vnodbas)
+                                                        : finemeshptr->m.vnumtax[finevnodnum];
+  }
+
+  orderExit (&coarordedat);
+  hmeshExit (&coarmeshdat);
+
+  return (0);
+}
+
+/************************************/
+/*                                  */
+/* These routines build the         */
+/* compressed mesh.                 */
+/*                                  */
+/************************************/
+
+/* This routine sequentially builds the
+** compressed mesh, if compression is
+** worth it.
+** It returns:
+** - 0   : if the compressed mesh was built.
+** - 1   : if the mesh needs not be compressed.
+** - 2   : on error.
+*/
+
+static
+int
+hmeshOrderCpCompress (
+HmeshOrderCpData * restrict const dataptr)
+{
+  Gnum                          coarvertnum;      /* Number of current compressed vertex  */
+  Gnum                          coaredgenum;      /* Number of current compressed edge    */
+  Gnum                          coarvnodnbr;      /* Estimated number of coarse nodes     */
+  Gnum                          coarvnodnnd;
+  Gnum                          coardegrmax;
+  int * restrict                finehasptab;      /* Pre-hashing table                    */
+  Gnum                          finehaspmsk;      /* Mask for access to pre-hashing table */
+  Gnum                          finevnodnum;
+  Gnum                          finevelmnum;
+
+  const Hmesh * restrict const      finemeshptr = dataptr->finemeshptr;
+  Hmesh * restrict const            coarmeshptr = dataptr->coarmeshptr;
+  Gnum * restrict const             finecoartax = dataptr->finecoartax;
+  Gnum * restrict const             finehsumtax = dataptr->finehsumtax;
+  Gnum * restrict const             coarfinetax = dataptr->coarfinetax;
+  Gnum * restrict const             coarvsiztax = dataptr->coarvsiztax;
+  Gnum * restrict const             coarverttax = dataptr->coarmeshptr->m.verttax;
+  Gnum * restrict const             coaredgetax = dataptr->coarmeshptr->m.edgetax;
+  HmeshOrderCpHash * restrict const finehashtab = dataptr->finehashtab;
+  const Gnum                        finehashmsk = dataptr->finehashmsk;
+  const Gnum                        coarvnodmax = dataptr->coarvnodmax;
+
+  finehasptab  = (int *) (finecoartax + finemeshptr->m.vnodbas); /* Use finecoartab as temporary pre-hash table */
   for (finehaspmsk = 1;                           /* Get pre-hash mask that fits in finecoartab     */
        finehaspmsk <= finemeshptr->m.vnodnbr;     /* Smallest (2^i)-1 value > vertnbr               */
        finehaspmsk = finehaspmsk * 2 + 1) ;
@@ -180,42 +339,14 @@ const HmeshOrderCpParam * restrict const  paraptr)
     finehasptab[finehsumval] |= (1 << finehsumbit); /* Put value into pre-hash table anyway                                                     */
   }
 
-  if (coarvnodnbr > coarvnodmax) {                /* If mesh needs not be compressed */
-    memFree (coarverttax);                        /* Group leader not yet based      */
-    return  (hmeshOrderSt (finemeshptr, fineordeptr, ordenum, cblkptr, paraptr->stratunc));
-  }
-
-  memSet (finecoartax, ~0, finemeshptr->m.vnodnbr * sizeof (Gnum));
-
-  memSet (&coarmeshdat, 0, sizeof (Hmesh));       /* Initialize compressed halo mesh structure   */
-  coarmeshdat.m.flagval = MESHFREEVERT | MESHVERTGROUP; /* Free only coarverttab as group leader */
-  coarmeshdat.m.baseval = finemeshptr->m.baseval;
-  coarmeshdat.m.velmbas = coarmeshdat.m.baseval;
-  coarmeshdat.m.velmnbr = coarvelmnbr;            /* Mesh compression does not touch elements, apart from isolated elements */
-  coarmeshdat.m.velmnnd =
-  coarmeshdat.m.vnodbas = coarvelmnbr + coarmeshdat.m.baseval;
-  coarmeshdat.m.veisnbr = finemeshptr->m.veisnbr; /* To date, keep all isolated element vertices, if any */
-  coarmeshdat.m.velosum = finemeshptr->m.velosum;
-  coarmeshdat.m.vnlosum = finemeshptr->m.vnlosum;
-
-  coarverttax -= coarmeshdat.m.baseval;
-  coarvsiztax -= coarmeshdat.m.vnodbas;           /* TRICK: if no vertex loads, coarvsiztax points to coarvnodtax */
-  coarvnlotax -= coarmeshdat.m.vnodbas;
-  coaredgetax -= coarmeshdat.m.baseval;
-  finecoartax -= finemeshptr->m.vnodbas;
-
-  coarmeshdat.m.verttax = coarverttax;
-  coarmeshdat.m.vendtax = coarverttax + 1;        /* Use compact representation of arrays     */
-  coarmeshdat.m.velotax = finemeshptr->m.velotax; /* Re-use element vertex load array, if any */
-  coarmeshdat.m.vnlotax = coarvnlotax;
-  coarmeshdat.m.edgetax = coaredgetax;
-
-  coarfinetax -= coarmeshdat.m.vnodbas;
+  if (coarvnodnbr > coarvnodmax)                  /* If mesh needs not be compressed */
+    return (1);
 
+  memSet (finecoartax + finemeshptr->m.vnodbas, ~0, finemeshptr->m.vnodnbr * sizeof (Gnum));
   memSet (finehashtab, ~0, (finehashmsk + 1) * sizeof (HmeshOrderCpHash));
 
-  for (finevelmnum = finemeshptr->m.velmbas, coarvertnum = coaredgenum = coarmeshdat.m.baseval, /* Build element arrays */
-       coarvnodnnd = coarmeshdat.m.baseval + finemeshptr->m.velmnbr, coardegrmax = 0;
+  for (finevelmnum = finemeshptr->m.velmbas, coarvertnum = coaredgenum = coarmeshptr->m.baseval, /* Build element arrays */
+       coarvnodnnd = coarmeshptr->m.baseval + finemeshptr->m.velmnbr, coardegrmax = 0;
        finevelmnum < finemeshptr->m.velmnnd; finevelmnum ++) {
     Gnum                fineeelmnum;
     Gnum                coardegrval;
@@ -226,9 +357,9 @@ const HmeshOrderCpParam * restrict const  paraptr)
       continue;
 #endif
 #ifdef SCOTCH_DEBUG_ORDER2
-    if (coarvertnum >= coarmeshdat.m.velmnnd) {   /* If too many elements declared   */
-      errorPrint ("hmeshOrderCp: internal error (1)"); /* Maybe problem with veisnbr */
-      return     (1);
+    if (coarvertnum >= coarmeshptr->m.velmnnd) {  /* If too many elements declared   */
+      errorPrint ("hmeshOrderCpCompress: internal error (1)"); /* Maybe problem with veisnbr */
+      return     (2);
     }
 #endif /* SCOTCH_DEBUG_ORDER2 */
 
@@ -250,10 +381,8 @@ const HmeshOrderCpParam * restrict const  paraptr)
         Gnum                fineeelmngb;
         Gnum                coarvsizval;          /* Number of fine node vertices in coarse node vertex  */
 
-        if (coarvnodnnd >= (coarvnodmax + coarmeshdat.m.vnodbas)) { /* If mesh needs not be compressed */
-          memFree (coarverttax + coarmeshdat.m.baseval);
-          return  (hmeshOrderSt (finemeshptr, fineordeptr, ordenum, cblkptr, paraptr->stratunc));
-        }
+        if (coarvnodnnd >= (coarvnodmax + coarmeshptr->m.vnodbas)) /* If mesh needs not be compressed */
+          return (1);
 
         coarvsizval = 1;                          /* Cluster leader it at least alone     */
         coarvnodnum = coarvnodnnd ++;             /* Node is leader of future cluster     */
@@ -320,25 +449,25 @@ loop_failed: ;
     coarvertnum ++;                               /* One more coarse element created */
   }
 #ifdef SCOTCH_DEBUG_ORDER2
-  if (coarvertnum != coarmeshdat.m.velmnnd) {     /* If too many elements declared */
-    errorPrint ("hmeshOrderCp: internal error (2)"); /* Maybe problem with veisnbr */
-    return     (1);
+  if (coarvertnum != coarmeshptr->m.velmnnd) {    /* If too many elements declared */
+    errorPrint ("hmeshOrderCpCompress: internal error (2)"); /* Maybe problem with veisnbr */
+    return     (2);
   }
 #endif /* SCOTCH_DEBUG_ORDER2 */
-  coarmeshdat.m.vnodnnd = coarvnodnnd;
-  coarmeshdat.m.vnodnbr = coarvnodnnd - coarmeshdat.m.vnodbas;
+  coarmeshptr->m.vnodnnd = coarvnodnnd;
+  coarmeshptr->m.vnodnbr = coarvnodnnd - coarmeshptr->m.vnodbas;
 
 #ifdef SCOTCH_DEBUG_ORDER2
   for (finevnodnum = finemeshptr->m.vnodbas;
        finevnodnum < finemeshptr->m.vnodnnd; finevnodnum ++) {
     if (finecoartax[finevnodnum] == ~0) {
-      errorPrint ("hmeshOrderCp: internal error (3)");
-      return     (1);
+      errorPrint ("hmeshOrderCpCompress: internal error (3)");
+      return     (2);
     }
   }
 #endif /* SCOTCH_DEBUG_ORDER2 */
 
-  for ( ; coarvertnum < coarmeshdat.m.vnodnnd; coarvertnum ++) { /* Build node arrays */
+  for ( ; coarvertnum < coarmeshptr->m.vnodnnd; coarvertnum ++) { /* Build node arrays */
     Gnum                finevnodnum;
     Gnum                fineenodnum;
     Gnum                coardegrval;
@@ -349,94 +478,389 @@ loop_failed: ;
     coardegrval = finemeshptr->m.vendtax[finevnodnum] - finemeshptr->m.verttax[finevnodnum];
     for (fineenodnum = finemeshptr->m.verttax[finevnodnum];
          fineenodnum < finemeshptr->m.vendtax[finevnodnum]; fineenodnum ++)
-      coaredgetax[coaredgenum ++] = finemeshptr->m.edgetax[fineenodnum] - (finemeshptr->m.velmbas - coarmeshdat.m.velmbas);
+      coaredgetax[coaredgenum ++] = finemeshptr->m.edgetax[fineenodnum] - (finemeshptr->m.velmbas - coarmeshptr->m.velmbas);
 
     if (coardegrval > coardegrmax)
       coardegrmax = coardegrval;
   }
   coarverttax[coarvertnum] = coaredgenum;         /* Set end of vertex array */
 
-  coarmeshdat.m.edgenbr = coaredgenum - coarmeshdat.m.baseval;
-  coarmeshdat.m.degrmax = coardegrmax;
-  coarmeshdat.vnohnbr   = coarmeshdat.m.vnodnbr;  /* Halo meshes not yet supported */
-  coarmeshdat.vnohnnd   = coarmeshdat.m.vnodnnd;
-  coarmeshdat.vehdtax   = coarmeshdat.m.vendtax;  /* Only element part of vendtab will be accessed through vehdtab */
-  coarmeshdat.vnhlsum   = coarmeshdat.m.vnlosum;
-  coarmeshdat.enohnbr   = coarmeshdat.m.edgenbr;
-  coarmeshdat.levlnum   = finemeshptr->levlnum;   /* Compression does not change level */
-  coarmeshdat.contptr   = finemeshptr->contptr;
+  coarmeshptr->m.edgenbr = coaredgenum - coarmeshptr->m.baseval;
+  coarmeshptr->m.degrmax = coardegrmax;
 
   if (finemeshptr->m.vnlotax != NULL) {           /* If fine mesh has node vertex loads */
-    memSet (coarmeshdat.m.vnlotax + coarmeshdat.m.vnodbas, 0, coarmeshdat.m.vnodnbr * sizeof (Gnum));
+    memSet (coarmeshptr->m.vnlotax + coarmeshptr->m.vnodbas, 0, coarmeshptr->m.vnodnbr * sizeof (Gnum));
 
     for (finevnodnum = finemeshptr->m.vnodbas; finevnodnum < finemeshptr->m.vnodnnd; finevnodnum ++) { /* Compute vertex loads for compressed mesh */
-      coarmeshdat.m.vnlotax[finecoartax[finevnodnum]] += finemeshptr->m.vnlotax[finevnodnum];
+      Gnum                coarvnodnum;
+
+      coarvnodnum = finecoartax[finevnodnum];     /* Get index of corresponding coarse node */
+      if (coarvnodnum < 0)                        /* If node is not cluster leader          */
+        coarvnodnum = -2 - coarvnodnum;           /* Get index of cluster leader            */
+      coarmeshptr->m.vnlotax[coarvnodnum] += finemeshptr->m.vnlotax[finevnodnum];
     }
   }
 
-#ifdef SCOTCH_DEBUG_ORDER2
-  if (hmeshCheck (&coarmeshdat) != 0) {
-    errorPrint ("hmeshOrderCp: internal error (4)");
-    hmeshExit  (&coarmeshdat);
-    return     (1);
+  return (0);
+}
+
+#ifndef HMESHORDERCPNOTHREAD
+
+/* This routine performs a prefix scan
+** sum operation on a fixed number of
+** Gnum values, backed by a temporary area.
+*/
+
+static
+void
+hmeshOrderCpScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  int                 scannum;
+
+  for (scannum = 0; scannum < HMESHORDERCPSCANNBR; scannum ++)
+    tlocptr[dstpval * HMESHORDERCPSCANNBR + scannum] = tlocptr[srcpval * HMESHORDERCPSCANNBR + scannum] +
+                                                       ((tremptr == NULL) ? 0 : tremptr[srcpval * HMESHORDERCPSCANNBR + scannum]);
+}
+
+/* This routine is the threaded core of the
+** building of the compressed mesh. Nodes
+** having the same element adjacency form
+** clusters, which are numbered in the order
+** of their first appearance in the element
+** adjacency array, as the sequential routine
+** does, whatever the number of threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+hmeshOrderCpCompress3 (
+ThreadDescriptor * restrict const descptr,
+HmeshOrderCpData * restrict const dataptr)
+{
+  Gnum                          finevnodbas;      /* Bounds of local fine node range    */
+  Gnum                          finevnodnnd;
+  Gnum                          finevnodnum;
+  Gnum                          finevelmbas;      /* Bounds of local fine element range */
+  Gnum                          finevelmnnd;
+  Gnum                          finevelmnum;
+  Gnum                          coarvnodnum;
+  Gnum                          coareelmnum;      /* Current coarse element edge        */
+  Gnum                          coarenodnum;      /* Current coarse node edge           */
+  Gnum                          coardegrmax;
+  Gnum * restrict               finelidxtax;      /* Index of first appearance of clusters in element adjacency */
+
+  const Hmesh * restrict const      finemeshptr = dataptr->finemeshptr;
+  Hmesh * restrict const            coarmeshptr = dataptr->coarmeshptr;
+  const Gnum * restrict const       fineverttax = finemeshptr->m.verttax;
+  const Gnum * restrict const       finevendtax = finemeshptr->m.vendtax;
+  const Gnum * restrict const       finevnlotax = finemeshptr->m.vnlotax;
+  const Gnum * restrict const       fineedgetax = finemeshptr->m.edgetax;
+  Gnum * restrict const             finecoartax = dataptr->finecoartax;
+  Gnum * restrict const             finehsumtax = dataptr->finehsumtax;
+  Gnum * restrict const             finerpsttax = dataptr->finerpsttax;
+  Gnum * restrict const             coarfinetax = dataptr->coarfinetax;
+  Gnum * restrict const             coarvsiztax = dataptr->coarvsiztax;
+  Gnum * restrict const             coarverttax = coarmeshptr->m.verttax;
+  Gnum * restrict const             coarvnlotax = coarmeshptr->m.vnlotax;
+  Gnum * restrict const             coaredgetax = coarmeshptr->m.edgetax;
+  const Gnum                        finehashmsk = dataptr->finehashmsk;
+  const Gnum                        coarvelmdlt = finemeshptr->m.velmbas - coarmeshptr->m.velmbas;
+  const int                         thrdnbr     = threadNbr (descptr);
+  const int                         thrdnum     = threadNum (descptr);
+  HmeshOrderCpThread * restrict const thrdptr     = &dataptr->thrdtab[thrdnum];
+  HmeshOrderCpHash * restrict const   finehashtab = thrdptr->hashtab;
+
+  memSet (finehashtab, ~0, (finehashmsk + 1) * sizeof (HmeshOrderCpHash));
+
+  finevnodbas = finemeshptr->m.vnodbas + DATASCAN (finemeshptr->m.vnodnbr, thrdnbr, thrdnum);
+  finevnodnnd = finemeshptr->m.vnodbas + DATASCAN (finemeshptr->m.vnodnbr, thrdnbr, thrdnum + 1);
+  for (finevnodnum = finevnodbas; finevnodnum < finevnodnnd; finevnodnum ++) { /* Compute hash sums of local nodes */
+    Gnum                fineenodnum;
+    Gnum                finehsumval;
+
+    for (fineenodnum = fineverttax[finevnodnum], finehsumval = 0;
+         fineenodnum < finevendtax[finevnodnum]; fineenodnum ++)
+      finehsumval += fineedgetax[fineenodnum];
+
+    finehsumtax[finevnodnum] = finehsumval;
   }
-#endif /* SCOTCH_DEBUG_ORDER2 */
 
-  orderInit (&coarordedat, coarmeshdat.m.baseval, coarmeshdat.m.vnodnbr, coarperitab); /* Build ordering of compressed submesh */
-  if (hmeshOrderSt (&coarmeshdat, &coarordedat, 0, &coarordedat.cblktre, paraptr->stratcpr) != 0) {
-    hmeshExit (&coarmeshdat);
-    return    (1);
+  threadBarrier (descptr);                        /* Hash sums of neighbors must be known */
+
+  for (finevnodnum = finevnodbas; finevnodnum < finevnodnnd; finevnodnum ++) { /* Find smallest node of cluster */
+    Gnum                finedegrval;
+    Gnum                finehsumval;
+    Gnum                finevnodbst;              /* Smallest node found to have same adjacency         */
+    Gnum                finevelmbst;              /* Element of smallest degree in adjacency of node    */
+    Gnum                fineenodnum;
+    Gnum                fineeelmnum;
+    int                 finehashflg;              /* Flag set when node adjacency is in hash table      */
+
+    finedegrval = finevendtax[finevnodnum] - fineverttax[finevnodnum];
+    finehsumval = finehsumtax[finevnodnum];
+    finevnodbst = finevnodnum;
+    finehashflg = 0;
+
+    if (finedegrval <= 0) {                       /* Isolated nodes are never merged */
+      finerpsttax[finevnodnum] = finevnodnum;
+      continue;
+    }
+    for (fineenodnum = fineverttax[finevnodnum], finevelmbst = fineedgetax[fineenodnum]; /* Search element of smallest degree */
+         fineenodnum < finevendtax[finevnodnum]; fineenodnum ++) {
+      Gnum                finevelmend;
+
+      finevelmend = fineedgetax[fineenodnum];
+      if ((finevendtax[finevelmend] - fineverttax[finevelmend]) < (finevendtax[finevelmbst] - fineverttax[finevelmbst]))
+        finevelmbst = finevelmend;
+    }
+
+    for (fineeelmnum = fineverttax[finevelmbst];  /* All nodes of cluster belong to any of its elements */
+         fineeelmnum < finevendtax[finevelmbst]; fineeelmnum ++) {
+      Gnum                finevnodend;
+      Gnum                fineenodtmp;
+      Gnum                finehelmnum;
+
+      finevnodend = fineedgetax[fineeelmnum];
+      if ((finevnodend >= finevnodbst) ||
+          (finehsumval != finehsumtax[finevnodend]) ||
+          (finedegrval != (finevendtax[finevnodend] - fineverttax[finevnodend])))
+        continue;
+
+      if (finehashflg == 0) {                     /* If node adjacency not yet in hash table */
+        for (fineenodtmp = fineverttax[finevnodnum];
+             fineenodtmp < finevendtax[finevnodnum]; fineenodtmp ++) {
+          Gnum                finevelmend;
+
+          finevelmend = fineedgetax[fineenodtmp];
+          for (finehelmnum = (finevelmend * HMESHORDERCPHASHPRIME) & finehashmsk;
+               finehashtab[finehelmnum].vnodnum == finevnodnum;
+               finehelmnum = (finehelmnum + 1) & finehashmsk) ;
+          finehashtab[finehelmnum].vnodnum = finevnodnum;
+          finehashtab[finehelmnum].velmnum = finevelmend;
+        }
+        finehashflg = 1;
+      }
+
+      for (fineenodtmp = fineverttax[finevnodend]; /* Check that adjacencies are identical */
+           fineenodtmp < finevendtax[finevnodend]; fineenodtmp ++) {
+        Gnum                finevelmend;
+
+        finevelmend = fineedgetax[fineenodtmp];
+        for (finehelmnum = (finevelmend * HMESHORDERCPHASHPRIME) & finehashmsk; ; finehelmnum = (finehelmnum + 1) & finehashmsk) {
+          if (finehashtab[finehelmnum].vnodnum != finevnodnum) /* If adjacencies differ */
+            goto loop_failed;
+          if (finehashtab[finehelmnum].velmnum == finevelmend) /* If neighbor found, process next neighbor */
+            break;
+        }
+      }
+      finevnodbst = finevnodend;                  /* Node has same adjacency and smaller number */
+loop_failed: ;
+    }
+
+    finerpsttax[finevnodnum] = finevnodbst;
   }
 
-  coarvsiztax += (coarmeshdat.m.vnodbas - coarmeshdat.m.baseval); /* Adjust array to match permutation bounds */
+  threadBarrier (descptr);                        /* Representatives of all nodes must be known */
 
-  *cblkptr = coarordedat.cblktre;                 /* Link sub-tree to ordering         */
-  coarordedat.cblktre.cblktab = NULL;             /* Unlink sub-tree from sub-ordering */
+  finelidxtax = finehsumtax;                      /* Hash sums no longer needed */
+  for (finevnodnum = finevnodbas; finevnodnum < finevnodnnd; finevnodnum ++) { /* Locate first appearance of local clusters */
+    Gnum                fineenodnum;
+    Gnum                fineeelmnum;
+    Gnum                finevelmmin;
 
-#ifdef SCOTCH_DEBUG_ORDER2
-  finevertnbr =
-#endif /* SCOTCH_DEBUG_ORDER2 */
-  hmeshOrderCpTree (coarordedat.peritab, coarvsiztax, cblkptr, 0); /* Expand sub-tree */
-#ifdef SCOTCH_DEBUG_ORDER2
-  if (finevertnbr != finemeshptr->m.vnodnbr) {
-    errorPrint ("hmeshOrderCp: internal error (5)");
-    hmeshExit  (&coarmeshdat);
-    return     (1);
+    if ((finerpsttax[finevnodnum] != finevnodnum) || /* If node is not cluster representative or is isolated */
+        (fineverttax[finevnodnum] >= finevendtax[finevnodnum])) {
+      finelidxtax[finevnodnum] = -1;
+      continue;
+    }
+
+    for (fineenodnum = fineverttax[finevnodnum], finevelmmin = fineedgetax[fineenodnum]; /* Get first element of cluster */
+         fineenodnum < finevendtax[finevnodnum]; fineenodnum ++) {
+      if (fineedgetax[fineenodnum] < finevelmmin)
+        finevelmmin = fineedgetax[fineenodnum];
+    }
+    for (fineeelmnum = fineverttax[finevelmmin]; finerpsttax[fineedgetax[fineeelmnum]] != finevnodnum; fineeelmnum ++) ;
+    finelidxtax[finevnodnum] = fineeelmnum;       /* Record index of first appearance of cluster */
   }
-#endif /* SCOTCH_DEBUG_ORDER2 */
-#ifdef SCOTCH_PTHREAD
-  pthread_mutex_lock (&fineordeptr->mutedat);
-#endif /* SCOTCH_PTHREAD */
-  fineordeptr->treenbr += coarordedat.treenbr - 1; /* Adjust number of tree nodes    */
-  fineordeptr->cblknbr += coarordedat.cblknbr - 1; /* Adjust number of column blocks */
-#ifdef SCOTCH_PTHREAD
-  pthread_mutex_unlock (&fineordeptr->mutedat);
-#endif /* SCOTCH_PTHREAD */
 
-  coarvpostax = coarmeshdat.m.verttax;            /* Recycle verttab (not velotab as may be merged with coarvsiztab) */
-  coarperitax = coarperitab - coarmeshdat.m.vnodbas;
+  threadBarrier (descptr);                        /* First appearances of all clusters must be known */
 
-  for (coarvnodnum = coarmeshdat.m.vnodbas, finevsizsum = 0; /* Compute initial indices for inverse permutation expansion */
-       coarvnodnum < coarmeshdat.m.vnodnnd; coarvnodnum ++) {
-    coarvpostax[coarperitax[coarvnodnum]] = finevsizsum;
-    finevsizsum += coarvsiztax[coarperitax[coarvnodnum]];
+  thrdptr->vnodnbr =
+  thrdptr->eelmnbr =
+  thrdptr->enodnbr = 0;
+  finevelmbas = finemeshptr->m.velmbas + DATASCAN (finemeshptr->m.velmnbr, thrdnbr, thrdnum);
+  finevelmnnd = finemeshptr->m.velmbas + DATASCAN (finemeshptr->m.velmnbr, thrdnbr, thrdnum + 1);
+  for (finevelmnum = finevelmbas; finevelmnum < finevelmnnd; finevelmnum ++) { /* Count coarse nodes and edges of local elements */
+    Gnum                fineeelmnum;
+
+    for (fineeelmnum = fineverttax[finevelmnum]; fineeelmnum < finevendtax[finevelmnum]; fineeelmnum ++) {
+      Gnum                finevnodnum;
+      Gnum                fineeidxval;
+
+      finevnodnum = fineedgetax[fineeelmnum];
+      fineeidxval = finelidxtax[finerpsttax[finevnodnum]];
+      if (fineedgetax[fineeidxval] == finevnodnum) /* If node is cluster leader */
+        thrdptr->eelmnbr ++;
+      if (fineeidxval == fineeelmnum) {           /* If first appearance of cluster */
+        thrdptr->vnodnbr ++;
+        thrdptr->enodnbr += finevendtax[finevnodnum] - fineverttax[finevnodnum];
+      }
+    }
   }
-  coarvpostax = coarmeshdat.m.verttax + (coarmeshdat.m.baseval - coarmeshdat.m.vnodbas);
-  for (finevnodnum = finemeshptr->m.vnodbas; finevnodnum < finemeshptr->m.vnodnnd; finevnodnum ++) { /* Compute fine permutation */
-    Gnum                coarvnodnum;
 
-    coarvnodnum = finecoartax[finevnodnum];       /* Get index of corresponding coarse node */
-    if (coarvnodnum < 0)                          /* If node is not cluster leader          */
-      coarvnodnum = -2 - coarvnodnum;             /* Get index of cluster leader            */
-    fineordeptr->peritab[coarvpostax[coarvnodnum] ++] = finevnodnum + (finemeshptr->m.baseval - finemeshptr->m.vnodbas);
+  thrdptr->scantab[0] = thrdptr->vnodnbr;
+  thrdptr->scantab[1] = thrdptr->eelmnbr;
+  thrdptr->scantab[2] = thrdptr->enodnbr;
+  threadScan (descptr, &thrdptr->scantab[0], sizeof (HmeshOrderCpThread), (ThreadScanFunc) hmeshOrderCpScan, NULL); /* Compute start indices of coarse nodes and edges */
+
+  if (dataptr->thrdtab[thrdnbr - 1].scantab[0] > dataptr->coarvnodmax) { /* If mesh needs not be compressed */
+    if (thrdnum == 0)
+      dataptr->retuval = 1;
+    return;
   }
 
-  orderExit (&coarordedat);
-  hmeshExit (&coarmeshdat);
+  coarvnodnum = coarmeshptr->m.vnodbas + thrdptr->scantab[0] - thrdptr->vnodnbr;
+  coareelmnum = coarmeshptr->m.baseval + thrdptr->scantab[1] - thrdptr->eelmnbr;
+  coarenodnum = coarmeshptr->m.baseval + dataptr->thrdtab[thrdnbr - 1].scantab[1] + thrdptr->scantab[2] - thrdptr->enodnbr;
+  for (finevelmnum = finevelmbas, coardegrmax = 0; /* Number clusters first appearing in local elements */
+       finevelmnum < finevelmnnd; finevelmnum ++) {
+    Gnum                fineeelmnum;
+    Gnum                coardegrval;
+
+    coarverttax[finevelmnum - coarvelmdlt] = coareelmnum;
+
+    for (fineeelmnum = fineverttax[finevelmnum], coardegrval = 0;
+         fineeelmnum < finevendtax[finevelmnum]; fineeelmnum ++) {
+      Gnum                finevnodnum;
+      Gnum                fineeidxval;
+      Gnum                coarvnodtmp;
+
+      finevnodnum = fineedgetax[fineeelmnum];
+      fineeidxval = finelidxtax[finerpsttax[finevnodnum]];
+      if (fineedgetax[fineeidxval] == finevnodnum) /* If node is cluster leader */
+        coardegrval ++;
+      if ((fineeidxval < fineverttax[finevelmnum]) || /* If cluster did not first appear in this element */
+          (fineeidxval >= finevendtax[finevelmnum]))
+        continue;
+
+      if (fineeidxval == fineeelmnum) {           /* If node is leader of new cluster */
+        Gnum                fineenodnum;
+
+        finecoartax[finevnodnum] = coarvnodnum;
+        coarfinetax[coarvnodnum] = finevnodnum;
+        coarvsiztax[coarvnodnum] = 1;             /* TRICK: if no vertex loads, coarvsiztax points to coarvnodtax */
+        if (finevnlotax != NULL)
+          coarvnlotax[coarvnodnum] = finevnlotax[finevnodnum];
+
+        coarverttax[coarvnodnum] = coarenodnum;   /* Build node adjacency */
+        for (fineenodnum = fineverttax[finevnodnum];
+             fineenodnum < finevendtax[finevnodnum]; fineenodnum ++)
+          coaredgetax[coarenodnum ++] = fineedgetax[fineenodnum] - coarvelmdlt;
+        if ((finevendtax[finevnodnum] - fineverttax[finevnodnum]) > coardegrmax)
+          coardegrmax = finevendtax[finevnodnum] - fineverttax[finevnodnum];
+
+        coarvnodnum ++;
+      }
+      else {                                      /* Leader of cluster already met in this element */
+        coarvnodtmp = finecoartax[fineedgetax[fineeidxval]];
+        finecoartax[finevnodnum] = -2 - coarvnodtmp; /* Set index of cluster non-leader */
+        coarvsiztax[coarvnodtmp] ++;
+        if (finevnlotax != NULL)
+          coarvnlotax[coarvnodtmp] += finevnlotax[finevnodnum];
+      }
+    }
+    coareelmnum += coardegrval;
+    if (coardegrval > coardegrmax)
+      coardegrmax = coardegrval;
+  }
+  thrdptr->degrmax = coardegrmax;
+
+  threadBarrier (descptr);                        /* All leaders must be numbered */
+
+  for (finevelmnum = finevelmbas; finevelmnum < finevelmnnd; finevelmnum ++) { /* Build element adjacency */
+    Gnum                fineeelmnum;
+
+    for (fineeelmnum = fineverttax[finevelmnum], coareelmnum = coarverttax[finevelmnum - coarvelmdlt];
+         fineeelmnum < finevendtax[finevelmnum]; fineeelmnum ++) {
+      Gnum                coarvnodend;
+
+      coarvnodend = finecoartax[fineedgetax[fineeelmnum]];
+      if (coarvnodend >= 0)                       /* If node is cluster leader */
+        coaredgetax[coareelmnum ++] = coarvnodend;
+    }
+  }
+}
+
+/* This routine builds the compressed
+** mesh concurrently, if compression is
+** worth it.
+** It returns:
+** - 0   : if the compressed mesh was built.
+** - 1   : if the mesh needs not be compressed.
+** - 2   : on error.
+*/
+
+static
+int
+hmeshOrderCpCompress2 (
+HmeshOrderCpData * restrict const dataptr)
+{
+  HmeshOrderCpHash * restrict   hashtab;
+  Gnum *                        finerpsttab;
+  Gnum                          coardegrmax;
+  Gnum                          coarvnodnbr;
+  Gnum                          coaredgenbr;
+  int                           thrdnum;
+
+  const Hmesh * restrict const  finemeshptr = dataptr->finemeshptr;
+  Hmesh * restrict const        coarmeshptr = dataptr->coarmeshptr;
+  const int                     thrdnbr     = contextThreadNbr (finemeshptr->contptr);
+
+  if (memAllocGroup ((void **) (void *)
+                     &dataptr->thrdtab, (size_t) (thrdnbr                  * sizeof (HmeshOrderCpThread)),
+                     &hashtab,          (size_t) (thrdnbr * (dataptr->finehashmsk + 1) * sizeof (HmeshOrderCpHash)),
+                     &finerpsttab,      (size_t) (finemeshptr->m.vnodnbr   * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("hmeshOrderCpCompress2: out of memory");
+    return     (2);
+  }
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    dataptr->thrdtab[thrdnum].hashtab = hashtab + thrdnum * (dataptr->finehashmsk + 1);
+  dataptr->finerpsttax = finerpsttab - finemeshptr->m.vnodbas;
+  dataptr->retuval     = 0;
+
+  contextThreadLaunch (finemeshptr->contptr, (ThreadFunc) hmeshOrderCpCompress3, (void *) dataptr);
+
+  if (dataptr->retuval != 0) {
+    memFree (dataptr->thrdtab);                   /* Free group leader */
+    return  (dataptr->retuval);
+  }
+
+  for (thrdnum = 0, coardegrmax = 0; thrdnum < thrdnbr; thrdnum ++) {
+    if (dataptr->thrdtab[thrdnum].degrmax > coardegrmax)
+      coardegrmax = dataptr->thrdtab[thrdnum].degrmax;
+  }
+  coarvnodnbr = dataptr->thrdtab[thrdnbr - 1].scantab[0];
+  coaredgenbr = dataptr->thrdtab[thrdnbr - 1].scantab[1] + dataptr->thrdtab[thrdnbr - 1].scantab[2];
+  memFree (dataptr->thrdtab);                     /* Free group leader */
+
+  coarmeshptr->m.vnodnbr = coarvnodnbr;
+  coarmeshptr->m.vnodnnd = coarvnodnbr + coarmeshptr->m.vnodbas;
+  coarmeshptr->m.edgenbr = coaredgenbr;
+  coarmeshptr->m.degrmax = coardegrmax;
+  coarmeshptr->m.verttax[coarmeshptr->m.vnodnnd] = coaredgenbr + coarmeshptr->m.baseval; /* Set end of vertex array */
 
   return (0);
 }
 
+#endif /* HMESHORDERCPNOTHREAD */
+
 /* This routine turns the coarse elimination
 ** tree produced by the ordering of the coarse
 ** mesh into a fine elimination tree, according
@@ -480,3 +904,4 @@ Gnum                        coarordenum)          /* Compressed vertex to start
 
   return (finevertnbr);                           /* Return accumulated number */
 }
+
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -53,6 +53,17 @@
 **  The defines.
 */
 
+/*+ Flag for compiling the multi-threaded
+    version of the compression routine.  +*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined HMESHORDERCPNOTHREAD)
+#define HMESHORDERCPNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined HMESHORDERCPNOTHREAD) */
+
+/*+ Number of values in thread scan areas. +*/
+
+#define HMESHORDERCPSCANNBR         3
+
 /** Prime number for hashing vertex numbers. **/
 
 #define HMESHORDERCPHASHPRIME       17            /* Prime number */
@@ -83,11 +94,45 @@ typedef struct HgraphOrderCpMate_ {
   Gnum                      finevertend;          /*+ Adjacent end vertex number        +*/
 } HgraphOrderCpMate;
 
+/*+ The thread-specific data block. +*/
+
+typedef struct HmeshOrderCpThread_ {
+  HmeshOrderCpHash *        hashtab;              /*+ Thread-local neighbor hash table       +*/
+  Gnum                      vnodnbr;              /*+ Number of local coarse node vertices   +*/
+  Gnum                      eelmnbr;              /*+ Number of local coarse element edges   +*/
+  Gnum                      enodnbr;              /*+ Number of local coarse node edges      +*/
+  Gnum                      degrmax;              /*+ Local maximum coarse degree            +*/
+  Gnum                      scantab[2 * HMESHORDERCPSCANNBR]; /*+ Scan area for the above counts +*/
+} HmeshOrderCpThread;
+
+/*+ The compression data block. +*/
+
+typedef struct HmeshOrderCpData_ {
+  const Hmesh *             finemeshptr;          /*+ Fine halo mesh                               +*/
+  Hmesh *                   coarmeshptr;          /*+ Compressed halo mesh                         +*/
+  Gnum *                    finecoartax;          /*+ Fine to coarse node array                    +*/
+  Gnum *                    finehsumtax;          /*+ Array of hash values of fine nodes           +*/
+  Gnum *                    finerpsttax;          /*+ Array of representatives of fine nodes       +*/
+  Gnum *                    coarfinetax;          /*+ Coarse to fine leader node array             +*/
+  Gnum *                    coarvsiztax;          /*+ Array of coarse node sizes                   +*/
+  Gnum                      coarvnodmax;          /*+ Maximum number of coarse node vertices       +*/
+  HmeshOrderCpHash *        finehashtab;          /*+ Neighbor hash table                          +*/
+  Gnum                      finehashmsk;          /*+ Mask for access to hash tables               +*/
+  HmeshOrderCpThread *      thrdtab;              /*+ Array of thread-specific data                +*/
+  int                       retuval;              /*+ Compression return value                     +*/
+} HmeshOrderCpData;
+
 /*
 **  The function prototypes.
 */
 
 #ifdef SCOTCH_HMESH_ORDER_CP
+static int                  hmeshOrderCpCompress (HmeshOrderCpData * restrict const);
+#ifndef HMESHORDERCPNOTHREAD
+static void                 hmeshOrderCpScan    (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+static void                 hmeshOrderCpCompress3 (ThreadDescriptor * restrict const, HmeshOrderCpData * restrict const);
+static int                  hmeshOrderCpCompress2 (HmeshOrderCpData * restrict const);
+#endif /* HMESHORDERCPNOTHREAD */
 static Gnum                 hmeshOrderCpTree    (const Gnum * const, const Gnum * const, OrderCblk * const, Gnum);
 #endif /* SCOTCH_HMESH_ORDER_CP */
 
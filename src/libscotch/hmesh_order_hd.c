@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.1  : from : 11 nov 2019     **/
 /**                                 to   : 11 feb 2020     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +65,7 @@
 #include "mesh.h"
 #include "hmesh.h"
 #include "hall_order_hd.h"
+#include "hall_order_hn.h"
 #include "hall_order_hx.h"
 #include "hmesh_order_hd.h"
 #include "hmesh_order_hx.h"
@@ -138,14 +139,22 @@ const HmeshOrderHdParam * restrict const  paraptr)
 
   hmeshOrderHxFill (meshptr, petab, lentab, iwtab, nvartab, elentab, &pfree);
 
-  hallOrderHdR2Halmd (norig, n, meshptr->m.velmnbr, iwlen, petab, pfree,
-                      lentab, iwtab, nvartab, elentab, lasttab, &ncmpa,
-                      leaftab, secntab, nexttab, frsttab);
-
-  if (ncmpa < 0) {
-    errorPrint ("hmeshOrderHd: internal error");
-    memFree    (petab);                           /* Free group leader */
-    return     (1);
+  if (paraptr->kernval == HALLORDERHNKERNNATV) {  /* If native kernel requested */
+    if (hallOrderHnHamd (n, petab, lentab, iwtab, nvartab, elentab, HALLORDERHNTYPEDEG) != 0) {
+      errorPrint ("hmeshOrderHd: cannot compute ordering");
+      memFree    (petab);                         /* Free group leader */
+      return     (1);
+    }
+  }
+  else {
+    hallOrderHdR2Halmd (norig, n, meshptr->m.velmnbr, iwlen, petab, pfree,
+                        lentab, iwtab, nvartab, elentab, lasttab, &ncmpa,
+                        leaftab, secntab, nexttab, frsttab);
+    if (ncmpa < 0) {
+      errorPrint ("hmeshOrderHd: internal error");
+      memFree    (petab);                         /* Free group leader */
+      return     (1);
+    }
   }
 
   if (meshptr->m.vnlotax != NULL) {
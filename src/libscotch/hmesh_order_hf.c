@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.1  : from : 29 oct 2019     **/
 /**                                 to   : 18 jan 2020     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +65,7 @@
 #include "mesh.h"
 #include "hmesh.h"
 #include "hall_order_hf.h"
+#include "hall_order_hn.h"
 #include "hall_order_hx.h"
 #include "hmesh_order_hf.h"
 #include "hmesh_order_hx.h"
@@ -142,13 +143,22 @@ const HmeshOrderHfParam * restrict const  paraptr)
 
   hmeshOrderHxFill (meshptr, petab, lentab, iwtab, nvtab, elentab, &pfree);
 
-  hallOrderHfR3Hamdf4 (norig, n, meshptr->m.velmnbr, nbbuck, iwlen, petab, pfree,
-                       lentab, iwtab, nvtab, elentab, lasttab, &ncmpa,
-                       leaftab, secntab, nexttab, frsttab, headtab);
-  if (ncmpa < 0) {
-    errorPrint ("hmeshOrderHf: internal error");
-    memFree    (petab);                           /* Free group leader */
-    return     (1);
+  if (paraptr->kernval == HALLORDERHNKERNNATV) {  /* If native kernel requested */
+    if (hallOrderHnHamd (n, petab, lentab, iwtab, nvtab, elentab, HALLORDERHNTYPEFILL) != 0) {
+      errorPrint ("hmeshOrderHf: cannot compute ordering");
+      memFree    (petab);                         /* Free group leader */
+      return     (1);
+    }
+  }
+  else {
+    hallOrderHfR3Hamdf4 (norig, n, meshptr->m.velmnbr, nbbuck, iwlen, petab, pfree,
+                         lentab, iwtab, nvtab, elentab, lasttab, &ncmpa,
+                         leaftab, secntab, nexttab, frsttab, headtab);
+    if (ncmpa < 0) {
+      errorPrint ("hmeshOrderHf: internal error");
+      memFree    (petab);                         /* Free group leader */
+      return     (1);
+    }
   }
 
   if (meshptr->m.vnlotax != NULL) {
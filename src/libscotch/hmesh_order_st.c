@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 4.0  : from : 28 sep 2002     **/
 /**                                 to   : 05 jan 2005     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,8 +63,11 @@
 #include "hmesh_order_cp.h"
 #include "hmesh_order_gp.h"
 #include "hmesh_order_gr.h"
+#include "hall_order_hn.h"
 #include "hmesh_order_hd.h"
 #include "hmesh_order_hf.h"
+#include "hall_order_hp.h"
+#include "hmesh_order_hp.h"
 #include "hmesh_order_nd.h"
 #include "hmesh_order_si.h"
 #include "hmesh_order_st.h"
@@ -100,12 +103,17 @@ static union {                                    /* Default parameters for nest
 static union {
   HmeshOrderHdParam         param;
   StratNodeMethodData       padding;
-} hmeshorderstdefaulthd = { { 1, 1000000, 0.08L } };
+} hmeshorderstdefaulthd = { { 1, 1000000, 0.08L, HALLORDERHNKERNHAMD } };
 
 static union {
   HmeshOrderHfParam         param;
   StratNodeMethodData       padding;
-} hmeshorderstdefaulthf = { { 1, 1000000, 0.08L } };
+} hmeshorderstdefaulthf = { { 1, 1000000, 0.08L, HALLORDERHNKERNHAMD } };
+
+static union {
+  HmeshOrderHpParam         param;
+  StratNodeMethodData       padding;
+} hmeshorderstdefaulthp = { { 1, 1000000, 0.08L, HALLORDERHPTYPEDEG } };
 
 static union {                                    /* Default parameters for nested dissection method */
   HmeshOrderNdParam         param;
@@ -119,6 +127,7 @@ static StratMethodTab       hmeshorderstmethtab[] = { /* Mesh ordering methods a
                               { HMESHORDERSTMETHGR, "v",  hmeshOrderGr, &hmeshorderstdefaultgr },
                               { HMESHORDERSTMETHHD, "d",  hmeshOrderHd, &hmeshorderstdefaulthd },
                               { HMESHORDERSTMETHHF, "f",  hmeshOrderHf, &hmeshorderstdefaulthf },
+                              { HMESHORDERSTMETHHP, "p",  hmeshOrderHp, &hmeshorderstdefaulthp },
                               { HMESHORDERSTMETHND, "n",  hmeshOrderNd, &hmeshorderstdefaultnd },
                               { HMESHORDERSTMETHSI, "s",  hmeshOrderSi, NULL },
                               { -1,                 NULL, NULL,         NULL } };
@@ -164,6 +173,10 @@ static StratParamTab        hmeshorderstparatab[] = { /* The method parameter li
                                 (byte *) &hmeshorderstdefaulthd.param,
                                 (byte *) &hmeshorderstdefaulthd.param.fillrat,
                                 NULL },
+                              { HMESHORDERSTMETHHD,   STRATPARAMCASE,   "kern",
+                                (byte *) &hmeshorderstdefaulthd.param,
+                                (byte *) &hmeshorderstdefaulthd.param.kernval,
+                                (void *) "hn" },
                               { HMESHORDERSTMETHHF,   STRATPARAMINT,    "cmin",
                                 (byte *) &hmeshorderstdefaulthf.param,
                                 (byte *) &hmeshorderstdefaulthf.param.colmin,
@@ -176,6 +189,26 @@ static StratParamTab        hmeshorderstparatab[] = { /* The method parameter li
                                 (byte *) &hmeshorderstdefaulthf.param,
                                 (byte *) &hmeshorderstdefaulthf.param.fillrat,
                                 NULL },
+                              { HMESHORDERSTMETHHF,   STRATPARAMCASE,   "kern",
+                                (byte *) &hmeshorderstdefaulthf.param,
+                                (byte *) &hmeshorderstdefaulthf.param.kernval,
+                                (void *) "hn" },
+                              { HMESHORDERSTMETHHP,   STRATPARAMINT,    "cmin",
+                                (byte *) &hmeshorderstdefaulthp.param,
+                                (byte *) &hmeshorderstdefaulthp.param.colmin,
+                                NULL },
+                              { HMESHORDERSTMETHHP,   STRATPARAMINT,    "cmax",
+                                (byte *) &hmeshorderstdefaulthp.param,
+                                (byte *) &hmeshorderstdefaulthp.param.colmax,
+                                NULL },
+                              { HMESHORDERSTMETHHP,   STRATPARAMDOUBLE, "frat",
+                                (byte *) &hmeshorderstdefaulthp.param,
+                                (byte *) &hmeshorderstdefaulthp.param.fillrat,
+                                NULL },
+                              { HMESHORDERSTMETHHP,   STRATPARAMCASE,   "type",
+                                (byte *) &hmeshorderstdefaulthp.param,
+                                (byte *) &hmeshorderstdefaulthp.param.typeval,
+                                (void *) "df" },
                               { HMESHORDERSTMETHND,   STRATPARAMSTRAT,  "sep",
                                 (byte *) &hmeshorderstdefaultnd.param,
                                 (byte *) &hmeshorderstdefaultnd.param.sepstrat,
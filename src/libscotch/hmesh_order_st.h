@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,6 +43,8 @@
 /**                                 to   : 08 feb 2004     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -59,6 +61,7 @@ typedef enum HmeshOrderStMethodType_ {
   HMESHORDERSTMETHGR,                             /*+ Graph-based ordering                  +*/
   HMESHORDERSTMETHHD,                             /*+ Block Halo Approximate Minimum Degree +*/
   HMESHORDERSTMETHHF,                             /*+ Block Halo Approximate Minimum Fill   +*/
+  HMESHORDERSTMETHHP,                             /*+ Multi-threaded Halo Approximate MD/MF +*/
   HMESHORDERSTMETHND,                             /*+ Nested Dissection                     +*/
   HMESHORDERSTMETHSI,                             /*+ Simple                                +*/
   HMESHORDERSTMETHNBR                             /*+ Number of methods                     +*/
@@ -0,0 +1,414 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kdgraph_map_lp.c                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module refines a distributed k-way **/
+/**                mapping by means of size-constrained    **/
+/**                label propagation.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KDGRAPH_MAP_LP
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "arch.h"
+#include "dgraph.h"
+#include "dmapping.h"
+#include "kdgraph.h"
+#include "kdgraph_map_lp.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine computes the communication
+** cost of placing a vertex in the given part,
+** with respect to the parts of its neighbors.
+** It returns:
+** - the cost value : in all cases.
+*/
+
+static
+Gnum
+kdgraphMapLpCost (
+const Arch * restrict const     archptr,
+const ArchDom * restrict const  domntab,          /*+ Domains of all parts            +*/
+const Gnum * restrict const     candtab,          /*+ Parts of neighbors              +*/
+const Gnum * restrict const     cedltab,          /*+ Edge load to each neighbor part +*/
+const Gnum                      candnbr,
+const Gnum                      partval)          /*+ Part to evaluate                +*/
+{
+  Gnum                costval;
+  Gnum                candnum;
+
+  for (candnum = 0, costval = 0; candnum < candnbr; candnum ++) {
+    if (candtab[candnum] != partval)
+      costval += cedltab[candnum] * (Gnum) archDomDist (archptr, &domntab[partval], &domntab[candtab[candnum]]);
+  }
+
+  return (costval);
+}
+
+/* This routine refines the given distributed
+** k-way mapping by size-constrained label
+** propagation. At each pass, every process
+** moves its boundary vertices to the neighbor
+** part which most reduces communication cost,
+** first towards parts of higher indices, then
+** towards parts of lower indices, so that two
+** adjacent vertices held by distinct processes
+** cannot swap their parts in the same round.
+** Every process may only fill its share of the
+** spare capacity of each part, which keeps load
+** balance within bounds globally.
+** It returns:
+** - 0 : if mapping could be refined.
+** - 1 : on error.
+*/
+
+int
+kdgraphMapLp (
+Kdgraph * restrict const                grafptr,  /*+ Active graph      +*/
+Kdmapping * restrict const              mappptr,  /*+ Mapping to refine +*/
+const KdgraphMapLpParam * restrict const paraptr) /*+ Method parameters +*/
+{
+  Dmapping * restrict const   dmapptr = mappptr->mappptr;
+  const Arch * restrict const archptr = &mappptr->mappptr->archdat;
+  Arch                        archdat;
+  Gnum * restrict             partgsttab;         /* Part indices of local and ghost vertices */
+  Gnum * restrict             partgsttax;
+  Gnum * restrict             sortloctab;
+  int * restrict              recvcnttab;
+  int * restrict              recvdsptab;
+  Gnum * restrict             termglbtab;         /* Sorted terminal numbers of all parts     */
+  ArchDom * restrict          domntab;
+  Gnum * restrict             loadtab;            /* Global loads of parts                    */
+  Gnum * restrict             loadavgtab;
+  Gnum * restrict             loadmaxtab;
+  Gnum * restrict             budgtab;            /* Load this process may still add to parts */
+  Gnum * restrict             dltloctab;          /* Local load variations, plus move count   */
+  Gnum * restrict             dltglbtab;
+  Gnum * restrict             slottab;            /* Candidate slot of parts, or -1           */
+  Gnum * restrict             candtab;
+  Gnum * restrict             cedltab;
+  Gnum                        termlocnbr;
+  Gnum                        termglbnbr;
+  Gnum                        partnbr;
+  Gnum                        partnum;
+  Gnum                        vertlocnum;
+  Gnum                        passnum;
+  Anum                        wghtsum;
+  int                         procnum;
+  int                         termloccnt;
+  int                         o;
+  Gnum                        reduloctab[2];
+  Gnum                        reduglbtab[2];
+
+  const Gnum                  baseval    = grafptr->s.baseval;
+  const Gnum                  vertlocnnd = grafptr->s.vertlocnnd;
+  const Gnum * restrict const vertloctax = grafptr->s.vertloctax;
+  const Gnum * restrict const vendloctax = grafptr->s.vendloctax;
+  const Gnum * restrict const veloloctax = grafptr->s.veloloctax;
+  const Gnum * restrict const edloloctax = grafptr->s.edloloctax;
+
+  if (archVar (archptr)) {
+    errorPrint ("kdgraphMapLp: variable-sized architectures not supported");
+    return     (1);
+  }
+
+  reduloctab[0] = dmapptr->vertlocnbr;
+  reduloctab[1] = 0;
+  if (dgraphGhst (&grafptr->s) != 0) {            /* Compute ghost edge array if not already present */
+    errorPrint ("kdgraphMapLp: cannot compute ghost edge array");
+    reduloctab[1] = 1;
+  }
+  partgsttab = NULL;
+  if ((reduloctab[1] == 0) &&
+      (memAllocGroup ((void **) (void *)
+                      &partgsttab, (size_t) (grafptr->s.vertgstnbr * sizeof (Gnum)),
+                      &sortloctab, (size_t) (grafptr->s.vertlocnbr * sizeof (Gnum)),
+                      &recvcnttab, (size_t) (grafptr->s.procglbnbr * sizeof (int)),
+                      &recvdsptab, (size_t) (grafptr->s.procglbnbr * sizeof (int)), NULL) == NULL)) {
+    errorPrint ("kdgraphMapLp: out of memory (1)");
+    reduloctab[1] = 1;
+  }
+
+  if (MPI_Allreduce (reduloctab, reduglbtab, 2, GNUM_MPI, MPI_SUM, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLp: communication error (1)");
+    reduglbtab[1] = 1;
+  }
+  if ((reduglbtab[1] != 0) ||                     /* If error, or if no mapping to refine */
+      (reduglbtab[0] == 0)) {
+    if (partgsttab != NULL)
+      memFree (partgsttab);                       /* Free group leader */
+    return ((int) reduglbtab[1]);
+  }
+  partgsttax = partgsttab - baseval;
+
+  if (dmapTerm (dmapptr, &grafptr->s, partgsttab) != 0) { /* Get terminal numbers of local vertices */
+    errorPrint ("kdgraphMapLp: cannot get current mapping");
+    memFree    (partgsttab);                      /* Free group leader */
+    return     (1);
+  }
+
+  memCpy (sortloctab, partgsttab, grafptr->s.vertlocnbr * sizeof (Gnum));
+  intSort1asc1 (sortloctab, grafptr->s.vertlocnbr);
+  for (vertlocnum = termlocnbr = 0; vertlocnum < grafptr->s.vertlocnbr; vertlocnum ++) { /* Keep distinct terminals only */
+    if ((termlocnbr == 0) || (sortloctab[vertlocnum] != sortloctab[termlocnbr - 1]))
+      sortloctab[termlocnbr ++] = sortloctab[vertlocnum];
+  }
+
+  termloccnt = (int) termlocnbr;
+  if (MPI_Allgather (&termloccnt, 1, MPI_INT, recvcnttab, 1, MPI_INT, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLp: communication error (2)");
+    memFree    (partgsttab);                      /* Free group leader */
+    return     (1);
+  }
+  for (procnum = 0, termglbnbr = 0; procnum < grafptr->s.procglbnbr; procnum ++) {
+    recvdsptab[procnum] = (int) termglbnbr;
+    termglbnbr         += (Gnum) recvcnttab[procnum];
+  }
+
+  reduloctab[0] = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &termglbtab, (size_t) (termglbnbr       * sizeof (Gnum)),
+                     &domntab,    (size_t) (termglbnbr       * sizeof (ArchDom)),
+                     &loadtab,    (size_t) (termglbnbr       * sizeof (Gnum)),
+                     &loadavgtab, (size_t) (termglbnbr       * sizeof (Gnum)),
+                     &loadmaxtab, (size_t) (termglbnbr       * sizeof (Gnum)),
+                     &budgtab,    (size_t) (termglbnbr       * sizeof (Gnum)),
+                     &dltloctab,  (size_t) ((termglbnbr + 1) * sizeof (Gnum)), /* "+1" for move count */
+                     &dltglbtab,  (size_t) ((termglbnbr + 1) * sizeof (Gnum)),
+                     &slottab,    (size_t) (termglbnbr       * sizeof (Gnum)),
+                     &candtab,    (size_t) (termglbnbr       * sizeof (Gnum)),
+                     &cedltab,    (size_t) (termglbnbr       * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("kdgraphMapLp: out of memory (2)");
+    reduloctab[0] = 1;
+  }
+  if (MPI_Allreduce (reduloctab, reduglbtab, 1, GNUM_MPI, MPI_MAX, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLp: communication error (3)");
+    reduglbtab[0] = 1;
+  }
+  if (reduglbtab[0] != 0) {
+    if (termglbtab != NULL)
+      memFree (termglbtab);
+    memFree (partgsttab);
+    return  (1);
+  }
+
+  o = 1;                                          /* Assume an error */
+  if (MPI_Allgatherv (sortloctab, termloccnt, GNUM_MPI,
+                      termglbtab, recvcnttab, recvdsptab, GNUM_MPI, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLp: communication error (4)");
+    goto abort;
+  }
+  intSort1asc1 (termglbtab, termglbnbr);
+  for (partnum = partnbr = 0; partnum < termglbnbr; partnum ++) { /* Keep distinct terminals only */
+    if ((partnbr == 0) || (termglbtab[partnum] != termglbtab[partnbr - 1]))
+      termglbtab[partnbr ++] = termglbtab[partnum];
+  }
+  for (partnum = 0; partnum < partnbr; partnum ++) {
+    if (archDomTerm (archptr, &domntab[partnum], (ArchDomNum) termglbtab[partnum]) != 0) {
+      errorPrint ("kdgraphMapLp: invalid terminal domain number");
+      goto abort;
+    }
+  }
+
+  memSet (dltloctab, 0, partnbr * sizeof (Gnum));
+  for (vertlocnum = baseval; vertlocnum < vertlocnnd; vertlocnum ++) { /* Turn terminal numbers into part indices */
+    Gnum                partmin;
+    Gnum                partmax;
+
+    for (partmin = 0, partmax = partnbr; (partmax - partmin) > 1; ) {
+      Gnum                partmed;
+
+      partmed = (partmax + partmin) / 2;
+      if (termglbtab[partmed] <= partgsttax[vertlocnum])
+        partmin = partmed;
+      else
+        partmax = partmed;
+    }
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+    if (termglbtab[partmin] != partgsttax[vertlocnum]) {
+      errorPrint ("kdgraphMapLp: internal error (1)");
+      goto abort;
+    }
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+    partgsttax[vertlocnum] = partmin;
+    dltloctab[partmin]    += (veloloctax != NULL) ? veloloctax[vertlocnum] : 1;
+  }
+  if (MPI_Allreduce (dltloctab, loadtab, partnbr, GNUM_MPI, MPI_SUM, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLp: communication error (5)");
+    goto abort;
+  }
+
+  wghtsum = archDomWght (archptr, &grafptr->m.domnorg);
+  for (partnum = 0; partnum < partnbr; partnum ++) {
+    loadavgtab[partnum] = (Gnum) (((double) grafptr->s.veloglbsum * (double) archDomWght (archptr, &domntab[partnum])) / (double) wghtsum);
+    loadmaxtab[partnum] = loadavgtab[partnum] + (Gnum) ((double) loadavgtab[partnum] * paraptr->kbalval);
+    slottab[partnum]    = -1;
+  }
+
+  for (passnum = 0; passnum < paraptr->passnbr; passnum ++) {
+    Gnum                moveglbnbr;
+    int                 dirnum;
+
+    for (dirnum = 0, moveglbnbr = 0; dirnum < 2; dirnum ++) { /* First round moves upwards, second one downwards */
+      if (dgraphHaloSync (&grafptr->s, (byte *) partgsttab, GNUM_MPI) != 0) {
+        errorPrint ("kdgraphMapLp: cannot perform halo exchange");
+        goto abort;
+      }
+
+      for (partnum = 0; partnum < partnbr; partnum ++) {
+        Gnum                budgval;
+
+        budgval = (loadmaxtab[partnum] - loadtab[partnum]) / grafptr->s.procglbnbr;
+        budgtab[partnum]   = MAX (budgval, 0);
+        dltloctab[partnum] = 0;
+      }
+      dltloctab[partnbr] = 0;
+
+      for (vertlocnum = baseval; vertlocnum < vertlocnnd; vertlocnum ++) {
+        Gnum                partval;
+        Gnum                partbst;
+        Gnum                veloval;
+        Gnum                costval;
+        Gnum                gainbst;
+        Gnum                excebst;
+        Gnum                candnbr;
+        Gnum                candnum;
+        Gnum                edgelocnum;
+
+        partval = partgsttax[vertlocnum];
+        for (edgelocnum = vertloctax[vertlocnum], candnbr = 0; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+          Gnum                partend;
+
+          partend = partgsttax[grafptr->s.edgegsttax[edgelocnum]];
+          if (slottab[partend] < 0) {             /* If neighbor part not yet recorded */
+            slottab[partend] = candnbr;
+            candtab[candnbr] = partend;
+            cedltab[candnbr] = 0;
+            candnbr ++;
+          }
+          cedltab[slottab[partend]] += (edloloctax != NULL) ? edloloctax[edgelocnum] : 1;
+        }
+        if ((candnbr == 0) ||                     /* If vertex is not a frontier vertex, skip it */
+            ((candnbr == 1) && (candtab[0] == partval))) {
+          if (candnbr != 0)
+            slottab[candtab[0]] = -1;
+          continue;
+        }
+
+        veloval = (veloloctax != NULL) ? veloloctax[vertlocnum] : 1;
+        costval = kdgraphMapLpCost (archptr, domntab, candtab, cedltab, candnbr, partval);
+        partbst = partval;
+        if ((loadtab[partval] + dltloctab[partval]) > loadmaxtab[partval]) { /* If part overloaded, accept any move */
+          gainbst = GNUMMIN;
+          excebst = GNUMMAX;
+        }
+        else {                                    /* Else only accept moves which improve cost or balance */
+          gainbst = 0;
+          excebst = loadtab[partval] + dltloctab[partval] - loadavgtab[partval];
+        }
+        for (candnum = 0; candnum < candnbr; candnum ++) {
+          Gnum                partend;
+          Gnum                gainval;
+          Gnum                exceval;
+
+          partend = candtab[candnum];
+          slottab[partend] = -1;                  /* Reset slot for next vertex */
+          if ((partend == partval) ||
+              ((dirnum == 0) ? (partend < partval) : (partend > partval)) ||
+              (veloval > budgtab[partend]))
+            continue;
+
+          gainval = costval - kdgraphMapLpCost (archptr, domntab, candtab, cedltab, candnbr, partend);
+          exceval = loadtab[partend] + dltloctab[partend] + veloval - loadavgtab[partend];
+          if ((gainval > gainbst) ||
+              ((gainval == gainbst) && (exceval < excebst))) {
+            partbst = partend;
+            gainbst = gainval;
+            excebst = exceval;
+          }
+        }
+
+        if (partbst != partval) {                 /* If vertex is to be moved */
+          partgsttax[vertlocnum] = partbst;
+          dltloctab[partval]    -= veloval;
+          dltloctab[partbst]    += veloval;
+          budgtab[partbst]      -= veloval;
+          dltloctab[partnbr] ++;
+        }
+      }
+
+      if (MPI_Allreduce (dltloctab, dltglbtab, partnbr + 1, GNUM_MPI, MPI_SUM, grafptr->s.proccomm) != MPI_SUCCESS) {
+        errorPrint ("kdgraphMapLp: communication error (6)");
+        goto abort;
+      }
+      for (partnum = 0; partnum < partnbr; partnum ++)
+        loadtab[partnum] += dltglbtab[partnum];
+      moveglbnbr += dltglbtab[partnbr];
+    }
+
+    if (moveglbnbr == 0)                          /* If no vertex moved during this pass, stop */
+      break;
+  }
+
+  for (vertlocnum = baseval; vertlocnum < vertlocnnd; vertlocnum ++) /* Turn part indices back into terminal numbers */
+    partgsttax[vertlocnum] = termglbtab[partgsttax[vertlocnum]];
+
+  archdat = dmapptr->archdat;                     /* Replace mapping fragments by refined mapping */
+  dmapExit (dmapptr);
+  dmapInit (dmapptr, &archdat);
+  o = dmapAddTerm (dmapptr, &grafptr->s, partgsttab);
+
+abort:
+  memFree (termglbtab);                           /* Free group leaders */
+  memFree (partgsttab);
+
+  return (o);
+}
@@ -0,0 +1,721 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kdgraph_map_ml.c                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module performs the direct k-way   **/
+/**                multi-level mapping algorithm in        **/
+/**                parallel.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KDGRAPH_MAP_ML
+
+#include "module.h"
+#include "common.h"
+#include "comm.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_st.h"
+#include "dgraph.h"
+#include "dgraph_coarsen.h"
+#include "dmapping.h"
+#include "kdgraph.h"
+#include "kdgraph_map_ml.h"
+#include "kdgraph_map_st.h"
+
+/*********************************************/
+/*                                           */
+/* The coarsening and uncoarsening routines. */
+/*                                           */
+/*********************************************/
+
+/* This routine builds a coarser graph from the
+** Kdgraph that is given on input.
+** It returns:
+** - 0  : if the coarse Kdgraph has been built.
+** - 1  : if threshold reached or on error.
+*/
+
+static
+int
+kdgraphMapMlCoarsen (
+Kdgraph * restrict const              finegrafptr, /*+ Finer graph                         +*/
+Kdgraph * restrict const              coargrafptr, /*+ Coarser graph to build              +*/
+DgraphCoarsenMulti * restrict * const coarmultptr, /*+ Pointer to multinode table to build +*/
+const KdgraphMapMlData * const        dataptr)    /*+ Multi-level data                     +*/
+{
+  int                 foldval;
+
+  const KdgraphMapMlParam * const paraptr = dataptr->paraptr;
+
+  switch (paraptr->foldval) {
+    case 0 :
+      foldval = DGRAPHCOARSENNONE;
+      break;
+    case 1 :
+      foldval = DGRAPHCOARSENFOLD;
+      break;
+    case 2 :
+      foldval = DGRAPHCOARSENFOLDDUP;
+      break;
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+    default :
+      errorPrint ("kdgraphMapMlCoarsen: invalid parameter");
+      return     (1);
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+  }
+  if ((finegrafptr->s.vertglbnbr / finegrafptr->s.procglbnbr) > paraptr->foldmax) /* If no need to fold */
+    foldval = DGRAPHCOARSENNONE;
+
+  *coarmultptr = NULL;                            /* Let the routine create the multinode array */
+  dgraphInit (&coargrafptr->s, finegrafptr->s.proccomm); /* Re-use fine graph communicator      */
+  if (dgraphCoarsen (&finegrafptr->s, &coargrafptr->s, coarmultptr, paraptr->passnbr,
+                     dataptr->coarnbr, paraptr->coarrat, foldval, finegrafptr->contptr) != 0)
+    return (1);                                   /* Return if coarsening failed */
+
+  if (*coarmultptr != NULL)                       /* Base pointer to multinode array */
+    *coarmultptr -= coargrafptr->s.baseval;
+  coargrafptr->m       = finegrafptr->m;          /* Coarse graph is mapped onto the same domain */
+  coargrafptr->levlnum = finegrafptr->levlnum + 1;
+  coargrafptr->contptr = finegrafptr->contptr;
+
+  return (0);
+}
+
+/* This routine computes the communication
+** cost of the given mapping of the given
+** distributed graph. Both ends of every cut
+** edge account for it, so the cost is halved.
+** It returns:
+** - 0   : if cost could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMlCost (
+Kdgraph * restrict const    grafptr,
+const Arch * restrict const archptr,
+const Gnum * restrict const termloctab,
+Gnum * restrict const       costptr)
+{
+  Gnum * restrict     termgsttax;
+  Gnum                vertlocnum;
+  Gnum                costlocval;
+  Gnum                edlolocval;
+
+  const Gnum * restrict const vertloctax = grafptr->s.vertloctax;
+  const Gnum * restrict const vendloctax = grafptr->s.vendloctax;
+  const Gnum * restrict const edloloctax = grafptr->s.edloloctax;
+
+  if (dgraphGhst (&grafptr->s) != 0) {            /* Compute ghost edge array if not already present */
+    errorPrint ("kdgraphMapMlCost: cannot compute ghost edge array");
+    return     (1);
+  }
+  if ((termgsttax = memAlloc (grafptr->s.vertgstnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("kdgraphMapMlCost: out of memory");
+    return     (1);
+  }
+  memCpy (termgsttax, termloctab, grafptr->s.vertlocnbr * sizeof (Gnum));
+  if (dgraphHaloSync (&grafptr->s, (byte *) termgsttax, GNUM_MPI) != 0) {
+    errorPrint ("kdgraphMapMlCost: cannot perform halo exchange");
+    memFree    (termgsttax);
+    return     (1);
+  }
+  termgsttax -= grafptr->s.baseval;
+
+  costlocval = 0;
+  edlolocval = 1;                                 /* Assume edges are not weighted */
+  for (vertlocnum = grafptr->s.baseval; vertlocnum < grafptr->s.vertlocnnd; vertlocnum ++) {
+    Gnum                termlocval;
+    Gnum                edgelocnum;
+
+    termlocval = termgsttax[vertlocnum];
+    for (edgelocnum = vertloctax[vertlocnum]; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+      Gnum                termendval;
+      ArchDom             domntab[2];
+
+      termendval = termgsttax[grafptr->s.edgegsttax[edgelocnum]];
+      if (termendval == termlocval)               /* If edge is not cut, skip it */
+        continue;
+
+      if (edloloctax != NULL)
+        edlolocval = edloloctax[edgelocnum];
+      archDomTerm (archptr, &domntab[0], (ArchDomNum) termlocval);
+      archDomTerm (archptr, &domntab[1], (ArchDomNum) termendval);
+      costlocval += edlolocval * archDomDist (archptr, &domntab[0], &domntab[1]);
+    }
+  }
+
+  memFree (termgsttax + grafptr->s.baseval);
+
+  if (MPI_Allreduce (&costlocval, costptr, 1, GNUM_MPI, MPI_SUM, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlCost: communication error");
+    return     (1);
+  }
+  *costptr /= 2;                                  /* Every cut edge has been accounted for twice */
+
+  return (0);
+}
+
+/* This routine is the reduction-loc operator which
+** returns in inout[1] the rank of the process which
+** holds the best mapping.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kdgraphMapMlOpBest (
+const Gnum * const          in,                   /* First operand                               */
+Gnum * const                inout,                /* Second and output operand                   */
+const int * const           len,                  /* Number of instances ; should be 1, not used */
+const MPI_Datatype * const  typedat)              /* MPI datatype ; not used                     */
+{
+  if (inout[0] == 1) {                            /* Handle cases when at least one of them is erroneous */
+    if (in[0] == 1) {
+      if (inout[1] > in[1]) {                     /* To enforce commutativity, always keep smallest process number */
+        inout[1] = in[1];
+        inout[2] = in[2];
+      }
+      return;
+    }
+
+    inout[0] = in[0];                             /* Validity flag      */
+    inout[1] = in[1];                             /* Lead process rank  */
+    inout[2] = in[2];                             /* Lead process color */
+    inout[3] = in[3];                             /* Communication cost */
+    return;
+  }
+  else if (in[0] == 1)
+    return;
+
+  if ((in[3] < inout[3]) ||                       /* Select best mapping */
+      ((in[3] == inout[3]) && (in[1] < inout[1]))) {
+    inout[1] = in[1];
+    inout[2] = in[2];
+    inout[3] = in[3];
+  }
+}
+
+/* This routine propagates the mapping of the
+** coarser graph back to the finer graph,
+** according to the multinode table of collapsed
+** vertices. When the coarse graph has been
+** folded with duplication, the mapping of least
+** communication cost is selected.
+** It returns:
+** - 0   : if coarse graph data has been propagated to fine graph.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMlUncoarsen (
+Kdgraph * restrict const                  finegrafptr, /*+ Finer graph                         +*/
+Kdgraph * restrict const                  coargrafptr, /*+ Coarser graph                       +*/
+const DgraphCoarsenMulti * restrict const coarmulttax, /*+ Multinode array                     +*/
+const Gnum * restrict const               coartermloctab, /*+ Coarse terminal domain array     +*/
+Gnum * restrict const                     finetermloctab, /*+ Fine terminal domain array       +*/
+const int                                 coarretuval, /*+ Return value of coarse mapping      +*/
+const KdgraphMapMlData * const            dataptr)    /*+ Multi-level data                     +*/
+{
+  MPI_Datatype                besttypedat;        /* Data type for finding best mapping              */
+  MPI_Op                      bestoperdat;        /* Handle of MPI operator for finding best mapping */
+  Gnum                        reduloctab[4];
+  Gnum                        reduglbtab[4];
+  KdgraphMapMlSort * restrict sortloctab;         /* Array of vertices to send to their owner        */
+  Gnum                        sortlocnbr;
+  Gnum                        sortlocnum;
+  int * restrict              vsndcnttab;
+  int * restrict              vsnddsptab;
+  int * restrict              vsndidxtab;
+  int * restrict              vrcvcnttab;
+  int * restrict              vrcvdsptab;
+  Gnum * restrict             vsnddattab;
+  Gnum * restrict             vrcvdattab;
+  int                         vsnddspnbr;
+  int                         vrcvdspnbr;
+  int                         vrcvdatnum;
+  Gnum                        finevertlocadj;
+  int                         procnum;
+
+  const int                   fineprocglbnbr = finegrafptr->s.procglbnbr;
+  const Gnum * restrict const fineprocvrttab = finegrafptr->s.procvrttab;
+
+  if (coargrafptr->s.procglbnbr <= 0) {           /* If unused folded coarse graph */
+    reduloctab[0] = 1;                            /* Set it as invalid             */
+    reduloctab[1] = 0;                            /* Useless rank                  */
+    reduloctab[2] = -1;                           /* Color of no coarse graph      */
+    reduloctab[3] = 0;                            /* Prevent Valgrind from yelling */
+  }
+  else {
+    reduloctab[0] = (coarretuval != 0) ? 1 : 0;
+    reduloctab[1] = finegrafptr->s.proclocnum;
+    reduloctab[2] = coargrafptr->s.prockeyval;
+    reduloctab[3] = 0;
+    if ((reduloctab[0] == 0) &&                   /* If duplicate coarse mappings have to be compared */
+        (dataptr->paraptr->foldval == 2) &&
+        (kdgraphMapMlCost (coargrafptr, &dataptr->mappptr->mappptr->archdat, coartermloctab, &reduloctab[3]) != 0))
+      reduloctab[0] = 1;
+  }
+
+  if ((MPI_Type_contiguous (4, GNUM_MPI, &besttypedat)                            != MPI_SUCCESS) ||
+      (MPI_Type_commit (&besttypedat)                                             != MPI_SUCCESS) ||
+      (MPI_Op_create ((MPI_User_function *) kdgraphMapMlOpBest, 1, &bestoperdat) != MPI_SUCCESS)) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (1)");
+    return     (1);
+  }
+  if (MPI_Allreduce (reduloctab, reduglbtab, 1, besttypedat, bestoperdat, finegrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (2)");
+    return     (1);
+  }
+  if ((MPI_Op_free   (&bestoperdat) != MPI_SUCCESS) ||
+      (MPI_Type_free (&besttypedat) != MPI_SUCCESS)) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (3)");
+    return     (1);
+  }
+
+  if (reduglbtab[0] == 1)                         /* If all possible mappings are invalid, low method will be applied */
+    return (1);
+
+  sortlocnbr = ((coargrafptr->s.procglbnbr > 0) && (reduglbtab[2] == (Gnum) coargrafptr->s.prockeyval)) /* If we belong to lead group */
+               ? (2 * coargrafptr->s.vertlocnbr) : 0;
+  reduloctab[0] = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &vsndcnttab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &vsnddsptab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &vsndidxtab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &vrcvcnttab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &vrcvdsptab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &sortloctab, (size_t) (sortlocnbr     * sizeof (KdgraphMapMlSort)), NULL) == NULL) {
+    errorPrint ("kdgraphMapMlUncoarsen: out of memory (1)");
+    reduloctab[0] = 1;
+  }
+#ifdef SCOTCH_DEBUG_KDGRAPH1                      /* Communication cannot be overlapped by a useful one */
+  if (MPI_Allreduce (&reduloctab[0], &reduglbtab[0], 1, GNUM_MPI, MPI_SUM, finegrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (4)");
+    return     (1);
+  }
+#else /* SCOTCH_DEBUG_KDGRAPH1 */
+  reduglbtab[0] = reduloctab[0];
+#endif /* SCOTCH_DEBUG_KDGRAPH1 */
+  if (reduglbtab[0] != 0) {
+    if (vsndcnttab != NULL)
+      memFree (vsndcnttab);                       /* Free group leader */
+    return (1);
+  }
+
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+  memSet (finetermloctab, ~0, finegrafptr->s.vertlocnbr * sizeof (Gnum)); /* All vertices are unvisited */
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+  memSet (vsndcnttab, 0, fineprocglbnbr * sizeof (int));
+
+  finevertlocadj = fineprocvrttab[finegrafptr->s.proclocnum];
+  if (sortlocnbr > 0) {                           /* If we belong to the group of the lead process, browse and send local data */
+    Gnum                coarvertlocnum;
+
+    for (coarvertlocnum = coargrafptr->s.baseval, sortlocnbr = 0;
+         coarvertlocnum < coargrafptr->s.vertlocnnd; coarvertlocnum ++) {
+      Gnum                coartermval;
+      Gnum                finevertglbnum;
+      int                 i;
+
+      coartermval = coartermloctab[coarvertlocnum - coargrafptr->s.baseval];
+      i = 0;
+      do {
+        Gnum                finevertlocnum;
+
+        finevertglbnum = coarmulttax[coarvertlocnum].vertglbnum[i];
+        finevertlocnum = finevertglbnum - finevertlocadj;
+        if ((finevertlocnum >= 0) &&              /* If vertex is local */
+            (finevertlocnum <  finegrafptr->s.vertlocnbr))
+          finetermloctab[finevertlocnum] = coartermval;
+        else {
+          int               procngbnum;
+          int               procngbmax;
+
+          procngbnum = 0;
+          procngbmax = fineprocglbnbr;
+          while ((procngbmax - procngbnum) > 1) { /* Find owner process by dichotomy on procvrttab */
+            int                 procngbmed;
+
+            procngbmed = (procngbmax + procngbnum) / 2;
+            if (fineprocvrttab[procngbmed] > finevertglbnum)
+              procngbmax = procngbmed;
+            else
+              procngbnum = procngbmed;
+          }
+
+          vsndcnttab[procngbnum] += 2;            /* Vertex and terminal numbers will be sent */
+          sortloctab[sortlocnbr].vertnum = finevertglbnum;
+          sortloctab[sortlocnbr].termnum = coartermval;
+          sortloctab[sortlocnbr].procnum = (Gnum) procngbnum;
+          sortlocnbr ++;
+        }
+
+        i ++;                                     /* Process next multinode vertex */
+      } while (finevertglbnum != coarmulttax[coarvertlocnum].vertglbnum[1]); /* If not single node */
+    }
+  }
+
+  if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, vrcvcnttab, 1, MPI_INT, finegrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (5)");
+    return     (1);
+  }
+
+  for (procnum = 0, vrcvdspnbr = vsnddspnbr = 0; /* Build communication index arrays */
+       procnum < fineprocglbnbr; procnum ++) {
+    vrcvdsptab[procnum] = vrcvdspnbr;
+    vsnddsptab[procnum] =
+    vsndidxtab[procnum] = vsnddspnbr;
+    vrcvdspnbr += vrcvcnttab[procnum];
+    vsnddspnbr += vsndcnttab[procnum];
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &vrcvdattab, (size_t) (vrcvdspnbr * sizeof (Gnum)),
+                     &vsnddattab, (size_t) (vsnddspnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("kdgraphMapMlUncoarsen: out of memory (2)");
+    reduloctab[0] = 1;
+  }
+#ifdef SCOTCH_DEBUG_KDGRAPH1                      /* Communication cannot be overlapped by a useful one */
+  if (MPI_Allreduce (&reduloctab[0], &reduglbtab[0], 1, GNUM_MPI, MPI_SUM, finegrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (6)");
+    return     (1);
+  }
+#else /* SCOTCH_DEBUG_KDGRAPH1 */
+  reduglbtab[0] = reduloctab[0];
+#endif /* SCOTCH_DEBUG_KDGRAPH1 */
+  if (reduglbtab[0] != 0) {
+    if (vrcvdattab != NULL)
+      memFree (vrcvdattab);                       /* Free group leaders */
+    memFree (vsndcnttab);
+    return (1);
+  }
+
+  for (sortlocnum = 0; sortlocnum < sortlocnbr; sortlocnum ++) { /* Pack vertices in the sub-arrays of their owners */
+    int                 vsndidxnum;
+
+    vsndidxnum = vsndidxtab[sortloctab[sortlocnum].procnum];
+    vsnddattab[vsndidxnum]     = sortloctab[sortlocnum].vertnum;
+    vsnddattab[vsndidxnum + 1] = sortloctab[sortlocnum].termnum;
+    vsndidxtab[sortloctab[sortlocnum].procnum] = vsndidxnum + 2;
+  }
+
+  if (MPI_Alltoallv (vsnddattab, vsndcnttab, vsnddsptab, GNUM_MPI,
+                     vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI, finegrafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (7)");
+    return     (1);
+  }
+
+  for (vrcvdatnum = 0; vrcvdatnum < vrcvdspnbr; vrcvdatnum += 2) { /* Update local vertices from received data */
+    Gnum                finevertlocnum;
+
+    finevertlocnum = vrcvdattab[vrcvdatnum] - finevertlocadj;
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+    if ((finevertlocnum < 0) || (finevertlocnum >= finegrafptr->s.vertlocnbr)) {
+      errorPrint ("kdgraphMapMlUncoarsen: internal error (1)");
+      return     (1);
+    }
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+    finetermloctab[finevertlocnum] = vrcvdattab[vrcvdatnum + 1];
+  }
+
+  memFree (vrcvdattab);                           /* Free group leaders */
+  memFree (vsndcnttab);
+
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+  for (sortlocnum = 0; sortlocnum < finegrafptr->s.vertlocnbr; sortlocnum ++) {
+    if (finetermloctab[sortlocnum] == ~0) {
+      errorPrint ("kdgraphMapMlUncoarsen: internal error (2)");
+      return     (1);
+    }
+  }
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+
+  return (0);
+}
+
+/* This routine maps the centralized version
+** of the given distributed graph, which is
+** held by a single process, with the
+** sequential mapping strategy.
+** It returns:
+** - 0   : if the mapping could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMlSequ (
+Kdgraph * restrict const        grafptr,
+Gnum * restrict const           termloctab,
+const KdgraphMapMlData * const  dataptr)
+{
+  Graph               cgrfdat;                    /* Centralized graph                   */
+  Kgraph              kgrfdat;                    /* Centralized mapping graph           */
+  Context             contdat;                    /* Threaded clone of execution context */
+  Arch * restrict     archptr;
+  Gnum                vertnum;
+  int                 o;
+
+  archptr = &dataptr->mappptr->mappptr->archdat;
+  if (dgraphGather (&grafptr->s, &cgrfdat) != 0) {
+    errorPrint ("kdgraphMapMlSequ: cannot centralize graph");
+    return     (1);
+  }
+  if (kgraphInit (&kgrfdat, &cgrfdat, archptr, &grafptr->m.domnorg, 0, NULL, 1, 1, NULL) != 0) {
+    errorPrint ("kdgraphMapMlSequ: cannot initialize centralized graph");
+    graphExit  (&cgrfdat);
+    return     (1);
+  }
+  kgrfdat.s.flagval = (kgrfdat.s.flagval & ~GRAPHBITSUSED) | cgrfdat.flagval; /* Free sequential graph along with mapping data */
+  kgrfdat.s.vnumtax = NULL;                       /* Remove index array if any                                                */
+  kgrfdat.contptr   = grafptr->contptr;
+  if (contextThreadClone (&contdat, grafptr->contptr, dataptr->procnodnbr, dataptr->procnodnum) == 0) /* Use node cores that sequential run would leave idle */
+    kgrfdat.contptr = &contdat;
+
+  o = kgraphMapSt (&kgrfdat, dataptr->paraptr->stratseq); /* Compute sequential mapping */
+
+  if (kgrfdat.contptr != grafptr->contptr) {      /* If threaded clone of context used, free it */
+    contextThreadCloneExit (&contdat);
+    kgrfdat.contptr = grafptr->contptr;
+  }
+
+  if (o == 0) {
+    const Anum * restrict const     parttax = kgrfdat.m.parttax;
+    const ArchDom * restrict const  domntab = kgrfdat.m.domntab;
+
+    if (parttax == NULL) {                        /* If empty strategy left all vertices in original domain */
+      Gnum                termnum;
+
+      termnum = (Gnum) archDomNum (archptr, &kgrfdat.m.domnorg);
+      for (vertnum = 0; vertnum < kgrfdat.s.vertnbr; vertnum ++)
+        termloctab[vertnum] = termnum;
+    }
+    else {
+      for (vertnum = 0; vertnum < kgrfdat.s.vertnbr; vertnum ++)
+        termloctab[vertnum] = (Gnum) archDomNum (archptr, &domntab[parttax[vertnum + kgrfdat.s.baseval]]);
+    }
+  }
+
+  kgraphExit (&kgrfdat);
+
+  return (o);
+}
+
+/* This routine applies the given parallel
+** mapping strategy to the given graph. If
+** flagval is set, the current mapping held
+** by termloctab is provided to the strategy,
+** which is expected to refine it. The
+** resulting mapping is written back into
+** termloctab.
+** It returns:
+** - 0   : if the strategy could be applied.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMlStrat (
+Kdgraph * restrict const        grafptr,
+Gnum * restrict const           termloctab,
+const int                       flagval,
+const Strat * const             strat,
+const KdgraphMapMlData * const  dataptr)
+{
+  Dmapping            mappdat;
+  Kdmapping           kmapdat;
+  Gnum *              vnumloctax;
+  int                 o;
+
+  if ((flagval != 0) && (strat->type == STRATNODEEMPTY)) /* If nothing to refine with, keep mapping as is */
+    return (0);
+
+  dmapInit (&mappdat, &dataptr->mappptr->mappptr->archdat);
+  kmapdat.mappptr = &mappdat;
+  kmapdat.domnorg = grafptr->m.domnorg;
+
+  vnumloctax = grafptr->s.vnumloctax;             /* Index temporary mapping fragments with plain global vertex numbers */
+  grafptr->s.vnumloctax = NULL;
+
+  o = 0;
+  if (flagval != 0)                               /* If current mapping to be refined */
+    o = dmapAddTerm (&mappdat, &grafptr->s, termloctab);
+  if (o == 0)
+    o = kdgraphMapSt (grafptr, &kmapdat, strat);
+  if (o == 0)
+    o = dmapTerm (&mappdat, &grafptr->s, termloctab);
+
+  grafptr->s.vnumloctax = vnumloctax;
+  dmapExit (&mappdat);
+
+  return (o);
+}
+
+/* This routine performs the
+** multi-level mapping recursion.
+** It returns:
+** - 0   : if mapping could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMl2 (
+Kdgraph * restrict const        grafptr,          /* Active graph                 */
+Gnum * restrict const           termloctab,       /* Terminal domain array to set */
+const KdgraphMapMlData * const  dataptr)          /* Multi-level data             */
+{
+  Kdgraph                       coargrafdat;
+  DgraphCoarsenMulti * restrict coarmulttax;
+  Gnum * restrict               coartermloctab;
+  int                           o;
+
+  if (grafptr->s.procglbnbr <= 1)                 /* Enter into sequential mode */
+    return (kdgraphMapMlSequ (grafptr, termloctab, dataptr));
+
+  coarmulttax = NULL;                             /* Assume multinode array is not allocated */
+  if (kdgraphMapMlCoarsen (grafptr, &coargrafdat, &coarmulttax, dataptr) == 0) {
+    coartermloctab = NULL;
+    o = 0;
+    if (coargrafdat.s.procglbnbr > 0) {           /* If we hold part of the coarse graph, map it */
+      if ((coartermloctab = memAlloc (coargrafdat.s.vertlocnbr * sizeof (Gnum))) == NULL) {
+        errorPrint ("kdgraphMapMl2: out of memory");
+        o = 1;
+      }
+      else
+        o = kdgraphMapMl2 (&coargrafdat, coartermloctab, dataptr);
+    }
+
+    if (((o = kdgraphMapMlUncoarsen (grafptr, &coargrafdat, coarmulttax, coartermloctab, termloctab, o, dataptr)) == 0) &&
+        ((o = kdgraphMapMlStrat (grafptr, termloctab, 1, dataptr->paraptr->stratasc, dataptr)) != 0)) { /* Apply ascending strategy if uncoarsening worked */
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+      errorPrintW ("kdgraphMapMl2: cannot apply ascending strategy");
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+    }
+
+    if (coartermloctab != NULL)
+      memFree (coartermloctab);
+    dgraphExit (&coargrafdat.s);
+    if (coarmulttax != NULL)                      /* If multinode array has been allocated */
+      memFree (coarmulttax + grafptr->s.baseval); /* Free array                            */
+
+    if (o == 0)                                   /* If multi-level failed, apply low strategy as fallback */
+      return (o);
+  }
+
+  if ((o = kdgraphMapMlStrat (grafptr, termloctab, 0, dataptr->paraptr->stratlow, dataptr)) != 0) { /* Apply low strategy */
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+    errorPrintW ("kdgraphMapMl2: cannot apply low strategy");
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+  }
+
+  return (o);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the multi-level
+** direct k-way mapping.
+** It returns:
+** - 0 : if mapping could be computed.
+** - 1 : on error.
+*/
+
+int
+kdgraphMapMl (
+Kdgraph * restrict const                grafptr,  /*+ Active graph      +*/
+Kdmapping * restrict const              mappptr,  /*+ Mapping to build  +*/
+const KdgraphMapMlParam * restrict const paraptr) /*+ Method parameters +*/
+{
+  KdgraphMapMlData    datadat;
+  Gnum * restrict     termloctab;
+  INT                 levlnum;
+  int                 o;
+
+  if (grafptr->s.vertglbnbr == 0)                 /* If nothing to do, return immediately */
+    return (0);
+
+  if (archVar (&mappptr->mappptr->archdat)) {
+    errorPrint ("kdgraphMapMl: variable-sized architectures not supported");
+    return     (1);
+  }
+
+  datadat.mappptr = mappptr;
+  datadat.paraptr = paraptr;
+  datadat.coarnbr = paraptr->coarnbr * (Gnum) archDomSize (&mappptr->mappptr->archdat, &grafptr->m.domnorg); /* Keep enough coarse vertices per terminal domain */
+  if (dgraphNodeData (&grafptr->s) != 0) {        /* Get core sharing data for sequential mapping */
+    errorPrint ("kdgraphMapMl: cannot get node data");
+    return     (1);
+  }
+  datadat.procnodnbr = grafptr->s.procnodnbr;
+  datadat.procnodnum = grafptr->s.procnodnum;
+
+  if ((termloctab = memAlloc (grafptr->s.vertlocnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("kdgraphMapMl: out of memory");
+    return     (1);
+  }
+
+  levlnum = grafptr->levlnum;                     /* Save graph level            */
+  grafptr->levlnum = 0;                           /* Initialize coarsening level */
+  o = kdgraphMapMl2 (grafptr, termloctab, &datadat); /* Perform multi-level mapping */
+  grafptr->levlnum = levlnum;                     /* Restore graph level         */
+
+  if (o == 0)
+    o = dmapAddTerm (mappptr->mappptr, &grafptr->s, termloctab);
+
+  memFree (termloctab);
+
+  return (o);
+}
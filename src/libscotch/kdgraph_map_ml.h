@@ -0,0 +1,98 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kdgraph_map_ml.h                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declaration    **/
+/**                for the parallel multi-level direct     **/
+/**                k-way mapping algorithm.                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct KdgraphMapMlParam_ {
+  INT                       passnbr;              /*+ Number of coarsening passes to go                      +*/
+  INT                       foldmax;              /*+ Maximum number of vertices per processor to do folding +*/
+  int                       foldval;              /*+ Type of folding                                        +*/
+  INT                       coarnbr;              /*+ Minimum number of vertices per terminal domain         +*/
+  double                    coarrat;              /*+ Coarsening ratio                                       +*/
+  Strat *                   stratlow;             /*+ Strategy at lowest level                               +*/
+  Strat *                   stratasc;             /*+ Strategy at ascending levels                           +*/
+  Strat *                   stratseq;             /*+ Sequential strategy when running on a single process   +*/
+} KdgraphMapMlParam;
+
+/*+ This structure holds the fine vertices
+    to be sent to their owner process.     +*/
+
+typedef struct KdgraphMapMlSort_ {
+  Gnum                      vertnum;              /*+ Global vertex index for uncoarsening +*/
+  Gnum                      termnum;              /*+ Terminal domain number               +*/
+  Gnum                      procnum;              /*+ Owner process of fine vertex         +*/
+} KdgraphMapMlSort;
+
+/*+ This structure holds the data shared
+    by all levels of the multi-level run. +*/
+
+typedef struct KdgraphMapMlData_ {
+  Kdmapping *               mappptr;              /*+ Mapping to compute                      +*/
+  const KdgraphMapMlParam * paraptr;              /*+ Method parameters                       +*/
+  Gnum                      coarnbr;              /*+ Minimum number of coarse vertices       +*/
+  int                       procnodnbr;           /*+ Processes sharing our cores             +*/
+  int                       procnodnum;           /*+ Rank of process among them              +*/
+} KdgraphMapMlData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_KDGRAPH_MAP_ML
+static int                  kdgraphMapMlCoarsen (Kdgraph * const, Kdgraph * const, DgraphCoarsenMulti * restrict * const, const KdgraphMapMlData * const);
+static int                  kdgraphMapMlCost    (Kdgraph * const, const Arch * const, const Gnum * const, Gnum * const);
+static void                 kdgraphMapMlOpBest  (const Gnum * const, Gnum * const, const int * const, const MPI_Datatype * const);
+static int                  kdgraphMapMlUncoarsen (Kdgraph * const, Kdgraph * const, const DgraphCoarsenMulti * restrict const, const Gnum * const, Gnum * const, const int, const KdgraphMapMlData * const);
+static int                  kdgraphMapMlSequ    (Kdgraph * const, Gnum * const, const KdgraphMapMlData * const);
+static int                  kdgraphMapMlStrat   (Kdgraph * const, Gnum * const, const int, const Strat * const, const KdgraphMapMlData * const);
+static int                  kdgraphMapMl2       (Kdgraph * const, Gnum * const, const KdgraphMapMlData * const);
+#endif /* SCOTCH_KDGRAPH_MAP_ML */
+
+int                         kdgraphMapMl        (Kdgraph * const, Kdmapping * const, const KdgraphMapMlParam * const);
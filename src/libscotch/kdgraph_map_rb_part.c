@@ -1,4 +1,4 @@
-/* Copyright 2008-2012,2014,2018,2019,2021-2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008-2012,2014,2018,2019,2021-2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 03 jun 2018     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -61,6 +61,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "comm.h"
 #include "parser.h"
 #include "graph.h"
 #include "arch.h"
@@ -102,8 +103,10 @@ Dmapping * restrict const                   mappptr,
 const KdgraphMapRbPartData * restrict const dataptr)
 {
   Graph * restrict          cgrfptr;
-  Kgraph                    kgrfdat;              /* Centralized mapping graph */
+  Kgraph                    kgrfdat;              /* Centralized mapping graph           */
+  Context                   contdat;              /* Threaded clone of execution context */
   DmappingFrag * restrict   fragptr;
+  int                       o;
 
   cgrfptr = &grafptr->data.cgrfdat;
   if (kgraphInit (&kgrfdat, cgrfptr, &mappptr->archdat, &grafptr->domnorg, 0, NULL, 1, 1, NULL) != 0) {
@@ -114,8 +117,16 @@ const KdgraphMapRbPartData * restrict const dataptr)
   kgrfdat.s.vnumtax   = NULL;                     /* Remove index array if any                                                    */
   kgrfdat.comploadrat = dataptr->comploadrat;     /* Use ideal load of full graph and not that of subgraph                        */
   kgrfdat.contptr     = dataptr->contptr;
+  if (contextThreadClone (&contdat, dataptr->contptr, dataptr->procnodnbr, dataptr->procnodnum) == 0) /* Use node cores that sequential run would leave idle */
+    kgrfdat.contptr = &contdat;
+
+  o = kgraphMapSt (&kgrfdat, dataptr->paraptr->stratseq); /* Compute sequential mapping */
 
-  if (kgraphMapSt (&kgrfdat, dataptr->paraptr->stratseq) != 0) { /* Compute sequential mapping */
+  if (kgrfdat.contptr != dataptr->contptr) {      /* If threaded clone of context used, free it */
+    contextThreadCloneExit (&contdat);
+    kgrfdat.contptr = dataptr->contptr;
+  }
+  if (o != 0) {
     kgraphExit (&kgrfdat);
     return (1);
   }
@@ -184,7 +195,7 @@ KdgraphMapRbPartThread * const  fldthrdptr)
 
   if (fldthrdptr->fldprocnbr > 1) {               /* If subpart has several processes, fold a distributed graph */
     o = dgraphFold2 (&indgrafdat, fldthrdptr->fldpartval, /* Fold temporary induced subgraph from all processes */
-                     &fldgrafptr->data.dgrfdat, fldthrdptr->fldproccomm, NULL, NULL, MPI_INT);
+                     &fldgrafptr->data.dgrfdat, fldthrdptr->fldproccomm, NULL, NULL, MPI_INT, fldthrdptr->contptr);
     fldgrafptr->data.dgrfdat.flagval |= DGRAPHFREECOMM; /* Split communicator has to be freed */
   }
   else {                                          /* Create a centralized graph */
@@ -274,6 +285,7 @@ KdgraphMapRbPartGraph * restrict const  fldgrafptr)
   fldthrdtab[0].fldgrafptr  = fldgrafptr;
   fldthrdtab[0].fldpartval  = 0;
   fldthrdtab[0].fldprocnbr  = indflagtab[indpartmax] & fldprocnbr0; /* Stop if domain limited to one vertex */
+  fldthrdtab[0].contptr     = actgrafptr->contptr;
   fldthrdtab[1].mappptr     = mappptr;
   fldthrdtab[1].orggrafptr  = &actgrafptr->s;     /* Assume jobs won't be run concurrently */
   fldthrdtab[1].inddomnptr  = &domnsubtab[indpartmax ^ 1];
@@ -283,6 +295,7 @@ KdgraphMapRbPartGraph * restrict const  fldgrafptr)
   fldthrdtab[1].fldgrafptr  = fldgrafptr;
   fldthrdtab[1].fldpartval  = 1;
   fldthrdtab[1].fldprocnbr  = indflagtab[indpartmax ^ 1] & (actgrafptr->s.procglbnbr - fldprocnbr0); /* Stop if domain limited to one vertex */
+  fldthrdtab[1].contptr     = actgrafptr->contptr;
 
   if (actgrafptr->s.proclocnum < fldprocnbr0) {   /* Compute color and rank in our future subpart */
     fldpartval = 0;
@@ -313,12 +326,13 @@ KdgraphMapRbPartGraph * restrict const  fldgrafptr)
     Dgraph              orggrafdat;               /* Structure for copying graph fields except communicator   */
 
     orggrafdat = actgrafptr->s;                   /* Create a separate graph structure to change its communicator */
-    orggrafdat.flagval = (orggrafdat.flagval & ~DGRAPHFREEALL) | DGRAPHFREECOMM;
+    orggrafdat.flagval = (orggrafdat.flagval & ~(DGRAPHFREEALL | DGRAPHHASNGBCOMM)) | DGRAPHFREECOMM; /* Copy will build its own neighborhood communicator */
     fldthrdtab[1].orggrafptr = &orggrafdat;
     MPI_Comm_dup (actgrafptr->s.proccomm, &orggrafdat.proccomm); /* Duplicate communicator to avoid interferences in communications */
 
     contextThreadLaunch (actgrafptr->contptr, (ThreadFunc) kdgraphMapRbPartFold3, (void *) fldthrdtab); /* Only threads 0 and 1 will work */
 
+    dgraphNgbFree (&orggrafdat);                  /* Free neighborhood communicator of copy, if any */
     MPI_Comm_free (&orggrafdat.proccomm);
 
     o = ((fldthrdtab[0].orggrafptr == NULL) ||    /* See if an error occured */
@@ -423,6 +437,13 @@ const KdgraphMapRbParam * restrict const  paraptr)
   datadat.comploadmax = (1.0 + paraptr->kbalval) * datadat.comploadrat;
   datadat.contptr = grafptr->contptr;
 
+  if (dgraphNodeData (&grafptr->s) != 0) {        /* Get core sharing data for sequential mappings */
+    errorPrint ("kdgraphMapRbPart: cannot get node data");
+    return (1);
+  }
+  datadat.procnodnbr = grafptr->s.procnodnbr;
+  datadat.procnodnum = grafptr->s.procnodnum;
+
   if (grafptr->s.procglbnbr <= 1) {               /* If single process, switch immediately to sequential mode */
     if (dgraphGather (&grafptr->s, &grafdat.data.cgrfdat) != 0) {
       errorPrint ("kdgraphMapRbPart: cannot centralize graph");
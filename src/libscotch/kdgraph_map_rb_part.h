@@ -1,4 +1,4 @@
-/* Copyright 2008,2010,2011,2018,2019,2022,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2010,2011,2018,2019,2022,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,6 +78,7 @@ typedef struct KdgraphMapRbPartThread_ {
   int                       fldprocnbr;           /*+ Number of processes in folded communicator     +*/
   int                       fldprocnum;           /*+ Rank of process in folded communicator, or -1  +*/
   MPI_Comm                  fldproccomm;          /*+ Communicator for the folded graph, if any      +*/
+  Context *                 contptr;              /*+ Execution context                              +*/
 } KdgraphMapRbPartThread;
 
 /*+ This structure holds the data passed to each bipartitioning job. +*/
@@ -89,6 +90,8 @@ typedef struct KdgraphMapRbPartData_ {
   double                    comploadmin;          /*+ Minimum vertex load per target load +*/
   double                    comploadmax;          /*+ Maximum vertex load per target load +*/
   Context *                 contptr;              /*+ Execution context                   +*/
+  int                       procnodnbr;           /*+ Processes sharing our cores         +*/
+  int                       procnodnum;           /*+ Rank of process among them          +*/
 } KdgraphMapRbPartData;
 
 /*
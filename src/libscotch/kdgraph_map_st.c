@@ -1,4 +1,4 @@
-/* Copyright 2008-2011,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008-2011,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**   DATES      : # Version 5.1  : from : 16 jun 2008     **/
 /**                                 to   : 14 apr 2011     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +65,8 @@
 #include "kgraph.h"
 #include "kgraph_map_st.h"
 #include "kdgraph.h"
+#include "kdgraph_map_lp.h"
+#include "kdgraph_map_ml.h"
 #include "kdgraph_map_rb.h"
 #include "kdgraph_map_st.h"
 
@@ -72,16 +74,68 @@
 **  The static and global variables.
 */
 
+static union {
+  KdgraphMapLpParam         param;
+  StratNodeMethodData       padding;
+} kdgraphmapstdefaultlp = { { 10, 0.05 } };
+
+static union {
+  KdgraphMapMlParam         param;
+  StratNodeMethodData       padding;
+} kdgraphmapstdefaultml = { { 5, 1000, 2, 100, 0.8L, &stratdummy, &stratdummy, &stratdummy } };
+
 static union {
   KdgraphMapRbParam         param;
   StratNodeMethodData       padding;
 } kdgraphmapstdefaultrb = { { &stratdummy, &stratdummy, 0.05 } };
 
 static StratMethodTab       kdgraphmapstmethtab[] = { /* Mapping methods array */
+                              { KDGRAPHMAPSTMETHLP, "l",  kdgraphMapLp, &kdgraphmapstdefaultlp },
+                              { KDGRAPHMAPSTMETHML, "m",  kdgraphMapMl, &kdgraphmapstdefaultml },
                               { KDGRAPHMAPSTMETHRB, "r",  kdgraphMapRb, &kdgraphmapstdefaultrb },
                               { -1,                 NULL, NULL,         NULL } };
 
 static StratParamTab        kdgraphmapstparatab[] = { /* Method parameter list */
+                              { KDGRAPHMAPSTMETHLP,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &kdgraphmapstdefaultlp.param,
+                                (byte *) &kdgraphmapstdefaultlp.param.kbalval,
+                                NULL },
+                              { KDGRAPHMAPSTMETHLP,  STRATPARAMINT,    "pass",
+                                (byte *) &kdgraphmapstdefaultlp.param,
+                                (byte *) &kdgraphmapstdefaultlp.param.passnbr,
+                                NULL },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "asc",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.stratasc,
+                                (void *) &kdgraphmapststratab },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "low",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.stratlow,
+                                (void *) &kdgraphmapststratab },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "seq",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.stratseq,
+                                (void *) &kgraphmapststratab },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMINT,    "pass",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.passnbr,
+                                NULL },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMINT,    "vert",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.coarnbr,
+                                NULL },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMINT,    "dvert",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.foldmax,
+                                NULL },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMCASE,   "fold",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.foldval,
+                                (void *) "nfd" },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMDOUBLE, "rat",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.coarrat,
+                                NULL },
                               { KDGRAPHMAPSTMETHRB,  STRATPARAMSTRAT,  "sep",
                                 (byte *) &kdgraphmapstdefaultrb.param,
                                 (byte *) &kdgraphmapstdefaultrb.param.stratsep,
@@ -134,7 +188,9 @@ const Strat * restrict const  strat)              /*+ Mapping strategy +*/
     errorPrint ("kdgraphMapSt: invalid type specification for parser variables");
     return     (1);
   }
-  if ((sizeof (KdgraphMapRbParam) > sizeof (StratNodeMethodData))) {
+  if ((sizeof (KdgraphMapLpParam) > sizeof (StratNodeMethodData)) ||
+      (sizeof (KdgraphMapMlParam) > sizeof (StratNodeMethodData)) ||
+      (sizeof (KdgraphMapRbParam) > sizeof (StratNodeMethodData))) {
     errorPrint ("kdgraphMapSt: invalid type specification");
     return     (1);
   }
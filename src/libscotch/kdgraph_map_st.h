@@ -1,4 +1,4 @@
-/* Copyright 2008,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,6 +45,8 @@
 /**                                 to   : 16 jun 2008     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -55,7 +57,9 @@
 /*+ Method types. +*/
 
 typedef enum KdgraphMapStMethodType_ {
-  KDGRAPHMAPSTMETHRB = 0,                         /*+ Dual Recursive Bipartitioning +*/
+  KDGRAPHMAPSTMETHLP = 0,                         /*+ K-way label propagation       +*/
+  KDGRAPHMAPSTMETHML,                             /*+ Direct k-way multi-level      +*/
+  KDGRAPHMAPSTMETHRB,                             /*+ Dual Recursive Bipartitioning +*/
   KDGRAPHMAPSTMETHNBR                             /*+ Number of methods             +*/
 } KdgraphMapStMethodType;
 
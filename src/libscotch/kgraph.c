@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 27 aug 2020     **/
 /**                # Version 7.0  : from : 22 jun 2021     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -117,6 +117,8 @@ const Gnum * restrict const     vmlotax)          /*+ Vertex migration cost arra
 
   actgrafptr->s.flagval  |= KGRAPHFREECOMP | KGRAPHFREEFRON; /* Load arrays always grouped */
   actgrafptr->comploadavg = NULL;                 /* In case of allocation error           */
+  actgrafptr->dimnnbr     = 0;                    /* No geometry by default                */
+  actgrafptr->geomtab     = NULL;
   if (((actgrafptr->frontab = memAlloc (actgrafptr->s.vertnbr * sizeof (Gnum))) == NULL) ||
       (memAllocGroup ((void **) (void *)
                       &actgrafptr->comploadavg, (size_t) (actgrafptr->m.domnmax * sizeof (Gnum)), /* TRICK: can send both compload arrays in one piece */
@@ -169,6 +171,10 @@ Kgraph * restrict const     grafptr)
       (grafptr->frontab != NULL))                 /* And if it exists             */
     memFree (grafptr->frontab);                   /* Free it                      */
 
+  if (((grafptr->s.flagval & KGRAPHFREEGEOM) != 0) && /* If geomtab must be freed */
+      (grafptr->geomtab != NULL))                 /* And if it exists             */
+    memFree (grafptr->geomtab);                   /* Free it                      */
+
   mapExit (&grafptr->m);
   mapExit (&grafptr->r.m);
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010-2012,2014,2018,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010-2012,2014,2018,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 13 jul 2021     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The comploadavg and comploaddlt       **/
 /**                  should always be allocated together,  **/
@@ -100,6 +100,7 @@
 #define KGRAPHFREEPFIX              (GRAPHBITSNOTUSED << 2) /*+ Free fixed vertex array          +*/
 #define KGRAPHFREEVMLO              (GRAPHBITSNOTUSED << 3) /*+ Free vertex migration cost array +*/
 #define KGRAPHHASANCHORS            (GRAPHBITSNOTUSED << 4) /*+ The graph is a band graph        +*/
+#define KGRAPHFREEGEOM              (GRAPHBITSNOTUSED << 5) /*+ Free geometry array              +*/
 
 /*
 **  The type and structure definitions.
@@ -125,6 +126,8 @@ typedef struct Kgraph_ {
   double                    comploadrat;          /*+ Ideal load balance per weight unit                +*/
   Gnum                      commload;             /*+ Communication load                                +*/
   double                    kbalval;              /*+ Last k-way imbalance ratio                        +*/
+  int                       dimnnbr;              /*+ Geometry dimension, if any                        +*/
+  double *                  geomtab;              /*+ Vertex coordinates [vertnbr * dimnnbr], or NULL   +*/
   INT                       levlnum;              /*+ Graph coarsening level                            +*/
   Context *                 contptr;              /*+ Execution context                                 +*/
 } Kgraph;
@@ -1,4 +1,4 @@
-/* Copyright 2010,2011,2012,2014,2015,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2011,2012,2014,2015,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 25 feb 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -62,6 +62,7 @@
 #include "arch.h"
 #include "mapping.h"
 #include "graph_coarsen.h"
+#include "graph_hier.h"
 #include "kgraph.h"
 #include "kgraph_map_ml.h"
 #include "kgraph_map_st.h"
@@ -76,7 +77,9 @@
 ** graph that is given on input. The coarser
 ** graphs differ at this stage from classical
 ** active graphs as their internal gains are not
-** yet computed.
+** yet computed. When label propagation clusters
+** are contracted, the fine-to-coarse array is
+** returned in place of the multinode array.
 ** It returns:
 ** - 0  : if the coarse graph has been built.
 ** - 1  : if threshold reached or on error.
@@ -87,9 +90,13 @@ int
 kgraphMapMlCoarsen (
 Kgraph * restrict const               finegrafptr, /*+ Finer graph                                  +*/
 Kgraph * restrict const               coargrafptr, /*+ Coarser graph to build                       +*/
+Gnum * restrict * const               finecoarptr, /*+ Pointer to un-based fine-to-coarse array     +*/
 GraphCoarsenMulti * restrict * const  coarmultptr, /*+ Pointer to un-based multinode table to build +*/
 const KgraphMapMlParam * const        paraptr)    /*+ Method parameters                             +*/
 {
+  const Gnum * restrict       finecoartax;        /* Fine-to-coarse array, if clusters contracted */
+  const GraphHierLevl *       levlptr;            /* Level of attached coarsening hierarchy, if any */
+
   const Anum * restrict const finepfixtax = finegrafptr->pfixtax;
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
@@ -100,10 +107,33 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
   }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
+  *finecoarptr = NULL;                            /* Assume no fine-to-coarse array needed        */
   *coarmultptr = NULL;                            /* Allocate coarmulttab along with coarse graph */
-  if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr, paraptr->coarnbr, paraptr->coarval, GRAPHCOARSENNOCOMPACT,
-                    finegrafptr->r.m.parttax, finepfixtax, finegrafptr->vfixnbr, finegrafptr->contptr) != 0)
-    return (1);
+  if ((paraptr->typeval != KGRAPHMAPMLTYPELBP) && /* If matching-based coarsening without constraints */
+      (finepfixtax == NULL) && (finegrafptr->r.m.parttax == NULL) &&
+      ((levlptr = graphHierLevl (&finegrafptr->s, finegrafptr->levlnum, paraptr->coarnbr, paraptr->coarval)) != NULL)) {
+    coargrafptr->s          = levlptr->grafdat;   /* Use coarse graph of attached hierarchy         */
+    coargrafptr->s.flagval  = (coargrafptr->s.flagval & (GRAPHBITSUSED & ~GRAPHFREETABS)) | GRAPHHASHIER; /* Do not free it */
+    coargrafptr->s.hierptr  = finegrafptr->s.hierptr; /* Keep hierarchy for next level                */
+    *coarmultptr            = levlptr->multtab;
+  }
+  else {
+    if ((paraptr->typeval == KGRAPHMAPMLTYPELBP) && /* If clusters wanted, keep fine-to-coarse array */
+        ((*finecoarptr = (Gnum *) memAlloc (finegrafptr->s.vertnbr * sizeof (Gnum))) == NULL)) {
+      errorPrint ("kgraphMapMlCoarsen: out of memory (1)");
+      return (1);
+    }
+    if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, (*finecoarptr != NULL) ? finecoarptr : NULL, coarmultptr,
+                      paraptr->coarnbr, paraptr->coarval,
+                      GRAPHCOARSENNOCOMPACT | ((*finecoarptr != NULL) ? GRAPHCOARSENCLUSTER : GRAPHCOARSENNONE) |
+                      ((paraptr->typeval == KGRAPHMAPMLTYPEHOP) ? GRAPHCOARSENHOP : GRAPHCOARSENNONE),
+                      finegrafptr->r.m.parttax, finepfixtax, finegrafptr->vfixnbr, finegrafptr->contptr) != 0) {
+      if (*finecoarptr != NULL)
+        memFree (*finecoarptr);
+      return (1);
+    }
+  }
+  finecoartax = (*finecoarptr != NULL) ? (*finecoarptr - finegrafptr->s.baseval) : NULL;
 
   mapInit2 (&coargrafptr->m,   &coargrafptr->s, finegrafptr->m.archptr,   &finegrafptr->m.domnorg,   finegrafptr->m.domnmax,   finegrafptr->m.domnnbr);
   mapInit2 (&coargrafptr->r.m, &coargrafptr->s, finegrafptr->r.m.archptr, &finegrafptr->r.m.domnorg, finegrafptr->r.m.domnmax, finegrafptr->r.m.domnnbr);
@@ -113,6 +143,8 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
   coargrafptr->comploaddlt = finegrafptr->comploaddlt;
   coargrafptr->frontab     = finegrafptr->frontab; /* Share frontier array of finer graph as coarse frontier array (no freeing) */
   coargrafptr->contptr     = finegrafptr->contptr;
+  coargrafptr->dimnnbr     = finegrafptr->dimnnbr;
+  coargrafptr->geomtab     = NULL;                /* Coarse geometry computed last, if any */
 
   coargrafptr->r.cmloval = finegrafptr->r.cmloval;
   coargrafptr->r.crloval = finegrafptr->r.crloval;
@@ -131,33 +163,49 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
     if (memAllocGroup ((void **) (void *)
                        &coarparotab, (size_t) (coarvertnbr * sizeof (Anum)),
                        &coarvmlotab, (size_t) (coarvertnbr * sizeof (Gnum)), NULL) == NULL) {
-      errorPrint ("kgraphMapMlCoarsen: out of memory (1)");
+      errorPrint ("kgraphMapMlCoarsen: out of memory (2)");
       kgraphExit (coargrafptr);
+      if (*finecoarptr != NULL)
+        memFree (*finecoarptr);
       return (1);
     }
     coargrafptr->r.m.flagval = MAPPINGFREEPART;   /* Free group leader                    */
     coargrafptr->r.m.parttax = coarparotab - coargrafptr->s.baseval; /* Set coarse arrays */
     coargrafptr->r.vmlotax   = coarvmlotab - coargrafptr->s.baseval;
 
-    for (coarvertnum = 0; coarvertnum < coarvertnbr; coarvertnum ++) { /* Un-based traversal */
-      Gnum                finevertnum0;
-      Gnum                finevertnum1;
+    if (finecoartax != NULL) {                    /* If clusters contracted, use fine-to-coarse array */
+      Gnum                finevertnum;
+      Gnum                finevertnnd;
 
-      finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
-      finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
-      coarparotab[coarvertnum] = fineparotax[finevertnum0];
-      coarvmlotab[coarvertnum] = (finevmlotax != NULL)
-                                 ? ((finevertnum0 == finevertnum1) ? 0 : finevmlotax[finevertnum1]) + finevmlotax[finevertnum0]
-                                 : ((finevertnum0 == finevertnum1) ? 1 : 2);
-#ifdef SCOTCH_DEBUG_KGRAPH2
-      if ((fineparotax[finevertnum1] != fineparotax[finevertnum0]) && /* If vertices were not in the same part */
-          ((finegrafptr->pfixtax == NULL) ||
-           ((finepfixtax[finevertnum1] == -1) &&  /* And both are not fixed */
-            (finepfixtax[finevertnum0] == -1)))) {
-        errorPrint ("kgraphMapMlCoarsen: internal error (2)");
-        return (1);
+      memSet (coarvmlotab, 0, coarvertnbr * sizeof (Gnum));
+      for (finevertnum = finegrafptr->s.baseval, finevertnnd = finegrafptr->s.vertnnd;
+           finevertnum < finevertnnd; finevertnum ++) {
+        coarvertnum = finecoartax[finevertnum] - coargrafptr->s.baseval;
+        coarparotab[coarvertnum]  = fineparotax[finevertnum]; /* All vertices of a cluster have same old part */
+        coarvmlotab[coarvertnum] += (finevmlotax != NULL) ? finevmlotax[finevertnum] : 1;
       }
+    }
+    else {
+      for (coarvertnum = 0; coarvertnum < coarvertnbr; coarvertnum ++) { /* Un-based traversal */
+        Gnum                finevertnum0;
+        Gnum                finevertnum1;
+
+        finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
+        finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
+        coarparotab[coarvertnum] = fineparotax[finevertnum0];
+        coarvmlotab[coarvertnum] = (finevmlotax != NULL)
+                                   ? ((finevertnum0 == finevertnum1) ? 0 : finevmlotax[finevertnum1]) + finevmlotax[finevertnum0]
+                                   : ((finevertnum0 == finevertnum1) ? 1 : 2);
+#ifdef SCOTCH_DEBUG_KGRAPH2
+        if ((fineparotax[finevertnum1] != fineparotax[finevertnum0]) && /* If vertices were not in the same part */
+            ((finegrafptr->pfixtax == NULL) ||
+             ((finepfixtax[finevertnum1] == -1) &&  /* And both are not fixed */
+              (finepfixtax[finevertnum0] == -1)))) {
+          errorPrint ("kgraphMapMlCoarsen: internal error (2)");
+          return (1);
+        }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
+      }
     }
   }
   else
@@ -173,27 +221,41 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
 
     coarvertnbr = coargrafptr->s.vertnbr;
     if ((coarpfixtab = (Anum *) memAlloc (coarvertnbr * sizeof (Anum))) == NULL) {
-      errorPrint ("kgraphMapMlCoarsen: out of memory (2)");
+      errorPrint ("kgraphMapMlCoarsen: out of memory (3)");
       kgraphExit (coargrafptr);
+      if (*finecoarptr != NULL)
+        memFree (*finecoarptr);
       return (1);
     }
     coargrafptr->s.flagval |= KGRAPHFREEPFIX;
     coargrafptr->pfixtax    = coarpfixtab - coargrafptr->s.baseval;
 
     coarvfixnbr = coarvertnbr;                    /* Assume all vertices are fixed */
-    for (coarvertnum = 0; coarvertnum < coarvertnbr; coarvertnum ++) {
-      Anum                coarpfixval;
+    if (finecoartax != NULL) {                    /* If clusters contracted, use fine-to-coarse array */
+      Gnum                finevertnum;
+      Gnum                finevertnnd;
+
+      for (finevertnum = finegrafptr->s.baseval, finevertnnd = finegrafptr->s.vertnnd;
+           finevertnum < finevertnnd; finevertnum ++) /* All vertices of a cluster have same fixed part */
+        coarpfixtab[finecoartax[finevertnum] - coargrafptr->s.baseval] = finepfixtax[finevertnum];
+      for (coarvertnum = 0; coarvertnum < coarvertnbr; coarvertnum ++)
+        coarvfixnbr += coarpfixtab[coarvertnum] >> (sizeof (Anum) * 8 - 1); /* Accumulate -1's, that is, non-fixed vertices */
+    }
+    else {
+      for (coarvertnum = 0; coarvertnum < coarvertnbr; coarvertnum ++) {
+        Anum                coarpfixval;
 
-      coarpfixval  = finepfixtax[coarmulttab[coarvertnum].vertnum[0]];
-      coarvfixnbr += coarpfixval >> (sizeof (Anum) * 8 - 1); /* Accumulate -1's, that is, non-fixed vertices */
+        coarpfixval  = finepfixtax[coarmulttab[coarvertnum].vertnum[0]];
+        coarvfixnbr += coarpfixval >> (sizeof (Anum) * 8 - 1); /* Accumulate -1's, that is, non-fixed vertices */
 
-      coarpfixtab[coarvertnum] = coarpfixval;
+        coarpfixtab[coarvertnum] = coarpfixval;
 #ifdef SCOTCH_DEBUG_KGRAPH2
-      if (finepfixtax[coarmulttab[coarvertnum].vertnum[1]] != coarpfixval) {
-        errorPrint ("kgraphMapMlCoarsen: internal error (3)");
-        return (1);
-      }
+        if (finepfixtax[coarmulttab[coarvertnum].vertnum[1]] != coarpfixval) {
+          errorPrint ("kgraphMapMlCoarsen: internal error (3)");
+          return (1);
+        }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
+      }
     }
     coargrafptr->vfixnbr = coarvfixnbr;
   }
@@ -202,6 +264,18 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
     coargrafptr->pfixtax = NULL;
   }
 
+  if (finegrafptr->geomtab != NULL) {             /* Project coordinates onto coarse vertices */
+    if (graphCoarsenGeom (&finegrafptr->s, coargrafptr->s.vertnbr, *finecoarptr, *coarmultptr,
+                          finegrafptr->dimnnbr, finegrafptr->geomtab, &coargrafptr->geomtab) != 0) {
+      errorPrint ("kgraphMapMlCoarsen: cannot compute coarse geometry");
+      kgraphExit (coargrafptr);
+      if (*finecoarptr != NULL)
+        memFree (*finecoarptr);
+      return (1);
+    }
+    coargrafptr->s.flagval |= KGRAPHFREEGEOM;
+  }
+
   coargrafptr->comploadrat = finegrafptr->comploadrat;
   coargrafptr->kbalval     = finegrafptr->kbalval;
   coargrafptr->levlnum     = finegrafptr->levlnum + 1;
@@ -211,7 +285,9 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
 
 /* This routine propagates the partitioning of the
 ** coarser graph back to the finer graph, according
-** to the multinode table of collapsed vertices.
+** to the multinode table of collapsed vertices, or
+** to the fine-to-coarse array when clusters have
+** been contracted.
 ** After the partitioning is propagated, it finishes
 ** to compute the parameters of the finer graph that
 ** were not computed at the coarsening stage.
@@ -224,8 +300,9 @@ static
 int
 kgraphMapMlUncoarsen (
 Kgraph * restrict const         finegrafptr,      /*+ Finer graph                +*/
-Kgraph * restrict const         coargrafptr,      /*+ Coarser graph              +*/
-const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to multinode array +*/
+Kgraph * restrict const         coargrafptr,      /*+ Coarser graph                           +*/
+const Gnum * const              finecoartab,      /*+ Un-based fine-to-coarse array, if any   +*/
+const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to multinode array              +*/
 {
   const Anum * restrict coarparttax;              /* Only known when coagrafptr is not NULL      */
   Gnum                  coarvertnnd;
@@ -273,6 +350,60 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to multinode array
   fineparttax = finegrafptr->m.parttax;           /* Fine part array is now allocated */
   coarparttax = coargrafptr->m.parttax;
   coarfrontab = coargrafptr->frontab;
+
+  if (finecoartab != NULL) {                      /* If clusters contracted, project through fine-to-coarse array */
+    byte * restrict     coarflagtax;              /* Flag array for coarse frontier vertices                      */
+    Gnum                finevertnnd;
+    Gnum                finevertnum;
+
+    const Gnum * restrict const finecoartax = finecoartab - finegrafptr->s.baseval;
+
+    if ((coarflagtax = (byte *) memAlloc (coargrafptr->s.vertnbr * sizeof (byte))) == NULL) {
+      errorPrint ("kgraphMapMlUncoarsen: out of memory");
+      return (1);
+    }
+    memSet (coarflagtax, 0, coargrafptr->s.vertnbr * sizeof (byte));
+    coarflagtax -= coargrafptr->s.baseval;
+
+    for (coarfronnum = 0, coarfronnbr = coargrafptr->fronnbr; /* Flag coarse frontier vertices */
+         coarfronnum < coarfronnbr; coarfronnum ++)
+      coarflagtax[coarfrontab[coarfronnum]] = 1;
+
+    for (finevertnum = finegrafptr->s.baseval, finevertnnd = finegrafptr->s.vertnnd;
+         finevertnum < finevertnnd; finevertnum ++)
+      fineparttax[finevertnum] = coarparttax[finecoartax[finevertnum]];
+
+    for (finevertnum = finegrafptr->s.baseval, finefronnum = 0; /* Only fine vertices of coarse frontier vertices may be in frontier */
+         finevertnum < finevertnnd; finevertnum ++) {
+      Gnum                fineedgenum;
+
+      if (coarflagtax[finecoartax[finevertnum]] == 0)
+        continue;
+
+      for (fineedgenum = fineverttax[finevertnum];
+           fineedgenum < finevendtax[finevertnum]; fineedgenum ++) {
+        if (fineparttax[fineedgetax[fineedgenum]] != fineparttax[finevertnum]) { /* If vertex belongs to frontier */
+          coarfrontab[finefronnum ++] = finevertnum; /* TRICK: coarse frontier array is also fine frontier array */
+          break;
+        }
+      }
+    }
+
+    memFree (coarflagtax + coargrafptr->s.baseval);
+
+    finegrafptr->commload = coargrafptr->commload;
+    finegrafptr->fronnbr  = finefronnum;
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+    if (kgraphCheck (finegrafptr) != 0) {
+      errorPrint ("kgraphMapMlUncoarsen: inconsistent graph data (1)");
+      return (1);
+    }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+    return (0);
+  }
+
   for (coarvertnum = coargrafptr->s.baseval, coarvertnnd = coargrafptr->s.vertnnd;
        coarvertnum < coarvertnnd; coarvertnum ++) {
     Gnum                finevertnum0;             /* First multinode vertex  */
@@ -344,7 +475,7 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to multinode array
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
   if (kgraphCheck (finegrafptr) != 0) {
-    errorPrint ("kgraphMapMlUncoarsen: inconsistent graph data");
+    errorPrint ("kgraphMapMlUncoarsen: inconsistent graph data (2)");
     return (1);
   }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
@@ -366,18 +497,21 @@ Kgraph * restrict const           grafptr,        /*+ Active graph      +*/
 const KgraphMapMlParam * const    paraptr)        /*+ Method parameters +*/
 {
   Kgraph              coargrafdat;
-  GraphCoarsenMulti * coarmulttab;                /* Pointer to un-based multinode array */
+  Gnum *              finecoartab;                /* Pointer to un-based fine-to-coarse array, if any */
+  GraphCoarsenMulti * coarmulttab;                /* Pointer to un-based multinode array              */
   int                 o;
 
-  if (kgraphMapMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = kgraphMapMl2         (&coargrafdat, paraptr))              == 0) &&
-        ((o = kgraphMapMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
-        ((o = kgraphMapSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
+  if (kgraphMapMlCoarsen (grafptr, &coargrafdat, &finecoartab, &coarmulttab, paraptr) == 0) {
+    if (((o = kgraphMapMl2         (&coargrafdat, paraptr))                           == 0) &&
+        ((o = kgraphMapMlUncoarsen (grafptr, &coargrafdat, finecoartab, coarmulttab)) == 0) &&
+        ((o = kgraphMapSt          (grafptr, paraptr->stratasc))                      != 0)) /* Apply ascending strategy */
       errorPrint ("kgraphMapMl2: cannot apply ascending strategy");
     kgraphExit (&coargrafdat);
+    if (finecoartab != NULL)                      /* If clusters were contracted */
+      memFree (finecoartab);
   }
   else {                                          /* Cannot coarsen due to lack of memory or error */
-    if (((o = kgraphMapMlUncoarsen (grafptr, NULL, NULL))        == 0) && /* Finalize graph        */
+    if (((o = kgraphMapMlUncoarsen (grafptr, NULL, NULL, NULL))  == 0) && /* Finalize graph        */
         ((o = kgraphMapSt          (grafptr, paraptr->stratlow)) != 0)) /* Apply low strategy      */
       errorPrint ("kgraphMapMl2: cannot apply low strategy");
   }
@@ -1,4 +1,4 @@
-/* Copyright 2010,2011,2014,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2011,2014,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,10 +45,21 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Indices of label propagation clustering and
+    of two-hop matching in the coarsening type
+    case string "hscdlt".                         +*/
+
+#define KGRAPHMAPMLTYPELBP          4
+#define KGRAPHMAPMLTYPEHOP          5
+
 /*
 **  The type and structure definitions.
 */
@@ -60,7 +71,7 @@ typedef struct KgraphMapMlParam_ {
   double                    coarval;              /*+ Coarsening ratio             +*/
   Strat *                   stratlow;             /*+ Strategy at lowest level     +*/
   Strat *                   stratasc;             /*+ Strategy at ascending levels +*/
-  int                       typeval;              /*+ Not used                     +*/
+  int                       typeval;              /*+ Coarsening type              +*/
 } KgraphMapMlParam;
 
 /*
@@ -68,8 +79,8 @@ typedef struct KgraphMapMlParam_ {
 */
 
 #ifdef SCOTCH_KGRAPH_MAP_ML
-static int                  kgraphMapMlCoarsen  (Kgraph * const, Kgraph * restrict const, GraphCoarsenMulti * restrict * const, const KgraphMapMlParam * const);
-static int                  kgraphMapMlUncoarsen (Kgraph * restrict const, Kgraph * const, const GraphCoarsenMulti * const);
+static int                  kgraphMapMlCoarsen  (Kgraph * const, Kgraph * restrict const, Gnum * restrict * const, GraphCoarsenMulti * restrict * const, const KgraphMapMlParam * const);
+static int                  kgraphMapMlUncoarsen (Kgraph * restrict const, Kgraph * const, const Gnum * const, const GraphCoarsenMulti * const);
 static int                  kgraphMapMl2        (Kgraph * restrict const, const KgraphMapMlParam * const);
 #endif /* SCOTCH_KGRAPH_MAP_ML */
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2013,2014,2018,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2013,2014,2018,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -69,7 +69,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 21 jun 2019     **/
 /**                # Version 7.0  : from : 23 aug 2019     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -139,6 +139,8 @@ const KgraphMapRbParam * restrict const paraptr)
   datadat.comploadrat = grafptr->comploadrat;
   datadat.comploadmin = (1.0 - paraptr->kbalval) * grafptr->comploadrat; /* Ratio can have been tilted when working on subgraph */
   datadat.comploadmax = (1.0 + paraptr->kbalval) * grafptr->comploadrat;
+  datadat.dimnnbr     = grafptr->dimnnbr;
+  datadat.geomtab     = grafptr->geomtab;
 
   if (grafptr->pfixtax == NULL) {
     indgrafptr = &grafptr->s;                     /* Work on the original graph */
@@ -591,6 +593,34 @@ Context * const                         contptr)  /*+ Execution context
   }
   actgrafptr->contptr = contptr;
 
+  if (dataptr->geomtab != NULL) {                 /* If geometry available, pass it to bipartition graph */
+    actgrafptr->dimnnbr = dataptr->dimnnbr;
+    if (actvnumtax == NULL)                       /* If active graph is not a subgraph, share array */
+      actgrafptr->geomtab = (double *) dataptr->geomtab;
+    else {
+      double * restrict   geomtab;
+      int                 dimnnum;
+
+      const Gnum                    dimnnbr    = dataptr->dimnnbr;
+      const Gnum                    orgbaseval = dataptr->grafptr->baseval;
+      const double * restrict const orggeomtab = dataptr->geomtab;
+
+      if ((geomtab = (double *) memAlloc (actgrafptr->s.vertnbr * dimnnbr * sizeof (double))) == NULL) {
+        errorPrint ("kgraphMapRbBgraph: out of memory (1)");
+        return (1);
+      }
+      for (actvertnum = 0; actvertnum < actgrafptr->s.vertnbr; actvertnum ++) {
+        Gnum                orgvertnum;
+
+        orgvertnum = actvnumtax[actvertnum + actgrafptr->s.baseval] - orgbaseval;
+        for (dimnnum = 0; dimnnum < dimnnbr; dimnnum ++)
+          geomtab[actvertnum * dimnnbr + dimnnum] = orggeomtab[orgvertnum * dimnnbr + dimnnum];
+      }
+      actgrafptr->s.flagval |= BGRAPHFREEGEOM;
+      actgrafptr->geomtab    = geomtab;
+    }
+  }
+
   flagval = KGRAPHMAPRBVEEXNONE;                  /* Assume no processing */
   if ((! archPart (archptr)) && (actvnumtax != NULL))
     flagval |= KGRAPHMAPRBVEEXMAPP;
@@ -603,7 +633,7 @@ Context * const                         contptr)  /*+ Execution context
     return (0);
 
   if ((veextax = (Gnum *) memAlloc (actgrafptr->s.vertnbr * sizeof (Gnum))) == NULL) {
-    errorPrint ("kgraphMapRbBgraph: out of memory");
+    errorPrint ("kgraphMapRbBgraph: out of memory (2)");
     return (1);
   }
   veextax -= actgrafptr->s.baseval;
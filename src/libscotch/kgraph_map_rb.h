@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2014,2018,2019,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2014,2018,2019,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -64,7 +64,7 @@
 /**                # Version 6.0  : from : 07 aug 2014     **/
 /**                                 to   : 03 aug 2018     **/
 /**                # Version 7.0  : from : 23 aug 2019     **/
-/**                                 to   : 27 jul 2021     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -129,6 +129,8 @@ typedef struct KgraphMapRbData_ {
   double                    comploadrat;          /*+ Ideal load balance per weight unit                       +*/
   double                    comploadmin;          /*+ Minimum vertex load per target load                      +*/
   double                    comploadmax;          /*+ Maximum vertex load per target load                      +*/
+  int                       dimnnbr;              /*+ Geometry dimension, if any                               +*/
+  const double *            geomtab;              /*+ Coordinates of top-level graph vertices, or NULL         +*/
 } KgraphMapRbData;
 
 /*+ Fixed vertex load type. An array of such
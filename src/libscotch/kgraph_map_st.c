@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009-2011,2014,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009-2011,2014,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -194,7 +194,7 @@ static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
                               { KGRAPHMAPSTMETHML,  STRATPARAMCASE,   "type",
                                 (byte *) &kgraphmapstdefaultml.param,
                                 (byte *) &kgraphmapstdefaultml.param.typeval,
-                                (void *) "hscd" },
+                                (void *) "hscdlt" },
                               { KGRAPHMAPSTMETHRB,  STRATPARAMCASE,   "job",
                                 (byte *) &kgraphmapstdefaultrb.param,
                                 (byte *) &kgraphmapstdefaultrb.param.flagjobtie,
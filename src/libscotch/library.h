@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2012,2014-2016,2018-2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2012,2014-2016,2018-2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.1  : from : 05 sep 2020     **/
 /**                                 to   : 01 apr 2021     **/
 /**                # Version 7.0  : from : 25 aug 2019     **/
-/**                                 to   : 10 oct 2021     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -97,7 +97,8 @@ typedef DUMMYINT SCOTCH_Num;
 #ifndef SCOTCH_OPTIONNUMNBR
 #define SCOTCH_OPTIONNUMDETERMINISTIC 0
 #define SCOTCH_OPTIONNUMRANDOMFIXEDSEED 1
-#define SCOTCH_OPTIONNUMNBR         2
+#define SCOTCH_OPTIONNUMCOMPRESS    2
+#define SCOTCH_OPTIONNUMNBR         3
 #endif /* SCOTCH_OPTIONNUMNBR */
 
 /*+ Coarsening flags. +*/
@@ -105,10 +106,18 @@ typedef DUMMYINT SCOTCH_Num;
 #ifndef SCOTCH_COARSENNONE
 #define SCOTCH_COARSENNONE          0x0000
 #define SCOTCH_COARSENFOLD          0x0100
+#define SCOTCH_COARSENHOP           0x0020
 #define SCOTCH_COARSENFOLDDUP       0x0300
 #define SCOTCH_COARSENNOMERGE       0x4000
 #endif /* SCOTCH_COARSENNONE */
 
+/*+ Streaming partitioning flags. +*/
+
+#ifndef SCOTCH_STREAMFENNEL
+#define SCOTCH_STREAMFENNEL         0x0000
+#define SCOTCH_STREAMLDG            0x0001
+#endif /* SCOTCH_STREAMFENNEL */
+
 /*+ Strategy string parametrization values. +*/
 
 #ifndef SCOTCH_STRATDEFAULT
@@ -255,6 +264,8 @@ int                         SCOTCH_graphCheck   (const SCOTCH_Graph * const);
 int                         SCOTCH_graphCoarsen (const SCOTCH_Graph * const, const SCOTCH_Num, const double, const SCOTCH_Num, SCOTCH_Graph * const, SCOTCH_Num * const);
 int                         SCOTCH_graphCoarsenMatch (const SCOTCH_Graph * const, SCOTCH_Num * const, const double, const SCOTCH_Num, SCOTCH_Num * const);
 int                         SCOTCH_graphCoarsenBuild (const SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Num * const, SCOTCH_Graph * const, SCOTCH_Num * const);
+int                         SCOTCH_graphCoarsenHier (SCOTCH_Graph * const, const SCOTCH_Num, const double);
+void                        SCOTCH_graphCoarsenHierFree (SCOTCH_Graph * const);
 int                         SCOTCH_graphColor   (const SCOTCH_Graph * const, SCOTCH_Num * const, SCOTCH_Num * const, const SCOTCH_Num);
 void                        SCOTCH_graphData    (const SCOTCH_Graph * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num ** const, SCOTCH_Num ** const, SCOTCH_Num ** const, SCOTCH_Num ** const, SCOTCH_Num * const, SCOTCH_Num ** const, SCOTCH_Num ** const);
 void                        SCOTCH_graphSize    (const SCOTCH_Graph * const, SCOTCH_Num * const, SCOTCH_Num * const);
@@ -282,7 +293,9 @@ int                         SCOTCH_graphMapFixed (SCOTCH_Graph * const, const SC
 int                         SCOTCH_graphMapView (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, FILE * const);
 int                         SCOTCH_graphPart    (SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphPartFixed (SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Strat * const, SCOTCH_Num * const);
+int                         SCOTCH_graphPartGeom (SCOTCH_Graph * const, const SCOTCH_Geom * const, const SCOTCH_Num, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphPartOvl (SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Strat * const, SCOTCH_Num * const);
+int                         SCOTCH_graphPartStream (FILE * const, FILE * const, const SCOTCH_Num, const double, const SCOTCH_Num);
 int                         SCOTCH_graphPartOvlView (const SCOTCH_Graph * const, const SCOTCH_Num, const SCOTCH_Num * const, FILE * const);
 int                         SCOTCH_graphRemap   (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Num *, const double, const SCOTCH_Num *, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphRemapFixed (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Num *, const double, const SCOTCH_Num *, SCOTCH_Strat * const, SCOTCH_Num * const);
@@ -306,6 +319,7 @@ int                         SCOTCH_graphOrderComputeList (SCOTCH_Graph * const,
 int                         SCOTCH_graphOrder   (SCOTCH_Graph * const, SCOTCH_Strat * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const);
 int                         SCOTCH_graphOrderList (SCOTCH_Graph * const, const SCOTCH_Num, const SCOTCH_Num * const, SCOTCH_Strat * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const);
 int                         SCOTCH_graphOrderCheck (const SCOTCH_Graph * const, const SCOTCH_Ordering * const);
+int                         SCOTCH_graphOrderStat (const SCOTCH_Graph * const, const SCOTCH_Ordering * const, SCOTCH_Num * const, SCOTCH_Num * const, double * const, double * const);
 
 SCOTCH_Mapping *            SCOTCH_mapAlloc     (void);
 int                         SCOTCH_mapSizeof    (void);
@@ -1,4 +1,4 @@
-/* Copyright 2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                library.                                **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -291,7 +291,8 @@ const SCOTCH_Num            optival)
   optitmp = optival;                              /* Set working value */
   o = 0;                                          /* Assume no error   */
 
-  switch (optival) {
+  switch (optinum) {
+    case CONTEXTOPTIONNUMCOMPRESS :
     case CONTEXTOPTIONNUMRANDOMFIXEDSEED :
       if (optitmp != 0)
         optitmp = 1;                              /* Only two values available */
@@ -324,6 +325,8 @@ static ContextOptionArg     contextOptionTab[] = {
   { 'u',  CONTEXTOPTIONNUMDETERMINISTIC,   0 },
   { 'f',  CONTEXTOPTIONNUMRANDOMFIXEDSEED, 1 },
   { 'r',  CONTEXTOPTIONNUMRANDOMFIXEDSEED, 0 },
+  { 'c',  CONTEXTOPTIONNUMCOMPRESS,        1 },
+  { 'n',  CONTEXTOPTIONNUMCOMPRESS,        0 },
   { '\0', -1, -1 } };
 
 int
@@ -1,4 +1,4 @@
-/* Copyright 2007,2012,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2012,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 29 nov 2012     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 20 sep 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -102,3 +102,39 @@ const SCOTCH_Num            flagval)
 
   return (dgraphLoad ((Dgraph * const) CONTEXTOBJECT (grafptr), stream, (Gnum) baseval, srcgrafflag));
 }
+
+/*+ This routine loads the given opaque graph
+*** structure with the data of the centralized
+*** graph file of given name, which is read
+*** concurrently by all processes through MPI-IO.
+*** Every vertex must be described on a line of
+*** its own. The base and flag values have the
+*** same meaning as for SCOTCH_dgraphLoad().
+*** It returns:
+*** - 0   : if the loading succeeded.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_dgraphLoadShared (
+SCOTCH_Dgraph * const       grafptr,
+const char * const          nameptr,
+const SCOTCH_Num            baseval,
+const SCOTCH_Num            flagval)
+{
+  GraphFlag           srcgrafflag;                /* Graph flags */
+
+  if ((baseval < -1) || (baseval > 1)) {
+    errorPrint (STRINGIFY (SCOTCH_dgraphLoadShared) ": invalid base parameter");
+    return     (1);
+  }
+  if ((flagval < 0) || (flagval > 3)) {
+    errorPrint (STRINGIFY (SCOTCH_dgraphLoadShared) ": invalid flag parameter");
+    return     (1);
+  }
+
+  srcgrafflag = (((flagval & 1) != 0) ? GRAPHIONOLOADVERT : 0) +
+                (((flagval & 2) != 0) ? GRAPHIONOLOADEDGE : 0);
+
+  return (dgraphLoadShared ((Dgraph * const) CONTEXTOBJECT (grafptr), nameptr, (Gnum) baseval, srcgrafflag));
+}
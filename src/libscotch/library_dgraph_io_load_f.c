@@ -1,4 +1,4 @@
-/* Copyright 2007,2010,2012,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2010,2012,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 29 nov 2012     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -110,3 +110,32 @@ int * const                 revaptr), \
 
   *revaptr = o;
 }
+
+/* String lengths are passed at the very
+** end of the argument list.
+*/
+
+SCOTCH_FORTRAN (                      \
+DGRAPHLOADSHARED, dgraphloadshared, ( \
+SCOTCH_Dgraph * const       grafptr,  \
+const char * const          string,   \
+const SCOTCH_Num * const    baseval,  \
+const SCOTCH_Num * const    flagval,  \
+int * const                 revaptr,  \
+const int                   strnbr),  \
+(grafptr, string, baseval, flagval, revaptr, strnbr))
+{
+  char * restrict     strtab;                     /* Pointer to null-terminated string */
+
+  if ((strtab = (char *) memAlloc (strnbr + 1)) == NULL) { /* Allocate temporary space */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (DGRAPHLOADSHARED)) ": out of memory");
+    *revaptr = 1;
+    return;
+  }
+  memCpy (strtab, string, strnbr);                /* Copy string contents */
+  strtab[strnbr] = '\0';                          /* Terminate string     */
+
+  *revaptr = SCOTCH_dgraphLoadShared (grafptr, strtab, *baseval, *flagval);
+
+  memFree (strtab);
+}
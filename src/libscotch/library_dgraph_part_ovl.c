@@ -0,0 +1,211 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_dgraph_part_ovl.c               **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the API for the          **/
+/**                distributed graph partitioning          **/
+/**                routines with overlap of the            **/
+/**                libPTSCOTCH library.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "parser.h"
+#include "dgraph.h"
+#include "arch.h"
+#include "wdgraph.h"
+#include "wdgraph_part_st.h"
+#include "ptscotch.h"
+
+/************************************/
+/*                                  */
+/* These routines are the C API for */
+/* distributed graph partitioning   */
+/* with overlap.                    */
+/*                                  */
+/************************************/
+
+/*+ This routine computes a partition with
+*** overlap of the given distributed graph
+*** structure with respect to the given
+*** strategy. Frontier vertices, which
+*** belong to all of their neighboring
+*** parts, are assigned part -1.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_dgraphPartOvl (
+SCOTCH_Dgraph * const       libgrafptr,           /*+ Graph to partition     +*/
+const SCOTCH_Num            partnbr,              /*+ Number of parts        +*/
+SCOTCH_Strat * const        straptr,              /*+ Partitioning strategy  +*/
+SCOTCH_Num * const          partloctab)           /*+ Local partition array  +*/
+{
+  Wdgraph             grafdat;
+  const Strat *       partstraptr;
+  Dgraph *            srcgrafptr;
+  Gnum                vertlocnum;
+  CONTEXTDECL        (libgrafptr);
+  int                 o;
+
+  o = 1;                                          /* Assume an error */
+
+  if (CONTEXTINIT (libgrafptr)) {
+    errorPrint (STRINGIFY (SCOTCH_dgraphPartOvl) ": cannot initialize context");
+    return     (o);
+  }
+
+  srcgrafptr = (Dgraph *) CONTEXTGETOBJECT (libgrafptr);
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  if (dgraphCheck (srcgrafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_dgraphPartOvl) ": invalid input graph");
+    goto abort;
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+  if (*((Strat **) straptr) == NULL)              /* Set default partitioning strategy if necessary */
+    SCOTCH_stratDgraphPartOvlBuild (straptr, SCOTCH_STRATQUALITY, srcgrafptr->procglbnbr, partnbr, 0.05);
+
+  partstraptr = *((Strat **) straptr);
+  if (partstraptr->tabl != &wdgraphpartststratab) {
+    errorPrint (STRINGIFY (SCOTCH_dgraphPartOvl) ": not a distributed graph partitioning with overlap strategy");
+    goto abort;
+  }
+
+  wdgraphInit (&grafdat, srcgrafptr, (Anum) partnbr);
+  grafdat.contptr = CONTEXTGETDATA (libgrafptr);
+
+  if (wdgraphAlloc (&grafdat) != 0) {             /* Allocate ghost and part arrays */
+    errorPrint (STRINGIFY (SCOTCH_dgraphPartOvl) ": out of memory");
+    wdgraphExit (&grafdat);
+    goto abort;
+  }
+
+  if ((o = wdgraphPartSt (&grafdat, partstraptr)) == 0) {
+    for (vertlocnum = 0; vertlocnum < grafdat.s.vertlocnbr; vertlocnum ++)
+      partloctab[vertlocnum] = (SCOTCH_Num) grafdat.partgsttax[vertlocnum + grafdat.s.baseval];
+  }
+
+  wdgraphExit (&grafdat);
+
+abort:
+  CONTEXTEXIT (libgrafptr);
+  return (o);
+}
+
+/*+ This routine parses the given
+*** distributed overlap partitioning
+*** strategy.
+*** It returns:
+*** - 0   : if string successfully scanned.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_stratDgraphPartOvl (
+SCOTCH_Strat * const        straptr,
+const char * const          string)
+{
+  if (*((Strat **) straptr) != NULL)
+    stratExit (*((Strat **) straptr));
+
+  if ((*((Strat **) straptr) = stratInit (&wdgraphpartststratab, string)) == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_stratDgraphPartOvl) ": error in parallel overlap partitioning strategy");
+    return (1);
+  }
+
+  return (0);
+}
+
+/*+ This routine provides predefined
+*** distributed overlap partitioning
+*** strategies.
+*** It returns:
+*** - 0   : if string successfully initialized.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_stratDgraphPartOvlBuild (
+SCOTCH_Strat * const        straptr,              /*+ Strategy to create              +*/
+const SCOTCH_Num            flagval,              /*+ Desired characteristics         +*/
+const SCOTCH_Num            procnbr,              /*+ Number of processes for running +*/
+const SCOTCH_Num            partnbr,              /*+ Number of expected parts        +*/
+const double                balrat)               /*+ Desired imbalance ratio         +*/
+{
+  char                bufftab[8192];              /* Should be enough */
+  char                kbaltab[64];
+  char                verttab[32];
+  char                vseqtab[32];
+  Gnum                vertnbr;
+
+  sprintf (kbaltab, "%lf", balrat);
+
+  vertnbr = MAX (2000 * procnbr, 10000);
+  vertnbr = MIN (vertnbr, 1000000);
+  sprintf (verttab, GNUMSTRING, vertnbr);
+  sprintf (vseqtab, GNUMSTRING, (Gnum) (20 * partnbr));
+
+  strcpy (bufftab, "r{sep=m{vert=<VERT>,asc=b{width=3,strat=q{strat=f}},low=q{strat=h},seq=q{strat=m{vert=120,low=h{pass=10},asc=b{width=3,bnd=f{bal=<KBAL>},org=h{pass=10}f{bal=<KBAL>}}}}},seq=<SEQU>}<THIN>");
+  if ((flagval & SCOTCH_STRATRECURSIVE) != 0)
+    stringSubst (bufftab, "<SEQU>", "<RECU>");    /* Use only the recursive bipartitioning framework */
+  else
+    stringSubst (bufftab, "<SEQU>", "m{vert=<VSEQ>,low=<RECU>,asc=f{bal=<KBAL>}}");
+  stringSubst (bufftab, "<RECU>", "r{sep=m{rat=0.7,vert=100,low=h{pass=10},asc=b{width=3,bnd=f{bal=<KBAL>},org=(|h{pass=10})f{bal=<KBAL>}}}|m{rat=0.7,vert=100,low=h{pass=10},asc=b{width=3,bnd=f{bal=<KBAL>},org=(|h{pass=10})f{bal=<KBAL>}}}}");
+  stringSubst (bufftab, "<THIN>", ((flagval & SCOTCH_STRATSPEED) != 0) ? "" : "t{pass=5}");
+  stringSubst (bufftab, "<VSEQ>", vseqtab);
+  stringSubst (bufftab, "<VERT>", verttab);
+  stringSubst (bufftab, "<KBAL>", kbaltab);
+
+  if (SCOTCH_stratDgraphPartOvl (straptr, bufftab) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_stratDgraphPartOvlBuild) ": error in parallel overlap partitioning strategy");
+    return (1);
+  }
+
+  return (0);
+}
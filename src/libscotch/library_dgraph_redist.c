@@ -1,4 +1,4 @@
-/* Copyright 2012,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 28 mar 2012     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 20 sep 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -81,24 +81,35 @@ const SCOTCH_Num            vertlocdlt,           /* Extra size of local vertex
 const SCOTCH_Num            edgelocdlt,           /* Extra size of local edge array              */
 SCOTCH_Dgraph * const       libredgrafptr)
 {
+  Dgraph *            orggrafptr;
   SCOTCH_Num          baseval;
+  CONTEXTDECL        (liborggrafptr);
+  int                 o;
 
-  Dgraph * const            orggrafptr = (Dgraph *) CONTEXTOBJECT (liborggrafptr);
   Dgraph * const            redgrafptr = (Dgraph *) CONTEXTOBJECT (libredgrafptr);
-#ifdef SCOTCH_DEBUG_LIBRARY1
-  int                 o;
 
+  if (CONTEXTINIT (liborggrafptr)) {
+    errorPrint (STRINGIFY (SCOTCH_dgraphRedist) ": cannot initialize context");
+    return (1);
+  }
+
+  orggrafptr = (Dgraph *) CONTEXTGETOBJECT (liborggrafptr);
+#ifdef SCOTCH_DEBUG_LIBRARY1
   MPI_Comm_compare (orggrafptr->proccomm, redgrafptr->proccomm, &o);
   if ((o != MPI_IDENT) && (o != MPI_CONGRUENT)) {
     errorPrint (STRINGIFY (SCOTCH_dgraphRedist) ": communicators are not congruent");
+    CONTEXTEXIT (liborggrafptr);
     return     (1);
   }
 #endif /* SCOTCH_DEBUG_LIBRARY1 */
 
   baseval = orggrafptr->baseval;
 
-  return (dgraphRedist (orggrafptr,
-                        ((partloctab != NULL) && (partloctab != (SCOTCH_Num *) orggrafptr)) ? (const Gnum * restrict const) (partloctab - baseval) : NULL,
-                        ((permgsttab != NULL) && (permgsttab != (SCOTCH_Num *) orggrafptr)) ? (const Gnum * restrict const) (permgsttab - baseval) : NULL,
-                        (vertlocdlt < 0) ? 0 : vertlocdlt, (edgelocdlt < 0) ? 0 : edgelocdlt, redgrafptr));
+  o = dgraphRedist (orggrafptr,
+                    ((partloctab != NULL) && (partloctab != (SCOTCH_Num *) orggrafptr)) ? (const Gnum * restrict const) (partloctab - baseval) : NULL,
+                    ((permgsttab != NULL) && (permgsttab != (SCOTCH_Num *) orggrafptr)) ? (const Gnum * restrict const) (permgsttab - baseval) : NULL,
+                    (vertlocdlt < 0) ? 0 : vertlocdlt, (edgelocdlt < 0) ? 0 : edgelocdlt, redgrafptr, CONTEXTGETDATA (liborggrafptr));
+
+  CONTEXTEXIT (liborggrafptr);
+  return (o);
 }
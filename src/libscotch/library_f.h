@@ -53,7 +53,7 @@
 !*                # Version 6.1  : from : 22 jun 2021     **
 !*                                 to   : 22 jun 2021     **
 !*                # Version 7.0  : from : 25 aug 2019     **
-!*                                 to   : 23 oct 2021     **
+!*                                 to   : 19 oct 2026     **
 !*                                                        **
 !***********************************************************
 
@@ -69,10 +69,12 @@
 
         INTEGER SCOTCH_OPTIONNUMDETERMINISTIC
         INTEGER SCOTCH_OPTIONNUMRANDOMFIXEDSEED
+        INTEGER SCOTCH_OPTIONNUMCOMPRESS
         INTEGER SCOTCH_OPTIONNUMNBR
         PARAMETER (SCOTCH_OPTIONNUMDETERMINISTIC   = 0)
         PARAMETER (SCOTCH_OPTIONNUMRANDOMFIXEDSEED = 1)
-        PARAMETER (SCOTCH_OPTIONNUMNBR             = 2)
+        PARAMETER (SCOTCH_OPTIONNUMCOMPRESS        = 2)
+        PARAMETER (SCOTCH_OPTIONNUMNBR             = 3)
 
 !* Flag definitions for the coarsening
 !* routines.
@@ -80,12 +82,22 @@
         INTEGER SCOTCH_COARSENNONE
         INTEGER SCOTCH_COARSENFOLD
         INTEGER SCOTCH_COARSENFOLDDUP
+        INTEGER SCOTCH_COARSENHOP
         INTEGER SCOTCH_COARSENNOMERGE
         PARAMETER (SCOTCH_COARSENNONE    = 0)
         PARAMETER (SCOTCH_COARSENFOLD    = 256)
         PARAMETER (SCOTCH_COARSENFOLDDUP = 768)
+        PARAMETER (SCOTCH_COARSENHOP     = 32)
         PARAMETER (SCOTCH_COARSENNOMERGE = 16384)
 
+!* Flag definitions for the streaming
+!* partitioning routine.
+
+        INTEGER SCOTCH_STREAMFENNEL
+        INTEGER SCOTCH_STREAMLDG
+        PARAMETER (SCOTCH_STREAMFENNEL = 0)
+        PARAMETER (SCOTCH_STREAMLDG    = 1)
+
 !* Flag definitions for the strategy
 !* string selection routines.
 
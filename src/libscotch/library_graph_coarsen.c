@@ -1,4 +1,4 @@
-/* Copyright 2011,2012,2014,2015,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2011,2012,2014,2015,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 06 sep 2011     **/
 /**                                 to   : 23 apr 2018     **/
 /**                # Version 7.0  : from : 03 may 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -58,6 +58,7 @@
 #include "arch.h"
 #include "graph.h"
 #include "graph_coarsen.h"
+#include "graph_hier.h"
 #include "scotch.h"
 
 /*********************************/
@@ -102,7 +103,7 @@ SCOTCH_Num * restrict const         coarmulttab)  /* Pointer to multinode array
 
   coarmultptr = (GraphCoarsenMulti *) coarmulttab; /* Indicate multinode array is user-provided */
   o = graphCoarsen ((const Graph * restrict const) CONTEXTGETOBJECT (finegrafptr), (Graph * restrict const) coargrafptr,
-                    NULL, &coarmultptr, coarvertnbr, coarval, flagval & GRAPHCOARSENNOMERGE,
+                    NULL, &coarmultptr, coarvertnbr, coarval, flagval & (GRAPHCOARSENHOP | GRAPHCOARSENNOMERGE),
                     NULL, NULL, 0, CONTEXTGETDATA (finegrafptr));
 
   CONTEXTEXIT (finegrafptr);
@@ -140,7 +141,7 @@ SCOTCH_Num * restrict const             finematetab) /* Mating array to fill
 
   finemateptr = finematetab;                      /* Slot will not be modified but preserve "const" of finematetab */
   o = graphCoarsenMatch ((const Graph * restrict const) CONTEXTGETOBJECT (finegrafptr), &finemateptr,
-                         coarvertptr, coarval, flagval & GRAPHCOARSENNOMERGE,
+                         coarvertptr, coarval, flagval & (GRAPHCOARSENHOP | GRAPHCOARSENNOMERGE),
                          NULL, NULL, 0, CONTEXTGETDATA (finegrafptr));
 
   CONTEXTEXIT (finegrafptr);
@@ -179,3 +180,52 @@ SCOTCH_Num * restrict const         coarmulttab)  /* Pointer to user-provided mu
   CONTEXTEXIT (finegrafptr);
   return (o);
 }
+
+/*+ This routine builds the coarsening hierarchy
+*** of the given graph, and attaches it to the
+*** graph. Graphs are coarsened repeatedly, until
+*** the coarse graph would have fewer than
+*** coarvertnbr vertices, or the coarsening ratio
+*** would be above coarval. Multilevel mapping and
+*** bipartitioning methods using the same ratio
+*** will then use the coarse graphs of the hierarchy
+*** instead of coarsening the graph anew, until the
+*** hierarchy is freed, either explicitly or when
+*** the graph is freed.
+*** It returns:
+*** - 0   : if the hierarchy has been built.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphCoarsenHier (
+SCOTCH_Graph * const        grafptr,              /* Graph to attach hierarchy to      */
+const SCOTCH_Num            coarvertnbr,          /* Minimum number of coarse vertices */
+const double                coarval)              /* Maximum contraction ratio         */
+{
+  CONTEXTDECL        (grafptr);
+  int                 o;
+
+  if (CONTEXTINIT (grafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphCoarsenHier) ": cannot initialize context");
+    return     (1);
+  }
+
+  o = graphHierBuild ((Graph * restrict const) CONTEXTGETOBJECT (grafptr), coarvertnbr, coarval, CONTEXTGETDATA (grafptr));
+
+  CONTEXTEXIT (grafptr);
+  return (o);
+}
+
+/*+ This routine frees the coarsening hierarchy
+*** attached to the given graph, if any.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+SCOTCH_graphCoarsenHierFree (
+SCOTCH_Graph * const        grafptr)
+{
+  graphHierFree ((Graph *) CONTEXTOBJECT (grafptr));
+}
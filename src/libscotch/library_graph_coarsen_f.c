@@ -1,4 +1,4 @@
-/* Copyright 2011,2015,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2011,2015,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 28 feb 2015     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -114,3 +114,30 @@ int * const                 revaptr),    \
 {
   *revaptr = SCOTCH_graphCoarsenBuild (finegrafptr, *coarvertptr, finematetab, coargrafptr, coarmulttab);
 }
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                         \
+GRAPHCOARSENHIER, graphcoarsenhier, (    \
+SCOTCH_Graph * const        grafptr,     \
+const SCOTCH_Num * const    coarvertptr, \
+const double * const        coarval,     \
+int * const                 revaptr),    \
+(grafptr, coarvertptr, coarval, revaptr))
+{
+  *revaptr = SCOTCH_graphCoarsenHier (grafptr, *coarvertptr, *coarval);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                              \
+GRAPHCOARSENHIERFREE, graphcoarsenhierfree, ( \
+SCOTCH_Graph * const        grafptr),         \
+(grafptr))
+{
+  SCOTCH_graphCoarsenHierFree (grafptr);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2012,2014,2018,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2012,2014,2018,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,6 +67,7 @@
 #include "graph.h"
 #include "arch.h"
 #include "arch_dist.h"
+#include "geom.h"
 #include "mapping.h"
 #include "kgraph.h"
 #include "kgraph_map_st.h"
@@ -152,6 +153,7 @@ SCOTCH_Mapping * const      mapoptr,              /*+ Old mapping
 const double                emraval,              /*+ Edge migration ratio                   +*/
 const SCOTCH_Num *          vmlotab,              /*+ Vertex migration cost array            +*/
 const SCOTCH_Num            vfixnbr,              /*+ Number of fixed vertices in part array +*/
+const Geom * const          geomptr,              /*+ Vertex coordinates, or NULL            +*/
 SCOTCH_Strat * const        straptr)              /*+ Mapping strategy                       +*/
 {
   Kgraph              mapgrafdat;                 /* Effective mapping graph              */
@@ -282,6 +284,10 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
     }
   }
 
+  if ((geomptr != NULL) && (geomptr->geomtab != NULL)) { /* If geometry provided, share it with mapping graph */
+    mapgrafdat.dimnnbr = geomptr->dimnnbr;
+    mapgrafdat.geomtab = geomptr->geomtab;
+  }
   mapgrafdat.contptr = CONTEXTGETDATA (actgrafptr);
 
   o = kgraphMapSt (&mapgrafdat, mapstraptr);
@@ -308,7 +314,7 @@ SCOTCH_Graph * const        grafptr,              /*+ Graph to order     +*/
 SCOTCH_Mapping * const      mappptr,              /*+ Mapping to compute +*/
 SCOTCH_Strat * const        straptr)              /*+ Mapping strategy   +*/
 {
-  return (graphMapCompute2 (grafptr, mappptr, NULL, 1, NULL, 0, straptr));
+  return (graphMapCompute2 (grafptr, mappptr, NULL, 1, NULL, 0, NULL, straptr));
 }
 
 /*+ This routine computes a mapping
@@ -346,7 +352,7 @@ const double                emraval,              /*+ Edge migration ratio
 const SCOTCH_Num *          vmlotab,              /*+ Vertex migration cost array +*/
 SCOTCH_Strat * const        straptr)              /*+ Mapping strategy            +*/
 {
-  return (graphMapCompute2 (grafptr, mappptr, mapoptr, emraval, vmlotab, 0, straptr));
+  return (graphMapCompute2 (grafptr, mappptr, mapoptr, emraval, vmlotab, 0, NULL, straptr));
 }
 
 /*+ This routine computes a remapping
@@ -379,7 +385,7 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
       vfixnbr ++;
   }
 
-  return (graphMapCompute2 (grafptr, mappptr, mapoptr, emraval, vmlotab, vfixnbr, straptr));
+  return (graphMapCompute2 (grafptr, mappptr, mapoptr, emraval, vmlotab, vfixnbr, NULL, straptr));
 }
 
 /*+ This routine computes a mapping of the
@@ -526,6 +532,70 @@ SCOTCH_Num * const          parttab)              /*+ Partition array  +*/
   return (o);
 }
 
+/*+ This routine computes a partition of
+*** the given graph structure with respect
+*** to the given strategy, making the given
+*** vertex coordinates available to the
+*** geometric bipartitioning method. When
+*** no strategy is provided, a default
+*** multilevel strategy using inertial
+*** bisection on the coarsest graphs is used.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphPartGeom (
+SCOTCH_Graph * const        grafptr,              /*+ Graph to map       +*/
+const SCOTCH_Geom * const   geomptr,              /*+ Vertex coordinates +*/
+const SCOTCH_Num            partnbr,              /*+ Number of parts    +*/
+SCOTCH_Strat * const        straptr,              /*+ Mapping strategy   +*/
+SCOTCH_Num * const          parttab)              /*+ Partition array    +*/
+{
+  SCOTCH_Arch         archdat;
+  SCOTCH_Mapping      mappdat;
+  SCOTCH_Num          vertnbr;
+  int                 o;
+
+  if (((const Geom *) geomptr)->geomtab == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartGeom) ": geometry not available");
+    return (1);
+  }
+  SCOTCH_graphSize (grafptr, &vertnbr, NULL);
+  if (((const Geom *) geomptr)->vertnbr != vertnbr) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartGeom) ": geometry does not match graph");
+    return (1);
+  }
+
+  if (*((Strat **) straptr) == NULL) {            /* Set default geometric strategy if necessary */
+    char                bufftab[8192];
+    char                kbaltab[64];
+    char                mvrttab[64];
+
+    sprintf (kbaltab, "%lf", 0.01);
+    sprintf (mvrttab, GNUMSTRING, (Gnum) (MAX ((20 * partnbr), 10000)));
+    strcpy  (bufftab, "m{vert=<MVRT>,low=r{job=t,map=t,poli=S,bal=<KBAL>,sep=<BSEP>},asc=b{bnd=d{pass=40}f{bal=<KBAL>,move=80},org=f{bal=<KBAL>,move=80}}}");
+    stringSubst (bufftab, "<BSEP>", "m{vert=120,low=c{type=i}f{bal=<KBAL>,move=120},asc=b{bnd=f{bal=<KBAL>,move=120},org=f{bal=<KBAL>,move=120}}}");
+    stringSubst (bufftab, "<MVRT>", mvrttab);
+    stringSubst (bufftab, "<KBAL>", kbaltab);
+
+    if (SCOTCH_stratGraphMap (straptr, bufftab) != 0) {
+      errorPrint (STRINGIFY (SCOTCH_graphPartGeom) ": error in geometric mapping strategy");
+      return (1);
+    }
+  }
+
+  SCOTCH_archInit  (&archdat);
+  SCOTCH_archCmplt (&archdat, partnbr);
+  SCOTCH_graphMapInit (grafptr, &mappdat, &archdat, parttab);
+  o = graphMapCompute2 (grafptr, &mappdat, NULL, 1, NULL, 0, (const Geom *) geomptr, straptr);
+  SCOTCH_graphMapExit (grafptr, &mappdat);
+  SCOTCH_archExit (&archdat);
+
+  return (o);
+}
+
 /*+ This routine computes a partition of
 *** the given graph structure with respect
 *** to the given strategy and the fixed
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010-2012,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010-2012,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 17 apr 2011     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -270,6 +270,23 @@ int * const                 revaptr), \
 **
 */
 
+SCOTCH_FORTRAN (                      \
+GRAPHPARTGEOM, graphpartgeom, (       \
+SCOTCH_Graph * const        grafptr,  \
+const SCOTCH_Geom * const   geomptr,  \
+const SCOTCH_Num * const    partptr,  \
+SCOTCH_Strat * const        straptr,  \
+SCOTCH_Num * const          parttab,  \
+int * const                 revaptr), \
+(grafptr, geomptr, partptr, straptr, parttab, revaptr))
+{
+  *revaptr = SCOTCH_graphPartGeom (grafptr, geomptr, *partptr, straptr, parttab);
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                      \
 GRAPHREPART, graphrepart, (           \
 SCOTCH_Graph * const        grafptr,  \
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2012-2014,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2012-2014,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 08 jan 2012     **/
 /**                                 to   : 29 sep 2019     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,6 +66,7 @@
 #include "parser.h"
 #include "graph.h"
 #include "order.h"
+#include "order_stat.h"
 #include "hgraph.h"
 #include "hgraph_order_st.h"
 #include "library_order.h"
@@ -464,6 +465,57 @@ const SCOTCH_Ordering * const ordeptr)            /*+ Ordering to check +*/
   return (orderCheck (&((LibOrder *) ordeptr)->o));
 }
 
+/*+ This routine computes the elimination
+*** tree and the column counts of the factored
+*** matrix associated with the given graph
+*** ordering, as well as its number of non-zeroes
+*** and operation count, without performing the
+*** symbolic factorization. Any of the output
+*** arrays and pointers may be NULL.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphOrderStat (
+const SCOTCH_Graph * const    libgrafptr,
+const SCOTCH_Ordering * const ordeptr,            /*+ Ordering to analyze               +*/
+SCOTCH_Num * const            fathtab,            /*+ Elimination tree father array     +*/
+SCOTCH_Num * const            ccnttab,            /*+ Column count array                +*/
+double * const                fnnzptr,            /*+ Number of non-zeroes of factor    +*/
+double * const                fopcptr)            /*+ Operation count of factorization  +*/
+{
+  Gnum *              worktab;                    /* Work array for unrequested results */
+  Gnum *              fathtmp;
+  Gnum *              ccnttmp;
+  int                 o;
+
+  const Graph * restrict const  grafptr = (Graph *) CONTEXTOBJECT (libgrafptr);
+  const LibOrder * const        libordeptr = (const LibOrder *) ordeptr;
+
+  worktab = NULL;
+  fathtmp = fathtab;
+  ccnttmp = ccnttab;
+  if ((fathtab == NULL) || (ccnttab == NULL)) {
+    if ((worktab = (Gnum *) memAlloc ((2 * grafptr->vertnbr + 1) * sizeof (Gnum))) == NULL) {
+      errorPrint (STRINGIFY (SCOTCH_graphOrderStat) ": out of memory");
+      return (1);
+    }
+    if (fathtmp == NULL)
+      fathtmp = worktab;
+    if (ccnttmp == NULL)
+      ccnttmp = worktab + grafptr->vertnbr;
+  }
+
+  o = orderStat (&libordeptr->o, grafptr, fathtmp - grafptr->baseval, ccnttmp - grafptr->baseval, fnnzptr, fopcptr);
+
+  if (worktab != NULL)
+    memFree (worktab);
+
+  return (o);
+}
+
 /*+ This routine parses the given
 *** graph ordering strategy.
 *** It returns:
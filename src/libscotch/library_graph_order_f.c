@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2012,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2012,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.0  : from : 08 jan 2012     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -301,6 +301,24 @@ int * const                   revaptr), \
 **
 */
 
+SCOTCH_FORTRAN (                        \
+GRAPHORDERSTAT, graphorderstat, (       \
+const SCOTCH_Graph * const    grafptr,  \
+const SCOTCH_Ordering * const ordeptr,  \
+SCOTCH_Num * const            fathtab,  \
+SCOTCH_Num * const            ccnttab,  \
+double * const                fnnzptr,  \
+double * const                fopcptr,  \
+int * const                   revaptr), \
+(grafptr, ordeptr, fathtab, ccnttab, fnnzptr, fopcptr, revaptr))
+{
+  *revaptr = SCOTCH_graphOrderStat (grafptr, ordeptr, fathtab, ccnttab, fnnzptr, fopcptr);
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                     \
 STRATGRAPHORDER, stratgraphorder, (  \
 SCOTCH_Strat * const        straptr, \
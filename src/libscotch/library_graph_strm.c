@@ -0,0 +1,95 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_strm.c                    **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the API for the one-pass **/
+/**                streaming graph partitioning routine of **/
+/**                the libSCOTCH library.                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "arch.h"
+#include "graph.h"
+#include "graph_strm.h"
+#include "scotch.h"
+
+/************************************/
+/*                                  */
+/* These routines are the C API for */
+/* streaming graph partitioning.    */
+/*                                  */
+/************************************/
+
+/*+ This routine partitions the graph read
+*** from the given input stream in a single
+*** pass, and writes the resulting mapping
+*** to the given output stream, in the format
+*** read by SCOTCH_graphTabLoad().
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphPartStream (
+FILE * const                instream,             /*+ Graph input stream    +*/
+FILE * const                outstream,            /*+ Mapping output stream +*/
+const SCOTCH_Num            partnbr,              /*+ Number of parts       +*/
+const double                kbalval,              /*+ Imbalance ratio       +*/
+const SCOTCH_Num            flagval)              /*+ Scoring method        +*/
+{
+  if ((flagval != SCOTCH_STREAMFENNEL) &&
+      (flagval != SCOTCH_STREAMLDG)) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartStream) ": invalid flag value");
+    return     (1);
+  }
+  if (kbalval < 0.0) {
+    errorPrint (STRINGIFY (SCOTCH_graphPartStream) ": invalid imbalance ratio");
+    return     (1);
+  }
+
+  return (graphStrmPart (instream, outstream, (Anum) partnbr, kbalval,
+                         (flagval == SCOTCH_STREAMLDG) ? GRAPHSTRMLDG : GRAPHSTRMFENNEL));
+}
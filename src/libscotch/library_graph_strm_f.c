@@ -0,0 +1,116 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_strm_f.c                  **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the Fortran API for the  **/
+/**                one-pass streaming graph partitioning   **/
+/**                routine of the libSCOTCH library.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "scotch.h"
+
+/**************************************/
+/*                                    */
+/* These routines are the Fortran API */
+/* for the streaming partitioning     */
+/* routines.                          */
+/*                                    */
+/**************************************/
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                        \
+GRAPHPARTSTREAM, graphpartstream, (     \
+int * const                 infileptr,  \
+int * const                 oufileptr,  \
+const SCOTCH_Num * const    partptr,    \
+const double * const        kbalptr,    \
+const SCOTCH_Num * const    flagptr,    \
+int * const                 revaptr),   \
+(infileptr, oufileptr, partptr, kbalptr, flagptr, revaptr))
+{
+  FILE *              instream;                   /* Streams to build from handles */
+  FILE *              oustream;
+  int                 infilenum;                  /* Duplicated handles            */
+  int                 oufilenum;
+  int                 o;
+
+  if ((infilenum = dup (*infileptr)) < 0) {       /* If cannot duplicate file descriptor */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (GRAPHPARTSTREAM)) ": cannot duplicate handle (1)");
+    *revaptr = 1;                                 /* Indicate error */
+    return;
+  }
+  if ((oufilenum = dup (*oufileptr)) < 0) {
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (GRAPHPARTSTREAM)) ": cannot duplicate handle (2)");
+    close      (infilenum);
+    *revaptr = 1;
+    return;
+  }
+  if ((instream = fdopen (infilenum, "r")) == NULL) { /* Build streams from handles */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (GRAPHPARTSTREAM)) ": cannot open input stream");
+    close      (infilenum);
+    close      (oufilenum);
+    *revaptr = 1;
+    return;
+  }
+  if ((oustream = fdopen (oufilenum, "w")) == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (GRAPHPARTSTREAM)) ": cannot open output stream");
+    fclose     (instream);
+    close      (oufilenum);
+    *revaptr = 1;
+    return;
+  }
+  setbuf (instream, NULL);                        /* Do not buffer on input */
+
+  o = SCOTCH_graphPartStream (instream, oustream, *partptr, *kbalptr, *flagptr);
+
+  fclose (instream);                              /* This closes file descriptors too */
+  fclose (oustream);
+
+  *revaptr = o;
+}
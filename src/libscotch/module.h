@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2016,2018-2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2016,2018-2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 24 aug 2020     **/
 /**                                 to   : 30 dec 2021     **/
 /**                # Version 7.0  : from : 02 mar 2018     **/
-/**                                 to   : 03 feb 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -175,6 +175,7 @@
 #define SCOTCH_DEBUG_VDGRAPH2
 #define SCOTCH_DEBUG_VGRAPH2
 #define SCOTCH_DEBUG_VMESH2
+#define SCOTCH_DEBUG_WDGRAPH2
 #define SCOTCH_DEBUG_WGRAPH2
 #endif /* SCOTCH_DEBUG_ALL */
 
@@ -205,6 +206,7 @@
 #define SCOTCH_DEBUG_VDGRAPH1
 #define SCOTCH_DEBUG_VGRAPH1
 #define SCOTCH_DEBUG_VMESH1
+#define SCOTCH_DEBUG_WDGRAPH1
 #define SCOTCH_DEBUG_WGRAPH1
 #endif /* SCOTCH_DEBUG */
 
@@ -257,7 +259,10 @@
 #define SCOTCH_COARSENNONE          SCOTCH_NAME_PUBLIC (SCOTCH_COARSENNONE)
 #define SCOTCH_COARSENFOLD          SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLD)
 #define SCOTCH_COARSENFOLDDUP       SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLDDUP)
+#define SCOTCH_COARSENHOP           SCOTCH_NAME_PUBLIC (SCOTCH_COARSENHOP)
 #define SCOTCH_COARSENNOMERGE       SCOTCH_NAME_PUBLIC (SCOTCH_COARSENNOMERGE)
+#define SCOTCH_STREAMFENNEL         SCOTCH_NAME_PUBLIC (SCOTCH_STREAMFENNEL)
+#define SCOTCH_STREAMLDG            SCOTCH_NAME_PUBLIC (SCOTCH_STREAMLDG)
 #define SCOTCH_STRATDEFAULT         SCOTCH_NAME_PUBLIC (SCOTCH_STRATDEFAULT)
 #define SCOTCH_STRATQUALITY         SCOTCH_NAME_PUBLIC (SCOTCH_STRATQUALITY)
 #define SCOTCH_STRATSPEED           SCOTCH_NAME_PUBLIC (SCOTCH_STRATSPEED)
@@ -300,6 +305,8 @@
 #define contextExit                 SCOTCH_NAME_INTERN (contextExit)
 #define contextInit                 SCOTCH_NAME_INTERN (contextInit)
 #define contextRandomClone          SCOTCH_NAME_INTERN (contextRandomClone)
+#define contextThreadClone          SCOTCH_NAME_INTERN (contextThreadClone)
+#define contextThreadCloneExit      SCOTCH_NAME_INTERN (contextThreadCloneExit)
 #define contextThreadInit           SCOTCH_NAME_INTERN (contextThreadInit)
 #define contextThreadInit2          SCOTCH_NAME_INTERN (contextThreadInit2)
 #define contextThreadLaunchSplit    SCOTCH_NAME_INTERN (contextThreadLaunchSplit)
@@ -368,6 +375,7 @@
 #define threadContextNbr            SCOTCH_NAME_INTERN (threadContextNbr)
 #define threadContextParam          SCOTCH_NAME_INTERN (threadContextParam)
 
+#define threadSystemCoreAff         SCOTCH_NAME_INTERN (threadSystemCoreAff)
 #define threadSystemCoreNbr         SCOTCH_NAME_INTERN (threadSystemCoreNbr)
 
 #define usagePrint                  SCOTCH_NAME_INTERN (usagePrint)
@@ -688,6 +696,7 @@
 #define bgraphSwal                  SCOTCH_NAME_INTERN (bgraphSwal)
 #define bgraphZero                  SCOTCH_NAME_INTERN (bgraphZero)
 #define bgraphBipartBd              SCOTCH_NAME_INTERN (bgraphBipartBd)
+#define bgraphBipartCo              SCOTCH_NAME_INTERN (bgraphBipartCo)
 #define bgraphBipartDf              SCOTCH_NAME_INTERN (bgraphBipartDf)
 #define bgraphBipartDf2             SCOTCH_NAME_INTERN (bgraphBipartDf2)
 #define bgraphBipartDfJoin          SCOTCH_NAME_INTERN (bgraphBipartDfJoin)
@@ -708,6 +717,12 @@
 #define commGatherv                 SCOTCH_NAME_INTERN (commGatherv)
 #define commScatterv                SCOTCH_NAME_INTERN (commScatterv)
 #endif /* ((defined INTSIZE64) || (defined SCOTCH_COMM)) */
+#define commDecode                  SCOTCH_NAME_INTERN (commDecode)
+#define commEncode                  SCOTCH_NAME_INTERN (commEncode)
+#define commNodeData                SCOTCH_NAME_INTERN (commNodeData)
+#define commRecvChunk               SCOTCH_NAME_INTERN (commRecvChunk)
+#define commSendChunk               SCOTCH_NAME_INTERN (commSendChunk)
+#define commGathervChunk            SCOTCH_NAME_INTERN (commGathervChunk)
 
 #define contextOptionsInit          SCOTCH_NAME_INTERN (contextOptionsInit)
 
@@ -749,17 +764,25 @@
 #define dgraphInduce2               SCOTCH_NAME_INTERN (dgraphInduce2)
 #define dgraphInit                  SCOTCH_NAME_INTERN (dgraphInit)
 #define dgraphLoad                  SCOTCH_NAME_INTERN (dgraphLoad)
+#define dgraphLoadShared            SCOTCH_NAME_INTERN (dgraphLoadShared)
 #define dgraphMatchInit             SCOTCH_NAME_INTERN (dgraphMatchInit)
 #define dgraphMatchExit             SCOTCH_NAME_INTERN (dgraphMatchExit)
 #define dgraphMatchSync             SCOTCH_NAME_INTERN (dgraphMatchSync)
 #define dgraphMatchSyncColl         SCOTCH_NAME_INTERN (dgraphMatchSyncColl)
 #define dgraphMatchSyncPtop         SCOTCH_NAME_INTERN (dgraphMatchSyncPtop)
+#define dgraphMatchSyncSlice        SCOTCH_NAME_INTERN (dgraphMatchSyncSlice)
 #define dgraphMatchCheck            SCOTCH_NAME_INTERN (dgraphMatchCheck)
 #define dgraphMatchHl               SCOTCH_NAME_INTERN (dgraphMatchHl)
 #define dgraphMatchHy               SCOTCH_NAME_INTERN (dgraphMatchHy)
 #define dgraphMatchLc               SCOTCH_NAME_INTERN (dgraphMatchLc)
 #define dgraphMatchLy               SCOTCH_NAME_INTERN (dgraphMatchLy)
 #define dgraphMatchSc               SCOTCH_NAME_INTERN (dgraphMatchSc)
+#define dgraphNgbAlltoall           SCOTCH_NAME_INTERN (dgraphNgbAlltoall)
+#define dgraphNgbAlltoallv          SCOTCH_NAME_INTERN (dgraphNgbAlltoallv)
+#define dgraphNgbComm               SCOTCH_NAME_INTERN (dgraphNgbComm)
+#define dgraphNgbFree               SCOTCH_NAME_INTERN (dgraphNgbFree)
+#define dgraphNgbIalltoallv         SCOTCH_NAME_INTERN (dgraphNgbIalltoallv)
+#define dgraphNodeData              SCOTCH_NAME_INTERN (dgraphNodeData)
 #define dgraphRedist                SCOTCH_NAME_INTERN (dgraphRedist)
 #define dgraphSave                  SCOTCH_NAME_INTERN (dgraphSave)
 #define dgraphScatter               SCOTCH_NAME_INTERN (dgraphScatter)
@@ -768,6 +791,7 @@
 #define dmapInit                    SCOTCH_NAME_INTERN (dmapInit)
 #define dmapExit                    SCOTCH_NAME_INTERN (dmapExit)
 #define dmapAdd                     SCOTCH_NAME_INTERN (dmapAdd)
+#define dmapAddTerm                 SCOTCH_NAME_INTERN (dmapAddTerm)
 #define dmapTerm                    SCOTCH_NAME_INTERN (dmapTerm)
 #define dmapSave                    SCOTCH_NAME_INTERN (dmapSave)
 
@@ -821,19 +845,28 @@
 #define graphFree                   SCOTCH_NAME_INTERN (graphFree)
 #define graphLoad                   SCOTCH_NAME_INTERN (graphLoad)
 #define graphLoad2                  SCOTCH_NAME_INTERN (graphLoad2)
+#define graphLoadHead               SCOTCH_NAME_INTERN (graphLoadHead)
 #define graphSave                   SCOTCH_NAME_INTERN (graphSave)
 #define graphBand                   SCOTCH_NAME_INTERN (graphBand)
 #define graphBase                   SCOTCH_NAME_INTERN (graphBase)
 #define graphCheck                  SCOTCH_NAME_INTERN (graphCheck)
 #define graphClone                  SCOTCH_NAME_INTERN (graphClone)
+#define graphClus                   SCOTCH_NAME_INTERN (graphClus)
+#define graphClusExit               SCOTCH_NAME_INTERN (graphClusExit)
+#define graphClusInit               SCOTCH_NAME_INTERN (graphClusInit)
+#define graphClusList               SCOTCH_NAME_INTERN (graphClusList)
 #define graphCoarsen                SCOTCH_NAME_INTERN (graphCoarsen)
 #define graphCoarsenBuild           SCOTCH_NAME_INTERN (graphCoarsenBuild)
+#define graphCoarsenGeom            SCOTCH_NAME_INTERN (graphCoarsenGeom)
 #define graphCoarsenMatch           SCOTCH_NAME_INTERN (graphCoarsenMatch)
 #define graphDiamPV                 SCOTCH_NAME_INTERN (graphDiamPV)
 #define graphDump                   SCOTCH_NAME_INTERN (graphDump)
 #define graphDump2                  SCOTCH_NAME_INTERN (graphDump2)
 #define graphDumpArray              SCOTCH_NAME_INTERN (graphDumpArray)
 #define graphDumpArrays             SCOTCH_NAME_INTERN (graphDumpArrays)
+#define graphHierBuild              SCOTCH_NAME_INTERN (graphHierBuild)
+#define graphHierFree               SCOTCH_NAME_INTERN (graphHierFree)
+#define graphHierLevl               SCOTCH_NAME_INTERN (graphHierLevl)
 #define graphIelo                   SCOTCH_NAME_INTERN (graphIelo)
 #define graphInduceList             SCOTCH_NAME_INTERN (graphInduceList)
 #define graphInducePart             SCOTCH_NAME_INTERN (graphInducePart)
@@ -848,9 +881,12 @@
 #define graphGeomSaveScot           SCOTCH_NAME_INTERN (graphGeomSaveScot)
 #define graphGeomSaveMmkt           SCOTCH_NAME_INTERN (graphGeomSaveMmkt)
 #define graphPtscotch               SCOTCH_NAME_INTERN (graphPtscotch)
+#define graphStrmPart               SCOTCH_NAME_INTERN (graphStrmPart)
 
 #define hallOrderHdR2Halmd          SCOTCH_NAME_INTERN (hallOrderHdR2Halmd)
 #define hallOrderHfR3Hamdf4         SCOTCH_NAME_INTERN (hallOrderHfR3Hamdf4)
+#define hallOrderHnHamd             SCOTCH_NAME_INTERN (hallOrderHnHamd)
+#define hallOrderHpHamd             SCOTCH_NAME_INTERN (hallOrderHpHamd)
 #define hallOrderHxBuild            SCOTCH_NAME_INTERN (hallOrderHxBuild)
 #define hallOrderHxTree             SCOTCH_NAME_INTERN (hallOrderHxTree)
 
@@ -862,6 +898,7 @@
 #define hdgraphFold2                SCOTCH_NAME_INTERN (hdgraphFold2)
 #define hdgraphGather               SCOTCH_NAME_INTERN (hdgraphGather)
 #define hdgraphInduceList           SCOTCH_NAME_INTERN (hdgraphInduceList)
+#define hdgraphOrderCp              SCOTCH_NAME_INTERN (hdgraphOrderCp)
 #define hdgraphOrderNd              SCOTCH_NAME_INTERN (hdgraphOrderNd)
 #define hdgraphOrderNd2             SCOTCH_NAME_INTERN (hdgraphOrderNd2)
 #define hdgraphOrderSi              SCOTCH_NAME_INTERN (hdgraphOrderSi)
@@ -876,12 +913,14 @@
 #define hgraphInduceList            SCOTCH_NAME_INTERN (hgraphInduceList)
 #define hgraphCheck                 SCOTCH_NAME_INTERN (hgraphCheck)
 #define hgraphDump                  SCOTCH_NAME_INTERN (hgraphDump)
+#define hgraphOrderAm               SCOTCH_NAME_INTERN (hgraphOrderAm)
 #define hgraphOrderBl               SCOTCH_NAME_INTERN (hgraphOrderBl)
 #define hgraphOrderCc               SCOTCH_NAME_INTERN (hgraphOrderCc)
 #define hgraphOrderCp               SCOTCH_NAME_INTERN (hgraphOrderCp)
 #define hgraphOrderGp               SCOTCH_NAME_INTERN (hgraphOrderGp)
 #define hgraphOrderHd               SCOTCH_NAME_INTERN (hgraphOrderHd)
 #define hgraphOrderHf               SCOTCH_NAME_INTERN (hgraphOrderHf)
+#define hgraphOrderHp               SCOTCH_NAME_INTERN (hgraphOrderHp)
 #define hgraphOrderHxFill           SCOTCH_NAME_INTERN (hgraphOrderHxFill)
 #define hgraphOrderKp               SCOTCH_NAME_INTERN (hgraphOrderKp)
 #define hgraphOrderNd               SCOTCH_NAME_INTERN (hgraphOrderNd)
@@ -902,6 +941,7 @@
 #define hmeshOrderGr                SCOTCH_NAME_INTERN (hmeshOrderGr)
 #define hmeshOrderHd                SCOTCH_NAME_INTERN (hmeshOrderHd)
 #define hmeshOrderHf                SCOTCH_NAME_INTERN (hmeshOrderHf)
+#define hmeshOrderHp                SCOTCH_NAME_INTERN (hmeshOrderHp)
 #define hmeshOrderHxFill            SCOTCH_NAME_INTERN (hmeshOrderHxFill)
 #define hmeshOrderNd                SCOTCH_NAME_INTERN (hmeshOrderNd)
 #define hmeshOrderSi                SCOTCH_NAME_INTERN (hmeshOrderSi)
@@ -911,6 +951,8 @@
 #define kdgraphInit                 SCOTCH_NAME_INTERN (kdgraphInit)
 #define kdgraphExit                 SCOTCH_NAME_INTERN (kdgraphExit)
 #define kdgraphGather               SCOTCH_NAME_INTERN (kdgraphGather)
+#define kdgraphMapLp                SCOTCH_NAME_INTERN (kdgraphMapLp)
+#define kdgraphMapMl                SCOTCH_NAME_INTERN (kdgraphMapMl)
 #define kdgraphMapRb                SCOTCH_NAME_INTERN (kdgraphMapRb)
 #define kdgraphMapRbAdd2            SCOTCH_NAME_INTERN (kdgraphMapRbAdd2)
 #define kdgraphMapRbAddBoth         SCOTCH_NAME_INTERN (kdgraphMapRbAddBoth)
@@ -997,6 +1039,7 @@
 #define orderCheck                  SCOTCH_NAME_INTERN (orderCheck)
 #define orderPeri                   SCOTCH_NAME_INTERN (orderPeri)
 #define orderRang                   SCOTCH_NAME_INTERN (orderRang)
+#define orderStat                   SCOTCH_NAME_INTERN (orderStat)
 #define orderTree                   SCOTCH_NAME_INTERN (orderTree)
 
 #define parserLocationUpdate        SCOTCH_NAME_INTERN (parserLocationUpdate)
@@ -1080,6 +1123,16 @@
 #define vmeshStoreSave              SCOTCH_NAME_INTERN (vmeshStoreSave)
 #define vmeshStoreUpdt              SCOTCH_NAME_INTERN (vmeshStoreUpdt)
 
+#define wdgraphpartststratab        SCOTCH_NAME_INTERN (wdgraphpartststratab)
+#define wdgraphAlloc                SCOTCH_NAME_INTERN (wdgraphAlloc)
+#define wdgraphCheck                SCOTCH_NAME_INTERN (wdgraphCheck)
+#define wdgraphCost                 SCOTCH_NAME_INTERN (wdgraphCost)
+#define wdgraphExit                 SCOTCH_NAME_INTERN (wdgraphExit)
+#define wdgraphInit                 SCOTCH_NAME_INTERN (wdgraphInit)
+#define wdgraphPartRb               SCOTCH_NAME_INTERN (wdgraphPartRb)
+#define wdgraphPartSt               SCOTCH_NAME_INTERN (wdgraphPartSt)
+#define wdgraphPartTh               SCOTCH_NAME_INTERN (wdgraphPartTh)
+
 #define wgraphpartststratab         SCOTCH_NAME_INTERN (wgraphpartststratab)
 #define wgraphAlloc                 SCOTCH_NAME_INTERN (wgraphAlloc)
 #define wgraphInit                  SCOTCH_NAME_INTERN (wgraphInit)
@@ -1151,6 +1204,7 @@
 #define SCOTCH_dgraphInducePart     SCOTCH_NAME_PUBLIC (SCOTCH_dgraphInducePart)
 #define SCOTCH_dgraphInit           SCOTCH_NAME_PUBLIC (SCOTCH_dgraphInit)
 #define SCOTCH_dgraphLoad           SCOTCH_NAME_PUBLIC (SCOTCH_dgraphLoad)
+#define SCOTCH_dgraphLoadShared     SCOTCH_NAME_PUBLIC (SCOTCH_dgraphLoadShared)
 #define SCOTCH_dgraphMap            SCOTCH_NAME_PUBLIC (SCOTCH_dgraphMap)
 #define SCOTCH_dgraphMapCompute     SCOTCH_NAME_PUBLIC (SCOTCH_dgraphMapCompute)
 #define SCOTCH_dgraphMapExit        SCOTCH_NAME_PUBLIC (SCOTCH_dgraphMapExit)
@@ -1170,6 +1224,7 @@
 #define SCOTCH_dgraphOrderSaveTree  SCOTCH_NAME_PUBLIC (SCOTCH_dgraphOrderSaveTree)
 #define SCOTCH_dgraphOrderTreeDist  SCOTCH_NAME_PUBLIC (SCOTCH_dgraphOrderTreeDist)
 #define SCOTCH_dgraphPart           SCOTCH_NAME_PUBLIC (SCOTCH_dgraphPart)
+#define SCOTCH_dgraphPartOvl        SCOTCH_NAME_PUBLIC (SCOTCH_dgraphPartOvl)
 #define SCOTCH_dgraphRedist         SCOTCH_NAME_PUBLIC (SCOTCH_dgraphRedist)
 #define SCOTCH_dgraphSave           SCOTCH_NAME_PUBLIC (SCOTCH_dgraphSave)
 #define SCOTCH_dgraphSizeof         SCOTCH_NAME_PUBLIC (SCOTCH_dgraphSizeof)
@@ -1191,6 +1246,8 @@
 #define SCOTCH_graphCheck           SCOTCH_NAME_PUBLIC (SCOTCH_graphCheck)
 #define SCOTCH_graphCoarsen         SCOTCH_NAME_PUBLIC (SCOTCH_graphCoarsen)
 #define SCOTCH_graphCoarsenBuild    SCOTCH_NAME_PUBLIC (SCOTCH_graphCoarsenBuild)
+#define SCOTCH_graphCoarsenHier     SCOTCH_NAME_PUBLIC (SCOTCH_graphCoarsenHier)
+#define SCOTCH_graphCoarsenHierFree SCOTCH_NAME_PUBLIC (SCOTCH_graphCoarsenHierFree)
 #define SCOTCH_graphCoarsenMatch    SCOTCH_NAME_PUBLIC (SCOTCH_graphCoarsenMatch)
 #define SCOTCH_graphColor           SCOTCH_NAME_PUBLIC (SCOTCH_graphColor)
 #define SCOTCH_graphData            SCOTCH_NAME_PUBLIC (SCOTCH_graphData)
@@ -1229,9 +1286,12 @@
 #define SCOTCH_graphOrderSave       SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderSave)
 #define SCOTCH_graphOrderSaveMap    SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderSaveMap)
 #define SCOTCH_graphOrderSaveTree   SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderSaveTree)
+#define SCOTCH_graphOrderStat       SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderStat)
 #define SCOTCH_graphPart            SCOTCH_NAME_PUBLIC (SCOTCH_graphPart)
 #define SCOTCH_graphPartFixed       SCOTCH_NAME_PUBLIC (SCOTCH_graphPartFixed)
+#define SCOTCH_graphPartGeom        SCOTCH_NAME_PUBLIC (SCOTCH_graphPartGeom)
 #define SCOTCH_graphPartOvl         SCOTCH_NAME_PUBLIC (SCOTCH_graphPartOvl)
+#define SCOTCH_graphPartStream      SCOTCH_NAME_PUBLIC (SCOTCH_graphPartStream)
 #define SCOTCH_graphRemap           SCOTCH_NAME_PUBLIC (SCOTCH_graphRemap)
 #define SCOTCH_graphRemapCompute    SCOTCH_NAME_PUBLIC (SCOTCH_graphRemapCompute)
 #define SCOTCH_graphRemapFixed      SCOTCH_NAME_PUBLIC (SCOTCH_graphRemapFixed)
@@ -1287,6 +1347,8 @@
 #define SCOTCH_stratDgraphMapBuild  SCOTCH_NAME_PUBLIC (SCOTCH_stratDgraphMapBuild)
 #define SCOTCH_stratDgraphOrder     SCOTCH_NAME_PUBLIC (SCOTCH_stratDgraphOrder)
 #define SCOTCH_stratDgraphOrderBuild SCOTCH_NAME_PUBLIC (SCOTCH_stratDgraphOrderBuild)
+#define SCOTCH_stratDgraphPartOvl   SCOTCH_NAME_PUBLIC (SCOTCH_stratDgraphPartOvl)
+#define SCOTCH_stratDgraphPartOvlBuild SCOTCH_NAME_PUBLIC (SCOTCH_stratDgraphPartOvlBuild)
 #define SCOTCH_stratExit            SCOTCH_NAME_PUBLIC (SCOTCH_stratExit)
 #define SCOTCH_stratFree            SCOTCH_NAME_PUBLIC (SCOTCH_stratFree)
 #define SCOTCH_stratGraphBipart     SCOTCH_NAME_PUBLIC (SCOTCH_stratGraphBipart)
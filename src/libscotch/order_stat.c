@@ -0,0 +1,338 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : order_stat.c                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes the elimination    **/
+/**                tree and the column counts of the       **/
+/**                factored matrix of a graph ordering,    **/
+/**                without performing the symbolic         **/
+/**                factorization.                          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # The elimination tree is computed by   **/
+/**                  the algorithm of J. W. H. Liu, using  **/
+/**                  path compression, and column counts   **/
+/**                  by the skeleton matrix and least      **/
+/**                  common ancestor method of J. R.       **/
+/**                  Gilbert, E. G. Ng and B. W. Peyton,   **/
+/**                  in almost linear time.                **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_ORDER_STAT
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "order.h"
+#include "order_stat.h"
+
+/***********************************/
+/*                                 */
+/* These routines compute factored */
+/* matrix statistics of orderings. */
+/*                                 */
+/***********************************/
+
+/* This routine determines whether column j
+** is a leaf of the row subtree of row i. If
+** it is a subsequent leaf, the least common
+** ancestor of j and of the previous leaf is
+** searched for, with path compression.
+** It returns:
+** - -1  : if j is not a leaf of the row subtree.
+** - i   : if j is the first leaf.
+** - q   : the least common ancestor, otherwise.
+*/
+
+static
+Gnum
+orderStatLeaf (
+const Gnum                    rowinum,
+const Gnum                    colnum,
+const Gnum * restrict const   frsttab,
+Gnum * restrict const         mfsttab,
+Gnum * restrict const         prvltab,
+Gnum * restrict const         anintab,
+Gnum * restrict const         leafptr)
+{
+  Gnum                colprv;
+  Gnum                ancenum;
+  Gnum                cmpsnum;
+
+  *leafptr = 0;
+  if ((rowinum <= colnum) || (frsttab[colnum] <= mfsttab[rowinum])) /* If j not a leaf */
+    return (-1);
+
+  mfsttab[rowinum] = frsttab[colnum];             /* Update first descendant of last leaf */
+  colprv           = prvltab[rowinum];
+  prvltab[rowinum] = colnum;
+  if (colprv == -1) {                             /* If first leaf of row subtree */
+    *leafptr = 1;
+    return (rowinum);
+  }
+
+  *leafptr = 2;                                   /* Subsequent leaf */
+  for (ancenum = colprv; ancenum != anintab[ancenum]; ancenum = anintab[ancenum]) ; /* Find root of set */
+  for (cmpsnum = colprv; cmpsnum != ancenum; ) {  /* Perform path compression                           */
+    Gnum                cmpstmp;
+
+    cmpstmp = anintab[cmpsnum];
+    anintab[cmpsnum] = ancenum;
+    cmpsnum = cmpstmp;
+  }
+
+  return (ancenum);
+}
+
+/* This routine computes the elimination tree
+** and the column counts of the factored matrix
+** associated with the given ordering of the
+** given graph. Both arrays are indexed by
+** permuted column numbers. Father indices are
+** based, with -1 for roots. When the graph has
+** vertex loads, each column stands for as many
+** unknowns as its load, and column counts are
+** the sums of the loads of the rows of each
+** column, including the diagonal. The number of
+** non-zeroes and the operation count of the
+** factored matrix are also returned.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+orderStat (
+const Order * restrict const  ordeptr,
+const Graph * restrict const  grafptr,
+Gnum * restrict const         fathtax,            /*+ Elimination tree father array [based] +*/
+Gnum * restrict const         ccnttax,            /*+ Column count array [based]            +*/
+double * restrict const       fnnzptr,            /*+ Number of non-zeroes of factor        +*/
+double * restrict const       fopcptr)            /*+ Operation count of factorization      +*/
+{
+  Gnum * restrict     permtax;                    /* Direct permutation array                */
+  Gnum * restrict     anintab;                    /* Virtual ancestor, then ancestor set     */
+  Gnum * restrict     dadwtab;                    /* Unbased father array                    */
+  Gnum * restrict     posttab;                    /* Postorder of columns                    */
+  Gnum * restrict     frsttab;                    /* First descendant; also list head        */
+  Gnum * restrict     mfsttab;                    /* Max first descendant; also list next    */
+  Gnum * restrict     prvltab;                    /* Previous leaf; also postorder stack     */
+  double              fnnzsum;
+  double              fopcsum;
+  Gnum                postnum;
+  Gnum                colnum;
+
+  const Gnum                  baseval = grafptr->baseval;
+  const Gnum                  vertnbr = grafptr->vertnbr;
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const velotax = grafptr->velotax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+  const Gnum * restrict const peritax = ordeptr->peritab - baseval; /* Orderings are based like graphs */
+  Gnum * restrict const       ccnttab = ccnttax + baseval;
+
+  if ((ordeptr->vnodnbr != vertnbr) ||
+      (ordeptr->baseval != baseval)) {
+    errorPrint ("orderStat: invalid parameters");
+    return     (1);
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &permtax, (size_t) (vertnbr * sizeof (Gnum)),
+                     &anintab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &dadwtab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &posttab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &frsttab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &mfsttab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &prvltab, (size_t) (vertnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("orderStat: out of memory");
+    return     (1);
+  }
+  permtax -= baseval;
+
+  for (colnum = 0; colnum < vertnbr; colnum ++)   /* Compute unbased direct permutation */
+    permtax[peritax[colnum + baseval]] = colnum;
+
+  for (colnum = 0; colnum < vertnbr; colnum ++) { /* Compute elimination tree */
+    Gnum                vertnum;
+    Gnum                edgenum;
+
+    dadwtab[colnum] =
+    anintab[colnum] = -1;
+    vertnum = peritax[colnum + baseval];
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                rownum;
+
+      rownum = permtax[edgetax[edgenum]];
+      while ((rownum < colnum) && (anintab[rownum] != -1) && (anintab[rownum] != colnum)) { /* Climb up with path compression */
+        Gnum                rowtmp;
+
+        rowtmp = anintab[rownum];
+        anintab[rownum] = colnum;
+        rownum = rowtmp;
+      }
+      if ((rownum < colnum) && (anintab[rownum] == -1)) { /* If root of subtree reached, link it */
+        anintab[rownum] = colnum;
+        dadwtab[rownum] = colnum;
+      }
+    }
+  }
+
+  memSet (frsttab, ~0, vertnbr * sizeof (Gnum));  /* Build son lists in ascending order */
+  for (colnum = vertnbr - 1; colnum >= 0; colnum --) {
+    Gnum                dadnum;
+
+    dadnum = dadwtab[colnum];
+    if (dadnum != -1) {
+      mfsttab[colnum] = frsttab[dadnum];
+      frsttab[dadnum] = colnum;
+    }
+  }
+  for (colnum = 0, postnum = 0; colnum < vertnbr; colnum ++) { /* Postorder all trees of forest */
+    Gnum                stacnbr;
+
+    if (dadwtab[colnum] != -1)                    /* Only start from roots */
+      continue;
+
+    prvltab[0] = colnum;
+    stacnbr    = 1;
+    while (stacnbr > 0) {
+      Gnum                topnum;
+      Gnum                sonnum;
+
+      topnum = prvltab[stacnbr - 1];
+      sonnum = frsttab[topnum];
+      if (sonnum == -1) {                         /* If all sons processed */
+        stacnbr --;
+        posttab[postnum ++] = topnum;
+      }
+      else {
+        frsttab[topnum]     = mfsttab[sonnum];    /* Remove son from list */
+        prvltab[stacnbr ++] = sonnum;
+      }
+    }
+  }
+#ifdef SCOTCH_DEBUG_ORDER2
+  if (postnum != vertnbr) {
+    errorPrint ("orderStat: internal error");
+    memFree    (permtax + baseval);               /* Free group leader */
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+
+  memSet (frsttab, ~0, vertnbr * sizeof (Gnum));
+  for (postnum = 0; postnum < vertnbr; postnum ++) { /* Compute first descendants and leaf weights */
+    Gnum                dadnum;
+
+    colnum = posttab[postnum];
+    ccnttab[colnum] = (frsttab[colnum] == -1) ? ((velotax != NULL) ? velotax[peritax[colnum + baseval]] : 1) : 0;
+    for (dadnum = colnum; (dadnum != -1) && (frsttab[dadnum] == -1); dadnum = dadwtab[dadnum])
+      frsttab[dadnum] = postnum;
+  }
+
+  for (colnum = 0; colnum < vertnbr; colnum ++) {
+    anintab[colnum] = colnum;                     /* Each column is its own ancestor set */
+    mfsttab[colnum] =
+    prvltab[colnum] = -1;
+  }
+
+  for (postnum = 0; postnum < vertnbr; postnum ++) { /* Accumulate skeleton matrix deltas */
+    Gnum                vertnum;
+    Gnum                edgenum;
+    Gnum                dadnum;
+
+    colnum  = posttab[postnum];
+    vertnum = peritax[colnum + baseval];
+    dadnum  = dadwtab[colnum];
+    if (dadnum != -1)                             /* Row subtree of column ends at its root */
+      ccnttab[dadnum] -= (velotax != NULL) ? velotax[vertnum] : 1;
+
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                rowvnum;
+      Gnum                ancenum;
+      Gnum                leafval;
+
+      rowvnum = edgetax[edgenum];
+      ancenum = orderStatLeaf (permtax[rowvnum], colnum, frsttab, mfsttab, prvltab, anintab, &leafval);
+      if (leafval >= 1) {
+        Gnum                rowwval;
+
+        rowwval = (velotax != NULL) ? velotax[rowvnum] : 1;
+        ccnttab[colnum] += rowwval;
+        if (leafval == 2)
+          ccnttab[ancenum] -= rowwval;
+      }
+    }
+
+    if (dadnum != -1)
+      anintab[colnum] = dadnum;
+  }
+
+  fnnzsum =
+  fopcsum = 0.0L;
+  for (colnum = 0; colnum < vertnbr; colnum ++) { /* Sum deltas up the tree, fathers being after sons */
+    Gnum                dadnum;
+    double              cnntval;
+    double              veloval;
+
+    dadnum = dadwtab[colnum];
+    if (dadnum != -1)
+      ccnttab[dadnum] += ccnttab[colnum];
+
+    veloval  = (velotax != NULL) ? (double) velotax[peritax[colnum + baseval]] : 1.0L;
+    cnntval  = (double) ccnttab[colnum];
+    fnnzsum += cnntval * veloval;
+    fopcsum += cnntval * cnntval * veloval;
+
+    fathtax[colnum + baseval] = (dadnum != -1) ? (dadnum + baseval) : -1;
+  }
+
+  if (fnnzptr != NULL)
+    *fnnzptr = fnnzsum;
+  if (fopcptr != NULL)
+    *fopcptr = fopcsum;
+
+  memFree (permtax + baseval);                    /* Free group leader */
+
+  return (0);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 5.0  : from : 07 feb 2006     **/
 /**                                 to   : 13 mar 2006     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -81,6 +81,8 @@ MPI_Comm                    proccomm)             /* Communicator to be used for
   memSet (grafptr, 0, sizeof (Vdgraph));          /* Clear public and private graph fields */
 
   grafptr->s.proccomm = proccomm;                 /* Set private fields      */
+  grafptr->dwgttab[0] =                           /* Parts are evenly weighted by default */
+  grafptr->dwgttab[1] = 1;
   MPI_Comm_size (proccomm, &grafptr->s.procglbnbr); /* Get communicator data */
   MPI_Comm_rank (proccomm, &grafptr->s.proclocnum);
 
@@ -121,7 +123,7 @@ Vdgraph * const             grafptr)
 {
   memSet (grafptr->partgsttax + grafptr->s.baseval, 0, grafptr->s.vertgstnbr * sizeof (GraphPart)); /* Set all local and ghost vertices to part 0 */
 
-  grafptr->compglbloaddlt = grafptr->s.veloglbsum;
+  grafptr->compglbloaddlt = grafptr->s.veloglbsum * grafptr->dwgttab[1];
   grafptr->compglbload[0] = grafptr->s.veloglbsum; /* No frontier vertices */
   grafptr->compglbload[1] =
   grafptr->compglbload[2] = 0;
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2010,2018,2019 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2010,2018,2019,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 06 jun 2018     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 27 aug 2019     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -60,6 +60,7 @@ typedef struct Vdgraph_ {
   Dgraph                    s;                    /*+ Source distributed graph                                                 +*/
   GraphPart *               partgsttax;           /*+ Based local part array: 0,1: part; 2: separator                          +*/
   Gnum                      compglbloaddlt;       /*+ Load difference between both parts                                       +*/
+  Gnum                      dwgttab[2];           /*+ Weights of the two subdomains                                            +*/
   Gnum                      compglbload[3];       /*+ Global loads of both parts and of separator; TRICK: before compglbsize[] +*/
   Gnum                      compglbsize[3];       /*+ Number of vertices in parts; compglbsize[2] is fronglbnbr, the separator +*/
   Gnum                      complocload[3];       /*+ Local loads of both parts and of separator; TRICK: before complocsize[]  +*/
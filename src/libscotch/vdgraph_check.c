@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 5.0  : from : 07 feb 2006     **/
 /**                                 to   : 01 mar 2008     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -99,7 +99,7 @@ const Vdgraph * const       grafptr)
     cheklocval = 1;
   }
 
-  if (grafptr->compglbloaddlt != (grafptr->compglbload[0] - grafptr->compglbload[1])) {
+  if (grafptr->compglbloaddlt != (grafptr->compglbload[0] * grafptr->dwgttab[1] - grafptr->compglbload[1] * grafptr->dwgttab[0])) {
     errorPrint ("vdgraphCheck: invalid global balance");
     cheklocval |= 2;
   }
@@ -225,6 +225,8 @@ const Vdgraph * const       grafptr)
     memFree (grafdat.edgegsttax + grafptr->s.baseval);
   if (grafptr->s.procsidtab != grafdat.procsidtab) /* The same for procsidtab */
     memFree (grafdat.procsidtab);
+  if ((grafptr->s.flagval & DGRAPHHASNGBCOMM) == 0) /* The same for neighborhood communicator */
+    dgraphNgbFree (&grafdat);
   memFree (partgsttax + grafptr->s.baseval);
 
   if ((cheklocval == 0) &&
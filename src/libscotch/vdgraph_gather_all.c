@@ -1,4 +1,4 @@
-/* Copyright 2007-2010,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2010,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.1  : from : 26 nov 2021     **/
 /**                                 to   : 26 nov 2021     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The definitions of MPI_Gather and     **/
 /**                  MPI_Gatherv indicate that elements in **/
@@ -139,8 +139,8 @@ Vgraph * restrict              cgrfptr)           /* Centralized graph */
 #endif /* SCOTCH_DEBUG_VDGRAPH1 */
   cgrfptr->s.flagval |= VGRAPHFREEPART;           /* Free group leader on output */
   cgrfptr->parttax   -= cgrfptr->s.baseval;
-  cgrfptr->dwgttab[0] =                           /* Parts should be evenly partitioned */
-  cgrfptr->dwgttab[1] = 1;
+  cgrfptr->dwgttab[0] = dgrfptr->dwgttab[0];      /* Preserve respective weights */
+  cgrfptr->dwgttab[1] = dgrfptr->dwgttab[1];
   cgrfptr->levlnum    = dgrfptr->levlnum;         /* Set level of separation graph as level of halo graph */
   cgrfptr->contptr    = dgrfptr->contptr;
 
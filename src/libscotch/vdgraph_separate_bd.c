@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 5.1  : from : 11 nov 2007     **/
 /**                                 to   : 01 mar 2008     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -131,7 +131,9 @@ const VdgraphSeparateBdParam * const  paraptr)    /*+ Method parameters +*/
   bandgrafdat.compglbload[0] = grafptr->compglbload[0] + bandvertglbancadj; /* All loads are kept in band graph */
   bandgrafdat.compglbload[1] = grafptr->compglbload[1] + bandvertglbancadj;
   bandgrafdat.compglbload[2] = grafptr->compglbload[2];
-  bandgrafdat.compglbloaddlt = grafptr->compglbloaddlt; /* Balance is not changed by anchor vertices */
+  bandgrafdat.compglbloaddlt = grafptr->compglbloaddlt + bandvertglbancadj * (grafptr->dwgttab[1] - grafptr->dwgttab[0]); /* Balance is not changed by anchor vertices if even weights */
+  bandgrafdat.dwgttab[0]     = grafptr->dwgttab[0]; /* Preserve respective weights */
+  bandgrafdat.dwgttab[1]     = grafptr->dwgttab[1];
   bandgrafdat.complocload[0] = grafptr->complocload[0] + bandvertlocancadj;
   bandgrafdat.complocload[1] = grafptr->complocload[1] + bandvertlocancadj;
   bandgrafdat.complocload[2] = grafptr->complocload[2];
@@ -172,7 +174,7 @@ const VdgraphSeparateBdParam * const  paraptr)    /*+ Method parameters +*/
   grafptr->compglbload[0] = bandgrafdat.compglbload[0] - bandvertglbancadj;
   grafptr->compglbload[1] = bandgrafdat.compglbload[1] - bandvertglbancadj;
   grafptr->compglbload[2] = bandgrafdat.compglbload[2];
-  grafptr->compglbloaddlt = bandgrafdat.compglbloaddlt;
+  grafptr->compglbloaddlt = bandgrafdat.compglbloaddlt - bandvertglbancadj * (grafptr->dwgttab[1] - grafptr->dwgttab[0]);
   grafptr->compglbsize[0] = reduglbtab[1];
   grafptr->compglbsize[1] = reduglbtab[2];
   grafptr->compglbsize[2] = bandgrafdat.compglbsize[2];
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**   DATES      : # Version 5.1  : from : 05 nov 2007     **/
 /**                                 to   : 09 nov 2008     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -149,7 +149,8 @@ const VdgraphSeparateDfParam * const  paraptr)    /*+ Method parameters +*/
   }
 
   psepval       = paraptr->partval & 1;           /* Coerce part in the {0,1} range */
-  compglbavg    = (float) (grafptr->compglbload[0] + grafptr->compglbload[1]) * 0.5F;
+  compglbavg    = (float) (grafptr->compglbload[0] + grafptr->compglbload[1]) * (float) grafptr->dwgttab[0] / /* Target load of part 0 */
+                  (float) (grafptr->dwgttab[0] + grafptr->dwgttab[1]);
   vanclocval[0] = (float) grafptr->compglbload[0];
   if (vanclocval[0] < (compglbavg * (1.0F - (float) paraptr->deltval))) /* Enforce balance constraint */
     vanclocval[0] = compglbavg * (1.0F - (float) paraptr->deltval);
@@ -352,7 +353,7 @@ abort :                                           /* If overflow occured, resume
     errorPrint ("vdgraphSeparateDf: communication error (2)");
     return     (1);
   }
-  grafptr->compglbloaddlt = grafptr->compglbload[0] - grafptr->compglbload[1];
+  grafptr->compglbloaddlt = grafptr->compglbload[0] * grafptr->dwgttab[1] - grafptr->compglbload[1] * grafptr->dwgttab[0];
 
 #ifdef SCOTCH_DEBUG_VDGRAPH2
   if (vdgraphCheck (grafptr) != 0) {
@@ -1,4 +1,4 @@
-/* Copyright 2007-2010,2012,2014,2019,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2010,2012,2014,2019,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 11 sep 2012     **/
 /**                                 to   : 28 sep 2014     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -122,6 +122,8 @@ const VdgraphSeparateMlParam * const  paraptr)     /*+ Method parameters
     return (0);
   }
 
+  coargrafptr->dwgttab[0] = finegrafptr->dwgttab[0]; /* Preserve respective weights    */
+  coargrafptr->dwgttab[1] = finegrafptr->dwgttab[1];
   coargrafptr->levlnum = finegrafptr->levlnum + 1; /* Graph level is coarsening level */
   coargrafptr->contptr = finegrafptr->contptr;
 
@@ -728,7 +730,7 @@ const DgraphCoarsenMulti * restrict const coarmulttax) /*+ Based multinode array
   finegrafptr->compglbsize[0] = reduglbtab[3];
   finegrafptr->compglbsize[1] = reduglbtab[4];
   finegrafptr->compglbsize[2] = reduglbtab[5];
-  finegrafptr->compglbloaddlt = reduglbtab[0] - reduglbtab[1];
+  finegrafptr->compglbloaddlt = reduglbtab[0] * finegrafptr->dwgttab[1] - reduglbtab[1] * finegrafptr->dwgttab[0];
 
 #ifdef SCOTCH_DEBUG_VDGRAPH2
   if (vdgraphCheck (finegrafptr) != 0) {
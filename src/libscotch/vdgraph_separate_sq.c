@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2010,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2010,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**   DATES      : # Version 5.1  : from : 15 feb 2006     **/
 /**                                 to   : 30 jul 2010     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -139,6 +139,7 @@ const VdgraphSeparateSqParam * const  paraptr)    /*+ Method parameters +*/
   Gnum              complocload1;
   Gnum              complocload2;
   Gnum              fronlocnbr;
+  Context           contdat;                      /* Threaded clone of execution context               */
   int               o;
 
   if ((MPI_Type_contiguous (4, GNUM_MPI, &besttypedat)                                != MPI_SUCCESS) ||
@@ -162,6 +163,10 @@ const VdgraphSeparateSqParam * const  paraptr)    /*+ Method parameters +*/
     return     (1);
   }
 
+  if ((dgraphNodeData (&dgrfptr->s) == 0) &&     /* Use node cores that sequential run would leave idle */
+      (contextThreadClone (&contdat, dgrfptr->contptr, dgrfptr->s.procnodnbr, dgrfptr->s.procnodnum) == 0))
+    cgrfdat.contptr = &contdat;
+
   if (vgraphSeparateSt (&cgrfdat, paraptr->strat) != 0) { /* Separate centralized graph */
     errorPrint ("vdgraphSeparateSq: cannot separate centralized graph");
     reduloctab[3] = 1;
@@ -173,6 +178,11 @@ const VdgraphSeparateSqParam * const  paraptr)    /*+ Method parameters +*/
     reduloctab[1] = cgrfdat.comploaddlt;
   }
 
+  if (cgrfdat.contptr != dgrfptr->contptr) {      /* If threaded clone of context used, free it */
+    contextThreadCloneExit (&contdat);
+    cgrfdat.contptr = dgrfptr->contptr;
+  }
+
   if (MPI_Allreduce (reduloctab, reduglbtab, 1, besttypedat, bestoperdat, dgrfptr->s.proccomm) != MPI_SUCCESS) {
     errorPrint ("vdgraphSeparateSq: communication error (2)");
     return     (1);
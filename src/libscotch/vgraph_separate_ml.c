@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011,2014,2015,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011,2014,2015,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 01 nov 2021     **/
 /**                                 to   : 21 nov 2021     **/
 /**                # Version 7.0  : from : 03 may 2019     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,7 +83,9 @@
 ** graph that is given on input. The coarser
 ** graphs differ at this stage from classical
 ** active graphs as their internal gains are not
-** yet computed.
+** yet computed. When label propagation clusters
+** are contracted, the fine-to-coarse array is
+** returned in place of the multinode array.
 ** It returns:
 ** - 0  : if the coarse graph has been built.
 ** - 1  : if threshold achieved or on error.
@@ -94,14 +96,27 @@ int
 vgraphSeparateMlCoarsen (
 const Vgraph * restrict const         finegrafptr, /*+ Finer graph                                  +*/
 Vgraph * restrict const               coargrafptr, /*+ Coarser graph to build                       +*/
+Gnum * restrict * const               finecoarptr, /*+ Pointer to un-based fine-to-coarse array     +*/
 GraphCoarsenMulti * restrict * const  coarmultptr, /*+ Pointer to un-based multinode table to build +*/
 const VgraphSeparateMlParam * const   paraptr)    /*+ Method parameters                             +*/
 {
+  *finecoarptr = NULL;                            /* Assume no fine-to-coarse array needed        */
   *coarmultptr = NULL;                            /* Allocate coarmulttab along with coarse graph */
-  if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr,
-                    paraptr->coarnbr, paraptr->coarval, GRAPHCOARSENNONE,
-                    NULL, NULL, 0, finegrafptr->contptr) != 0)
+  if ((paraptr->coartype == GRAPHCOARLBP) &&      /* If clusters wanted, keep fine-to-coarse array */
+      ((*finecoarptr = (Gnum *) memAlloc (finegrafptr->s.vertnbr * sizeof (Gnum))) == NULL)) {
+    errorPrint ("vgraphSeparateMlCoarsen: out of memory");
+    return     (1);
+  }
+  if (graphCoarsen (&finegrafptr->s, &coargrafptr->s,
+                    (*finecoarptr != NULL) ? finecoarptr : NULL, coarmultptr,
+                    paraptr->coarnbr, paraptr->coarval,
+                    ((*finecoarptr != NULL) ? GRAPHCOARSENCLUSTER : GRAPHCOARSENNONE) |
+                    ((paraptr->coartype == GRAPHCOARHOP) ? GRAPHCOARSENHOP : GRAPHCOARSENNONE),
+                    NULL, NULL, 0, finegrafptr->contptr) != 0) {
+    if (*finecoarptr != NULL)
+      memFree (*finecoarptr);
     return (1);                                   /* Return if coarsening failed */
+  }
 
   coargrafptr->parttax    = NULL;                 /* Do not allocate partition data yet      */
   coargrafptr->frontab    = finegrafptr->frontab; /* Re-use frontier array for coarser graph */
@@ -115,7 +130,9 @@ const VgraphSeparateMlParam * const   paraptr)    /*+ Method parameters
 
 /* This routine propagates the separation of the
 ** coarser graph back to the finer graph, according
-** to the multinode table of collapsed vertices.
+** to the multinode table of collapsed vertices, or
+** to the fine-to-coarse array when clusters have
+** been contracted.
 ** After the separation is propagated, it finishes
 ** to compute the parameters of the finer graph that
 ** were not computed at the coarsening stage.
@@ -128,8 +145,9 @@ static
 int
 vgraphSeparateMlUncoarsen (
 Vgraph * restrict const                   finegrafptr, /*+ Finer graph              +*/
-const Vgraph * restrict const             coargrafptr, /*+ Coarser graph            +*/
-const GraphCoarsenMulti * restrict const  coarmulttab) /*+ Un-based multinode array +*/
+const Vgraph * restrict const             coargrafptr, /*+ Coarser graph                         +*/
+const Gnum * restrict const               finecoartab, /*+ Un-based fine-to-coarse array, if any +*/
+const GraphCoarsenMulti * restrict const  coarmulttab) /*+ Un-based multinode array              +*/
 {
   Gnum                coarvertnbr;
   Gnum                coarvertnum;                /* Number of current coarse vertex           */
@@ -151,30 +169,50 @@ const GraphCoarsenMulti * restrict const  coarmulttab) /*+ Un-based multinode ar
     const GraphPart * restrict const  coarparttab = coargrafptr->parttax + coargrafptr->s.baseval;
     Gnum * restrict const             finefrontab = finegrafptr->frontab;
 
-    finesize1   = coargrafptr->compsize[1];       /* Pre-allocate size */
     fineparttax = finegrafptr->parttax;
-    for (coarvertnum = finefronnbr = 0, coarvertnbr = coargrafptr->s.vertnbr;
-         coarvertnum < coarvertnbr; coarvertnum ++) {
-      Gnum                finevertnum0;           /* First multinode vertex          */
-      Gnum                finevertnum1;           /* Second multinode vertex         */
-      GraphPart           coarpartval;            /* Value of current multinode part */
+    if (finecoartab != NULL) {                    /* If clusters contracted, project through fine-to-coarse array */
+      Gnum                finevertnnd;
+      Gnum                finevertnum;
 
-      finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
-      finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
-      coarpartval  = coarparttab[coarvertnum];
+      const Gnum * restrict const finecoartax = finecoartab - finegrafptr->s.baseval;
 
-      fineparttax[finevertnum0] = coarpartval;
-      if (coarpartval != 2) {                     /* If vertex is not in separator */
-        if (finevertnum0 != finevertnum1) {
-          fineparttax[finevertnum1] = coarpartval;
-          finesize1 += (Gnum) coarpartval;        /* One extra vertex accounted for in part 1 if (coarpartval == 1) */
-        }
+      for (finevertnum = finegrafptr->s.baseval, finevertnnd = finegrafptr->s.vertnnd, finefronnbr = finesize1 = 0;
+           finevertnum < finevertnnd; finevertnum ++) {
+        GraphPart           coarpartval;
+
+        coarpartval = coarparttab[finecoartax[finevertnum] - coargrafptr->s.baseval];
+        fineparttax[finevertnum] = coarpartval;
+        if (coarpartval == 2)                     /* All vertices of separator clusters are in separator */
+          finefrontab[finefronnbr ++] = finevertnum;
+        else
+          finesize1 += (Gnum) coarpartval;
       }
-      else {                                      /* Vertex is in separator */
-        finefrontab[finefronnbr ++] = finevertnum0;
-        if (finevertnum0 != finevertnum1) {
-          fineparttax[finevertnum1] = coarpartval;
-          finefrontab[finefronnbr ++] = finevertnum1; /* One extra vertex in separator */
+    }
+    else {
+      finesize1 = coargrafptr->compsize[1];       /* Pre-allocate size */
+      for (coarvertnum = finefronnbr = 0, coarvertnbr = coargrafptr->s.vertnbr;
+           coarvertnum < coarvertnbr; coarvertnum ++) {
+        Gnum                finevertnum0;         /* First multinode vertex          */
+        Gnum                finevertnum1;         /* Second multinode vertex         */
+        GraphPart           coarpartval;          /* Value of current multinode part */
+
+        finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
+        finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
+        coarpartval  = coarparttab[coarvertnum];
+
+        fineparttax[finevertnum0] = coarpartval;
+        if (coarpartval != 2) {                   /* If vertex is not in separator */
+          if (finevertnum0 != finevertnum1) {
+            fineparttax[finevertnum1] = coarpartval;
+            finesize1 += (Gnum) coarpartval;      /* One extra vertex accounted for in part 1 if (coarpartval == 1) */
+          }
+        }
+        else {                                    /* Vertex is in separator */
+          finefrontab[finefronnbr ++] = finevertnum0;
+          if (finevertnum0 != finevertnum1) {
+            fineparttax[finevertnum1] = coarpartval;
+            finefrontab[finefronnbr ++] = finevertnum1; /* One extra vertex in separator */
+          }
         }
       }
     }
@@ -214,18 +252,21 @@ Vgraph * restrict const             grafptr,      /* Vertex-separation graph */
 const VgraphSeparateMlParam * const paraptr)      /* Method parameters       */
 {
   Vgraph                        coargrafdat;
+  Gnum * restrict               finecoartab;
   GraphCoarsenMulti * restrict  coarmulttab;
   int                           o;
 
-  if (vgraphSeparateMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = vgraphSeparateMl2         (&coargrafdat, paraptr))              == 0) &&
-        ((o = vgraphSeparateMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
-        ((o = vgraphSeparateSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
+  if (vgraphSeparateMlCoarsen (grafptr, &coargrafdat, &finecoartab, &coarmulttab, paraptr) == 0) {
+    if (((o = vgraphSeparateMl2         (&coargrafdat, paraptr))                           == 0) &&
+        ((o = vgraphSeparateMlUncoarsen (grafptr, &coargrafdat, finecoartab, coarmulttab)) == 0) &&
+        ((o = vgraphSeparateSt          (grafptr, paraptr->stratasc))                      != 0)) /* Apply ascending strategy */
       errorPrint ("vgraphSeparateMl2: cannot apply ascending strategy");
     vgraphExit (&coargrafdat);
+    if (finecoartab != NULL)                      /* If clusters were contracted */
+      memFree (finecoartab);
   }
   else {                                          /* Cannot coarsen due to lack of memory or error */
-    if (((o = vgraphSeparateMlUncoarsen (grafptr, NULL, NULL)) == 0) && /* Finalize graph          */
+    if (((o = vgraphSeparateMlUncoarsen (grafptr, NULL, NULL, NULL)) == 0) && /* Finalize graph    */
         ((o = vgraphSeparateSt          (grafptr, paraptr->stratlow)) != 0)) /* Apply low strategy */
       errorPrint ("vgraphSeparateMl2: cannot apply low strategy");
   }
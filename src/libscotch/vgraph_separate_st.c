@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011-2014,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011-2014,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 01 may 2014     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -181,7 +181,7 @@ static StratParamTab        vgraphseparatestparatab[] = { /* Graph separation me
                               { VGRAPHSEPASTMETHML,  STRATPARAMCASE,   "type",
                                 (byte *) &vgraphseparatedefaultml.param,
                                 (byte *) &vgraphseparatedefaultml.param.coartype,
-                                (void *) "hs" },
+                                (void *) "hslt" },
                               { VGRAPHSEPASTMETHML,  STRATPARAMINT,    "vert",
                                 (byte *) &vgraphseparatedefaultml.param,
                                 (byte *) &vgraphseparatedefaultml.param.coarnbr,
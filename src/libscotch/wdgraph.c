@@ -0,0 +1,177 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : wdgraph.c                               **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the data struc-    **/
+/**                ture handling routines for distribu-    **/
+/**                ted overlap partitioning graphs.        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "arch.h"
+#include "dgraph.h"
+#include "wdgraph.h"
+
+/*************************************/
+/*                                   */
+/* These routines handle distributed */
+/* overlap partitioning graphs.      */
+/*                                   */
+/*************************************/
+
+/* This routine initializes the active
+** distributed graph corresponding to the
+** given source distributed graph.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+wdgraphInit (
+Wdgraph * restrict const        actgrafptr,       /* Active graph */
+const Dgraph * restrict const   srcgrafptr,       /* Source graph */
+const Anum                      partnbr)
+{
+  actgrafptr->s            = *srcgrafptr;         /* Clone source graph       */
+  actgrafptr->s.flagval   &= ~DGRAPHFREEALL;      /* Do not free its contents */
+  actgrafptr->s.vlblloctax = NULL;                /* Vertex labels are no use */
+  actgrafptr->partnbr      = partnbr;
+  actgrafptr->partgsttax   = NULL;                /* No part array yet */
+  actgrafptr->fronlocnbr   =
+  actgrafptr->fronglbnbr   =
+  actgrafptr->fronglbload  = 0;
+  actgrafptr->levlnum      = 0;
+}
+
+/* This routine frees the contents
+** of the given active graph.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+wdgraphExit (
+Wdgraph * const             grafptr)
+{
+  if (grafptr->partgsttax != NULL)
+    memFree (grafptr->partgsttax + grafptr->s.baseval);
+
+  dgraphExit (&grafptr->s);                       /* Free ghost data computed on cloned graph, if any */
+
+#ifdef SCOTCH_DEBUG_WDGRAPH2
+  memSet (grafptr, ~0, sizeof (Wdgraph));
+#endif /* SCOTCH_DEBUG_WDGRAPH2 */
+}
+
+/* This routine computes the ghost edge
+** array of the active graph, if necessary,
+** and allocates its part array, the contents
+** of which are set to part 0.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+wdgraphAlloc (
+Wdgraph * const             grafptr)
+{
+  if (dgraphGhst (&grafptr->s) != 0) {            /* Compute ghost edge array if not already present */
+    errorPrint ("wdgraphAlloc: cannot compute ghost edge array");
+    return (1);
+  }
+
+  if ((grafptr->partgsttax = (Anum *) memAlloc (grafptr->s.vertgstnbr * sizeof (Anum))) == NULL) {
+    errorPrint ("wdgraphAlloc: out of memory");
+    return (1);
+  }
+  memSet (grafptr->partgsttax, 0, grafptr->s.vertgstnbr * sizeof (Anum)); /* Set all vertices to part 0 */
+  grafptr->partgsttax -= grafptr->s.baseval;
+  grafptr->fronlocnbr  =
+  grafptr->fronglbnbr  =
+  grafptr->fronglbload = 0;
+
+  return (0);
+}
+
+/* This routine computes the number and
+** load of frontier vertices, that is,
+** vertices which belong to the overlap,
+** of the current partition.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+wdgraphCost (
+Wdgraph * const             grafptr)
+{
+  Gnum                vertlocnum;
+  Gnum                reduloctab[2];
+  Gnum                reduglbtab[2];
+
+  const Gnum * restrict const veloloctax = grafptr->s.veloloctax;
+  const Anum * restrict const partgsttax = grafptr->partgsttax;
+
+  for (vertlocnum = grafptr->s.baseval, reduloctab[0] = reduloctab[1] = 0;
+       vertlocnum < grafptr->s.vertlocnnd; vertlocnum ++) {
+    if (partgsttax[vertlocnum] < 0) {
+      reduloctab[0] ++;
+      reduloctab[1] += (veloloctax != NULL) ? veloloctax[vertlocnum] : 1;
+    }
+  }
+
+  if (MPI_Allreduce (reduloctab, reduglbtab, 2, GNUM_MPI, MPI_SUM, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("wdgraphCost: communication error");
+    return (1);
+  }
+
+  grafptr->fronlocnbr  = reduloctab[0];
+  grafptr->fronglbnbr  = reduglbtab[0];
+  grafptr->fronglbload = reduglbtab[1];
+
+  return (0);
+}
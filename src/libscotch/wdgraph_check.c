@@ -0,0 +1,176 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : wdgraph_check.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the distributed    **/
+/**                overlap partitioning graph consis-      **/
+/**                tency checking routine.                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "arch.h"
+#include "dgraph.h"
+#include "wdgraph.h"
+
+/*************************/
+/*                       */
+/* These routines handle */
+/* distributed overlap   */
+/* partitioning graphs.  */
+/*                       */
+/*************************/
+
+/* This routine checks the consistency
+** of the given distributed overlap
+** partitioning graph. No two adjacent
+** non-frontier vertices may belong to
+** different parts.
+** It returns:
+** - 0   : if graph data are consistent.
+** - !0  : on error.
+*/
+
+int
+wdgraphCheck (
+const Wdgraph * const       grafptr)
+{
+  Dgraph                grafdat;                  /* Copy of graph for halo exchange */
+  Anum * restrict       partgsttab;               /* Synchronized copy of part array */
+  const Anum * restrict partgsttax;               /* Based access to partgsttab      */
+  Gnum                  vertlocnum;
+  Gnum                  reduloctab[3];
+  Gnum                  reduglbtab[3];
+  int                   cheklocval;
+  int                   chekglbval;
+
+  const Gnum * restrict const vertloctax = grafptr->s.vertloctax;
+  const Gnum * restrict const vendloctax = grafptr->s.vendloctax;
+  const Gnum * restrict const veloloctax = grafptr->s.veloloctax;
+
+  cheklocval = 0;
+  partgsttab = NULL;
+  if ((grafptr->s.flagval & DGRAPHHASEDGEGST) == 0) { /* Part array must be ghost-sized */
+    errorPrint ("wdgraphCheck: ghost edge array not computed");
+    cheklocval = 1;
+  }
+  else if ((partgsttab = memAlloc (grafptr->s.vertgstnbr * sizeof (Anum))) == NULL) {
+    errorPrint ("wdgraphCheck: out of memory");
+    cheklocval = 1;
+  }
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("wdgraphCheck: communication error (1)");
+    return (1);
+  }
+  if (chekglbval != 0) {
+    if (partgsttab != NULL)
+      memFree (partgsttab);
+    return (1);
+  }
+
+  memCpy (partgsttab, grafptr->partgsttax + grafptr->s.baseval, grafptr->s.vertlocnbr * sizeof (Anum));
+  grafdat = grafptr->s;                           /* Do not modify graph structure */
+  if (dgraphHaloSync (&grafdat, partgsttab, ANUM_MPI) != 0) {
+    errorPrint ("wdgraphCheck: cannot perform halo exchange");
+    cheklocval = 1;
+  }
+  if ((grafptr->s.flagval & DGRAPHHASNGBCOMM) == 0) /* If neighborhood communicator built on copy, free it */
+    dgraphNgbFree (&grafdat);
+
+  partgsttax = partgsttab - grafptr->s.baseval;
+  reduloctab[0] =
+  reduloctab[1] = 0;
+  for (vertlocnum = grafptr->s.baseval;           /* Skip checks if halo exchange failed */
+       (cheklocval == 0) && (vertlocnum < grafptr->s.vertlocnnd); vertlocnum ++) {
+    Anum                partval;
+    Gnum                edgelocnum;
+
+    partval = partgsttax[vertlocnum];
+    if ((partval < -1) || (partval >= grafptr->partnbr)) {
+      errorPrint ("wdgraphCheck: invalid part array");
+      cheklocval = 1;
+      break;
+    }
+    if (partval < 0) {                            /* If frontier vertex */
+      reduloctab[0] ++;
+      reduloctab[1] += (veloloctax != NULL) ? veloloctax[vertlocnum] : 1;
+      continue;
+    }
+
+    for (edgelocnum = vertloctax[vertlocnum]; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+      Anum                partend;
+
+      partend = partgsttax[grafptr->s.edgegsttax[edgelocnum]];
+      if ((partend >= 0) && (partend != partval)) {
+        errorPrint ("wdgraphCheck: vertices of different parts are adjacent");
+        cheklocval = 1;
+        break;
+      }
+    }
+    if (cheklocval != 0)
+      break;
+  }
+  if ((cheklocval == 0) &&
+      (reduloctab[0] != grafptr->fronlocnbr)) {
+    errorPrint ("wdgraphCheck: invalid number of local frontier vertices");
+    cheklocval = 1;
+  }
+  memFree (partgsttab);
+
+  reduloctab[2] = (Gnum) cheklocval;
+  if (MPI_Allreduce (reduloctab, reduglbtab, 3, GNUM_MPI, MPI_SUM, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("wdgraphCheck: communication error (2)");
+    return (1);
+  }
+  if (reduglbtab[2] != 0)                         /* Return from previous errors */
+    return (1);
+
+  if ((reduglbtab[0] != grafptr->fronglbnbr) ||
+      (reduglbtab[1] != grafptr->fronglbload)) {
+    errorPrint ("wdgraphCheck: invalid global frontier data");
+    return (1);
+  }
+
+  return (0);
+}
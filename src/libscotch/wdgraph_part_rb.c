@@ -0,0 +1,609 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : wdgraph_part_rb.c                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module performs the parallel       **/
+/**                overlap partitioning of a distribu-     **/
+/**                ted graph by means of recursive         **/
+/**                vertex separation.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # This code derives from the code of    **/
+/**                  kdgraph_map_rb_part.c, adapted for    **/
+/**                  vertex overlapped graph partitioning. **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_WDGRAPH_PART_RB
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "wgraph.h"
+#include "wgraph_part_st.h"
+#include "dgraph.h"
+#include "vdgraph.h"
+#include "vdgraph_separate_st.h"
+#include "wdgraph.h"
+#include "wdgraph_part_rb.h"
+
+/***********************************/
+/*                                 */
+/* Fragment management routines.   */
+/*                                 */
+/***********************************/
+
+/* This routine makes room for the given
+** number of additional (vertex, part) pairs
+** in the fragment array.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+wdgraphPartRbFrag (
+WdgraphPartRbData * restrict const  dataptr,
+const Gnum                          fragnbr)      /*+ Number of pairs to add +*/
+{
+  Gnum * restrict     fragtab;
+  Gnum                fragmax;
+
+  if ((dataptr->fragnbr + fragnbr) <= dataptr->fragmax) /* If enough room already */
+    return (0);
+
+  fragmax = MAX (dataptr->fragnbr + fragnbr, dataptr->fragmax + (dataptr->fragmax >> 2)); /* Grow array by at least 25% */
+  if ((fragtab = (Gnum *) memRealloc (dataptr->fragtab, 2 * fragmax * sizeof (Gnum))) == NULL) {
+    errorPrint ("wdgraphPartRbFrag: out of memory");
+    return (1);
+  }
+  dataptr->fragtab = fragtab;
+  dataptr->fragmax = fragmax;
+
+  return (0);
+}
+
+/* This routine records the parts of the
+** local vertices of the given distributed
+** graph. The part of each vertex is given
+** by the entry of domntab indexed by the
+** value of the vertex in the separation
+** part array. Vertices the part of which
+** is negative and not -1 are not recorded,
+** as they will be handled by subsequent
+** recursion levels.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+wdgraphPartRbAddDist (
+WdgraphPartRbData * restrict const  dataptr,
+const Dgraph * restrict const       grafptr,
+const GraphPart * restrict const    partgsttax,   /*+ Separation part array, or NULL if all vertices in part 0 +*/
+const Anum * restrict const         domntab)      /*+ Part number for each separation part value              +*/
+{
+  Gnum                vertlocnum;
+  Gnum                vertglbadj;
+  Gnum                fragnbr;
+
+  const Gnum * restrict const vnumloctax = grafptr->vnumloctax;
+
+  if (wdgraphPartRbFrag (dataptr, grafptr->vertlocnbr) != 0)
+    return (1);
+
+  vertglbadj = grafptr->procvrttab[grafptr->proclocnum] - grafptr->baseval;
+  for (vertlocnum = grafptr->baseval, fragnbr = dataptr->fragnbr;
+       vertlocnum < grafptr->vertlocnnd; vertlocnum ++) {
+    Anum                partval;
+
+    partval = domntab[(partgsttax != NULL) ? partgsttax[vertlocnum] : 0];
+    if (partval < -1)                             /* If vertex will be handled by recursion */
+      continue;
+
+    dataptr->fragtab[2 * fragnbr]     = (vnumloctax != NULL) ? vnumloctax[vertlocnum] : (vertlocnum + vertglbadj);
+    dataptr->fragtab[2 * fragnbr + 1] = (Gnum) partval;
+    fragnbr ++;
+  }
+  dataptr->fragnbr = fragnbr;
+
+  return (0);
+}
+
+/* This routine returns the rank of the
+** process which owns the given global
+** vertex, by dichotomy on the array of
+** process vertex ranges.
+** It returns:
+** - [0,procglbnbr[  : in all cases.
+*/
+
+static
+int
+wdgraphPartRbOwner (
+const Gnum * restrict const procvrttab,
+const int                   procglbnbr,
+const Gnum                  vertglbnum)
+{
+  int                 procnum;
+  int                 procmax;
+
+  for (procnum = 0, procmax = procglbnbr; (procmax - procnum) > 1; ) {
+    int                 procmed;
+
+    procmed = (procmax + procnum) / 2;
+    if (procvrttab[procmed] > vertglbnum)
+      procmax = procmed;
+    else
+      procnum = procmed;
+  }
+
+  return (procnum);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine sequentially computes an
+** overlap partition of the given centralized
+** subgraph, and records its result in the
+** fragment array.
+** It returns:
+** - 0   : if the partition could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+wdgraphPartRbSequ (
+WdgraphPartRbGraph * restrict const grafptr,
+WdgraphPartRbData * restrict const  dataptr)
+{
+  Graph * restrict    cgrfptr;
+  Wgraph              wgrfdat;                    /* Centralized overlap partitioning graph */
+  Gnum                vertnum;
+  Gnum                fragnbr;
+  int                 o;
+
+  cgrfptr = &grafptr->data.cgrfdat;
+  wgraphInit (&wgrfdat, cgrfptr, grafptr->domnsiz);
+  wgrfdat.s.vnumtax = NULL;                       /* Parts are recorded with respect to subgraph */
+  wgrfdat.levlnum   = 0;
+  wgrfdat.contptr   = dataptr->contptr;
+
+  o = 1;                                          /* Assume an error */
+  if (wgraphAlloc (&wgrfdat) != 0) {
+    errorPrint ("wdgraphPartRbSequ: out of memory");
+    goto abort;
+  }
+  if (wgraphPartSt (&wgrfdat, dataptr->paraptr->stratseq) != 0) {
+    errorPrint ("wdgraphPartRbSequ: cannot compute sequential partition");
+    goto abort;
+  }
+  if (wdgraphPartRbFrag (dataptr, cgrfptr->vertnbr) != 0)
+    goto abort;
+
+  for (vertnum = cgrfptr->baseval, fragnbr = dataptr->fragnbr;
+       vertnum < cgrfptr->vertnnd; vertnum ++, fragnbr ++) {
+    Anum                partval;
+
+    partval = wgrfdat.parttax[vertnum];
+    dataptr->fragtab[2 * fragnbr]     = (cgrfptr->vnumtax != NULL) ? cgrfptr->vnumtax[vertnum] : vertnum;
+    dataptr->fragtab[2 * fragnbr + 1] = (Gnum) ((partval < 0) ? -1 : (grafptr->domnnum + partval));
+  }
+  dataptr->fragnbr = fragnbr;
+  o = 0;
+
+abort:
+  wgraphExit (&wgrfdat);                          /* Does not free centralized graph */
+  graphExit  (cgrfptr);
+
+  return (o);
+}
+
+/* This routine builds either a centralized or a
+** distributed subgraph, according to the number
+** of processes in the given part.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+wdgraphPartRbFold2 (
+WdgraphPartRbFold * const   fldptr)
+{
+  WdgraphPartRbGraph * restrict fldgrafptr;       /* Pointer to folded graph area */
+  Dgraph                        indgrafdat;       /* Induced distributed graph    */
+  int                           o;
+
+  if (fldptr->fldprocnbr == 0)                    /* If part has already been recorded */
+    return (0);
+
+  fldgrafptr = fldptr->fldgrafptr;
+
+  dgraphInit (&indgrafdat, fldptr->orggrafptr->proccomm); /* Re-use communicator of original graph                          */
+  if (dgraphInducePart (fldptr->orggrafptr, fldptr->indparttax, /* Compute unfinished induced subgraph on all processes */
+                        fldptr->indvertnbr, fldptr->indpartval, &indgrafdat) != 0)
+    return (1);
+
+  if (fldptr->fldprocnbr > 1) {                   /* If subpart has several processes, fold a distributed graph */
+    o = dgraphFold2 (&indgrafdat, fldptr->fldpartval, /* Fold temporary induced subgraph from all processes    */
+                     &fldgrafptr->data.dgrfdat, fldptr->fldproccomm, NULL, NULL, MPI_INT, fldptr->contptr);
+    if (fldptr->fldprocnum >= 0)                  /* If we are a receiver of the folded graph */
+      fldgrafptr->data.dgrfdat.flagval |= DGRAPHFREECOMM; /* Split communicator has to be freed */
+  }
+  else {                                          /* Create a centralized graph */
+    Graph * restrict      fldcgrfptr;
+
+    fldcgrfptr = (fldptr->fldprocnum == 0) ? &fldgrafptr->data.cgrfdat : NULL; /* See if we are the receiver */
+    o = dgraphGather (&indgrafdat, fldcgrfptr);   /* Gather centralized subgraph from all other processes    */
+  }
+  dgraphExit (&indgrafdat);                       /* Free temporary induced graph */
+
+  return (o);
+}
+
+/* This routine folds the two separated parts
+** of the given graph onto the two halves of
+** its process set. The largest part is always
+** folded onto the first, biggest, half.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+wdgraphPartRbFold (
+Vdgraph * restrict const                    actgrafptr, /*+ Separated graph     +*/
+const WdgraphPartRbGraph * restrict const   orggrafptr, /*+ Original graph data +*/
+WdgraphPartRbGraph * restrict const         fldgrafptr) /*+ Folded graph area   +*/
+{
+  WdgraphPartRbFold   fldtab[2];
+  Anum                domnsubnum[2];              /* First part number of subdomains */
+  Anum                domnsubsiz[2];              /* Number of parts of subdomains   */
+  int                 fldprocnbr0;                /* Number of processes in first half */
+  int                 fldprocnum;
+  int                 fldproccol;
+  int                 fldpartval;
+  GraphPart           indpartmax;                 /* Induced part having most vertices */
+
+  domnsubnum[0] = orggrafptr->domnnum;            /* Subdomain sizes match separation weights */
+  domnsubsiz[0] = orggrafptr->domnsiz / 2;
+  domnsubnum[1] = orggrafptr->domnnum + domnsubsiz[0];
+  domnsubsiz[1] = orggrafptr->domnsiz - domnsubsiz[0];
+
+  indpartmax  = (actgrafptr->compglbsize[0] >= actgrafptr->compglbsize[1]) ? 0 : 1;
+  fldprocnbr0 = (actgrafptr->s.procglbnbr + 1) / 2; /* Get number of processes in part 0 (always more than in part 1) */
+
+  fldtab[0].orggrafptr  = &actgrafptr->s;         /* Load data to pass to the subgraph building routines */
+  fldtab[0].indvertnbr  = actgrafptr->complocsize[indpartmax];
+  fldtab[0].indpartval  = indpartmax;
+  fldtab[0].indparttax  = actgrafptr->partgsttax;
+  fldtab[0].fldgrafptr  = fldgrafptr;
+  fldtab[0].fldpartval  = 0;
+  fldtab[0].fldprocnbr  = (domnsubsiz[indpartmax] > 1) ? fldprocnbr0 : 0; /* Stop if domain is terminal */
+  fldtab[0].contptr     = actgrafptr->contptr;
+  fldtab[1].orggrafptr  = &actgrafptr->s;
+  fldtab[1].indvertnbr  = actgrafptr->complocsize[indpartmax ^ 1];
+  fldtab[1].indpartval  = indpartmax ^ 1;
+  fldtab[1].indparttax  = actgrafptr->partgsttax;
+  fldtab[1].fldgrafptr  = fldgrafptr;
+  fldtab[1].fldpartval  = 1;
+  fldtab[1].fldprocnbr  = (domnsubsiz[indpartmax ^ 1] > 1) ? (actgrafptr->s.procglbnbr - fldprocnbr0) : 0;
+  fldtab[1].contptr     = actgrafptr->contptr;
+
+  if (actgrafptr->s.proclocnum < fldprocnbr0) {   /* Compute color and rank in our future subpart */
+    fldpartval = 0;
+    fldprocnum = actgrafptr->s.proclocnum;
+  }
+  else {
+    fldpartval = 1;
+    fldprocnum = actgrafptr->s.proclocnum - fldprocnbr0;
+  }
+
+  fldgrafptr->domnnum = domnsubnum[fldtab[fldpartval].indpartval]; /* Set data of our folded graph */
+  fldgrafptr->domnsiz = domnsubsiz[fldtab[fldpartval].indpartval];
+  fldgrafptr->procnbr = fldtab[fldpartval].fldprocnbr;
+  fldgrafptr->levlnum = orggrafptr->levlnum + 1;  /* One level down in the recursion                       */
+  fldproccol = fldpartval;                        /* Split color is the part value                         */
+  if (fldgrafptr->procnbr <= 1)                   /* If our part will have only one processor or will stop */
+    fldproccol = MPI_UNDEFINED;                   /* Do not create any sub-communicator for it             */
+  if (MPI_Comm_split (actgrafptr->s.proccomm, fldproccol, fldprocnum, &fldtab[fldpartval].fldproccomm) != MPI_SUCCESS) {
+    errorPrint ("wdgraphPartRbFold: communication error");
+    return (1);
+  }
+  fldtab[fldpartval].fldprocnum      = fldprocnum; /* This will be our rank afterwards  */
+  fldtab[fldpartval ^ 1].fldprocnum  = -1;        /* Other part will not be in communicator */
+  fldtab[fldpartval ^ 1].fldproccomm = MPI_COMM_NULL;
+
+  return (wdgraphPartRbFold2 (&fldtab[0]) ||      /* Perform inductions in sequence */
+          wdgraphPartRbFold2 (&fldtab[1]));
+}
+
+/* This routine performs the parallel
+** recursive vertex separation. Separator
+** vertices are recorded as overlap vertices,
+** and both separated parts are folded onto
+** halves of the process set, so that recursion
+** can proceed independently on each of them.
+** It returns:
+** - 0   : if the partition could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+wdgraphPartRb2 (
+WdgraphPartRbGraph * restrict const grafptr,
+WdgraphPartRbData * restrict const  dataptr)
+{
+  Vdgraph             actgrafdat;                 /* Vertex separation graph   */
+  WdgraphPartRbGraph  indgrafdat;                 /* Induced folded graph area */
+  Anum                domntab[3];                 /* Parts to record per separation part */
+  int                 o;
+
+  if (dgraphGhst (&grafptr->data.dgrfdat) != 0) { /* Compute ghost edge array if not already present, to have vertgstnbr */
+    errorPrint ("wdgraphPartRb2: cannot compute ghost edge array");
+    dgraphExit (&grafptr->data.dgrfdat);
+    return (1);
+  }
+
+  actgrafdat.s            = grafptr->data.dgrfdat; /* Clone graph without freeing anything from it */
+  actgrafdat.s.flagval   &= ~DGRAPHFREEALL;
+  actgrafdat.s.vlblloctax = NULL;
+  actgrafdat.partgsttax   = NULL;
+  if (((actgrafdat.fronloctab = (Gnum *) memAlloc (actgrafdat.s.vertlocnbr * sizeof (Gnum))) == NULL) ||
+      ((actgrafdat.partgsttax = (GraphPart *) memAlloc (actgrafdat.s.vertgstnbr * sizeof (GraphPart))) == NULL)) {
+    errorPrint ("wdgraphPartRb2: out of memory");
+    o = 1;
+    goto abort;
+  }
+  actgrafdat.partgsttax -= actgrafdat.s.baseval;
+  actgrafdat.dwgttab[0]  = grafptr->domnsiz / 2;  /* Compute relative weights of subdomains to compute */
+  actgrafdat.dwgttab[1]  = grafptr->domnsiz - actgrafdat.dwgttab[0];
+  actgrafdat.levlnum     = grafptr->levlnum;
+  actgrafdat.contptr     = dataptr->contptr;
+  vdgraphZero (&actgrafdat);                      /* Set all local vertices to part 0 */
+
+  if (vdgraphSeparateSt (&actgrafdat, dataptr->paraptr->stratsep) != 0) {
+    errorPrint ("wdgraphPartRb2: cannot separate graph");
+    o = 1;
+    goto abort;
+  }
+
+  if ((actgrafdat.compglbsize[0] == 0) ||         /* If could not separate, centralize graph */
+      (actgrafdat.compglbsize[1] == 0)) {
+    Graph * restrict      cgrfptr;
+
+    indgrafdat.domnnum = grafptr->domnnum;
+    indgrafdat.domnsiz = grafptr->domnsiz;
+    indgrafdat.procnbr = 1;
+    indgrafdat.levlnum = grafptr->levlnum + 1;
+    cgrfptr = (grafptr->data.dgrfdat.proclocnum == 0) ? &indgrafdat.data.cgrfdat : NULL;
+    memFree    (actgrafdat.fronloctab);           /* Free graph before centralizing it */
+    memFree    (actgrafdat.partgsttax + actgrafdat.s.baseval);
+    o = dgraphGather (&grafptr->data.dgrfdat, cgrfptr);
+    dgraphExit (&grafptr->data.dgrfdat);
+    if ((o == 0) && (cgrfptr != NULL))
+      o = wdgraphPartRbSequ (&indgrafdat, dataptr);
+    return (o);
+  }
+
+  domntab[0] = ((grafptr->domnsiz / 2) <= 1) ? grafptr->domnnum : -2; /* Record parts of terminal subdomains now */
+  domntab[1] = ((grafptr->domnsiz - grafptr->domnsiz / 2) <= 1) ? (grafptr->domnnum + grafptr->domnsiz / 2) : -2;
+  domntab[2] = -1;                                /* Separator vertices belong to the overlap */
+  indgrafdat.procnbr = 0;                         /* Assume recursion ends here */
+  if (((o = wdgraphPartRbAddDist (dataptr, &actgrafdat.s, actgrafdat.partgsttax, domntab)) == 0) &&
+      (grafptr->domnsiz > 2))                     /* If at least one subdomain is not terminal */
+    o = wdgraphPartRbFold (&actgrafdat, grafptr, &indgrafdat);
+
+  memFree    (actgrafdat.fronloctab);             /* Free graph before going to next level */
+  memFree    (actgrafdat.partgsttax + actgrafdat.s.baseval);
+  dgraphExit (&grafptr->data.dgrfdat);
+
+  if (o == 0) {
+    if (indgrafdat.procnbr == 1)                  /* If sequential job */
+      o = wdgraphPartRbSequ (&indgrafdat, dataptr);
+    else if (indgrafdat.procnbr > 1)              /* If distributed job */
+      o = wdgraphPartRb2 (&indgrafdat, dataptr);
+  }
+  return (o);
+
+abort:
+  if (actgrafdat.partgsttax != NULL)
+    memFree (actgrafdat.partgsttax + actgrafdat.s.baseval);
+  if (actgrafdat.fronloctab != NULL)
+    memFree (actgrafdat.fronloctab);
+  dgraphExit (&grafptr->data.dgrfdat);
+
+  return (o);
+}
+
+/* This routine computes an overlap partition
+** of the given distributed graph by parallel
+** recursive vertex separation, and sends the
+** parts of all vertices back to their owner
+** processes.
+** It returns:
+** - 0   : if the partition could be computed.
+** - !0  : on error.
+*/
+
+int
+wdgraphPartRb (
+Wdgraph * restrict const                  grafptr,
+const WdgraphPartRbParam * restrict const paraptr)
+{
+  WdgraphPartRbGraph  grafdat;
+  WdgraphPartRbData   datadat;
+  int * restrict      sendcnttab;
+  int * restrict      senddsptab;
+  int * restrict      recvcnttab;
+  int * restrict      recvdsptab;
+  Gnum * restrict     sendtab;
+  Gnum * restrict     recvtab;
+  Gnum                fragnum;
+  Gnum                vertlocadj;
+  int                 procnum;
+  int                 cheklocval;
+  int                 chekglbval;
+
+  const Gnum * restrict const procvrttab = grafptr->s.procvrttab;
+  const int                   procglbnbr = grafptr->s.procglbnbr;
+
+  if (grafptr->partnbr <= 1) {                    /* If only one part, no separation needed */
+    memSet (grafptr->partgsttax + grafptr->s.baseval, 0, grafptr->s.vertgstnbr * sizeof (Anum));
+    return (wdgraphCost (grafptr));
+  }
+
+  datadat.paraptr = paraptr;
+  datadat.fragnbr = 0;
+  datadat.fragmax = grafptr->s.vertlocnbr;        /* Most processes will record about as many vertices as they own */
+  datadat.contptr = grafptr->contptr;
+  if ((datadat.fragtab = (Gnum *) memAlloc (2 * datadat.fragmax * sizeof (Gnum))) == NULL) {
+    errorPrint ("wdgraphPartRb: out of memory (1)");
+    return (1);
+  }
+
+  grafdat.domnnum = 0;
+  grafdat.domnsiz = grafptr->partnbr;
+  grafdat.procnbr = procglbnbr;
+  grafdat.levlnum = grafptr->levlnum;
+
+  if (procglbnbr <= 1) {                          /* If single process, switch immediately to sequential mode */
+    if ((cheklocval = dgraphGather (&grafptr->s, &grafdat.data.cgrfdat)) != 0)
+      errorPrint ("wdgraphPartRb: cannot centralize graph");
+    else
+      cheklocval = wdgraphPartRbSequ (&grafdat, &datadat);
+  }
+  else {
+    grafdat.data.dgrfdat = grafptr->s;            /* Create a clone graph that will never be freed */
+    grafdat.data.dgrfdat.flagval &= ~DGRAPHFREEALL;
+    cheklocval = wdgraphPartRb2 (&grafdat, &datadat);
+  }
+
+  if ((cheklocval == 0) &&
+      (memAllocGroup ((void **) (void *)
+                      &sendcnttab, (size_t) (procglbnbr * sizeof (int)),
+                      &senddsptab, (size_t) (procglbnbr * sizeof (int)),
+                      &recvcnttab, (size_t) (procglbnbr * sizeof (int)),
+                      &recvdsptab, (size_t) (procglbnbr * sizeof (int)),
+                      &sendtab,    (size_t) (2 * datadat.fragnbr * sizeof (Gnum)),
+                      &recvtab,    (size_t) (2 * grafptr->s.vertlocnbr * sizeof (Gnum)), NULL) == NULL)) {
+    errorPrint ("wdgraphPartRb: out of memory (2)");
+    cheklocval = 1;
+  }
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("wdgraphPartRb: communication error (1)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (cheklocval == 0)
+      memFree (sendcnttab);                       /* Free group leader */
+    memFree (datadat.fragtab);
+    return (1);
+  }
+
+  memSet (sendcnttab, 0, procglbnbr * sizeof (int));
+  for (fragnum = 0; fragnum < datadat.fragnbr; fragnum ++) /* Count pairs to send to each owner process */
+    sendcnttab[wdgraphPartRbOwner (procvrttab, procglbnbr, datadat.fragtab[2 * fragnum])] += 2;
+  for (procnum = 0, senddsptab[0] = 0; procnum < (procglbnbr - 1); procnum ++)
+    senddsptab[procnum + 1] = senddsptab[procnum] + sendcnttab[procnum];
+
+  for (fragnum = 0; fragnum < datadat.fragnbr; fragnum ++) { /* Fill send array in process order */
+    Gnum                vertglbnum;
+
+    vertglbnum = datadat.fragtab[2 * fragnum];
+    procnum    = wdgraphPartRbOwner (procvrttab, procglbnbr, vertglbnum);
+    sendtab[senddsptab[procnum] ++] = vertglbnum;
+    sendtab[senddsptab[procnum] ++] = datadat.fragtab[2 * fragnum + 1];
+  }
+  memFree (datadat.fragtab);
+  for (procnum = 0; procnum < procglbnbr; procnum ++) /* Restore send displacements */
+    senddsptab[procnum] -= sendcnttab[procnum];
+
+  if (MPI_Alltoall (sendcnttab, 1, MPI_INT, recvcnttab, 1, MPI_INT, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("wdgraphPartRb: communication error (2)");
+    memFree    (sendcnttab);
+    return     (1);
+  }
+  for (procnum = 0, recvdsptab[0] = 0; procnum < (procglbnbr - 1); procnum ++)
+    recvdsptab[procnum + 1] = recvdsptab[procnum] + recvcnttab[procnum];
+#ifdef SCOTCH_DEBUG_WDGRAPH2
+  if ((recvdsptab[procglbnbr - 1] + recvcnttab[procglbnbr - 1]) != (2 * grafptr->s.vertlocnbr)) {
+    errorPrint ("wdgraphPartRb: internal error");
+    memFree    (sendcnttab);
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_WDGRAPH2 */
+
+  if (MPI_Alltoallv (sendtab, sendcnttab, senddsptab, GNUM_MPI,
+                     recvtab, recvcnttab, recvdsptab, GNUM_MPI, grafptr->s.proccomm) != MPI_SUCCESS) {
+    errorPrint ("wdgraphPartRb: communication error (3)");
+    memFree    (sendcnttab);
+    return     (1);
+  }
+
+  vertlocadj = grafptr->s.baseval - procvrttab[grafptr->s.proclocnum];
+  for (fragnum = 0; fragnum < grafptr->s.vertlocnbr; fragnum ++)
+    grafptr->partgsttax[recvtab[2 * fragnum] + vertlocadj] = (Anum) recvtab[2 * fragnum + 1];
+
+  memFree (sendcnttab);                           /* Free group leader */
+
+  if (dgraphHaloSync (&grafptr->s, grafptr->partgsttax + grafptr->s.baseval, ANUM_MPI) != 0) {
+    errorPrint ("wdgraphPartRb: cannot perform halo exchange");
+    return (1);
+  }
+
+  return (wdgraphCost (grafptr));
+}
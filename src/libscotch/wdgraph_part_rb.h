@@ -0,0 +1,116 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : wdgraph_part_rb.h                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the parallel recursive vertex       **/
+/**                separation overlap partitioning         **/
+/**                method.                                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct WdgraphPartRbParam_ {
+  Strat *                   stratsep;             /*+ Distributed vertex separation strategy   +*/
+  Strat *                   stratseq;             /*+ Sequential overlap partitioning strategy +*/
+} WdgraphPartRbParam;
+
+/*+ This structure holds folded graph data, whether centralized or distributed. +*/
+
+typedef struct WdgraphPartRbGraph_ {
+  Anum                      domnnum;              /*+ First part number of subgraph domain +*/
+  Anum                      domnsiz;              /*+ Number of parts of subgraph domain   +*/
+  int                       procnbr;              /*+ Number of processes holding graph    +*/
+  INT                       levlnum;              /*+ Recursion level                      +*/
+  union {
+    Graph                   cgrfdat;              /*+ Centralized graph +*/
+    Dgraph                  dgrfdat;              /*+ Distributed graph +*/
+  } data;
+} WdgraphPartRbGraph;
+
+/*+ This structure holds the data passed to the subgraph building routine. +*/
+
+typedef struct WdgraphPartRbFold_ {
+  Dgraph *                  orggrafptr;           /*+ Pointer to original graph                     +*/
+  Gnum                      indvertnbr;           /*+ Local number of vertices in subgraph          +*/
+  GraphPart                 indpartval;           /*+ Graph part from which to extract subgraph     +*/
+  const GraphPart *         indparttax;           /*+ Based local vertex part array of graph        +*/
+  WdgraphPartRbGraph *      fldgrafptr;           /*+ Pointer to folded graph union area            +*/
+  int                       fldpartval;           /*+ Part of processor array to which to fold to   +*/
+  int                       fldprocnbr;           /*+ Number of processes in folded communicator    +*/
+  int                       fldprocnum;           /*+ Rank of process in folded communicator, or -1 +*/
+  MPI_Comm                  fldproccomm;          /*+ Communicator for the folded graph, if any     +*/
+  Context *                 contptr;              /*+ Execution context                             +*/
+} WdgraphPartRbFold;
+
+/*+ This structure holds the data shared by all
+    recursion jobs. Vertex parts are recorded as
+    pairs of global vertex numbers in the original
+    graph and of part numbers, to be sent back to
+    the owner processes of the vertices at the end
+    of the recursion.                              +*/
+
+typedef struct WdgraphPartRbData_ {
+  const WdgraphPartRbParam * paraptr;             /*+ Method parameters                +*/
+  Gnum                      fragnbr;              /*+ Number of recorded vertex pairs  +*/
+  Gnum                      fragmax;              /*+ Size of fragment array, in pairs +*/
+  Gnum *                    fragtab;              /*+ Array of (vertex, part) pairs    +*/
+  Context *                 contptr;              /*+ Execution context                +*/
+} WdgraphPartRbData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_WDGRAPH_PART_RB
+static int                  wdgraphPartRbFrag   (WdgraphPartRbData * restrict const, const Gnum);
+static int                  wdgraphPartRbAddDist (WdgraphPartRbData * restrict const, const Dgraph * restrict const, const GraphPart * restrict const, const Anum * restrict const);
+static int                  wdgraphPartRbOwner  (const Gnum * restrict const, const int, const Gnum);
+static int                  wdgraphPartRbSequ   (WdgraphPartRbGraph * restrict const, WdgraphPartRbData * restrict const);
+static int                  wdgraphPartRbFold   (Vdgraph * restrict const, const WdgraphPartRbGraph * restrict const, WdgraphPartRbGraph * restrict const);
+static int                  wdgraphPartRbFold2  (WdgraphPartRbFold * const);
+static int                  wdgraphPartRb2      (WdgraphPartRbGraph * restrict const, WdgraphPartRbData * restrict const);
+#endif /* SCOTCH_WDGRAPH_PART_RB */
+
+int                         wdgraphPartRb       (Wdgraph * const, const WdgraphPartRbParam * const);
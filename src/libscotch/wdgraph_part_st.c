@@ -0,0 +1,226 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : wdgraph_part_st.c                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the strategy and   **/
+/**                method tables for the distributed       **/
+/**                overlap partitioning routines.          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "wgraph.h"
+#include "wgraph_part_st.h"
+#include "dgraph.h"
+#include "vdgraph.h"
+#include "vdgraph_separate_st.h"
+#include "wdgraph.h"
+#include "wdgraph_part_rb.h"
+#include "wdgraph_part_th.h"
+#include "wdgraph_part_st.h"
+
+/*
+**  The static and global variables.
+*/
+
+static Wdgraph              wdgraphdummy;         /* Dummy distributed overlap graph for offset computations */
+
+static union {
+  WdgraphPartRbParam        param;
+  StratNodeMethodData       padding;
+} wdgraphpartstdefaultrb = { { &stratdummy, &stratdummy } };
+
+static union {
+  WdgraphPartThParam        param;
+  StratNodeMethodData       padding;
+} wdgraphpartstdefaultth = { { 5 } };
+
+static StratMethodTab       wdgraphpartstmethtab[] = { /* Distributed overlap partitioning methods array */
+                              { WDGRAPHPARTSTMETHRB, "r",  wdgraphPartRb, &wdgraphpartstdefaultrb },
+                              { WDGRAPHPARTSTMETHTH, "t",  wdgraphPartTh, &wdgraphpartstdefaultth },
+                              { -1,                  NULL, NULL,          NULL } };
+
+static StratParamTab        wdgraphpartstparatab[] = { /* Method parameter list */
+                              { WDGRAPHPARTSTMETHRB,  STRATPARAMSTRAT,  "sep",
+                                (byte *) &wdgraphpartstdefaultrb.param,
+                                (byte *) &wdgraphpartstdefaultrb.param.stratsep,
+                                (void *) &vdgraphseparateststratab },
+                              { WDGRAPHPARTSTMETHRB,  STRATPARAMSTRAT,  "seq",
+                                (byte *) &wdgraphpartstdefaultrb.param,
+                                (byte *) &wdgraphpartstdefaultrb.param.stratseq,
+                                (void *) &wgraphpartststratab },
+                              { WDGRAPHPARTSTMETHTH,  STRATPARAMINT,    "pass",
+                                (byte *) &wdgraphpartstdefaultth.param,
+                                (byte *) &wdgraphpartstdefaultth.param.passnbr,
+                                NULL },
+                              { WDGRAPHPARTSTMETHNBR, STRATPARAMINT,    NULL,
+                                NULL, NULL, NULL } };
+
+static StratParamTab        wdgraphpartstcondtab[] = { /* Distributed overlap graph condition parameter table */
+                              { STRATNODECOND,        STRATPARAMINT,    "edge",
+                                (byte *) &wdgraphdummy,
+                                (byte *) &wdgraphdummy.s.edgeglbnbr,
+                                NULL },
+                              { STRATNODECOND,        STRATPARAMINT,    "levl",
+                                (byte *) &wdgraphdummy,
+                                (byte *) &wdgraphdummy.levlnum,
+                                NULL },
+                              { STRATNODECOND,        STRATPARAMINT,    "load",
+                                (byte *) &wdgraphdummy,
+                                (byte *) &wdgraphdummy.s.veloglbsum,
+                                NULL },
+                              { STRATNODECOND,        STRATPARAMINT,    "part",
+                                (byte *) &wdgraphdummy,
+                                (byte *) &wdgraphdummy.partnbr,
+                                NULL },
+                              { STRATNODECOND,        STRATPARAMINT,    "proc",
+                                (byte *) &wdgraphdummy,
+                                (byte *) &wdgraphdummy.s.procglbnbr,
+                                NULL },
+                              { STRATNODECOND,        STRATPARAMINT,    "rank",
+                                (byte *) &wdgraphdummy,
+                                (byte *) &wdgraphdummy.s.proclocnum,
+                                NULL },
+                              { STRATNODECOND,        STRATPARAMINT,    "vert",
+                                (byte *) &wdgraphdummy,
+                                (byte *) &wdgraphdummy.s.vertglbnbr,
+                                NULL },
+                              { STRATNODENBR,         STRATPARAMINT,    NULL,
+                                NULL, NULL, NULL } };
+
+StratTab                    wdgraphpartststratab = { /* Strategy tables for distributed overlap partitioning methods */
+                              wdgraphpartstmethtab,
+                              wdgraphpartstparatab,
+                              wdgraphpartstcondtab };
+
+/*************************************/
+/*                                   */
+/* This is the generic distributed   */
+/* overlap partitioning routine.     */
+/*                                   */
+/*************************************/
+
+/* This routine computes the overlap partition
+** of the given distributed graph according to
+** the given strategy.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+wdgraphPartSt (
+Wdgraph * restrict const      grafptr,            /*+ Distributed overlap partitioning graph    +*/
+const Strat * restrict const  strat)              /*+ Distributed overlap partitioning strategy +*/
+{
+  StratTest           val;
+  int                 o;
+
+#ifdef SCOTCH_DEBUG_WDGRAPH2
+  if (sizeof (Gnum) != sizeof (INT)) {
+    errorPrint ("wdgraphPartSt: invalid type specification for parser variables");
+    return     (1);
+  }
+  if ((sizeof (WdgraphPartRbParam) > sizeof (StratNodeMethodData)) ||
+      (sizeof (WdgraphPartThParam) > sizeof (StratNodeMethodData))) {
+    errorPrint ("wdgraphPartSt: invalid type specification");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_WDGRAPH2 */
+#ifdef SCOTCH_DEBUG_WDGRAPH1
+  if ((strat->tabl != &wdgraphpartststratab) &&
+      (strat       != &stratdummy)) {
+    errorPrint ("wdgraphPartSt: invalid parameter (1)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_WDGRAPH1 */
+
+  o = 0;
+  switch (strat->type) {
+    case STRATNODECONCAT :
+      o = wdgraphPartSt (grafptr, strat->data.concat.strat[0]); /* Apply first strategy          */
+      if (o == 0)                                 /* If it worked all right                       */
+        o |= wdgraphPartSt (grafptr, strat->data.concat.strat[1]); /* Then apply second strategy */
+      break;
+    case STRATNODECOND :
+      o = stratTestEval (strat->data.cond.test, &val, (void *) grafptr); /* Evaluate expression */
+      if (o == 0) {                               /* If evaluation was correct                  */
+#ifdef SCOTCH_DEBUG_WDGRAPH2
+        if ((val.typetest != STRATTESTVAL) ||
+            (val.typenode != STRATPARAMLOG)) {
+          errorPrint ("wdgraphPartSt: invalid test result");
+          o = 1;
+          break;
+        }
+#endif /* SCOTCH_DEBUG_WDGRAPH2 */
+        if (val.data.val.vallog == 1)             /* If expression is true                            */
+          o = wdgraphPartSt (grafptr, strat->data.cond.strat[0]); /* Apply first strategy             */
+        else {                                    /* Else if expression is false                      */
+          if (strat->data.cond.strat[1] != NULL)  /* And if there is an else statement                */
+            o = wdgraphPartSt (grafptr, strat->data.cond.strat[1]); /* Apply second strategy          */
+        }
+      }
+      break;
+    case STRATNODEEMPTY :
+      break;
+    case STRATNODESELECT :
+      errorPrint ("wdgraphPartSt: selection operator not implemented for distributed overlap strategies");
+      return      (1);
+#ifdef SCOTCH_DEBUG_WDGRAPH1
+    case STRATNODEMETHOD :
+#else  /* SCOTCH_DEBUG_WDGRAPH1 */
+    default :
+#endif /* SCOTCH_DEBUG_WDGRAPH1 */
+      return (strat->tabl->methtab[strat->data.method.meth].func (grafptr, (void *) &strat->data.method.data));
+#ifdef SCOTCH_DEBUG_WDGRAPH1
+    default :
+      errorPrint ("wdgraphPartSt: invalid parameter (2)");
+      return     (1);
+#endif /* SCOTCH_DEBUG_WDGRAPH1 */
+  }
+  return (o);
+}
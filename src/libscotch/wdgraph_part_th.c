@@ -0,0 +1,199 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : wdgraph_part_th.c                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module thins the overlap of a      **/
+/**                distributed overlap partition, by       **/
+/**                moving frontier vertices which are      **/
+/**                only adjacent to one part into it.      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "arch.h"
+#include "dgraph.h"
+#include "wdgraph.h"
+#include "wdgraph_part_th.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the thinning of the
+** overlap. At each pass, every frontier vertex
+** the non-frontier neighbors of which all belong
+** to the same part becomes a candidate for moving
+** into this part. Since two adjacent candidates
+** for different parts cannot both move, the one
+** with the smallest global number wins on even
+** passes, and the one with the largest on odd
+** passes, so that no vertex is always favored.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+wdgraphPartTh (
+Wdgraph * restrict const                  grafptr,
+const WdgraphPartThParam * restrict const paraptr)
+{
+  Anum * restrict     candgsttax;                 /* Candidate part array, -1 if not candidate */
+  Gnum                vertlocnum;
+  Gnum                vertglbadj;
+  Gnum                reduloctab[2];
+  Gnum                reduglbtab[2];
+  INT                 passnum;
+
+  const Gnum * restrict const vertloctax = grafptr->s.vertloctax;
+  const Gnum * restrict const vendloctax = grafptr->s.vendloctax;
+  const Gnum * restrict const veloloctax = grafptr->s.veloloctax;
+  const Gnum * restrict const edgeloctax = grafptr->s.edgeloctax;
+  const Gnum * restrict const edgegsttax = grafptr->s.edgegsttax;
+  Anum * restrict const       partgsttax = grafptr->partgsttax;
+
+  if (grafptr->fronglbnbr == 0)                   /* If no overlap, nothing to do */
+    return (0);
+
+  if ((candgsttax = (Anum *) memAlloc (grafptr->s.vertgstnbr * sizeof (Anum))) == NULL) {
+    errorPrint ("wdgraphPartTh: out of memory");
+    return (1);
+  }
+  candgsttax -= grafptr->s.baseval;
+
+  vertglbadj = grafptr->s.procvrttab[grafptr->s.proclocnum] - grafptr->s.baseval;
+  for (passnum = 0; passnum < paraptr->passnbr; passnum ++) {
+    for (vertlocnum = grafptr->s.baseval; vertlocnum < grafptr->s.vertlocnnd; vertlocnum ++) {
+      Anum                partval;
+      Gnum                edgelocnum;
+
+      candgsttax[vertlocnum] = -1;                /* Assume vertex is not a candidate */
+      if (partgsttax[vertlocnum] >= 0)            /* If vertex not in overlap, skip it */
+        continue;
+
+      for (edgelocnum = vertloctax[vertlocnum], partval = -1;
+           edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+        Anum                partend;
+
+        partend = partgsttax[edgegsttax[edgelocnum]];
+        if (partend < 0)                          /* Overlap neighbors do not constrain move */
+          continue;
+        if ((partval >= 0) && (partval != partend)) { /* If vertex separates two parts, keep it */
+          partval = -1;
+          break;
+        }
+        partval = partend;
+      }
+      candgsttax[vertlocnum] = partval;
+    }
+
+    if (dgraphHaloSync (&grafptr->s, candgsttax + grafptr->s.baseval, ANUM_MPI) != 0) {
+      errorPrint ("wdgraphPartTh: cannot perform halo exchange (1)");
+      memFree    (candgsttax + grafptr->s.baseval);
+      return     (1);
+    }
+
+    reduloctab[0] =
+    reduloctab[1] = 0;
+    for (vertlocnum = grafptr->s.baseval; vertlocnum < grafptr->s.vertlocnnd; vertlocnum ++) {
+      Anum                partval;
+      Gnum                vertglbnum;
+      Gnum                edgelocnum;
+
+      partval = candgsttax[vertlocnum];
+      if (partval < 0)                            /* If vertex is not a candidate */
+        continue;
+
+      vertglbnum = vertlocnum + vertglbadj;
+      for (edgelocnum = vertloctax[vertlocnum]; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+        Anum                partend;
+        Gnum                vertglbend;
+
+        partend = candgsttax[edgegsttax[edgelocnum]];
+        if ((partend < 0) || (partend == partval)) /* If neighbor does not compete for another part */
+          continue;
+
+        vertglbend = edgeloctax[edgelocnum];
+        if ((vertglbend < vertglbnum) ^ (passnum & 1)) /* If neighbor wins, vertex stays in overlap */
+          break;
+      }
+      if (edgelocnum < vendloctax[vertlocnum])
+        continue;
+
+      partgsttax[vertlocnum] = partval;           /* Move vertex; candidate array is not changed */
+      reduloctab[0] ++;
+      reduloctab[1] += (veloloctax != NULL) ? veloloctax[vertlocnum] : 1;
+    }
+
+    if (MPI_Allreduce (reduloctab, reduglbtab, 2, GNUM_MPI, MPI_SUM, grafptr->s.proccomm) != MPI_SUCCESS) {
+      errorPrint ("wdgraphPartTh: communication error");
+      memFree    (candgsttax + grafptr->s.baseval);
+      return     (1);
+    }
+    grafptr->fronlocnbr  -= reduloctab[0];
+    grafptr->fronglbnbr  -= reduglbtab[0];
+    grafptr->fronglbload -= reduglbtab[1];
+    if (reduglbtab[0] == 0)                       /* If no vertex moved, partition is stable */
+      break;
+
+    if (dgraphHaloSync (&grafptr->s, partgsttax + grafptr->s.baseval, ANUM_MPI) != 0) {
+      errorPrint ("wdgraphPartTh: cannot perform halo exchange (2)");
+      memFree    (candgsttax + grafptr->s.baseval);
+      return     (1);
+    }
+  }
+
+  memFree (candgsttax + grafptr->s.baseval);
+
+#ifdef SCOTCH_DEBUG_WDGRAPH2
+  if (wdgraphCheck (grafptr) != 0) {
+    errorPrint ("wdgraphPartTh: inconsistent graph data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_WDGRAPH2 */
+
+  return (0);
+}
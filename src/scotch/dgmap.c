@@ -1,4 +1,4 @@
-/* Copyright 2008-2012,2014,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008-2012,2014,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 17 apr 2019     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,8 +83,10 @@ static const char *         C_usageList[] = {     /* Usage */
   "dgpart [<nparts/pwght>] [<input source file> [<output mapping file> [<output log file>]]] <options>",
   "  -b<val>    : Load imbalance tolerance (default: 0.05)",
   "  -C<opt>    : Choose execution context options according to one or several of <opt>:",
+  "                 c  : compress graph data exchanged between processes",
   "                 d  : deterministic behavior (even across multiple threads; implies 'f')",
   "                 f  : fixed random seed",
+  "                 n  : do not compress graph data exchanged between processes",
   "                 r  : variable random seed",
   "                 u  : undeterministic behavior (may be faster with several threads)",
   "                 Default behavior depends on compilation flags",
@@ -391,10 +393,12 @@ char *                      argv[])
   if (((straval != 0) || ((flagval & C_FLAGKBALVAL) != 0)) && (straptr != NULL))
     errorPrint ("main: options '-b' / '-c' and '-m' are exclusive");
 
-  if ((flagval & C_FLAGCLUSTER) != 0)             /* If clustering wanted */
-    SCOTCH_stratDgraphClusterBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, (SCOTCH_Num) C_partNbr, 1.0, kbalval);
-  else
-    SCOTCH_stratDgraphMapBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, (SCOTCH_Num) C_partNbr, kbalval);
+  if (straptr == NULL) {                          /* If no user-provided strategy, build default one */
+    if ((flagval & C_FLAGCLUSTER) != 0)           /* If clustering wanted                            */
+      SCOTCH_stratDgraphClusterBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, (SCOTCH_Num) C_partNbr, 1.0, kbalval);
+    else
+      SCOTCH_stratDgraphMapBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, (SCOTCH_Num) C_partNbr, kbalval);
+  }
 
   SCOTCH_contextBindDgraph (&contdat, &grafdat, &cogrdat);
 
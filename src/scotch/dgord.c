@@ -1,4 +1,4 @@
-/* Copyright 2007-2012,2014,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2012,2014,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 17 apr 2019     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -80,8 +80,10 @@ static const char *         C_usageList[] = {
   "dgord [<input source file> [<output ordering file> [<output log file>]]] <options>",
   "  -b         : Output block ordering data instead of plain ordering data",
   "  -C<opt>    : Choose execution context options according to one or several of <opt>:",
+  "                 c  : compress graph data exchanged between processes",
   "                 d  : deterministic behavior (even across multiple threads; implies 'f')",
   "                 f  : fixed random seed",
+  "                 n  : do not compress graph data exchanged between processes",
   "                 r  : variable random seed",
   "                 u  : undeterministic behavior (may be faster with several threads)",
   "                 Default behavior depends on compilation flags",
@@ -341,26 +343,14 @@ char *              argv[])
 
   clockStart (&runtime[0]);
 
-  if (proclocnum == protglbnum) {
-    if ((flagval & C_FLAGBLOCK) == 0)
-      SCOTCH_dgraphOrderSave (&grafdat, &ordedat, C_filepntrordout);
-    else
-      SCOTCH_dgraphOrderSaveBlock (&grafdat, &ordedat, C_filepntrordout);
-    if ((flagval & C_FLAGMAPOUT) != 0)            /* If mapping wanted                   */
-      SCOTCH_dgraphOrderSaveMap (&grafdat, &ordedat, C_filepntrmapout); /* Write mapping */
-    if ((flagval & C_FLAGTREOUT) != 0)            /* If separator tree wanted            */
-      SCOTCH_dgraphOrderSaveTree (&grafdat, &ordedat, C_filepntrtreout); /* Write tree   */
-  }
-  else {
-    if ((flagval & C_FLAGBLOCK) == 0)
-      SCOTCH_dgraphOrderSave (&grafdat, &ordedat, NULL);
-    else
-      SCOTCH_dgraphOrderSaveBlock (&grafdat, &ordedat, NULL);
-    if ((flagval & C_FLAGMAPOUT) != 0)
-      SCOTCH_dgraphOrderSaveMap (&grafdat, &ordedat, NULL);
-    if ((flagval & C_FLAGTREOUT) != 0)
-      SCOTCH_dgraphOrderSaveTree (&grafdat, &ordedat, NULL);
-  }
+  if ((flagval & C_FLAGBLOCK) == 0)               /* Streams of non-root processes are NULL for centralized files */
+    SCOTCH_dgraphOrderSave (&grafdat, &ordedat, C_filepntrordout);
+  else
+    SCOTCH_dgraphOrderSaveBlock (&grafdat, &ordedat, C_filepntrordout);
+  if ((flagval & C_FLAGMAPOUT) != 0)              /* If mapping wanted                   */
+    SCOTCH_dgraphOrderSaveMap (&grafdat, &ordedat, C_filepntrmapout); /* Write mapping */
+  if ((flagval & C_FLAGTREOUT) != 0)              /* If separator tree wanted            */
+    SCOTCH_dgraphOrderSaveTree (&grafdat, &ordedat, C_filepntrtreout); /* Write tree   */
 
   clockStop (&runtime[0]);
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -68,7 +68,7 @@
 /**                # Version 6.0  : from : 29 may 2010     **/
 /**                                 to   : 26 aug 2020     **/
 /**                # Version 7.0  : from : 10 oct 2021     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -127,6 +127,9 @@ static const char *         C_usageList[] = {     /* Usage */
   "  -s<obj>    : Force unity weights on <obj>:",
   "                 e  : edges",
   "                 v  : vertices",
+  "  -t<opt>    : Partition the graph in one pass while streaming it, without loading it (only for gpart):",
+  "                 f  : use the Fennel objective function (default)",
+  "                 l  : use linear deterministic greedy assignment",
   "  -V         : Print program version and copyright",
   "  -v<verb>   : Set verbose mode to <verb>:",
   "                 m  : mapping information",
@@ -155,6 +158,7 @@ char *                      argv[])
   SCOTCH_Strat          stradat;                  /* Mapping strategy               */
   char *                straptr;                  /* Strategy string to use         */
   SCOTCH_Num            straval;
+  SCOTCH_Num            strmval;                  /* Streaming scoring method       */
   SCOTCH_Mapping        mappdat;                  /* Mapping data                   */
   SCOTCH_Mapping        mapodat;                  /* Old mapping data               */
   SCOTCH_Num * restrict parttab;                  /* Partition array                */
@@ -171,6 +175,7 @@ char *                      argv[])
   emraval = 1;                                    /* Default edge migration ratio   */
   straval = 0;                                    /* No strategy flags              */
   straptr = NULL;
+  strmval = SCOTCH_STREAMFENNEL;
 
   vmlotab = NULL;
 
@@ -323,6 +328,26 @@ char *                      argv[])
             }
           }
           break;
+        case 'T' :
+        case 't' :                                /* Streaming partitioning */
+          if ((flagval & C_FLAGPART) == 0)
+            errorPrint ("main: option '-t' only valid for graph partitioning");
+          flagval |= C_FLAGSTREAM;
+          for (j = 2; argv[i][j] != '\0'; j ++) {
+            switch (argv[i][j]) {
+              case 'F' :
+              case 'f' :
+                strmval = SCOTCH_STREAMFENNEL;
+                break;
+              case 'L' :
+              case 'l' :
+                strmval = SCOTCH_STREAMLDG;
+                break;
+              default :
+                errorPrint ("main: unprocessed parameter '%c' in '%s'", argv[i][j], argv[i]);
+            }
+          }
+          break;
         case 'V' :
           fprintf (stderr, "gmap/gpart, version " SCOTCH_VERSION_STRING "\n");
           fprintf (stderr, SCOTCH_COPYRIGHT_STRING "\n");
@@ -360,11 +385,35 @@ char *                      argv[])
     fileBlockName (C_fileTab, 1) = "-";
   }
 
+  if (((flagval & C_FLAGSTREAM) != 0) &&
+      ((flagval & (C_FLAGPARTOVL | C_FLAGCLUSTER | C_FLAGFIXED | C_FLAGRMAPOLD)) != 0))
+    errorPrint ("main: option '-t' is exclusive of options '-f', '-o', '-q' and '-r'");
+  if (((flagval & C_FLAGSTREAM) != 0) && ((straval != 0) || (straptr != NULL)))
+    errorPrint ("main: option '-t' is exclusive of options '-c' and '-m'");
+
   fileBlockOpen (C_fileTab, C_FILENBR);           /* Open all files */
 
   clockInit  (&runtime[0]);
   clockStart (&runtime[0]);
 
+  if ((flagval & C_FLAGSTREAM) != 0) {            /* If graph to be partitioned while streamed */
+    if (SCOTCH_graphPartStream (C_filepntrsrcinp, C_filepntrmapout, (SCOTCH_Num) C_partNbr, kbalval, strmval) != 0)
+      errorPrint ("main: cannot compute streaming partition");
+
+    clockStop (&runtime[0]);
+
+    if (flagval & C_FLAGVERBTIM)
+      fprintf (C_filepntrlogout, "T\tTotal\t\t%g\n",
+               (double) clockVal (&runtime[0]));
+
+    fileBlockClose (C_fileTab, C_FILENBR);
+
+    SCOTCH_stratExit   (&stradat);
+    SCOTCH_contextExit (&contdat);
+
+    return (EXIT_SUCCESS);
+  }
+
   SCOTCH_graphInit (&grafdat);                    /* Create graph structure         */
   SCOTCH_graphLoad (&grafdat, C_filepntrsrcinp, -1, grafflag); /* Read source graph */
 
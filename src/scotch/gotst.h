@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2014,2020 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2014,2020,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,6 +47,8 @@
 /**                                 to   : 12 nov 2014     **/
 /**                # Version 6.1  : from : 01 jun 2020     **/
 /**                                 to   : 14 jun 2020     **/
+/**                # Version 7.0  : from : 19 oct 2026     **/
+/**                                 to   : 19 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -87,8 +89,6 @@ typedef struct C_FactorNode_ {
 /* Data structure for computing factored matrix statistics. */
 
 typedef struct FactorStat_ {
-  const SCOTCH_Num *      velotax;                /*+ Array of vertex weights (or NULL)                                             +*/
-  const SCOTCH_Num *      peritax;                /*+ Inverse permutation array                                                     +*/
   const SCOTCH_Num *      ldadtax;                /*+ Array of permuted indices of parent column                                    +*/
   const SCOTCH_Num *      lsontax;                /*+ Array of permuted indices of first child column                               +*/
   const SCOTCH_Num *      lbrotax;                /*+ Array of permuted indices of sibling column                                   +*/
@@ -97,15 +97,12 @@ typedef struct FactorStat_ {
   SCOTCH_Num              heignbr;
   double                  heigavg;
   double                  heigdlt;
-  const SCOTCH_Num *      fnnztax;                /*+ Array of number of factored rows, then sum of vertex weights of factored rows +*/
-  double                  fnnzsum;
 } FactorStat;
 
 /*
 **  The function prototypes.
 */
 
-static int                  factorView          (const SCOTCH_Num, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, FILE * restrict const);
-static int                  factorView2         (const SCOTCH_Num, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, SCOTCH_Num * restrict, SCOTCH_Num * restrict, SCOTCH_Num * restrict, SCOTCH_Num * restrict);
+static int                  factorView          (const SCOTCH_Graph * const, const SCOTCH_Ordering * const, const SCOTCH_Num, const SCOTCH_Num, FILE * restrict const);
 static void                 factorView3         (FactorStat * restrict const, SCOTCH_Num, SCOTCH_Num, double * restrict const);
-static void                 factorView4         (FactorStat * restrict const, SCOTCH_Num, SCOTCH_Num, double * restrict const);
+static void                 factorView4         (FactorStat * restrict const, SCOTCH_Num, SCOTCH_Num);